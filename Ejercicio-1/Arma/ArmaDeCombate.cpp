@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <stdexcept>
 #include <cstdlib>
+#include <typeinfo>
 
 // ==========================================
 // IMPLEMENTACION DE METODOS CLASE ARMADECOMBATE
@@ -30,7 +31,7 @@ ArmaDeCombate::ArmaDeCombate(string n, int df, int dm, double p, Rarity r, int n
 
 // Implementación de getters y setters (ya documentados en el .hpp)
 void ArmaDeCombate::setNombre(const string& nombreArg) { nombre = nombreArg; }
-string ArmaDeCombate::getNombre() const { return nombre; }
+const string& ArmaDeCombate::getNombre() const { return nombre; }
 int ArmaDeCombate::getPoder() const { return danioFisico; }
 int ArmaDeCombate::getDurabilidadActual() const { return durabilidadActual; }
 int ArmaDeCombate::getDurabilidadMaxima() const { return durabilidadMaxima; }
@@ -38,6 +39,25 @@ Rarity ArmaDeCombate::getRareza() const { return rareza; }
 double ArmaDeCombate::getPeso() const { return peso; }
 int ArmaDeCombate::getNivelFilo() const { return nivelFilo; }
 
+/**
+ * @brief Implementación del método setAtributosBase
+ * 
+ * @param r Rareza del arma
+ * @param df Daño físico base
+ * @param p Peso del arma
+ * @param dm Durabilidad máxima
+ * @param da Durabilidad actual
+ * @param nf Nivel de filo
+ */
+void ArmaDeCombate::setAtributosBase(Rarity r, int df, double p, int dm, int da, int nf) {
+    rareza = r;
+    danioFisico = df;
+    peso = p;
+    durabilidadMaxima = dm;
+    durabilidadActual = da;
+    nivelFilo = nf;
+}
+
 /**
  * @brief Implementación del método reparar
  * 
@@ -131,6 +151,29 @@ int ArmaDeCombate::usar() {
     }
 }
 
+/**
+ * @brief Implementación del método estimarUso
+ *
+ * El desgaste del filo ocurre después del golpe, así que el próximo uso
+ * tiene un único resultado posible.
+ *
+ * @return Distribución del valor que devolvería usar()
+ */
+DistribucionDanio ArmaDeCombate::estimarUso() const {
+    if (durabilidadActual <= 0) {
+        return DistribucionDanio{1, {0}, {1.0}};
+    }
+    return DistribucionDanio{1, {danioFisico + calcularBonoPorFilo()}, {1.0}};
+}
+
+/**
+ * @brief Implementación del método estimarUsosRestantes
+ * @return Durabilidad actual (cada golpe gasta un punto)
+ */
+int ArmaDeCombate::estimarUsosRestantes() const {
+    return max(0, durabilidadActual);
+}
+
 /**
  * @brief Implementación del método reducirDurabilidad
  * 
@@ -180,4 +223,36 @@ void ArmaDeCombate::reducirDurabilidad(int cantidad) {
  */
 int ArmaDeCombate::calcularBonoPorFilo() const {
     return min(10, nivelFilo / 10);
-}
\ No newline at end of file
+}
+
+// ==========================================
+// CHECKPOINT DE ESTADO
+// ==========================================
+
+/**
+ * @brief Implementación del método guardarCheckpoint
+ * 
+ * @return Checkpoint con la durabilidad y el filo actuales
+ */
+CheckpointArma ArmaDeCombate::guardarCheckpoint() const {
+    CheckpointArma checkpoint{};
+    checkpoint.tipoDinamico = typeid(*this).hash_code();
+    checkpoint.durabilidadActual = durabilidadActual;
+    checkpoint.nivelFilo = nivelFilo;
+    return checkpoint;
+}
+
+/**
+ * @brief Implementación del método restaurarCheckpoint
+ * 
+ * @param checkpoint Checkpoint a restaurar
+ * @return true si se restauró, false si el checkpoint es de otro tipo de arma
+ */
+bool ArmaDeCombate::restaurarCheckpoint(const CheckpointArma& checkpoint) {
+    if (checkpoint.tipoDinamico != typeid(*this).hash_code()) {
+        return false;
+    }
+    durabilidadActual = checkpoint.durabilidadActual;
+    nivelFilo = checkpoint.nivelFilo;
+    return true;
+}
@@ -46,14 +46,18 @@ public:
     // ==========================================
 
     void setNombre(const string& nombreArg) override;
-    string getNombre() const override;
+    const string& getNombre() const override;
     int getPoder() const override; 
     int getDurabilidadActual() const override;
     int getDurabilidadMaxima() const override;
     Rarity getRareza() const override;
     void reparar(int cantidad) override;
     int usar() override;
+    DistribucionDanio estimarUso() const override;
+    int estimarUsosRestantes() const override;
     void mostrarInfo() const override;
+    CheckpointArma guardarCheckpoint() const override;
+    bool restaurarCheckpoint(const CheckpointArma& checkpoint) override;
     
     // ==========================================
     // METODOS PROPIOS DE LA CLASE ABSTRACTA
@@ -70,6 +74,21 @@ public:
      * @return El nivel de filo correspondiente a un arma
      */
     int getNivelFilo() const;
+
+    /**
+     * @brief Reemplaza los atributos base sin validarlos ni mostrar mensajes
+     * 
+     * La fábrica lo usa para ajustar un clon del prototipo sin volver a pasar
+     * por el constructor.
+     * 
+     * @param r Rareza del arma
+     * @param df Daño físico base
+     * @param p Peso del arma
+     * @param dm Durabilidad máxima
+     * @param da Durabilidad actual
+     * @param nf Nivel de filo
+     */
+    void setAtributosBase(Rarity r, int df, double p, int dm, int da, int nf);
     
     /**
      * @brief Afila un arma una cantidad finita (puede no ser positiva) y devuelve true si se afilo correctamente
@@ -120,3 +120,11 @@ void Espada::pulirHoja() {
         cout << "La hoja ya está perfectamente afilada." << endl;
     }
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> Espada::clonar() const {
+    return make_unique<Espada>(*this);
+}
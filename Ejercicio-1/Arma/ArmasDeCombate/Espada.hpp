@@ -46,6 +46,7 @@ public:
            
     int usar() override;
     void mostrarInfo() const override;
+    unique_ptr<InterfazArmas> clonar() const override;
 
     // ==========================================
     // METODOS PROPIOS DE LA CLASE ESPADA
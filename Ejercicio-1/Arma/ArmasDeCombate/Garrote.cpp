@@ -39,6 +39,54 @@ int Garrote::usar() {
     return danoBase;
 }
 
+/**
+ * @brief Implementación del método estimarUso para Garrote
+ *
+ * El garrote suma el bono de filo dos veces, la segunda con el filo que
+ * queda después del golpe base: por eso el resultado depende de si el filo
+ * se desgasta (y cuánto) en ese golpe.
+ *
+ * @return Distribución del valor que devolvería usar()
+ */
+DistribucionDanio Garrote::estimarUso() const {
+    // El golpe base deja la durabilidad en 0 si quedaba 1 y el garrote devuelve 0
+    if (durabilidadActual <= 1) {
+        return DistribucionDanio{1, {0}, {1.0}};
+    }
+    int base = danioFisico + calcularBonoPorFilo() + (tieneClavos ? 5 : 0) + bonusAturdimiento;
+    DistribucionDanio distribucion{1, {base + min(10, nivelFilo / 10)}, {1.0}};
+    if (nivelFilo <= 0) {
+        return distribucion;
+    }
+
+    // Desgastes de 1 a 3 puntos; los que no cambian el bono se suman al resultado sin desgaste
+    double probabilidadDesgaste = 1.0 / (10 + nivelFilo / 10);
+    distribucion.probabilidades[0] = 1.0 - probabilidadDesgaste;
+    for (int desgaste = 1; desgaste <= 3; ++desgaste) {
+        int valor = base + min(10, max(0, nivelFilo - desgaste) / 10);
+        int i = 0;
+        while (i < distribucion.cantidad && distribucion.valores[i] != valor) ++i;
+        if (i == distribucion.cantidad) {
+            distribucion.valores[i] = valor;
+            distribucion.probabilidades[i] = 0.0;
+            ++distribucion.cantidad;
+        }
+        distribucion.probabilidades[i] += probabilidadDesgaste / 3;
+    }
+    if (distribucion.cantidad == 1) {
+        distribucion.probabilidades[0] = 1.0;
+    }
+    return distribucion;
+}
+
+/**
+ * @brief Implementación del método estimarUsosRestantes para Garrote
+ * @return Golpes que quedan: cada uno gasta dos puntos de durabilidad
+ */
+int Garrote::estimarUsosRestantes() const {
+    return max(0, durabilidadActual) / 2;
+}
+
 /**
  * @brief Implementación del método mostrarInfo para Garrote
  * 
@@ -145,3 +193,11 @@ void Garrote::reforzarMadera() {
     reparar(aumentoDur / 2);
     cout << "Durabilidad máxima aumentada a " << durabilidadMaxima << "." << endl;
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> Garrote::clonar() const {
+    return make_unique<Garrote>(*this);
+}
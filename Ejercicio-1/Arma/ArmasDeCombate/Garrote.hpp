@@ -45,7 +45,10 @@ public:
     // ==========================================
     
     int usar() override;
+    DistribucionDanio estimarUso() const override;
+    int estimarUsosRestantes() const override;
     void mostrarInfo() const override;
+    unique_ptr<InterfazArmas> clonar() const override;
 
     // ==========================================
     // MÉTODOS PROPIOS DE LA CLASE GARROTE
@@ -107,3 +107,11 @@ int HachaDoble::ataqueTorbellino() {
  */
 bool HachaDoble::esADosManos() const { return requiereDosManos; }
 double HachaDoble::getBalance() const { return balance; }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> HachaDoble::clonar() const {
+    return make_unique<HachaDoble>(*this);
+}
@@ -45,6 +45,7 @@ public:
     
     int usar() override;
     void mostrarInfo() const override;
+    unique_ptr<InterfazArmas> clonar() const override;
 
     // ==========================================
     // MÉTODOS PROPIOS DE LA CLASE HACHADOBLE
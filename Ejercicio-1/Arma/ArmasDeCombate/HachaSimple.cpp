@@ -97,3 +97,11 @@ int HachaSimple::lanzar() {
 double HachaSimple::getLongitudMango() const { return longitudMango; }
 bool HachaSimple::puedeArrojarse() const { return esArrojadiza; }
 string HachaSimple::getMarcaHerrero() const { return marcaHerrero; }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> HachaSimple::clonar() const {
+    return make_unique<HachaSimple>(*this);
+}
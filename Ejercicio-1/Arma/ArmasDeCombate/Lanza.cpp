@@ -35,6 +35,25 @@ int Lanza::usar() {
     return danoBase;
 }
 
+/**
+ * @brief Implementación del método estimarUso para Lanza
+ *
+ * Contempla la preparación contra carga, que duplica el golpe y suma el
+ * alcance completo.
+ *
+ * @return Distribución del valor que devolvería usar()
+ */
+DistribucionDanio Lanza::estimarUso() const {
+    if (preparadaContraCarga) {
+        return DistribucionDanio{1, {(danioFisico + calcularBonoPorFilo()) * 2 + alcance * 2}, {1.0}};
+    }
+    DistribucionDanio distribucion = ArmaDeCombate::estimarUso();
+    if (distribucion.valores[0] > 0) {
+        distribucion.valores[0] += alcance / 2;
+    }
+    return distribucion;
+}
+
 /**
  * @brief Implementación del método mostrarInfo para Lanza
  * 
@@ -106,6 +125,15 @@ int Lanza::getAlcance() const {
     return alcance; 
 }
 
+/**
+ * @brief Implementación del método getLongitudAsta
+ * 
+ * @return Longitud del asta en metros
+ */
+double Lanza::getLongitudAsta() const {
+    return longitudAsta;
+}
+
 /**
  * @brief Implementación del método ponerQuitarBandera
  * 
@@ -147,3 +175,39 @@ void Lanza::desmontarPunta() {
     cout << "Desmontas la punta de " << nombre << ". Ahora tienes el asta y la punta por separado." << endl;
     // En una implementación completa, esto podría generar dos objetos nuevos
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> Lanza::clonar() const {
+    return make_unique<Lanza>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarCheckpoint
+ * 
+ * Agrega al checkpoint del arma de combate si la lanza está preparada
+ * contra carga, porque eso cambia el daño del próximo golpe.
+ * 
+ * @return Checkpoint con durabilidad, filo y preparación
+ */
+CheckpointArma Lanza::guardarCheckpoint() const {
+    CheckpointArma checkpoint = ArmaDeCombate::guardarCheckpoint();
+    checkpoint.preparadaContraCarga = preparadaContraCarga;
+    return checkpoint;
+}
+
+/**
+ * @brief Implementación del método restaurarCheckpoint
+ * 
+ * @param checkpoint Checkpoint a restaurar
+ * @return true si se restauró, false si el checkpoint no corresponde a una lanza
+ */
+bool Lanza::restaurarCheckpoint(const CheckpointArma& checkpoint) {
+    if (!ArmaDeCombate::restaurarCheckpoint(checkpoint)) {
+        return false;
+    }
+    preparadaContraCarga = checkpoint.preparadaContraCarga;
+    return true;
+}
@@ -46,7 +46,11 @@ public:
     // ==========================================
     
     int usar() override;
+    DistribucionDanio estimarUso() const override;
     void mostrarInfo() const override;
+    unique_ptr<InterfazArmas> clonar() const override;
+    CheckpointArma guardarCheckpoint() const override;
+    bool restaurarCheckpoint(const CheckpointArma& checkpoint) override;
 
     // ==========================================
     // MÉTODOS PROPIOS DE LA CLASE LANZA
@@ -70,6 +74,12 @@ public:
      */
     int getAlcance() const;
     
+    /**
+     * @brief Obtiene la longitud del asta de la lanza
+     * @return Longitud del asta en metros
+     */
+    double getLongitudAsta() const;
+    
     /**
      * @brief Coloca o quita una bandera en la lanza
      * @param poner true para colocar bandera, false para quitarla
@@ -1,10 +1,48 @@
 #pragma once
 
 #include <string>
+#include <memory>
+#include <cstddef>
 #include "enumArmas.hpp"
 
 using namespace std;
 
+/**
+ * @brief Estado mutable de un arma, guardado como POD para restaurarlo sin reconstruirla
+ *
+ * Solo contiene lo que cambia al usar el arma. Los campos que no aplican al
+ * tipo concreto quedan en 0. La lista de hechizos de un libro se guarda como
+ * su longitud: al restaurar se descartan los agregados posteriores.
+ */
+struct CheckpointArma {
+    size_t tipoDinamico;        ///< hash_code del tipo concreto, para rechazar checkpoints ajenos
+    int durabilidadActual;
+    int nivelFilo;              ///< Solo armas de combate
+    int energiaArcanaActual;    ///< Solo objetos mágicos
+    int dosisRestantes;         ///< Solo pociones
+    int potenciaEfecto;         ///< Solo pociones
+    int efectoPocion;           ///< Solo pociones (valor de EfectoPocion)
+    int cantidadHechizos;       ///< Solo libros de hechizos
+    bool estaSintonizado;       ///< Solo amuletos
+    bool preparadaContraCarga;  ///< Solo lanzas
+};
+
+/// Cantidad máxima de resultados distintos que puede tener un uso de arma
+static const int MAX_RESULTADOS_USO = 4;
+
+/**
+ * @brief Distribución discreta del valor que devuelve un uso del arma
+ *
+ * Casi todas las armas tienen un único resultado posible; las que dependen
+ * del azar (por ejemplo, el desgaste del filo entre dos golpes de un
+ * garrote) listan cada valor con su probabilidad.
+ */
+struct DistribucionDanio {
+    int cantidad;                                   ///< Resultados cargados (1 a MAX_RESULTADOS_USO)
+    int valores[MAX_RESULTADOS_USO];
+    double probabilidades[MAX_RESULTADOS_USO];
+};
+
 /**
  * @brief Interfaz base para todos los tipos de armas
  * 
@@ -27,9 +65,9 @@ public:
 
     /**
      * @brief Obtiene el nombre del arma u objeto
-     * @return String con el nombre del arma
+     * @return Referencia al nombre, válida mientras exista el arma
      */
-    virtual string getNombre() const = 0;
+    virtual const string& getNombre() const = 0;
 
     /**
      * @brief Obtiene el poder base del arma u objeto
@@ -72,6 +110,37 @@ public:
      */
     virtual void reparar(int cantidad) = 0;
     
+    /**
+     * @brief Crea una copia independiente del arma u objeto (patrón Prototype)
+     * @return Puntero único a la copia con el mismo tipo dinámico
+     */
+    virtual unique_ptr<InterfazArmas> clonar() const = 0;
+    
+    /**
+     * @brief Guarda el estado mutable del arma
+     * @return Checkpoint con durabilidad, filo, energía, dosis, efecto de poción y demás contadores
+     */
+    virtual CheckpointArma guardarCheckpoint() const = 0;
+    
+    /**
+     * @brief Restaura el estado mutable guardado con guardarCheckpoint
+     * @param checkpoint Checkpoint a restaurar
+     * @return true si se restauró, false si el checkpoint es de otro tipo de arma
+     */
+    virtual bool restaurarCheckpoint(const CheckpointArma& checkpoint) = 0;
+
+    /**
+     * @brief Calcula lo que devolvería usar() en el próximo uso, sin usar el arma
+     * @return Distribución del valor devuelto por usar()
+     */
+    virtual DistribucionDanio estimarUso() const = 0;
+
+    /**
+     * @brief Calcula cuántos usos le quedan al arma antes de romperse o quedarse sin energía
+     * @return Cantidad esperada de usos que todavía devuelven el resultado de estimarUso()
+     */
+    virtual int estimarUsosRestantes() const = 0;
+    
     /**
      * @brief Destructor virtual para permitir la correcta liberación de recursos
      */
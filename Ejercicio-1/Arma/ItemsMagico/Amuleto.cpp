@@ -56,6 +56,37 @@ int Amuleto::usar() {
     return valorBonus * 2;
 }
 
+/**
+ * @brief Implementación del método estimarUso para Amuleto
+ *
+ * @return Distribución del valor que devolvería usar() (0 sin sintonizar, roto o sin energía)
+ */
+DistribucionDanio Amuleto::estimarUso() const {
+    if ((requiereSintonizacion && !estaSintonizado) || durabilidadActual <= 0 ||
+        (energiaArcanaMaxima > 0 && energiaArcanaActual < calcularCostoEnergia())) {
+        return DistribucionDanio{1, {0}, {1.0}};
+    }
+    return DistribucionDanio{1, {valorBonus * 2}, {1.0}};
+}
+
+/**
+ * @brief Implementación del método estimarUsosRestantes para Amuleto
+ *
+ * El amuleto pierde durabilidad en uno de cada cinco usos en promedio.
+ *
+ * @return Usos esperados, limitados por la energía (0 si no está sintonizado)
+ */
+int Amuleto::estimarUsosRestantes() const {
+    if (requiereSintonizacion && !estaSintonizado) {
+        return 0;
+    }
+    int usos = max(0, durabilidadActual) * 5;
+    if (energiaArcanaMaxima > 0) {
+        usos = min(usos, max(0, energiaArcanaActual) / calcularCostoEnergia());
+    }
+    return usos;
+}
+
 /**
  * @brief Implementación del método mostrarInfo para Amuleto
  * 
@@ -130,3 +161,38 @@ bool Amuleto::desintonizar() {
         return false;
     }
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> Amuleto::clonar() const {
+    return make_unique<Amuleto>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarCheckpoint
+ * 
+ * Agrega el estado de sintonización al checkpoint del objeto mágico.
+ * 
+ * @return Checkpoint con durabilidad, energía y sintonización
+ */
+CheckpointArma Amuleto::guardarCheckpoint() const {
+    CheckpointArma checkpoint = ObjetoMagico::guardarCheckpoint();
+    checkpoint.estaSintonizado = estaSintonizado;
+    return checkpoint;
+}
+
+/**
+ * @brief Implementación del método restaurarCheckpoint
+ * 
+ * @param checkpoint Checkpoint a restaurar
+ * @return true si se restauró, false si el checkpoint no corresponde a el amuleto
+ */
+bool Amuleto::restaurarCheckpoint(const CheckpointArma& checkpoint) {
+    if (!ObjetoMagico::restaurarCheckpoint(checkpoint)) {
+        return false;
+    }
+    estaSintonizado = checkpoint.estaSintonizado;
+    return true;
+}
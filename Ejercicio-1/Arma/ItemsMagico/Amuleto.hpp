@@ -43,7 +43,12 @@ public:
     // ==========================================
     
     int usar() override;
+    DistribucionDanio estimarUso() const override;
+    int estimarUsosRestantes() const override;
     void mostrarInfo() const override;
+    unique_ptr<InterfazArmas> clonar() const override;
+    CheckpointArma guardarCheckpoint() const override;
+    bool restaurarCheckpoint(const CheckpointArma& checkpoint) override;
 
     // ==========================================
     // MÉTODOS PROPIOS DE LA CLASE AMULETO
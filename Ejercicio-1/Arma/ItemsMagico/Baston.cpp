@@ -49,6 +49,19 @@ int Baston::usar() {
     }
 }
 
+/**
+ * @brief Implementación del método estimarUso para Baston
+ *
+ * @return Distribución del valor que devolvería usar() (0 si está roto o sin energía)
+ */
+DistribucionDanio Baston::estimarUso() const {
+    if (durabilidadActual <= 0 ||
+        (energiaArcanaMaxima > 0 && energiaArcanaActual < calcularCostoEnergia())) {
+        return DistribucionDanio{1, {0}, {1.0}};
+    }
+    return DistribucionDanio{1, {poderMagico / 2 + nivelEncantamiento}, {1.0}};
+}
+
 /**
  * @brief Implementación del método mostrarInfo para Baston
  * 
@@ -181,4 +194,12 @@ void Baston::cambiarGema(TipoGema nuevaGema) {
  */
 ElementoMagico Baston::getElementoBaston() {
     return this->elementoPreferido;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> Baston::clonar() const {
+    return make_unique<Baston>(*this);
+}
@@ -42,7 +42,9 @@ public:
     // ==========================================
     
     int usar() override;
+    DistribucionDanio estimarUso() const override;
     void mostrarInfo() const override;
+    unique_ptr<InterfazArmas> clonar() const override;
 
     // ==========================================
     // MÉTODOS PROPIOS DE LA CLASE BASTON
@@ -33,6 +33,23 @@ int LibroHechizos::usar() {
     return 0;
 }
 
+/**
+ * @brief Implementación del método estimarUso para LibroHechizos
+ *
+ * @return Distribución del valor que devolvería usar() (leer el libro no hace daño)
+ */
+DistribucionDanio LibroHechizos::estimarUso() const {
+    return DistribucionDanio{1, {0}, {1.0}};
+}
+
+/**
+ * @brief Implementación del método estimarUsosRestantes para LibroHechizos
+ * @return Lecturas esperadas: el libro se daña en una de cada diez
+ */
+int LibroHechizos::estimarUsosRestantes() const {
+    return max(0, durabilidadActual) * 10;
+}
+
 /**
  * @brief Implementación del método mostrarInfo para LibroHechizos
  * 
@@ -123,6 +140,9 @@ int LibroHechizos::cantidadHechizos() const {
     return hechizos.size();
 }
 
+const vector<string>& LibroHechizos::getHechizos() const { return hechizos; }
+void LibroHechizos::setHechizos(vector<string> nuevos) { hechizos = move(nuevos); }
+
 /**
  * @brief Implementación del método listarHechizos
  * 
@@ -139,3 +159,41 @@ void LibroHechizos::listarHechizos() const {
         cout << "  - " << h << endl;
     }
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> LibroHechizos::clonar() const {
+    return make_unique<LibroHechizos>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarCheckpoint
+ * 
+ * Agrega la cantidad de hechizos del libro al checkpoint del objeto mágico.
+ * 
+ * @return Checkpoint con durabilidad, energía y cantidad de hechizos
+ */
+CheckpointArma LibroHechizos::guardarCheckpoint() const {
+    CheckpointArma checkpoint = ObjetoMagico::guardarCheckpoint();
+    checkpoint.cantidadHechizos = static_cast<int>(hechizos.size());
+    return checkpoint;
+}
+
+/**
+ * @brief Implementación del método restaurarCheckpoint
+ * 
+ * @param checkpoint Checkpoint a restaurar
+ * @return true si se restauró, false si el checkpoint no corresponde a el libro
+ */
+bool LibroHechizos::restaurarCheckpoint(const CheckpointArma& checkpoint) {
+    if (!ObjetoMagico::restaurarCheckpoint(checkpoint)) {
+        return false;
+    }
+    // Se descartan los hechizos agregados después del checkpoint
+    if (checkpoint.cantidadHechizos >= 0 && static_cast<size_t>(checkpoint.cantidadHechizos) < hechizos.size()) {
+        hechizos.resize(checkpoint.cantidadHechizos);
+    }
+    return true;
+}
@@ -43,7 +43,12 @@ public:
     // ==========================================
     
     int usar() override;
+    DistribucionDanio estimarUso() const override;
+    int estimarUsosRestantes() const override;
     void mostrarInfo() const override;
+    unique_ptr<InterfazArmas> clonar() const override;
+    CheckpointArma guardarCheckpoint() const override;
+    bool restaurarCheckpoint(const CheckpointArma& checkpoint) override;
 
     // ==========================================
     // MÉTODOS PROPIOS DE LA CLASE LIBROHECHIZOS
@@ -75,6 +80,21 @@ public:
      * @return Número de hechizos en el libro
      */
     int cantidadHechizos() const;
+
+    /**
+     * @brief Obtiene los hechizos del libro
+     * @return Referencia constante a los hechizos, en el orden en que se aprendieron
+     */
+    const vector<string>& getHechizos() const;
+
+    /**
+     * @brief Reemplaza los hechizos sin mostrar mensajes ni gastar páginas
+     * 
+     * La fábrica lo usa al cargar un roster.
+     * 
+     * @param nuevos Hechizos del libro
+     */
+    void setHechizos(vector<string> nuevos);
     
     /**
      * @brief Muestra todos los hechizos contenidos en el libro
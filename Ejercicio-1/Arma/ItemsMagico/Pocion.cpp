@@ -49,6 +49,41 @@ int Pocion::usar() {
     return efectoValor;
 }
 
+/**
+ * @brief Implementación del método estimarUso para Pocion
+ *
+ * @return Distribución del valor que devolvería usar(), según el efecto
+ */
+DistribucionDanio Pocion::estimarUso() const {
+    int valor = 0;
+    if (!estaVacia()) {
+        switch (efecto) {
+            case EfectoPocion::Curacion:
+            case EfectoPocion::Mana:
+            case EfectoPocion::Fuerza:
+                valor = potenciaEfecto;
+                break;
+            case EfectoPocion::Veneno:
+                valor = -potenciaEfecto;
+                break;
+            case EfectoPocion::Invisibilidad:
+                valor = 1;
+                break;
+            default:
+                break;
+        }
+    }
+    return DistribucionDanio{1, {valor}, {1.0}};
+}
+
+/**
+ * @brief Implementación del método estimarUsosRestantes para Pocion
+ * @return Dosis restantes
+ */
+int Pocion::estimarUsosRestantes() const {
+    return max(0, dosisRestantes);
+}
+
 /**
  * @brief Implementación del método mostrarInfo para Pocion
  * 
@@ -71,6 +106,12 @@ EfectoPocion Pocion::getEfecto() const { return efecto; }
 int Pocion::getPotenciaEfecto() const { return potenciaEfecto; }
 int Pocion::getDosisRestantes() const { return dosisRestantes; }
 bool Pocion::estaVacia() const { return dosisRestantes <= 0; }
+bool Pocion::getEsPermanente() const { return esPermanente; }
+ColorPocion Pocion::getColor() const { return colorLiquido; }
+
+Ingrediente Pocion::comoIngrediente() const {
+    return Ingrediente{efecto, colorLiquido, potenciaEfecto, rareza};
+}
 
 /**
  * @brief Implementación del método aplicarEfecto
@@ -133,6 +174,48 @@ void Pocion::combinar(const Pocion& otraPocion) {
     }
 }
 
+/**
+ * @brief Implementación del método combinar con recetario
+ * 
+ * Las pociones permanentes no se mezclan. El resultado sale de la memoria
+ * del recetario si esa mezcla ya se había preparado antes. Las dosis son
+ * las de la receta por cada par de dosis restantes (redondeando hacia
+ * arriba), con un mínimo de las de la receta.
+ * 
+ * @param otraPocion La poción con la que se intenta combinar
+ * @param recetario Recetario a consultar
+ * @return true si la mezcla no explotó
+ */
+bool Pocion::combinar(const Pocion& otraPocion, RecetarioAlquimia& recetario) {
+    cout << "Intentas combinar " << nombre << " con " << otraPocion.getNombre() << "." << endl;
+    Ingrediente ingredientes[2] = {comoIngrediente(), otraPocion.comoIngrediente()};
+    ResultadoMezcla resultado = esPermanente || otraPocion.esPermanente
+        ? ResultadoMezcla{-1, EfectoPocion::Curacion, ColorPocion::Negro, 0, 0, Rarity::Comun}
+        : recetario.fabricar(ingredientes, 2);
+
+    if (resultado.receta < 0) {
+        cout << "¡La combinación resulta inestable y explota!" << endl;
+        dosisRestantes = 0;
+        durabilidadActual = 0;
+        potenciaEfecto = 0;
+        efecto = EfectoPocion::Curacion;
+        return false;
+    }
+
+    nombre = recetario.getReceta(resultado.receta).nombre;
+    efecto = resultado.efecto;
+    colorLiquido = resultado.color;
+    potenciaEfecto = resultado.potencia;
+    rareza = resultado.rareza;
+    int pares = max(1, (dosisRestantes + otraPocion.dosisRestantes + 1) / 2);
+    durabilidadMaxima = resultado.dosis * pares;
+    dosisRestantes = durabilidadMaxima;
+    durabilidadActual = dosisRestantes;
+    cout << "¡Obtienes " << nombre << "! Potencia: " << potenciaEfecto
+         << ", Dosis: " << dosisRestantes << ", Rareza: " << rarityToString(rareza) << endl;
+    return true;
+}
+
 /**
  * @brief Implementación del método calcularCostoEnergia
  * 
@@ -146,3 +229,43 @@ int Pocion::calcularCostoEnergia() const {
     costoBase += static_cast<int>(rareza);
     return max(1, costoBase);
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia
+ */
+unique_ptr<InterfazArmas> Pocion::clonar() const {
+    return make_unique<Pocion>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarCheckpoint
+ * 
+ * Agrega las dosis restantes, la potencia y el efecto (que cambian al
+ * combinar) al checkpoint del objeto mágico.
+ * 
+ * @return Checkpoint con durabilidad, energía, dosis, potencia y efecto
+ */
+CheckpointArma Pocion::guardarCheckpoint() const {
+    CheckpointArma checkpoint = ObjetoMagico::guardarCheckpoint();
+    checkpoint.dosisRestantes = dosisRestantes;
+    checkpoint.potenciaEfecto = potenciaEfecto;
+    checkpoint.efectoPocion = static_cast<int>(efecto);
+    return checkpoint;
+}
+
+/**
+ * @brief Implementación del método restaurarCheckpoint
+ * 
+ * @param checkpoint Checkpoint a restaurar
+ * @return true si se restauró, false si el checkpoint no corresponde a la poción
+ */
+bool Pocion::restaurarCheckpoint(const CheckpointArma& checkpoint) {
+    if (!ObjetoMagico::restaurarCheckpoint(checkpoint)) {
+        return false;
+    }
+    dosisRestantes = checkpoint.dosisRestantes;
+    potenciaEfecto = checkpoint.potenciaEfecto;
+    efecto = static_cast<EfectoPocion>(checkpoint.efectoPocion);
+    return true;
+}
@@ -2,6 +2,7 @@
 
 #include "../ObjetoMagico.hpp"
 #include "../enumArmas.hpp"
+#include "RecetarioAlquimia.hpp"
 
 /**
  * @brief Clase Pocion que hereda de ObjetoMagico
@@ -44,7 +45,12 @@ public:
     // ==========================================
     
     int usar() override;
+    DistribucionDanio estimarUso() const override;
+    int estimarUsosRestantes() const override;
     void mostrarInfo() const override;
+    unique_ptr<InterfazArmas> clonar() const override;
+    CheckpointArma guardarCheckpoint() const override;
+    bool restaurarCheckpoint(const CheckpointArma& checkpoint) override;
 
     // ==========================================
     // MÉTODOS PROPIOS DE LA CLASE POCION
@@ -74,6 +80,24 @@ public:
      */
     bool estaVacia() const;
     
+    /**
+     * @brief Indica si el efecto de la poción es permanente
+     * @return true si es permanente, false si es temporal
+     */
+    bool getEsPermanente() const;
+
+    /**
+     * @brief Obtiene el color del líquido
+     * @return Color de la poción
+     */
+    ColorPocion getColor() const;
+
+    /**
+     * @brief Describe la poción como ingrediente de una mezcla
+     * @return Efecto, color, potencia y rareza de la poción
+     */
+    Ingrediente comoIngrediente() const;
+    
     /**
      * @brief Combina esta poción con otra del mismo efecto
      * 
@@ -84,6 +108,21 @@ public:
      */
     void combinar(const Pocion& otraPocion);
 
+    /**
+     * @brief Combina esta poción con otra siguiendo un recetario
+     * 
+     * Si la mezcla corresponde a una receta, la poción pasa a ser el
+     * resultado (nombre, efecto, color, potencia y rareza de la receta). La
+     * receta rinde sus dosis por cada par de dosis restantes de ambas
+     * pociones, así que no se pierden las que quedaban.
+     * Si no, la mezcla explota como en combinar.
+     * 
+     * @param otraPocion La poción con la que se va a combinar
+     * @param recetario Recetario a consultar
+     * @return true si la mezcla no explotó
+     */
+    bool combinar(const Pocion& otraPocion, RecetarioAlquimia& recetario);
+
 protected:
     // ==========================================
     // MÉTODOS PROTEGIDOS
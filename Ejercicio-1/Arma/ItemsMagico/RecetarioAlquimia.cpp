@@ -0,0 +1,258 @@
+#include "RecetarioAlquimia.hpp"
+#include <algorithm>
+#include <functional>
+
+/**
+ * @brief Implementación del constructor de RecetarioAlquimia
+ */
+RecetarioAlquimia::RecetarioAlquimia() : aciertos(0), fallos(0) {}
+
+RecetarioAlquimia& RecetarioAlquimia::global() {
+    static RecetarioAlquimia recetario = []() {
+        RecetarioAlquimia inicial;
+        const ColorPocion colores[CANTIDAD_EFECTOS] = {
+            ColorPocion::Rojo, ColorPocion::Azul, ColorPocion::Amarillo, ColorPocion::Verde,
+            ColorPocion::Transparente, ColorPocion::Negro, ColorPocion::Morado
+        };
+        for (int i = 0; i < CANTIDAD_EFECTOS; ++i) {
+            EfectoPocion efecto = static_cast<EfectoPocion>(i);
+            inicial.registrar(Receta{"Concentrado de " + efectoPocionToString(efecto), {efecto, efecto}, efecto,
+                                     colores[i], 75, 0, 2, Rarity::Comun, false, false});
+        }
+        inicial.registrar(Receta{"Suero Neutralizante", {EfectoPocion::Veneno, EfectoPocion::Antidoto},
+                                 EfectoPocion::Curacion, ColorPocion::Transparente, 50, 5, 1, Rarity::Comun, false, false});
+        inicial.registrar(Receta{"Elixir Vital", {EfectoPocion::Curacion, EfectoPocion::Mana},
+                                 EfectoPocion::Curacion, ColorPocion::Morado, 100, 10, 1, Rarity::PocoComun, false, true});
+        inicial.registrar(Receta{"Tónico del Guerrero", {EfectoPocion::Fuerza, EfectoPocion::Agilidad},
+                                 EfectoPocion::Fuerza, ColorPocion::Amarillo, 80, 0, 2, Rarity::Comun, false, false});
+        inicial.registrar(Receta{"Niebla del Asesino",
+                                 {EfectoPocion::Invisibilidad, EfectoPocion::Agilidad, EfectoPocion::Veneno},
+                                 EfectoPocion::Veneno, ColorPocion::Negro, 120, 5, 1, Rarity::Raro, false, true});
+        inicial.registrar(Receta{"Esencia Arcana", {EfectoPocion::Mana, EfectoPocion::Mana, EfectoPocion::Mana},
+                                 EfectoPocion::Mana, ColorPocion::Azul, 100, 0, 1, Rarity::Comun, true, true});
+        return inicial;
+    }();
+    return recetario;
+}
+
+/**
+ * @brief Implementación del método registrar
+ *
+ * Indexa la receta por sus efectos ordenados y agrega sus aristas al grafo.
+ *
+ * @param receta Receta a registrar
+ * @return Identificador de la receta, -1 si la cantidad de ingredientes no es válida
+ */
+int RecetarioAlquimia::registrar(const Receta& receta) {
+    size_t cantidad = receta.ingredientes.size();
+    if (cantidad < 2 || cantidad > static_cast<size_t>(MAX_INGREDIENTES)) {
+        return -1;
+    }
+    Receta ajustada = receta;
+    ajustada.porcentajePotencia = max(0, ajustada.porcentajePotencia);
+    ajustada.dosis = max(1, ajustada.dosis);
+
+    int id;
+    auto it = porNombre.find(ajustada.nombre);
+    if (it != porNombre.end()) {
+        id = it->second;
+        // Se desindexa la version anterior antes de reemplazarla
+        for (auto& [efectos, candidatas] : porEfectos) {
+            candidatas.erase(remove(candidatas.begin(), candidatas.end(), id), candidatas.end());
+        }
+        for (vector<int>& aristas : recetasPorEfecto) {
+            aristas.erase(remove(aristas.begin(), aristas.end(), id), aristas.end());
+        }
+        recetas[id] = ajustada;
+    } else {
+        id = static_cast<int>(recetas.size());
+        recetas.push_back(ajustada);
+        porNombre[ajustada.nombre] = id;
+    }
+
+    uint32_t efectos[MAX_INGREDIENTES];
+    for (size_t i = 0; i < cantidad; ++i) {
+        efectos[i] = static_cast<uint32_t>(ajustada.ingredientes[i]);
+    }
+    sort(efectos, efectos + cantidad, greater<uint32_t>());
+    vector<int>& candidatas = porEfectos[claveEfectos(efectos, cantidad)];
+    candidatas.insert(lower_bound(candidatas.begin(), candidatas.end(), id), id);
+
+    for (size_t i = 0; i < cantidad; ++i) {
+        if (i > 0 && efectos[i] == efectos[i - 1]) continue;
+        vector<int>& aristas = recetasPorEfecto[efectos[i]];
+        aristas.insert(lower_bound(aristas.begin(), aristas.end(), id), id);
+    }
+
+    limpiarMemoria();
+    return id;
+}
+
+int RecetarioAlquimia::buscar(const string& nombre) const {
+    auto it = porNombre.find(nombre);
+    return it != porNombre.end() ? it->second : -1;
+}
+
+/**
+ * @brief Implementación del método fabricar
+ *
+ * Canoniza la mezcla y la busca en la memoria; solo si no está se busca la
+ * receta. La potencia sale siempre de la suma de esta mezcla.
+ *
+ * @param ingredientes Ingredientes de la mezcla
+ * @param cantidad Cantidad de ingredientes
+ * @return Resultado; receta == -1 si la mezcla explota
+ */
+ResultadoMezcla RecetarioAlquimia::fabricar(const Ingrediente* ingredientes, size_t cantidad) {
+    if (cantidad < 2 || cantidad > static_cast<size_t>(MAX_INGREDIENTES)) {
+        return ResultadoMezcla{-1, EfectoPocion::Curacion, ColorPocion::Negro, 0, 0, Rarity::Comun};
+    }
+
+    ClaveMezcla clave{};
+    int sumaPotencia = 0;
+    for (size_t i = 0; i < cantidad; ++i) {
+        clave.ingredientes[i] = empaquetar(ingredientes[i]);
+        sumaPotencia += clamp(ingredientes[i].potencia, 0, 0xFFFF);
+    }
+    sort(clave.ingredientes.begin(), clave.ingredientes.begin() + cantidad, greater<uint32_t>());
+
+    ResultadoMezcla resultado;
+    auto it = memoria.find(clave);
+    if (it != memoria.end()) {
+        ++aciertos;
+        resultado = it->second;
+    } else {
+        ++fallos;
+        resultado = calcular(clave, cantidad);
+        if (memoria.size() >= MAX_MEMORIZADOS) {
+            memoria.clear();
+        }
+        memoria.emplace(clave, resultado);
+    }
+    if (resultado.receta >= 0) {
+        const Receta& receta = recetas[resultado.receta];
+        resultado.potencia = sumaPotencia * receta.porcentajePotencia / 100 + receta.bonusPotencia;
+    }
+    return resultado;
+}
+
+ResultadoMezcla RecetarioAlquimia::fabricar(const vector<Ingrediente>& ingredientes) {
+    return fabricar(ingredientes.data(), ingredientes.size());
+}
+
+/**
+ * @brief Implementación del método fabricarLote
+ *
+ * @param mezclas Ingredientes de cada mezcla
+ * @param resultados Se reemplaza por un resultado por mezcla
+ * @return Cantidad de mezclas que no explotaron
+ */
+size_t RecetarioAlquimia::fabricarLote(const vector<vector<Ingrediente>>& mezclas,
+                                       vector<ResultadoMezcla>& resultados) {
+    resultados.clear();
+    resultados.reserve(mezclas.size());
+    size_t exitosas = 0;
+    for (const vector<Ingrediente>& mezcla : mezclas) {
+        resultados.push_back(fabricar(mezcla));
+        if (resultados.back().receta >= 0) ++exitosas;
+    }
+    return exitosas;
+}
+
+const vector<int>& RecetarioAlquimia::recetasCon(EfectoPocion efecto) const {
+    return recetasPorEfecto[static_cast<int>(efecto)];
+}
+
+void RecetarioAlquimia::limpiarMemoria() {
+    memoria.clear();
+}
+
+const Receta& RecetarioAlquimia::getReceta(int id) const { return recetas.at(id); }
+size_t RecetarioAlquimia::getCantidad() const { return recetas.size(); }
+size_t RecetarioAlquimia::getMemorizados() const { return memoria.size(); }
+size_t RecetarioAlquimia::getAciertos() const { return aciertos; }
+size_t RecetarioAlquimia::getFallos() const { return fallos; }
+
+bool RecetarioAlquimia::ClaveMezcla::operator==(const ClaveMezcla& otra) const {
+    return ingredientes == otra.ingredientes;
+}
+
+size_t RecetarioAlquimia::HashClaveMezcla::operator()(const ClaveMezcla& clave) const {
+    uint64_t primera = (static_cast<uint64_t>(clave.ingredientes[0]) << 32) | clave.ingredientes[1];
+    uint64_t segunda = (static_cast<uint64_t>(clave.ingredientes[2]) << 32) | clave.ingredientes[3];
+    uint64_t h = primera * 0x9E3779B97F4A7C15ull ^ segunda * 0xC2B2AE3D27D4EB4Full;
+    return static_cast<size_t>(h ^ (h >> 29));
+}
+
+/**
+ * @brief Implementación del método empaquetar
+ *
+ * El bit más alto marca un lugar ocupado; después van efecto, color y
+ * rareza, así que ordenar los enteros agrupa por efecto. La potencia no
+ * se empaqueta: no cambia qué receta se aplica.
+ *
+ * @param ingrediente Ingrediente a empaquetar
+ * @return Ingrediente empaquetado
+ */
+uint32_t RecetarioAlquimia::empaquetar(const Ingrediente& ingrediente) {
+    return 0x80000000u
+        | (static_cast<uint32_t>(ingrediente.efecto) << 26)
+        | (static_cast<uint32_t>(ingrediente.color) << 22)
+        | (static_cast<uint32_t>(ingrediente.rareza) << 18);
+}
+
+Ingrediente RecetarioAlquimia::desempaquetar(uint32_t valor) {
+    return Ingrediente{static_cast<EfectoPocion>((valor >> 26) & 0x7),
+                       static_cast<ColorPocion>((valor >> 22) & 0x7),
+                       0,
+                       static_cast<Rarity>((valor >> 18) & 0x7)};
+}
+
+uint32_t RecetarioAlquimia::claveEfectos(const uint32_t* efectos, size_t cantidad) {
+    uint32_t clave = 0;
+    for (size_t i = 0; i < cantidad; ++i) {
+        clave = (clave << 4) | (efectos[i] + 1);
+    }
+    return clave;
+}
+
+/**
+ * @brief Implementación del método calcular
+ *
+ * Recorre las recetas que usan exactamente esos efectos y aplica la primera
+ * cuyas condiciones de rareza y color cumple la mezcla. La potencia la
+ * completa fabricar.
+ *
+ * @param clave Mezcla canónica
+ * @param cantidad Cantidad de ingredientes
+ * @return Resultado de la mezcla
+ */
+ResultadoMezcla RecetarioAlquimia::calcular(const ClaveMezcla& clave, size_t cantidad) const {
+    Ingrediente ingredientes[MAX_INGREDIENTES];
+    uint32_t efectos[MAX_INGREDIENTES];
+    for (size_t i = 0; i < cantidad; ++i) {
+        ingredientes[i] = desempaquetar(clave.ingredientes[i]);
+        efectos[i] = static_cast<uint32_t>(ingredientes[i].efecto);
+    }
+
+    auto it = porEfectos.find(claveEfectos(efectos, cantidad));
+    if (it != porEfectos.end()) {
+        for (int id : it->second) {
+            const Receta& receta = recetas[id];
+            bool cumple = true;
+            Rarity mayorRareza = Rarity::Comun;
+            for (size_t i = 0; i < cantidad && cumple; ++i) {
+                cumple = ingredientes[i].rareza >= receta.rarezaMinima
+                    && (!receta.mismoColor || ingredientes[i].color == ingredientes[0].color);
+                mayorRareza = max(mayorRareza, ingredientes[i].rareza);
+            }
+            if (!cumple) continue;
+
+            if (receta.subeRareza && mayorRareza < Rarity::Legendario) {
+                mayorRareza = static_cast<Rarity>(static_cast<int>(mayorRareza) + 1);
+            }
+            return ResultadoMezcla{id, receta.resultado, receta.color, 0, receta.dosis, mayorRareza};
+        }
+    }
+    return ResultadoMezcla{-1, EfectoPocion::Curacion, ColorPocion::Negro, 0, 0, Rarity::Comun};
+}
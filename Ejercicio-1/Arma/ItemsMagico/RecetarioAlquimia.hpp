@@ -0,0 +1,187 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../enumArmas.hpp"
+
+using namespace std;
+
+/**
+ * @brief Máximo de ingredientes que acepta una mezcla
+ */
+static const int MAX_INGREDIENTES = 4;
+
+/**
+ * @brief Máximo de mezclas distintas que guarda la memoria del recetario
+ */
+static const size_t MAX_MEMORIZADOS = 16384;
+
+/**
+ * @brief Lo que aporta una poción a una mezcla
+ */
+struct Ingrediente {
+    EfectoPocion efecto;
+    ColorPocion color;
+    int potencia;       ///< Se acota entre 0 y 65535
+    Rarity rareza;
+};
+
+/**
+ * @brief Receta de alquimia: un conjunto de efectos que se transforma en otro
+ *
+ * Potencia del resultado = suma de potencias * porcentajePotencia / 100 + bonusPotencia.
+ * Rareza del resultado = la mayor de los ingredientes, un nivel más si subeRareza.
+ */
+struct Receta {
+    string nombre;
+    vector<EfectoPocion> ingredientes;  ///< Efectos requeridos (el orden no importa; se admiten repetidos)
+    EfectoPocion resultado;
+    ColorPocion color;                  ///< Color del resultado
+    int porcentajePotencia;
+    int bonusPotencia;
+    int dosis;                          ///< Dosis de la poción fabricada
+    Rarity rarezaMinima;                ///< Rareza que deben tener todos los ingredientes
+    bool mismoColor;                    ///< Los ingredientes deben compartir color
+    bool subeRareza;
+};
+
+/**
+ * @brief Resultado de una mezcla
+ */
+struct ResultadoMezcla {
+    int receta;             ///< Receta aplicada, -1 si la mezcla explotó
+    EfectoPocion efecto;
+    ColorPocion color;
+    int potencia;
+    int dosis;
+    Rarity rareza;
+};
+
+/**
+ * @brief Grafo de recetas de alquimia con resultados memorizados
+ *
+ * Cada receta es una arista que une un conjunto de efectos con el efecto
+ * resultante; recetasCon recorre las aristas que salen de un efecto.
+ *
+ * Las mezclas se canonizan (cada ingrediente se empaqueta en un entero y se
+ * ordenan), así que el orden de los ingredientes no cambia el resultado.
+ * La receta que corresponde a cada mezcla canónica se guarda en una tabla
+ * hash: la primera vez se busca y se calcula; las siguientes cuestan una
+ * sola búsqueda. Las mezclas que explotan también se memorizan.
+ *
+ * Qué receta se aplica no depende de la potencia, así que la clave la
+ * omite y la potencia del resultado se calcula en cada mezcla a partir de
+ * la suma. La memoria guarda hasta MAX_MEMORIZADOS mezclas; al llenarse
+ * se vacía y vuelve a llenarse con las que se sigan preparando.
+ */
+class RecetarioAlquimia {
+public:
+    RecetarioAlquimia();
+
+    /**
+     * @brief Recetario compartido
+     *
+     * Trae ya registrados los concentrados de dos pociones del mismo efecto
+     * (75% de la suma de potencias, 2 dosis; Pocion::combinar sin recetario
+     * suma en cambio la mitad de la otra potencia y todas las dosis) y
+     * algunas recetas clásicas entre efectos distintos.
+     *
+     * @return Recetario global
+     */
+    static RecetarioAlquimia& global();
+
+    /**
+     * @brief Registra una receta (o reemplaza la que tenga el mismo nombre)
+     *
+     * Vacía la memoria de resultados, que podrían cambiar con la nueva receta.
+     * Si varias recetas usan los mismos efectos, gana la registrada primero
+     * entre las que la mezcla cumpla.
+     *
+     * @param receta Receta a registrar
+     * @return Identificador de la receta, -1 si no tiene entre 2 y MAX_INGREDIENTES ingredientes
+     */
+    int registrar(const Receta& receta);
+
+    /**
+     * @brief Busca una receta por nombre
+     * @param nombre Nombre de la receta
+     * @return Identificador, -1 si no está registrada
+     */
+    int buscar(const string& nombre) const;
+
+    /**
+     * @brief Mezcla ingredientes
+     * @param ingredientes Ingredientes de la mezcla
+     * @param cantidad Cantidad de ingredientes (2 a MAX_INGREDIENTES)
+     * @return Resultado; receta == -1 si la mezcla explota
+     */
+    ResultadoMezcla fabricar(const Ingrediente* ingredientes, size_t cantidad);
+
+    /**
+     * @brief Mezcla ingredientes
+     * @param ingredientes Ingredientes de la mezcla
+     * @return Resultado; receta == -1 si la mezcla explota
+     */
+    ResultadoMezcla fabricar(const vector<Ingrediente>& ingredientes);
+
+    /**
+     * @brief Fabrica muchas mezclas de una vez
+     * @param mezclas Ingredientes de cada mezcla
+     * @param resultados Se reemplaza por un resultado por mezcla, en el mismo orden
+     * @return Cantidad de mezclas que no explotaron
+     */
+    size_t fabricarLote(const vector<vector<Ingrediente>>& mezclas, vector<ResultadoMezcla>& resultados);
+
+    /**
+     * @brief Recetas en las que participa un efecto
+     * @param efecto Efecto a consultar
+     * @return Identificadores de las recetas que lo usan como ingrediente
+     */
+    const vector<int>& recetasCon(EfectoPocion efecto) const;
+
+    void limpiarMemoria();
+
+    const Receta& getReceta(int id) const;
+    size_t getCantidad() const;
+    size_t getMemorizados() const;
+    size_t getAciertos() const;
+    size_t getFallos() const;
+
+private:
+    static constexpr int CANTIDAD_EFECTOS = 7;
+
+    /**
+     * @brief Mezcla canónica: ingredientes empaquetados sin potencia, ordenados de mayor a menor
+     */
+    struct ClaveMezcla {
+        array<uint32_t, MAX_INGREDIENTES> ingredientes;
+        bool operator==(const ClaveMezcla& otra) const;
+    };
+
+    struct HashClaveMezcla {
+        size_t operator()(const ClaveMezcla& clave) const;
+    };
+
+    static uint32_t empaquetar(const Ingrediente& ingrediente);
+    static Ingrediente desempaquetar(uint32_t valor);
+    static uint32_t claveEfectos(const uint32_t* efectos, size_t cantidad);
+
+    /**
+     * @brief Busca la receta de una mezcla canónica
+     * @return Resultado sin potencia; receta == -1 si la mezcla explota
+     */
+    ResultadoMezcla calcular(const ClaveMezcla& clave, size_t cantidad) const;
+
+    vector<Receta> recetas;
+    unordered_map<string, int> porNombre;
+    unordered_map<uint32_t, vector<int>> porEfectos;        ///< Efectos ordenados -> recetas candidatas
+    array<vector<int>, CANTIDAD_EFECTOS> recetasPorEfecto;   ///< Aristas del grafo por efecto
+
+    unordered_map<ClaveMezcla, ResultadoMezcla, HashClaveMezcla> memoria;
+    size_t aciertos;
+    size_t fallos;
+};
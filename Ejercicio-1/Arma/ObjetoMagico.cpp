@@ -1,6 +1,7 @@
 #include "ObjetoMagico.hpp"
 #include <algorithm>
 #include <stdexcept>
+#include <typeinfo>
 
 /**
  * @brief Constructor que inicializa un objeto mágico con propiedades básicas
@@ -35,7 +36,7 @@ ObjetoMagico::ObjetoMagico(string n, int pm, int dm, double p, Rarity r, int eam
 }
 
 void ObjetoMagico::setNombre(const string& nombreArg) { nombre = nombreArg; }
-string ObjetoMagico::getNombre() const { return nombre; }
+const string& ObjetoMagico::getNombre() const { return nombre; }
 int ObjetoMagico::getPoder() const { return poderMagico; }
 int ObjetoMagico::getDurabilidadActual() const { return durabilidadActual; }
 int ObjetoMagico::getDurabilidadMaxima() const { return durabilidadMaxima; }
@@ -43,6 +44,28 @@ Rarity ObjetoMagico::getRareza() const { return rareza; }
 double ObjetoMagico::getPeso() const { return peso; }
 int ObjetoMagico::getEnergiaArcanaActual() const { return energiaArcanaActual; }
 int ObjetoMagico::getEnergiaArcanaMaxima() const { return energiaArcanaMaxima; }
+int ObjetoMagico::getCostoEnergia() const { return calcularCostoEnergia(); }
+
+/**
+ * @brief Implementación del método setAtributosBase
+ * 
+ * @param r Rareza del objeto
+ * @param pm Poder mágico base
+ * @param p Peso del objeto
+ * @param dm Durabilidad máxima
+ * @param da Durabilidad actual
+ * @param eam Energía arcana máxima
+ * @param eaa Energía arcana actual
+ */
+void ObjetoMagico::setAtributosBase(Rarity r, int pm, double p, int dm, int da, int eam, int eaa) {
+    rareza = r;
+    poderMagico = pm;
+    peso = p;
+    durabilidadMaxima = dm;
+    durabilidadActual = da;
+    energiaArcanaMaxima = eam;
+    energiaArcanaActual = eaa;
+}
 
 /**
  * @brief Repara el objeto mágico, aumentando su durabilidad
@@ -117,6 +140,31 @@ int ObjetoMagico::usar() {
     }
 }
 
+/**
+ * @brief Implementación del método estimarUso
+ *
+ * @return Distribución del valor que devolvería usar() (0 si está roto o sin energía)
+ */
+DistribucionDanio ObjetoMagico::estimarUso() const {
+    if (durabilidadActual <= 0 ||
+        (energiaArcanaMaxima > 0 && energiaArcanaActual < calcularCostoEnergia())) {
+        return DistribucionDanio{1, {0}, {1.0}};
+    }
+    return DistribucionDanio{1, {poderMagico / 10}, {1.0}};
+}
+
+/**
+ * @brief Implementación del método estimarUsosRestantes
+ * @return Usos que permiten la durabilidad y la energía arcana, lo que se acabe primero
+ */
+int ObjetoMagico::estimarUsosRestantes() const {
+    int usos = max(0, durabilidadActual);
+    if (energiaArcanaMaxima > 0) {
+        usos = min(usos, max(0, energiaArcanaActual) / calcularCostoEnergia());
+    }
+    return usos;
+}
+
 /**
  * @brief Aplica el efecto base del objeto mágico
  * 
@@ -168,3 +216,35 @@ void ObjetoMagico::reducirDurabilidad(int cantidad) {
     }
     cout << "Durabilidad: " << durabilidadActual << "/" << durabilidadMaxima << endl;
 }
+
+// ==========================================
+// CHECKPOINT DE ESTADO
+// ==========================================
+
+/**
+ * @brief Implementación del método guardarCheckpoint
+ * 
+ * @return Checkpoint con la durabilidad y la energía arcana actuales
+ */
+CheckpointArma ObjetoMagico::guardarCheckpoint() const {
+    CheckpointArma checkpoint{};
+    checkpoint.tipoDinamico = typeid(*this).hash_code();
+    checkpoint.durabilidadActual = durabilidadActual;
+    checkpoint.energiaArcanaActual = energiaArcanaActual;
+    return checkpoint;
+}
+
+/**
+ * @brief Implementación del método restaurarCheckpoint
+ * 
+ * @param checkpoint Checkpoint a restaurar
+ * @return true si se restauró, false si el checkpoint es de otro tipo de objeto
+ */
+bool ObjetoMagico::restaurarCheckpoint(const CheckpointArma& checkpoint) {
+    if (checkpoint.tipoDinamico != typeid(*this).hash_code()) {
+        return false;
+    }
+    durabilidadActual = checkpoint.durabilidadActual;
+    energiaArcanaActual = checkpoint.energiaArcanaActual;
+    return true;
+}
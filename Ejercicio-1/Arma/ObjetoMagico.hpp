@@ -51,14 +51,18 @@ public:
     // ==========================================
 
     void setNombre(const string& nombreArg) override;
-    string getNombre() const override;
+    const string& getNombre() const override;
     int getPoder() const override;
     int getDurabilidadActual() const override;
     int getDurabilidadMaxima() const override; 
     Rarity getRareza() const override;
     void reparar(int cantidad) override;
     int usar() override;
+    DistribucionDanio estimarUso() const override;
+    int estimarUsosRestantes() const override;
     void mostrarInfo() const override;
+    CheckpointArma guardarCheckpoint() const override;
+    bool restaurarCheckpoint(const CheckpointArma& checkpoint) override;
 
     // ==========================================
     // METODOS PROPIOS DE LA CLASE ABSTRACTA
@@ -81,6 +85,28 @@ public:
      * @return Valor numérico de la energía arcana máxima
      */
     int getEnergiaArcanaMaxima() const;
+
+    /**
+     * @brief Reemplaza los atributos base sin validarlos ni mostrar mensajes
+     * 
+     * La fábrica lo usa para ajustar un clon del prototipo sin volver a pasar
+     * por el constructor.
+     * 
+     * @param r Rareza del objeto
+     * @param pm Poder mágico base
+     * @param p Peso del objeto
+     * @param dm Durabilidad máxima
+     * @param da Durabilidad actual
+     * @param eam Energía arcana máxima
+     * @param eaa Energía arcana actual
+     */
+    void setAtributosBase(Rarity r, int pm, double p, int dm, int da, int eam, int eaa);
+
+    /**
+     * @brief Obtiene la energía arcana que gasta cada uso
+     * @return Costo de calcularCostoEnergia con el estado actual
+     */
+    int getCostoEnergia() const;
     
     /**
      * @brief Recarga la energía arcana del objeto
@@ -0,0 +1,429 @@
+#include "BatallaEquipos.hpp"
+#include <cmath>
+#include <iostream>
+#include "Mago.hpp"
+#include "Guerrero.hpp"
+#include "../Arma/ArmasDeCombate/HachaSimple.hpp"
+
+namespace {
+
+/**
+ * @brief Silencia cout y cerr mientras existe y los restaura al destruirse
+ *
+ * Asi una excepcion a mitad de la batalla no deja la salida silenciada.
+ */
+class SilenciadorSalida {
+public:
+    explicit SilenciadorSalida(bool activo)
+        : salida(activo ? cout.rdbuf(nullptr) : nullptr),
+          errores(activo ? cerr.rdbuf(nullptr) : nullptr),
+          activo(activo) {}
+
+    ~SilenciadorSalida() {
+        if (activo) {
+            cout.rdbuf(salida);
+            cerr.rdbuf(errores);
+        }
+    }
+
+    SilenciadorSalida(const SilenciadorSalida&) = delete;
+    SilenciadorSalida& operator=(const SilenciadorSalida&) = delete;
+
+private:
+    streambuf* salida;
+    streambuf* errores;
+    bool activo;
+};
+
+}
+
+/**
+ * @brief Implementacion del constructor de BatallaEquipos
+ * 
+ * @param politica Politica de eleccion de objetivos
+ * @param semilla Semilla del generador
+ */
+BatallaEquipos::BatallaEquipos(PoliticaObjetivo politica, uint64_t semilla)
+    : politica(politica), generador(semilla), usaPosiciones(false) {}
+
+/**
+ * @brief Implementacion del metodo agregar
+ * 
+ * @param personaje Personaje a agregar
+ * @param equipo 0 o 1
+ * @return true si se agrego; false si el equipo es invalido, el personaje es nulo o la batalla usa posiciones
+ */
+bool BatallaEquipos::agregar(InterfazPersonaje* personaje, int equipo) {
+    if (usaPosiciones) {
+        cerr << "Error: en una batalla con posiciones todos los personajes necesitan una posicion." << endl;
+        return false;
+    }
+    if (!agregarActor(personaje, equipo)) {
+        return false;
+    }
+    // Con posiciones MenorHP mira solo los enemigos a su alcance y el monticulo no se usa
+    if (politica == PoliticaObjetivo::MenorHP) {
+        menorHP[equipo].push({personaje->getHP(), static_cast<int>(actores.size()) - 1});
+    }
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo agregar con posicion
+ * 
+ * @param personaje Personaje a agregar
+ * @param equipo 0 o 1
+ * @param posicion Posicion inicial en metros
+ * @return true si se agrego
+ */
+bool BatallaEquipos::agregar(InterfazPersonaje* personaje, int equipo, const Posicion& posicion) {
+    if (!usaPosiciones && !actores.empty()) {
+        cerr << "Error: la batalla ya tiene personajes sin posicion." << endl;
+        return false;
+    }
+    if (!agregarActor(personaje, equipo)) {
+        return false;
+    }
+    usaPosiciones = true;
+    int indice = static_cast<int>(actores.size()) - 1;
+    actores[indice].posicion = posicion;
+    cuadricula[equipo].insertar(indice, posicion);
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo agregarActor
+ * 
+ * La rama del personaje y la destreza se leen una sola vez; los alcances se
+ * calculan aca y se vuelven a calcular si cambia el arma equipada.
+ * 
+ * @param personaje Personaje a agregar
+ * @param equipo 0 o 1
+ * @return true si se agrego, false si el equipo es invalido o el personaje es nulo
+ */
+bool BatallaEquipos::agregarActor(InterfazPersonaje* personaje, int equipo) {
+    if (!personaje || equipo < 0 || equipo > 1) {
+        cerr << "Error: no se puede agregar el personaje al equipo " << equipo << "." << endl;
+        return false;
+    }
+
+    int indice = static_cast<int>(actores.size());
+    Mago* mago = dynamic_cast<Mago*>(personaje);
+    Guerrero* guerrero = mago ? nullptr : dynamic_cast<Guerrero*>(personaje);
+    int destreza = mago ? mago->getDestreza() : (guerrero ? guerrero->getDestreza() : 0);
+    actores.push_back({personaje, equipo, destreza, static_cast<int>(vivos[equipo].size()), mago, guerrero,
+                       nullptr, 0.0, 0.0, 1.0 + destreza / 20.0, {0.0, 0.0}, -1});
+    Actor& actor = actores.back();
+    actor.armaAlcance = obtenerArmaEquipada(actor);
+    actor.alcance = calcularAlcanceArma(actor.armaAlcance);
+    actor.alcanceLanzamiento = calcularAlcanceLanzamiento(actor.armaAlcance);
+    vivos[equipo].push_back(indice);
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo configurarCampo
+ * 
+ * @param ancho Ancho del campo en metros
+ * @param alto Alto del campo en metros
+ * @param tamanioCelda Lado de las celdas del indice espacial
+ * @return false si ya hay personajes agregados
+ */
+bool BatallaEquipos::configurarCampo(double ancho, double alto, double tamanioCelda) {
+    if (!actores.empty()) {
+        cerr << "Error: el campo debe configurarse antes de agregar personajes." << endl;
+        return false;
+    }
+    cuadricula[0] = CuadriculaEspacial(ancho, alto, tamanioCelda);
+    cuadricula[1] = CuadriculaEspacial(ancho, alto, tamanioCelda);
+    return true;
+}
+
+Posicion BatallaEquipos::getPosicion(int indice) const {
+    return actores.at(indice).posicion;
+}
+
+/**
+ * @brief Implementacion del metodo ejecutar
+ * 
+ * Saca de la cola al actor con el menor instante de proxima accion, lo hace
+ * atacar a un enemigo y lo vuelve a programar. Termina cuando un equipo se
+ * queda sin vivos o al llegar al limite de acciones.
+ * 
+ * Con posiciones, antes de elegir objetivo se revisa si cambio el arma
+ * equipada (una comparacion de punteros); arrojar el hacha usa
+ * HachaSimple::lanzar en lugar de atacar.
+ * 
+ * @param maxAcciones Limite de ataques (0 = 50 por actor)
+ * @param narrar true para mostrar la salida de los personajes
+ * @return Resultado de la batalla
+ */
+ResultadoBatalla BatallaEquipos::ejecutar(long maxAcciones, bool narrar) {
+    if (maxAcciones <= 0) {
+        maxAcciones = 50L * static_cast<long>(actores.size());
+    }
+
+    priority_queue<Turno, vector<Turno>, greater<Turno>> cola;
+    for (size_t i = 0; i < actores.size(); ++i) {
+        if (actores[i].posicionEnVivos >= 0) {
+            cola.push({intervalo(actores[i].destreza), actores[i].destreza, static_cast<int>(i)});
+        }
+    }
+
+    static const MovimientoCombate opciones[] = {
+        MovimientoCombate::GolpeFuerte,
+        MovimientoCombate::GolpeRapido,
+        MovimientoCombate::DefensaYGolpe
+    };
+
+    // Sin narracion tambien se silencian los avisos de armas rotas, que van a cerr
+    SilenciadorSalida silenciador(!narrar);
+    long acciones = 0;
+    long movimientos = 0;
+    long lanzamientos = 0;
+
+    while (!vivos[0].empty() && !vivos[1].empty() && acciones + movimientos < maxAcciones && !cola.empty()) {
+        Turno turno = cola.top();
+        cola.pop();
+
+        Actor& atacante = actores[turno.actor];
+        if (atacante.posicionEnVivos < 0) {
+            continue; // Cayo despues de ser programado
+        }
+
+        int objetivo;
+        HachaSimple* arrojada = nullptr;
+        if (usaPosiciones) {
+            InterfazArmas* arma = actualizarAlcance(atacante);
+            objetivo = elegirObjetivoEnRango(atacante, atacante.alcance);
+            if (objetivo < 0 && atacante.alcanceLanzamiento > atacante.alcance) {
+                objetivo = elegirObjetivoEnRango(atacante, atacante.alcanceLanzamiento);
+                if (objetivo >= 0) {
+                    arrojada = static_cast<HachaSimple*>(arma);
+                }
+            }
+            if (objetivo < 0) {
+                // Nadie a su alcance: usa el turno para acercarse
+                if (avanzar(turno.actor)) {
+                    ++movimientos;
+                }
+                cola.push({turno.instante + intervalo(atacante.destreza), atacante.destreza, turno.actor});
+                continue;
+            }
+        } else {
+            objetivo = elegirObjetivo(1 - atacante.equipo);
+        }
+        int danio;
+        if (arrojada) {
+            danio = arrojada->lanzar();
+            atacante.alcanceLanzamiento = calcularAlcanceLanzamiento(arrojada);
+            ++lanzamientos;
+        } else {
+            MovimientoCombate movimiento = opciones[generador() % 3];
+            danio = atacante.personaje->atacar(movimiento);
+        }
+        ++acciones;
+
+        if (danio > 0) {
+            InterfazPersonaje* defensor = actores[objetivo].personaje;
+            bool sigueVivo = defensor->recibirDanio(danio, false);
+            if (!sigueVivo || defensor->getHP() <= 0) {
+                marcarCaido(objetivo);
+                if (narrar) {
+                    cout << ">> " << defensor->getNombre() << " cae. Quedan " << vivos[actores[objetivo].equipo].size()
+                         << " en el equipo " << actores[objetivo].equipo << "." << endl;
+                }
+            } else if (politica == PoliticaObjetivo::MenorHP && !usaPosiciones) {
+                menorHP[actores[objetivo].equipo].push({defensor->getHP(), objetivo});
+            }
+        }
+
+        cola.push({turno.instante + intervalo(atacante.destreza), atacante.destreza, turno.actor});
+    }
+
+    ResultadoBatalla resultado{-1, acciones, movimientos, lanzamientos, {getVivos(0), getVivos(1)}};
+    if (vivos[1].empty() && !vivos[0].empty()) {
+        resultado.equipoGanador = 0;
+    } else if (vivos[0].empty() && !vivos[1].empty()) {
+        resultado.equipoGanador = 1;
+    }
+    return resultado;
+}
+
+int BatallaEquipos::getVivos(int equipo) const {
+    return (equipo == 0 || equipo == 1) ? static_cast<int>(vivos[equipo].size()) : 0;
+}
+
+size_t BatallaEquipos::getCantidadActores() const {
+    return actores.size();
+}
+
+/**
+ * @brief Implementacion del metodo elegirObjetivo
+ * 
+ * Con MenorHP se descartan las entradas vencidas del monticulo (actores
+ * caidos o cuyo HP cambio desde que se registraron).
+ * 
+ * @param equipoEnemigo Equipo del que se elige el objetivo
+ * @return Indice del actor objetivo, -1 si no quedan vivos
+ */
+int BatallaEquipos::elegirObjetivo(int equipoEnemigo) {
+    vector<int>& candidatos = vivos[equipoEnemigo];
+    if (candidatos.empty()) {
+        return -1;
+    }
+
+    if (politica == PoliticaObjetivo::MenorHP) {
+        auto& monticulo = menorHP[equipoEnemigo];
+        while (!monticulo.empty()) {
+            const EntradaHP& entrada = monticulo.top();
+            const Actor& actor = actores[entrada.actor];
+            if (actor.posicionEnVivos >= 0 && actor.personaje->getHP() == entrada.hp) {
+                return entrada.actor;
+            }
+            monticulo.pop();
+        }
+    }
+
+    return candidatos[generador() % candidatos.size()];
+}
+
+/**
+ * @brief Implementacion del metodo elegirObjetivoEnRango
+ * 
+ * Consulta solo las celdas de la cuadricula enemiga que tocan el radio.
+ * 
+ * @param atacante Actor que ataca
+ * @param alcance Radio de busqueda en metros
+ * @return Indice del actor objetivo, -1 si ningun enemigo esta a su alcance
+ */
+int BatallaEquipos::elegirObjetivoEnRango(const Actor& atacante, double alcance) {
+    candidatos.clear();
+    cuadricula[1 - atacante.equipo].enRango(atacante.posicion, alcance, candidatos);
+    if (candidatos.empty()) {
+        return -1;
+    }
+
+    if (politica == PoliticaObjetivo::MenorHP) {
+        int elegido = candidatos[0];
+        int menor = actores[elegido].personaje->getHP();
+        for (int candidato : candidatos) {
+            int hp = actores[candidato].personaje->getHP();
+            if (hp < menor || (hp == menor && candidato < elegido)) {
+                menor = hp;
+                elegido = candidato;
+            }
+        }
+        return elegido;
+    }
+    return candidatos[generador() % candidatos.size()];
+}
+
+/**
+ * @brief Implementacion del metodo avanzar
+ * 
+ * Se mueve en linea recta hacia el enemigo mas cercano y se detiene al
+ * quedar a distancia de ataque. El enemigo elegido se conserva mientras
+ * siga vivo, asi que la busqueda del mas cercano (que con el campo vacio
+ * recorre muchas celdas) se hace una vez por objetivo y no en cada paso.
+ * 
+ * @param indice Indice del actor
+ * @return true si se movio, false si no quedan enemigos
+ */
+bool BatallaEquipos::avanzar(int indice) {
+    Actor& actor = actores[indice];
+    int enemigo = actor.objetivoMarcha;
+    if (enemigo < 0 || actores[enemigo].posicionEnVivos < 0) {
+        enemigo = cuadricula[1 - actor.equipo].masCercana(actor.posicion);
+        actor.objetivoMarcha = enemigo;
+    }
+    if (enemigo < 0) {
+        return false;
+    }
+
+    const Posicion& destino = actores[enemigo].posicion;
+    double dx = destino.x - actor.posicion.x;
+    double dy = destino.y - actor.posicion.y;
+    double distancia = sqrt(dx * dx + dy * dy);
+    double paso = min(actor.velocidad, max(0.0, distancia - actor.alcance * 0.9));
+    if (distancia > 0.0) {
+        actor.posicion.x += dx / distancia * paso;
+        actor.posicion.y += dy / distancia * paso;
+    }
+    cuadricula[actor.equipo].mover(indice, actor.posicion);
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo marcarCaido
+ * 
+ * Borra al actor de los vivos de su equipo intercambiandolo con el ultimo.
+ * 
+ * @param indice Indice del actor
+ */
+void BatallaEquipos::marcarCaido(int indice) {
+    Actor& actor = actores[indice];
+    if (actor.posicionEnVivos < 0) {
+        return;
+    }
+
+    vector<int>& equipo = vivos[actor.equipo];
+    int ultimo = equipo.back();
+    equipo[actor.posicionEnVivos] = ultimo;
+    actores[ultimo].posicionEnVivos = actor.posicionEnVivos;
+    equipo.pop_back();
+    actor.posicionEnVivos = -1;
+    if (usaPosiciones) {
+        cuadricula[actor.equipo].quitar(indice);
+    }
+}
+
+/**
+ * @brief Implementacion del metodo actualizarAlcance
+ * 
+ * @param actor Actor a revisar
+ * @return Arma equipada actual (puede ser nullptr)
+ */
+InterfazArmas* BatallaEquipos::actualizarAlcance(Actor& actor) {
+    InterfazArmas* arma = obtenerArmaEquipada(actor);
+    if (arma != actor.armaAlcance) {
+        actor.armaAlcance = arma;
+        actor.alcance = calcularAlcanceArma(arma);
+        actor.alcanceLanzamiento = calcularAlcanceLanzamiento(arma);
+    }
+    return arma;
+}
+
+/**
+ * @brief Implementacion del metodo obtenerArmaEquipada
+ * 
+ * @param actor Actor a consultar
+ * @return Arma equipada del mago o guerrero, nullptr si no tiene
+ */
+InterfazArmas* BatallaEquipos::obtenerArmaEquipada(const Actor& actor) {
+    if (actor.mago) {
+        return actor.mago->getArmaEquipada();
+    }
+    if (actor.guerrero) {
+        return actor.guerrero->getArmaEquipada();
+    }
+    return nullptr;
+}
+
+uint64_t BatallaEquipos::intervalo(int destreza) const {
+    return ESCALA_INICIATIVA / static_cast<uint64_t>(max(destreza, 0) + 1);
+}
+
+/**
+ * @brief Orden de la cola: primero el menor instante; a igual instante, mayor destreza y luego menor indice
+ */
+bool BatallaEquipos::Turno::operator>(const Turno& otro) const {
+    if (instante != otro.instante) return instante > otro.instante;
+    if (destreza != otro.destreza) return destreza < otro.destreza;
+    return actor > otro.actor;
+}
+
+bool BatallaEquipos::EntradaHP::operator>(const EntradaHP& otro) const {
+    if (hp != otro.hp) return hp > otro.hp;
+    return actor > otro.actor;
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstdint>
+#include <queue>
+#include <random>
+#include <vector>
+#include "InterfazPersonaje.hpp"
+#include "CuadriculaEspacial.hpp"
+
+using namespace std;
+
+class Mago;
+class Guerrero;
+
+/**
+ * @enum PoliticaObjetivo
+ * @brief Define como elige cada actor a quien atacar
+ */
+enum class PoliticaObjetivo {
+    Aleatorio,   ///< Cualquier enemigo vivo, elegido al azar
+    MenorHP      ///< El enemigo vivo con menos HP
+};
+
+/**
+ * @brief Resultado de una batalla por equipos
+ */
+struct ResultadoBatalla {
+    int equipoGanador;        ///< 0 o 1, -1 si se alcanzo el limite de acciones
+    long acciones;            ///< Ataques realizados
+    long movimientos;         ///< Turnos usados para acercarse a un enemigo (solo con posiciones)
+    long lanzamientos;        ///< Ataques hechos arrojando el arma, incluidos en acciones (solo con posiciones)
+    int supervivientes[2];    ///< Actores vivos de cada equipo al terminar
+};
+
+/**
+ * @brief Motor de batallas de dos equipos de N personajes
+ *
+ * Los actores actuan segun una cola de iniciativa (monticulo binario): cada
+ * actor tiene un instante de su proxima accion que avanza en
+ * ESCALA_INICIATIVA / (destreza + 1), asi que los mas diestros actuan mas
+ * seguido. Programar el siguiente turno cuesta O(log n). Los actores caidos
+ * se descartan al salir de la cola.
+ *
+ * Cada equipo mantiene sus vivos en un vector con borrado por intercambio,
+ * para elegir un objetivo al azar en O(1), y un monticulo de HP con
+ * entradas vencidas para la politica MenorHP sin posiciones.
+ *
+ * Si los personajes se agregan con posicion, cada equipo se indexa en una
+ * CuadriculaEspacial: en su turno el actor ataca a un enemigo dentro del
+ * alcance de su arma (calcularAlcanceArma); si no hay ninguno pero su arma
+ * se puede arrojar, la lanza a un enemigo dentro de
+ * calcularAlcanceLanzamiento, y si tampoco, avanza hacia el enemigo mas
+ * cercano. Ninguna de las consultas recorre a todos los enemigos. Los
+ * alcances se recalculan cuando el actor cambia de arma equipada.
+ *
+ * Una batalla es con posiciones o sin ellas: no se pueden mezclar
+ * personajes con y sin posicion (los que no tienen posicion nunca estarian
+ * al alcance de nadie).
+ *
+ * Los personajes no pasan a ser propiedad del motor. Sin narracion, la
+ * salida de los personajes (cout y cerr) se silencia durante la batalla.
+ */
+class BatallaEquipos {
+public:
+    /// Unidades de tiempo de iniciativa repartidas segun la destreza
+    static const uint64_t ESCALA_INICIATIVA = 1000000;
+
+    /**
+     * @brief Constructor
+     * @param politica Politica de eleccion de objetivos
+     * @param semilla Semilla del generador (movimientos y objetivos)
+     */
+    explicit BatallaEquipos(PoliticaObjetivo politica = PoliticaObjetivo::Aleatorio, uint64_t semilla = 1);
+
+    /**
+     * @brief Agrega un personaje a un equipo
+     * @param personaje Personaje a agregar (no debe estar ya caido)
+     * @param equipo 0 o 1
+     * @return true si se agrego; false si el equipo es invalido, el personaje es nulo o la batalla usa posiciones
+     */
+    bool agregar(InterfazPersonaje* personaje, int equipo);
+
+    /**
+     * @brief Agrega un personaje a un equipo en una posicion del campo
+     *
+     * Al usar esta sobrecarga la batalla pasa a tener en cuenta posiciones y
+     * alcances, asi que todos los personajes deben agregarse con posicion.
+     *
+     * @param personaje Personaje a agregar
+     * @param equipo 0 o 1
+     * @param posicion Posicion inicial en metros
+     * @return true si se agrego; false tambien si ya hay personajes sin posicion
+     */
+    bool agregar(InterfazPersonaje* personaje, int equipo, const Posicion& posicion);
+
+    /**
+     * @brief Define las dimensiones del campo (antes de agregar personajes con posicion)
+     * @param ancho Ancho del campo en metros
+     * @param alto Alto del campo en metros
+     * @param tamanioCelda Lado de las celdas del indice espacial
+     * @return false si ya hay personajes agregados
+     */
+    bool configurarCampo(double ancho, double alto, double tamanioCelda);
+
+    /**
+     * @brief Obtiene la posicion actual de un actor
+     * @param indice Orden en que se agrego el actor (desde 0)
+     * @return Posicion del actor (solo valida con posiciones)
+     */
+    Posicion getPosicion(int indice) const;
+
+    /**
+     * @brief Ejecuta la batalla hasta que un equipo quede sin actores vivos
+     * @param maxAcciones Limite de ataques (0 = 50 por actor)
+     * @param narrar true para mostrar la salida de los personajes y un resumen por caida
+     * @return Resultado de la batalla
+     */
+    ResultadoBatalla ejecutar(long maxAcciones = 0, bool narrar = false);
+
+    /**
+     * @brief Obtiene la cantidad de actores vivos de un equipo
+     * @param equipo 0 o 1
+     * @return Actores vivos
+     */
+    int getVivos(int equipo) const;
+
+    /**
+     * @brief Obtiene la cantidad total de actores
+     * @return Actores registrados en ambos equipos
+     */
+    size_t getCantidadActores() const;
+
+private:
+    /**
+     * @brief Datos de un participante
+     */
+    struct Actor {
+        InterfazPersonaje* personaje;
+        int equipo;
+        int destreza;
+        int posicionEnVivos;   ///< Indice en vivos[equipo], -1 si cayo
+        Mago* mago;            ///< El personaje como Mago, nullptr si no lo es
+        Guerrero* guerrero;    ///< El personaje como Guerrero, nullptr si no lo es
+        const InterfazArmas* armaAlcance;   ///< Arma equipada con la que se calcularon los alcances
+        double alcance;        ///< Metros hasta donde llega su arma equipada
+        double alcanceLanzamiento;          ///< Metros hasta donde puede arrojarla, 0 si no puede
+        double velocidad;      ///< Metros que avanza por turno
+        Posicion posicion;
+        int objetivoMarcha;    ///< Enemigo hacia el que avanza, -1 si no eligio
+    };
+
+    /**
+     * @brief Entrada de la cola de iniciativa
+     */
+    struct Turno {
+        uint64_t instante;
+        int destreza;
+        int actor;
+        bool operator>(const Turno& otro) const;
+    };
+
+    /**
+     * @brief Entrada del monticulo de HP (puede estar vencida)
+     */
+    struct EntradaHP {
+        int hp;
+        int actor;
+        bool operator>(const EntradaHP& otro) const;
+    };
+
+    /**
+     * @brief Elige el objetivo de un atacante segun la politica
+     * @param equipoEnemigo Equipo del que se elige el objetivo
+     * @return Indice del actor objetivo, -1 si no quedan vivos
+     */
+    int elegirObjetivo(int equipoEnemigo);
+
+    /**
+     * @brief Elige un objetivo dentro de un radio alrededor del atacante segun la politica
+     * @param atacante Actor que ataca
+     * @param alcance Radio de busqueda en metros
+     * @return Indice del actor objetivo, -1 si ningun enemigo esta a su alcance
+     */
+    int elegirObjetivoEnRango(const Actor& atacante, double alcance);
+
+    /**
+     * @brief Recalcula los alcances de un actor si cambio su arma equipada
+     * @param actor Actor a revisar
+     * @return Arma equipada actual (puede ser nullptr)
+     */
+    InterfazArmas* actualizarAlcance(Actor& actor);
+
+    /**
+     * @brief Agrega un actor sin validar el modo de la batalla
+     * @param personaje Personaje a agregar
+     * @param equipo 0 o 1
+     * @return true si se agrego
+     */
+    bool agregarActor(InterfazPersonaje* personaje, int equipo);
+
+    /**
+     * @brief Acerca al actor hacia el enemigo mas cercano
+     * @param indice Indice del actor
+     * @return true si se movio, false si no quedan enemigos
+     */
+    bool avanzar(int indice);
+
+    /**
+     * @brief Quita a un actor caido de los vivos de su equipo
+     * @param indice Indice del actor
+     */
+    void marcarCaido(int indice);
+
+    static InterfazArmas* obtenerArmaEquipada(const Actor& actor);
+    uint64_t intervalo(int destreza) const;
+
+    PoliticaObjetivo politica;
+    mt19937_64 generador;
+    vector<Actor> actores;
+    vector<int> vivos[2];
+    priority_queue<EntradaHP, vector<EntradaHP>, greater<EntradaHP>> menorHP[2];
+    bool usaPosiciones;
+    CuadriculaEspacial cuadricula[2];
+    vector<int> candidatos;
+};
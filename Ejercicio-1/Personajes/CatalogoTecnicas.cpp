@@ -0,0 +1,129 @@
+#include "CatalogoTecnicas.hpp"
+#include <algorithm>
+#include <mutex>
+
+/**
+ * @brief Implementacion del constructor de CatalogoTecnicas
+ */
+CatalogoTecnicas::CatalogoTecnicas() {}
+
+/**
+ * @brief Implementacion del metodo global
+ *
+ * Las dos inicializaciones estaticas son seguras entre hilos: las tecnicas
+ * clasicas se registran una sola vez, antes de devolver el catalogo.
+ */
+CatalogoTecnicas& CatalogoTecnicas::global() {
+    static CatalogoTecnicas catalogo;
+    static const bool clasicasRegistradas = []() {
+        catalogo.registrar(Tecnica{"Golpe del León", 150, 25, 100, 0, 20});
+        catalogo.registrar(Tecnica{"Danza de Redes", 50, 150, 100, 0, 15});
+        catalogo.registrar(Tecnica{"Tridente Giratorio", 100, 100, 50, 2, 18});
+        catalogo.registrar(Tecnica{"Ovación Final", 75, 75, 200, 5, 25});
+        return true;
+    }();
+    (void)clasicasRegistradas;
+    return catalogo;
+}
+
+/**
+ * @brief Implementacion del metodo registrar
+ *
+ * @param tecnica Tecnica a registrar
+ * @return Identificador de la tecnica
+ */
+int CatalogoTecnicas::registrar(const Tecnica& tecnica) {
+    unique_lock<shared_mutex> bloqueo(cerrojo);
+    return registrarBloqueado(tecnica);
+}
+
+int CatalogoTecnicas::buscar(const string& nombre) const {
+    shared_lock<shared_mutex> bloqueo(cerrojo);
+    return buscarBloqueado(nombre);
+}
+
+/**
+ * @brief Implementacion del metodo obtener
+ *
+ * Primero busca con el cerrojo de lectura; si no la encuentra, vuelve a
+ * buscar con el de escritura antes de registrarla, por si otro hilo la
+ * registro en el medio.
+ *
+ * @param nombre Nombre de la tecnica
+ * @return Identificador, -1 si el nombre es vacio
+ */
+int CatalogoTecnicas::obtener(const string& nombre) {
+    if (nombre.empty()) return -1;
+    int id = buscar(nombre);
+    if (id >= 0) return id;
+
+    unique_lock<shared_mutex> bloqueo(cerrojo);
+    id = buscarBloqueado(nombre);
+    return id >= 0 ? id : registrarBloqueado(Tecnica{nombre, 100, 50, 100, 0, 15});
+}
+
+int CatalogoTecnicas::calcularDanio(int id, int fuerza, int destreza, int nivel) const {
+    return calcularDanio(getFormula(id), fuerza, destreza, nivel);
+}
+
+int CatalogoTecnicas::calcularDanio(const FormulaTecnica& formula, int fuerza, int destreza, int nivel) {
+    return (formula.coefFuerza * fuerza + formula.coefDestreza * destreza + formula.coefNivel * nivel) / 100
+        + formula.bonus;
+}
+
+Tecnica CatalogoTecnicas::getTecnica(int id) const {
+    shared_lock<shared_mutex> bloqueo(cerrojo);
+    return tecnicas.at(id);
+}
+
+FormulaTecnica CatalogoTecnicas::getFormula(int id) const {
+    shared_lock<shared_mutex> bloqueo(cerrojo);
+    const Tecnica& tecnica = tecnicas.at(id);
+    return FormulaTecnica{tecnica.coefFuerza, tecnica.coefDestreza, tecnica.coefNivel, tecnica.bonus,
+                          tecnica.costoEstamina};
+}
+
+/**
+ * @brief Implementacion del metodo getNombre
+ *
+ * El deque no mueve sus elementos y registrar nunca reescribe un nombre, asi
+ * que la referencia sigue valida despues de soltar el cerrojo.
+ *
+ * @param id Identificador de la tecnica
+ * @return Nombre de la tecnica
+ */
+const string& CatalogoTecnicas::getNombre(int id) const {
+    shared_lock<shared_mutex> bloqueo(cerrojo);
+    return tecnicas.at(id).nombre;
+}
+
+size_t CatalogoTecnicas::getCantidad() const {
+    shared_lock<shared_mutex> bloqueo(cerrojo);
+    return tecnicas.size();
+}
+
+int CatalogoTecnicas::registrarBloqueado(const Tecnica& tecnica) {
+    Tecnica ajustada = tecnica;
+    ajustada.costoEstamina = max(0, ajustada.costoEstamina);
+
+    auto it = porNombre.find(ajustada.nombre);
+    if (it != porNombre.end()) {
+        // Solo cambia la formula: el nombre puede estar referenciado por getNombre
+        Tecnica& existente = tecnicas[it->second];
+        existente.coefFuerza = ajustada.coefFuerza;
+        existente.coefDestreza = ajustada.coefDestreza;
+        existente.coefNivel = ajustada.coefNivel;
+        existente.bonus = ajustada.bonus;
+        existente.costoEstamina = ajustada.costoEstamina;
+        return it->second;
+    }
+    int id = static_cast<int>(tecnicas.size());
+    tecnicas.push_back(ajustada);
+    porNombre[ajustada.nombre] = id;
+    return id;
+}
+
+int CatalogoTecnicas::buscarBloqueado(const string& nombre) const {
+    auto it = porNombre.find(nombre);
+    return it != porNombre.end() ? it->second : -1;
+}
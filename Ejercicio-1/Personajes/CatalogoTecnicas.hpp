@@ -0,0 +1,147 @@
+#pragma once
+
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+/**
+ * @brief Tecnica especial de gladiador con su formula de daño
+ *
+ * Daño = (coefFuerza * fuerza + coefDestreza * destreza + coefNivel * nivel) / 100
+ *        + bonus + antiguedad de la tecnica para quien la usa.
+ */
+struct Tecnica {
+    string nombre;
+    int coefFuerza;         ///< Porcentaje de la fuerza que suma al daño
+    int coefDestreza;       ///< Porcentaje de la destreza que suma al daño
+    int coefNivel;          ///< Porcentaje del nivel que suma al daño
+    int bonus;              ///< Daño fijo
+    int costoEstamina;
+};
+
+/**
+ * @brief Formula de una tecnica sin su nombre, para copiarla en quien la aprende
+ */
+struct FormulaTecnica {
+    int coefFuerza;
+    int coefDestreza;
+    int coefNivel;
+    int bonus;
+    int costoEstamina;
+};
+
+/**
+ * @brief Catalogo de tecnicas con identificadores numericos
+ *
+ * Cada tecnica se registra una vez; despues se la usa por su identificador,
+ * que es su posicion en el catalogo. El nombre solo se busca (en una tabla
+ * hash) al aprenderla o al usarla por nombre.
+ *
+ * Las tecnicas se guardan en un deque, asi que registrar no mueve las ya
+ * registradas, y un cerrojo de lectura/escritura permite que varios hilos
+ * consulten y registren a la vez. getTecnica devuelve una copia porque
+ * registrar puede reemplazar la formula de una tecnica existente; el nombre
+ * nunca cambia, asi que getNombre puede devolver una referencia.
+ */
+class CatalogoTecnicas {
+public:
+    CatalogoTecnicas();
+
+    CatalogoTecnicas(const CatalogoTecnicas&) = delete;
+    CatalogoTecnicas& operator=(const CatalogoTecnicas&) = delete;
+
+    /**
+     * @brief Catalogo compartido por todos los gladiadores
+     *
+     * Trae algunas tecnicas clasicas de la arena ya registradas.
+     *
+     * @return Catalogo global
+     */
+    static CatalogoTecnicas& global();
+
+    /**
+     * @brief Registra una tecnica (o reemplaza la formula de la que tenga el mismo nombre)
+     * @param tecnica Tecnica a registrar
+     * @return Identificador de la tecnica
+     */
+    int registrar(const Tecnica& tecnica);
+
+    /**
+     * @brief Busca una tecnica por nombre
+     * @param nombre Nombre de la tecnica
+     * @return Identificador, -1 si no esta registrada
+     */
+    int buscar(const string& nombre) const;
+
+    /**
+     * @brief Busca una tecnica o la registra con la formula por defecto
+     *
+     * La formula por defecto es fuerza + destreza / 2 + nivel, con costo 15.
+     * Buscar y registrar ocurren bajo el mismo cerrojo, asi que dos hilos que
+     * piden el mismo nombre reciben el mismo identificador.
+     *
+     * @param nombre Nombre de la tecnica
+     * @return Identificador, -1 si el nombre es vacio
+     */
+    int obtener(const string& nombre);
+
+    /**
+     * @brief Calcula el daño base de una tecnica (sin la antiguedad)
+     * @param id Identificador de la tecnica
+     * @param fuerza Fuerza de quien la usa
+     * @param destreza Destreza de quien la usa
+     * @param nivel Nivel de quien la usa
+     * @return Daño base
+     */
+    int calcularDanio(int id, int fuerza, int destreza, int nivel) const;
+
+    /**
+     * @brief Calcula el daño base con una formula ya copiada
+     * @param formula Formula obtenida con getFormula
+     * @param fuerza Fuerza de quien la usa
+     * @param destreza Destreza de quien la usa
+     * @param nivel Nivel de quien la usa
+     * @return Daño base
+     */
+    static int calcularDanio(const FormulaTecnica& formula, int fuerza, int destreza, int nivel);
+
+    /**
+     * @brief Copia una tecnica del catalogo
+     * @param id Identificador de la tecnica
+     * @return Copia de la tecnica
+     */
+    Tecnica getTecnica(int id) const;
+
+    /**
+     * @brief Copia solo la formula de una tecnica
+     * @param id Identificador de la tecnica
+     * @return Formula de la tecnica
+     */
+    FormulaTecnica getFormula(int id) const;
+
+    /**
+     * @brief Obtiene el nombre de una tecnica sin copiarlo
+     * @param id Identificador de la tecnica
+     * @return Nombre, valido mientras exista el catalogo
+     */
+    const string& getNombre(int id) const;
+    size_t getCantidad() const;
+
+private:
+    /**
+     * @brief Registra una tecnica con el cerrojo de escritura tomado
+     */
+    int registrarBloqueado(const Tecnica& tecnica);
+
+    /**
+     * @brief Busca una tecnica con algun cerrojo tomado
+     */
+    int buscarBloqueado(const string& nombre) const;
+
+    mutable shared_mutex cerrojo;
+    deque<Tecnica> tecnicas;
+    unordered_map<string, int> porNombre;
+};
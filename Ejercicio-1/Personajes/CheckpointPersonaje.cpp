@@ -0,0 +1,105 @@
+#include "CheckpointPersonaje.hpp"
+#include <cstring>
+
+/**
+ * @brief Implementación de calcularDelta
+ *
+ * @param antes Checkpoint inicial
+ * @param despues Checkpoint final
+ * @return Delta con (después - antes) para cada campo
+ */
+DeltaPersonaje calcularDelta(const CheckpointPersonaje& antes, const CheckpointPersonaje& despues) {
+    DeltaPersonaje delta{};
+    delta.hpActual = despues.hpActual - antes.hpActual;
+    delta.hpMax = despues.hpMax - antes.hpMax;
+    delta.recursoActual = despues.recursoActual - antes.recursoActual;
+    delta.fuerza = despues.fuerza - antes.fuerza;
+    delta.destreza = despues.destreza - antes.destreza;
+    delta.constitucion = despues.constitucion - antes.constitucion;
+    delta.inteligencia = despues.inteligencia - antes.inteligencia;
+    delta.armaEquipadaPos = despues.armaEquipadaPos - antes.armaEquipadaPos;
+    delta.cantidadHechizos = despues.cantidadHechizos - antes.cantidadHechizos;
+
+    for (int i = 0; i < MAX_ESTADO_CLASE; ++i) {
+        delta.estadoClase[i] = despues.estadoClase[i] - antes.estadoClase[i];
+    }
+
+    for (int i = 0; i < MAX_ARMAS_CHECKPOINT; ++i) {
+        const CheckpointArma& a = antes.armas[i];
+        const CheckpointArma& d = despues.armas[i];
+        delta.durabilidadArmas[i] = d.durabilidadActual - a.durabilidadActual;
+        delta.filoArmas[i] = d.nivelFilo - a.nivelFilo;
+        delta.energiaArmas[i] = d.energiaArcanaActual - a.energiaArcanaActual;
+        delta.dosisArmas[i] = d.dosisRestantes - a.dosisRestantes;
+        delta.potenciaArmas[i] = d.potenciaEfecto - a.potenciaEfecto;
+        delta.efectoArmas[i] = d.efectoPocion - a.efectoPocion;
+        delta.hechizosArmas[i] = d.cantidadHechizos - a.cantidadHechizos;
+        delta.sintonizacionArmas[i] = static_cast<int>(d.estaSintonizado) - static_cast<int>(a.estaSintonizado);
+        delta.preparacionArmas[i] = static_cast<int>(d.preparadaContraCarga) - static_cast<int>(a.preparadaContraCarga);
+    }
+
+    return delta;
+}
+
+/**
+ * @brief Implementación de aplicarDelta
+ *
+ * @param base Checkpoint de partida
+ * @param delta Delta a sumar
+ * @return Checkpoint resultante
+ */
+CheckpointPersonaje aplicarDelta(const CheckpointPersonaje& base, const DeltaPersonaje& delta) {
+    CheckpointPersonaje resultado = base;
+    resultado.hpActual += delta.hpActual;
+    resultado.hpMax += delta.hpMax;
+    resultado.recursoActual += delta.recursoActual;
+    resultado.fuerza += delta.fuerza;
+    resultado.destreza += delta.destreza;
+    resultado.constitucion += delta.constitucion;
+    resultado.inteligencia += delta.inteligencia;
+    resultado.armaEquipadaPos += delta.armaEquipadaPos;
+    resultado.cantidadHechizos += delta.cantidadHechizos;
+
+    for (int i = 0; i < MAX_ESTADO_CLASE; ++i) {
+        resultado.estadoClase[i] += delta.estadoClase[i];
+    }
+
+    for (int i = 0; i < MAX_ARMAS_CHECKPOINT; ++i) {
+        CheckpointArma& arma = resultado.armas[i];
+        arma.durabilidadActual += delta.durabilidadArmas[i];
+        arma.nivelFilo += delta.filoArmas[i];
+        arma.energiaArcanaActual += delta.energiaArmas[i];
+        arma.dosisRestantes += delta.dosisArmas[i];
+        arma.potenciaEfecto += delta.potenciaArmas[i];
+        arma.efectoPocion += delta.efectoArmas[i];
+        arma.cantidadHechizos += delta.hechizosArmas[i];
+        arma.estaSintonizado = (static_cast<int>(arma.estaSintonizado) + delta.sintonizacionArmas[i]) > 0;
+        arma.preparadaContraCarga = (static_cast<int>(arma.preparadaContraCarga) + delta.preparacionArmas[i]) > 0;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Implementación de deltaVacio
+ *
+ * @param delta Delta a inspeccionar
+ * @return true si todos los campos son 0
+ */
+bool deltaVacio(const DeltaPersonaje& delta) {
+    // DeltaPersonaje solo contiene enteros (sin relleno), así que se compara en bloque
+    static const DeltaPersonaje vacio{};
+    return memcmp(&delta, &vacio, sizeof(DeltaPersonaje)) == 0;
+}
+
+/**
+ * @brief Implementación de mezclarFirma
+ *
+ * @param firma Firma acumulada hasta ahora
+ * @param valor Valor a agregar
+ * @return Firma nueva
+ */
+uint64_t mezclarFirma(uint64_t firma, long long valor) {
+    uint64_t h = (firma ^ static_cast<uint64_t>(valor)) * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 31);
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "../Arma/InterfazArmas.hpp"
+
+using namespace std;
+
+/// Cantidad de armas que entra en un checkpoint (igual al inventario máximo)
+static const int MAX_ARMAS_CHECKPOINT = 2;
+
+/// Cantidad de valores propios de cada subclase que entran en un checkpoint
+static const int MAX_ESTADO_CLASE = 4;
+
+/**
+ * @brief Estado mutable completo de un personaje, guardado como POD
+ *
+ * Guardar y restaurar es copiar unos cien bytes: no hay memoria dinámica ni
+ * textos. Sirve para simular miles de combates hipotéticos sobre el mismo
+ * personaje volviendo siempre al mismo punto, sin recrearlo con la fábrica.
+ *
+ * El recurso es maná para magos y estamina para guerreros. estadoClase guarda
+ * los contadores propios de cada subclase (furia, fe, filacteria, oro...) en
+ * el orden que define cada una. Las listas de textos se guardan como su
+ * longitud y al restaurar se descartan los elementos agregados después del
+ * checkpoint. La composición del inventario no se restaura: las armas se
+ * emparejan por posición y solo se restaura su estado.
+ */
+struct CheckpointPersonaje {
+    size_t tipoDinamico;      ///< hash_code del tipo concreto, para rechazar checkpoints ajenos
+    int hpActual;
+    int hpMax;
+    int recursoActual;
+    int fuerza;
+    int destreza;
+    int constitucion;
+    int inteligencia;
+    int armaEquipadaPos;
+    int cantidadHechizos;     ///< Solo magos
+    int cantidadArmas;
+    int estadoClase[MAX_ESTADO_CLASE];
+    CheckpointArma armas[MAX_ARMAS_CHECKPOINT];
+};
+
+/**
+ * @brief Diferencia campo a campo entre dos checkpoints de un personaje
+ *
+ * Cada valor es (después - antes). Los booleanos de las armas se expresan
+ * como -1, 0 o 1.
+ */
+struct DeltaPersonaje {
+    int hpActual;
+    int hpMax;
+    int recursoActual;
+    int fuerza;
+    int destreza;
+    int constitucion;
+    int inteligencia;
+    int armaEquipadaPos;
+    int cantidadHechizos;
+    int estadoClase[MAX_ESTADO_CLASE];
+    int durabilidadArmas[MAX_ARMAS_CHECKPOINT];
+    int filoArmas[MAX_ARMAS_CHECKPOINT];
+    int energiaArmas[MAX_ARMAS_CHECKPOINT];
+    int dosisArmas[MAX_ARMAS_CHECKPOINT];
+    int potenciaArmas[MAX_ARMAS_CHECKPOINT];
+    int efectoArmas[MAX_ARMAS_CHECKPOINT];
+    int hechizosArmas[MAX_ARMAS_CHECKPOINT];
+    int sintonizacionArmas[MAX_ARMAS_CHECKPOINT];
+    int preparacionArmas[MAX_ARMAS_CHECKPOINT];
+};
+
+/**
+ * @brief Calcula la diferencia entre dos checkpoints del mismo personaje
+ * @param antes Checkpoint inicial
+ * @param despues Checkpoint final
+ * @return Delta con (después - antes) para cada campo
+ */
+DeltaPersonaje calcularDelta(const CheckpointPersonaje& antes, const CheckpointPersonaje& despues);
+
+/**
+ * @brief Aplica un delta a un checkpoint
+ * @param base Checkpoint de partida
+ * @param delta Delta a sumar
+ * @return Checkpoint resultante, listo para restaurarCheckpoint
+ */
+CheckpointPersonaje aplicarDelta(const CheckpointPersonaje& base, const DeltaPersonaje& delta);
+
+/**
+ * @brief Indica si un delta no contiene cambios
+ * @param delta Delta a inspeccionar
+ * @return true si todos los campos son 0
+ */
+bool deltaVacio(const DeltaPersonaje& delta);
+
+/**
+ * @brief Agrega un valor a una firma de estado
+ *
+ * Sirve para resumir en un entero los campos de los que depende un cálculo
+ * y detectar que alguno cambió sin guardar una copia de todos.
+ *
+ * @param firma Firma acumulada hasta ahora
+ * @param valor Valor a agregar
+ * @return Firma nueva
+ */
+uint64_t mezclarFirma(uint64_t firma, long long valor);
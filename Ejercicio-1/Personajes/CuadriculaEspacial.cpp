@@ -0,0 +1,259 @@
+#include "CuadriculaEspacial.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "../Arma/ArmasDeCombate/Lanza.hpp"
+#include "../Arma/ArmasDeCombate/Espada.hpp"
+#include "../Arma/ArmasDeCombate/HachaSimple.hpp"
+#include "../Arma/ItemsMagico/Baston.hpp"
+
+/**
+ * @brief Implementacion de distanciaCuadrada
+ *
+ * @param a Primera posicion
+ * @param b Segunda posicion
+ * @return Distancia al cuadrado
+ */
+double distanciaCuadrada(const Posicion& a, const Posicion& b) {
+    double dx = a.x - b.x;
+    double dy = a.y - b.y;
+    return dx * dx + dy * dy;
+}
+
+/**
+ * @brief Implementacion de calcularAlcanceArma
+ *
+ * @param arma Arma equipada (puede ser nullptr)
+ * @return Alcance en metros
+ */
+double calcularAlcanceArma(const InterfazArmas* arma) {
+    if (!arma) {
+        return 1.0;
+    }
+    if (auto lanza = dynamic_cast<const Lanza*>(arma)) {
+        return lanza->getLongitudAsta() + ALCANCE_BRAZO;
+    }
+    if (auto espada = dynamic_cast<const Espada*>(arma)) {
+        return espada->getLongitudHoja() + ALCANCE_BRAZO;
+    }
+    if (auto hacha = dynamic_cast<const HachaSimple*>(arma)) {
+        return hacha->getLongitudMango() + ALCANCE_BRAZO;
+    }
+    if (auto baston = dynamic_cast<const Baston*>(arma)) {
+        return 4.0 + 2.0 * baston->getNivelEncantamiento();
+    }
+    return 1.5;
+}
+
+/**
+ * @brief Implementacion de calcularAlcanceLanzamiento
+ *
+ * @param arma Arma equipada (puede ser nullptr)
+ * @return Alcance en metros, 0 si el arma no se puede arrojar
+ */
+double calcularAlcanceLanzamiento(const InterfazArmas* arma) {
+    auto hacha = dynamic_cast<const HachaSimple*>(arma);
+    if (!hacha || !hacha->puedeArrojarse() || hacha->getDurabilidadActual() <= 0) {
+        return 0.0;
+    }
+    return ALCANCE_LANZAMIENTO_HACHA;
+}
+
+// ==========================================
+// CUADRICULA ESPACIAL
+// ==========================================
+
+/**
+ * @brief Implementacion del constructor de CuadriculaEspacial
+ *
+ * @param ancho Ancho del campo en metros
+ * @param alto Alto del campo en metros
+ * @param tamanioCelda Lado de cada celda en metros
+ */
+CuadriculaEspacial::CuadriculaEspacial(double ancho, double alto, double tamanioCelda)
+    : tamanioCelda(max(tamanioCelda, 0.001)),
+      columnas(max(1, static_cast<int>(ceil(ancho / this->tamanioCelda)))),
+      filas(max(1, static_cast<int>(ceil(alto / this->tamanioCelda)))),
+      celdas(static_cast<size_t>(columnas) * filas),
+      cantidad(0) {}
+
+/**
+ * @brief Implementacion del metodo insertar
+ *
+ * Si la unidad ya estaba insertada equivale a moverla.
+ *
+ * @param id Identificador de la unidad
+ * @param posicion Posicion inicial
+ */
+void CuadriculaEspacial::insertar(int id, const Posicion& posicion) {
+    if (id < 0) return;
+    if (static_cast<size_t>(id) >= ubicaciones.size()) {
+        ubicaciones.resize(id + 1, Ubicacion{{0.0, 0.0}, -1, -1});
+    }
+    if (ubicaciones[id].celda >= 0) {
+        mover(id, posicion);
+        return;
+    }
+    ubicaciones[id].posicion = posicion;
+    agregarACelda(id, celdaDe(posicion));
+    ++cantidad;
+}
+
+/**
+ * @brief Implementacion del metodo mover
+ *
+ * Solo toca las celdas si la unidad cambio de celda.
+ *
+ * @param id Identificador de la unidad
+ * @param posicion Nueva posicion
+ */
+void CuadriculaEspacial::mover(int id, const Posicion& posicion) {
+    if (!contiene(id)) return;
+    ubicaciones[id].posicion = posicion;
+    int nueva = celdaDe(posicion);
+    if (nueva != ubicaciones[id].celda) {
+        quitarDeCelda(id);
+        agregarACelda(id, nueva);
+    }
+}
+
+/**
+ * @brief Implementacion del metodo quitar
+ *
+ * @param id Identificador de la unidad
+ */
+void CuadriculaEspacial::quitar(int id) {
+    if (!contiene(id)) return;
+    quitarDeCelda(id);
+    ubicaciones[id].celda = -1;
+    --cantidad;
+}
+
+/**
+ * @brief Implementacion del metodo masCercana
+ *
+ * Una celda del anillo r esta, como minimo, a (r - 1) celdas completas del
+ * punto de consulta; cuando esa distancia supera a la mejor encontrada, no
+ * hace falta seguir.
+ *
+ * @param origen Punto de consulta
+ * @param radioMaximo Distancia maxima de busqueda (negativo = sin limite)
+ * @return Identificador de la unidad, -1 si no hay ninguna
+ */
+int CuadriculaEspacial::masCercana(const Posicion& origen, double radioMaximo) const {
+    if (cantidad == 0) return -1;
+
+    const int cx = columnaDe(origen.x);
+    const int cy = filaDe(origen.y);
+    int maxAnillo = max(columnas, filas);
+    if (radioMaximo >= 0.0) {
+        maxAnillo = min(maxAnillo, static_cast<int>(ceil(radioMaximo / tamanioCelda)) + 1);
+    }
+
+    int mejor = -1;
+    double mejorDistancia = numeric_limits<double>::max();
+
+    auto revisarCelda = [&](int columna, int fila) {
+        if (columna < 0 || columna >= columnas || fila < 0 || fila >= filas) return;
+        for (int id : celdas[static_cast<size_t>(fila) * columnas + columna]) {
+            double d = distanciaCuadrada(origen, ubicaciones[id].posicion);
+            if (d < mejorDistancia || (d == mejorDistancia && id < mejor)) {
+                mejorDistancia = d;
+                mejor = id;
+            }
+        }
+    };
+
+    for (int r = 0; r <= maxAnillo; ++r) {
+        if (mejor >= 0) {
+            double cota = (r - 1) * tamanioCelda;
+            if (cota > 0.0 && cota * cota > mejorDistancia) break;
+        }
+        if (r == 0) {
+            revisarCelda(cx, cy);
+            continue;
+        }
+        for (int dx = -r; dx <= r; ++dx) {
+            revisarCelda(cx + dx, cy - r);
+            revisarCelda(cx + dx, cy + r);
+        }
+        for (int dy = -r + 1; dy <= r - 1; ++dy) {
+            revisarCelda(cx - r, cy + dy);
+            revisarCelda(cx + r, cy + dy);
+        }
+    }
+
+    if (mejor >= 0 && radioMaximo >= 0.0 && mejorDistancia > radioMaximo * radioMaximo) {
+        return -1;
+    }
+    return mejor;
+}
+
+/**
+ * @brief Implementacion del metodo enRango
+ *
+ * @param origen Punto de consulta
+ * @param radio Radio de busqueda
+ * @param salida Vector donde se agregan los identificadores
+ */
+void CuadriculaEspacial::enRango(const Posicion& origen, double radio, vector<int>& salida) const {
+    if (cantidad == 0 || radio < 0.0) return;
+
+    const double radioCuadrado = radio * radio;
+    const int columnaMin = columnaDe(origen.x - radio);
+    const int columnaMax = columnaDe(origen.x + radio);
+    const int filaMin = filaDe(origen.y - radio);
+    const int filaMax = filaDe(origen.y + radio);
+
+    for (int fila = filaMin; fila <= filaMax; ++fila) {
+        for (int columna = columnaMin; columna <= columnaMax; ++columna) {
+            for (int id : celdas[static_cast<size_t>(fila) * columnas + columna]) {
+                if (distanciaCuadrada(origen, ubicaciones[id].posicion) <= radioCuadrado) {
+                    salida.push_back(id);
+                }
+            }
+        }
+    }
+}
+
+bool CuadriculaEspacial::contiene(int id) const {
+    return id >= 0 && static_cast<size_t>(id) < ubicaciones.size() && ubicaciones[id].celda >= 0;
+}
+
+const Posicion& CuadriculaEspacial::getPosicion(int id) const { return ubicaciones[id].posicion; }
+size_t CuadriculaEspacial::getCantidad() const { return cantidad; }
+
+int CuadriculaEspacial::celdaDe(const Posicion& posicion) const {
+    return filaDe(posicion.y) * columnas + columnaDe(posicion.x);
+}
+
+int CuadriculaEspacial::columnaDe(double x) const {
+    return clamp(static_cast<int>(floor(x / tamanioCelda)), 0, columnas - 1);
+}
+
+int CuadriculaEspacial::filaDe(double y) const {
+    return clamp(static_cast<int>(floor(y / tamanioCelda)), 0, filas - 1);
+}
+
+void CuadriculaEspacial::agregarACelda(int id, int celda) {
+    vector<int>& contenido = celdas[celda];
+    ubicaciones[id].celda = celda;
+    ubicaciones[id].ranura = static_cast<int>(contenido.size());
+    contenido.push_back(id);
+}
+
+/**
+ * @brief Implementacion del metodo quitarDeCelda
+ *
+ * Borra por intercambio con el ultimo de la celda y actualiza su ranura.
+ *
+ * @param id Identificador de la unidad
+ */
+void CuadriculaEspacial::quitarDeCelda(int id) {
+    Ubicacion& ubicacion = ubicaciones[id];
+    vector<int>& contenido = celdas[ubicacion.celda];
+    int ultimo = contenido.back();
+    contenido[ubicacion.ranura] = ultimo;
+    ubicaciones[ultimo].ranura = ubicacion.ranura;
+    contenido.pop_back();
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <vector>
+#include "../Arma/InterfazArmas.hpp"
+
+using namespace std;
+
+/**
+ * @brief Posicion de un personaje en el campo de batalla, en metros
+ */
+struct Posicion {
+    double x;
+    double y;
+};
+
+/**
+ * @brief Calcula la distancia al cuadrado entre dos posiciones
+ * @param a Primera posicion
+ * @param b Segunda posicion
+ * @return Distancia al cuadrado
+ */
+double distanciaCuadrada(const Posicion& a, const Posicion& b);
+
+/**
+ * @brief Calcula el alcance de un ataque normal con un arma
+ *
+ * - Sin arma: 1 m (cuerpo a cuerpo).
+ * - Lanza: longitud del asta mas el brazo (0.7 m).
+ * - Espada: longitud de la hoja mas el brazo.
+ * - HachaSimple: longitud del mango mas el brazo, sea o no arrojadiza; el
+ *   alcance de un lanzamiento lo da calcularAlcanceLanzamiento.
+ * - Baston: 4 m mas 2 m por nivel de encantamiento (hechizos a distancia).
+ * - Resto de armas: 1.5 m.
+ *
+ * @param arma Arma equipada (puede ser nullptr)
+ * @return Alcance en metros
+ */
+double calcularAlcanceArma(const InterfazArmas* arma);
+
+/**
+ * @brief Calcula hasta donde se puede arrojar un arma
+ *
+ * Solo se arroja una HachaSimple arrojadiza que no este rota, a
+ * ALCANCE_LANZAMIENTO_HACHA; lanzar() no define una distancia, asi que se
+ * usa un valor fijo.
+ *
+ * @param arma Arma equipada (puede ser nullptr)
+ * @return Alcance en metros, 0 si el arma no se puede arrojar
+ */
+double calcularAlcanceLanzamiento(const InterfazArmas* arma);
+
+/// Distancia a la que se arroja un hacha simple, en metros
+static const double ALCANCE_LANZAMIENTO_HACHA = 8.0;
+
+/// Largo del brazo que se suma a las armas de mano, en metros
+static const double ALCANCE_BRAZO = 0.7;
+
+/**
+ * @brief Indice espacial de cuadricula uniforme
+ *
+ * Divide un campo rectangular en celdas cuadradas; cada celda guarda los
+ * identificadores de las unidades que contiene. Insertar, mover y quitar
+ * son O(1) (borrado por intercambio dentro de la celda). Las consultas
+ * recorren solo las celdas que tocan el radio buscado, asi que con una
+ * densidad acotada cuestan O(1) por consulta en vez de recorrer todas las
+ * unidades.
+ *
+ * Las posiciones fuera del campo se asignan a la celda del borde mas
+ * cercana; las distancias se calculan siempre con la posicion real.
+ */
+class CuadriculaEspacial {
+public:
+    /**
+     * @brief Constructor
+     * @param ancho Ancho del campo en metros
+     * @param alto Alto del campo en metros
+     * @param tamanioCelda Lado de cada celda en metros
+     */
+    CuadriculaEspacial(double ancho = 1000.0, double alto = 1000.0, double tamanioCelda = 10.0);
+
+    /**
+     * @brief Inserta una unidad
+     * @param id Identificador (no negativo) de la unidad
+     * @param posicion Posicion inicial
+     */
+    void insertar(int id, const Posicion& posicion);
+
+    /**
+     * @brief Mueve una unidad ya insertada
+     * @param id Identificador de la unidad
+     * @param posicion Nueva posicion
+     */
+    void mover(int id, const Posicion& posicion);
+
+    /**
+     * @brief Quita una unidad de la cuadricula
+     * @param id Identificador de la unidad
+     */
+    void quitar(int id);
+
+    /**
+     * @brief Busca la unidad mas cercana a un punto
+     *
+     * Recorre anillos de celdas alrededor del punto y se detiene cuando el
+     * siguiente anillo ya no puede contener una unidad mas cercana.
+     *
+     * @param origen Punto de consulta
+     * @param radioMaximo Distancia maxima de busqueda (negativo = sin limite)
+     * @return Identificador de la unidad, -1 si no hay ninguna
+     */
+    int masCercana(const Posicion& origen, double radioMaximo = -1.0) const;
+
+    /**
+     * @brief Obtiene las unidades a una distancia menor o igual al radio
+     * @param origen Punto de consulta
+     * @param radio Radio de busqueda
+     * @param salida Vector donde se agregan los identificadores (no se vacia)
+     */
+    void enRango(const Posicion& origen, double radio, vector<int>& salida) const;
+
+    /**
+     * @brief Indica si una unidad esta en la cuadricula
+     * @param id Identificador de la unidad
+     * @return true si esta insertada
+     */
+    bool contiene(int id) const;
+
+    const Posicion& getPosicion(int id) const;
+    size_t getCantidad() const;
+
+private:
+    /**
+     * @brief Ubicacion de una unidad dentro de la cuadricula
+     */
+    struct Ubicacion {
+        Posicion posicion;
+        int celda;        ///< -1 si la unidad no esta insertada
+        int ranura;       ///< Indice dentro de celdas[celda]
+    };
+
+    int celdaDe(const Posicion& posicion) const;
+    int columnaDe(double x) const;
+    int filaDe(double y) const;
+    void agregarACelda(int id, int celda);
+    void quitarDeCelda(int id);
+
+    double tamanioCelda;
+    int columnas;
+    int filas;
+    vector<vector<int>> celdas;
+    vector<Ubicacion> ubicaciones;
+    size_t cantidad;
+};
@@ -0,0 +1,225 @@
+#include "EfectosTemporales.hpp"
+#include <algorithm>
+#include "Mago.hpp"
+#include "Guerrero.hpp"
+
+/**
+ * @brief Implementacion del constructor de EfectosTemporales
+ *
+ * @param capacidad Personajes y temporizadores para los que se reserva memoria
+ */
+EfectosTemporales::EfectosTemporales(size_t capacidad)
+    : rueda(capacidad) {
+    registro.reservar(capacidad);
+    pilas.reserve(capacidad);
+    invisibilidades.reserve(capacidad);
+    venenos.reserve(capacidad);
+    venenoRestante.reserve(capacidad);
+    ticksVeneno.reserve(capacidad);
+}
+
+/**
+ * @brief Implementacion del metodo registrar
+ *
+ * @param personaje Personaje a registrar
+ * @return Indice del personaje, -1 si es nulo
+ */
+int EfectosTemporales::registrar(InterfazPersonaje* personaje) {
+    int indice = registro.registrar(personaje);
+    if (indice < 0) {
+        return -1;
+    }
+    pilas.push_back(pilaModificadoresDe(personaje));
+    invisibilidades.push_back(0);
+    venenos.push_back(IdTemporizador{0xFFFFFFFFu, 0});
+    venenoRestante.push_back(0);
+    ticksVeneno.push_back(0);
+    return indice;
+}
+
+/**
+ * @brief Implementacion del metodo beberPocion
+ *
+ * @param indice Personaje que bebe
+ * @param pocion Pocion a beber
+ * @param duracion Ticks que dura el efecto
+ * @return true si habia dosis y se aplico el efecto
+ */
+bool EfectosTemporales::beberPocion(int indice, Pocion& pocion, uint32_t duracion) {
+    if (!registro.esValido(indice) || pocion.estaVacia()) {
+        return false;
+    }
+
+    InterfazPersonaje* personaje = registro.get(indice);
+    const int potencia = pocion.getPotenciaEfecto();
+    const bool instantanea = pocion.getEsPermanente() || duracion == 0;
+    pocion.usar();
+
+    switch (pocion.getEfecto()) {
+        case EfectoPocion::Curacion:
+            personaje->curar(potencia);
+            break;
+        case EfectoPocion::Mana:
+            if (auto mago = dynamic_cast<Mago*>(personaje)) {
+                mago->recuperarMana(potencia);
+            }
+            break;
+        case EfectoPocion::Fuerza:
+            agregarBuff(indice, AtributoPersonaje::Fuerza, potencia, instantanea ? 0 : duracion);
+            break;
+        case EfectoPocion::Agilidad:
+            agregarBuff(indice, AtributoPersonaje::Destreza, potencia, instantanea ? 0 : duracion);
+            break;
+        case EfectoPocion::Invisibilidad:
+            ++invisibilidades[indice];
+            if (!instantanea) {
+                rueda.programar(duracion, indice, static_cast<int>(TipoEfectoTemporal::FinInvisibilidad), 1);
+            }
+            break;
+        case EfectoPocion::Veneno:
+            if (instantanea) {
+                personaje->recibirDanio(potencia, false);
+            } else {
+                curarVeneno(indice);
+                venenoRestante[indice] = max(potencia, 0);
+                ticksVeneno[indice] = static_cast<int>(duracion);
+                venenos[indice] = rueda.programar(1, indice, static_cast<int>(TipoEfectoTemporal::Veneno), 0,
+                                                  1, static_cast<int>(duracion));
+            }
+            break;
+        case EfectoPocion::Antidoto:
+            curarVeneno(indice);
+            break;
+    }
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo programarDanioPeriodico
+ *
+ * @param indice Personaje afectado
+ * @param danio Daño por tick
+ * @param periodo Ticks entre aplicaciones
+ * @param repeticiones Cantidad de aplicaciones
+ * @return Identificador para cancelarlo; invalido si el indice no esta registrado
+ */
+IdTemporizador EfectosTemporales::programarDanioPeriodico(int indice, int danio, uint32_t periodo, int repeticiones) {
+    if (!registro.esValido(indice)) {
+        return IdTemporizador{0xFFFFFFFFu, 0};
+    }
+    periodo = max<uint32_t>(periodo, 1);
+    return rueda.programar(periodo, indice, static_cast<int>(TipoEfectoTemporal::DanioPeriodico), danio,
+                           periodo, max(repeticiones, 1));
+}
+
+/**
+ * @brief Implementacion del metodo programarRegeneracion
+ *
+ * @param indice Personaje afectado
+ * @param cantidad Recurso recuperado por aplicacion
+ * @param periodo Ticks entre aplicaciones
+ * @return Identificador para cancelarla; invalido si el indice no esta registrado
+ */
+IdTemporizador EfectosTemporales::programarRegeneracion(int indice, int cantidad, uint32_t periodo) {
+    if (!registro.esValido(indice)) {
+        return IdTemporizador{0xFFFFFFFFu, 0};
+    }
+    periodo = max<uint32_t>(periodo, 1);
+    return rueda.programar(periodo, indice, static_cast<int>(TipoEfectoTemporal::Regeneracion), cantidad, periodo);
+}
+
+bool EfectosTemporales::cancelar(IdTemporizador id) {
+    return rueda.cancelar(id);
+}
+
+/**
+ * @brief Implementacion del metodo avanzar
+ *
+ * @return Cantidad de efectos aplicados
+ */
+size_t EfectosTemporales::avanzar() {
+    vencidos.clear();
+    size_t cantidad = rueda.avanzar(vencidos);
+    for (const EventoTemporizador& evento : vencidos) {
+        aplicar(evento);
+    }
+    return cantidad;
+}
+
+bool EfectosTemporales::estaInvisible(int indice) const { return invisibilidades.at(indice) > 0; }
+uint64_t EfectosTemporales::getTickActual() const { return rueda.getTickActual(); }
+size_t EfectosTemporales::getEfectosPendientes() const { return rueda.getPendientes(); }
+
+/**
+ * @brief Implementacion del metodo agregarBuff
+ *
+ * El id del modificador viaja como valor del temporizador.
+ *
+ * @param indice Personaje afectado
+ * @param atributo Atributo que sube
+ * @param potencia Puntos planos
+ * @param duracion Ticks que dura; 0 para que no venza
+ */
+void EfectosTemporales::agregarBuff(int indice, AtributoPersonaje atributo, int potencia, uint32_t duracion) {
+    PilaModificadores* pila = pilas[indice];
+    if (!pila) {
+        return;
+    }
+    int id = pila->agregar(Modificador{atributo, OrigenModificador::Buff, potencia, 0});
+    if (duracion > 0) {
+        rueda.programar(duracion, indice, static_cast<int>(TipoEfectoTemporal::FinBuff), id);
+    }
+}
+
+void EfectosTemporales::curarVeneno(int indice) {
+    rueda.cancelar(venenos[indice]);
+    venenoRestante[indice] = 0;
+    ticksVeneno[indice] = 0;
+}
+
+/**
+ * @brief Implementacion del metodo aplicar
+ *
+ * Los personajes caidos no reciben daño periodico ni regeneracion.
+ *
+ * @param evento Evento entregado por la rueda
+ */
+void EfectosTemporales::aplicar(const EventoTemporizador& evento) {
+    InterfazPersonaje* personaje = registro.get(evento.objetivo);
+    switch (static_cast<TipoEfectoTemporal>(evento.tipo)) {
+        case TipoEfectoTemporal::FinBuff:
+            // Si alguien limpio la pila antes, el id ya no esta y no pasa nada
+            pilas[evento.objetivo]->quitar(evento.valor);
+            break;
+        case TipoEfectoTemporal::FinInvisibilidad:
+            --invisibilidades[evento.objetivo];
+            break;
+        case TipoEfectoTemporal::DanioPeriodico:
+            if (personaje->getHP() > 0) {
+                personaje->recibirDanio(evento.valor, false);
+            }
+            break;
+        case TipoEfectoTemporal::Veneno: {
+            // Redondear hacia arriba lo que falta reparte el resto en los primeros ticks
+            int& ticks = ticksVeneno[evento.objetivo];
+            int& restante = venenoRestante[evento.objetivo];
+            int danio = ticks > 0 ? (restante + ticks - 1) / ticks : restante;
+            restante -= danio;
+            --ticks;
+            if (danio > 0 && personaje->getHP() > 0) {
+                personaje->recibirDanio(danio, false);
+            }
+            break;
+        }
+        case TipoEfectoTemporal::Regeneracion:
+            if (personaje->getHP() <= 0) {
+                break;
+            }
+            if (auto guerrero = dynamic_cast<Guerrero*>(personaje)) {
+                guerrero->recuperarEstamina(evento.valor);
+            } else if (auto mago = dynamic_cast<Mago*>(personaje)) {
+                mago->recuperarMana(evento.valor);
+            }
+            break;
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <vector>
+#include "InterfazPersonaje.hpp"
+#include "RuedaTemporizadores.hpp"
+#include "PilaModificadores.hpp"
+#include "RegistroCombatientes.hpp"
+#include "../Arma/ItemsMagico/Pocion.hpp"
+
+using namespace std;
+
+/**
+ * @enum TipoEfectoTemporal
+ * @brief Define que hace un temporizador al vencer
+ */
+enum class TipoEfectoTemporal {
+    FinBuff,              ///< Quita de la pila el modificador cuyo id trae el evento
+    FinInvisibilidad,     ///< Termina una invisibilidad
+    DanioPeriodico,       ///< Aplica daño en cada vencimiento (maldiciones, trampas)
+    Veneno,               ///< Aplica el siguiente tick del veneno activo
+    Regeneracion          ///< Recupera estamina (guerreros) o mana (magos)
+};
+
+/**
+ * @brief Duraciones, buffs, daño periodico y regeneracion de muchos personajes
+ *
+ * Cada personaje registrado recibe un indice; su invisibilidad y su veneno
+ * se guardan en vectores paralelos a ese indice y los vencimientos se
+ * programan en una RuedaTemporizadores. Avanzar un tick solo procesa los
+ * efectos que vencen en ese tick, sin recorrer a todos los personajes.
+ *
+ * Los bonus de fuerza y destreza entran como modificadores de origen Buff
+ * en la PilaModificadores del personaje, asi que los ven getFuerza,
+ * getDestreza, el ataque y la firma de combate; al vencer se quitan por su
+ * id.
+ */
+class EfectosTemporales {
+public:
+    /**
+     * @brief Constructor
+     * @param capacidad Personajes y temporizadores para los que se reserva memoria
+     */
+    explicit EfectosTemporales(size_t capacidad = 0);
+
+    /**
+     * @brief Registra un personaje
+     * @param personaje Personaje (no pasa a ser propiedad del gestor)
+     * @return Indice del personaje, -1 si es nulo
+     */
+    int registrar(InterfazPersonaje* personaje);
+
+    /**
+     * @brief Bebe una dosis de la pocion y programa su efecto
+     *
+     * - Curacion y Mana: se aplican en el momento.
+     * - Fuerza y Agilidad: modificador Buff igual a la potencia durante la
+     *   duracion (sin efecto en personajes sin pila de modificadores).
+     * - Invisibilidad: activa hasta que vence la duracion.
+     * - Veneno: la potencia se reparte exacta en un tick por unidad de
+     *   duracion (potencia / duracion cada tick y el resto de a uno en los
+     *   primeros); un veneno nuevo reemplaza al anterior.
+     * - Antidoto: cancela el veneno activo.
+     *
+     * Las pociones permanentes se tratan como instantaneas.
+     *
+     * @param indice Personaje que bebe
+     * @param pocion Pocion a beber (pierde una dosis)
+     * @param duracion Ticks que dura el efecto
+     * @return true si habia dosis y se aplico el efecto
+     */
+    bool beberPocion(int indice, Pocion& pocion, uint32_t duracion);
+
+    /**
+     * @brief Programa daño periodico sobre un personaje
+     * @param indice Personaje afectado
+     * @param danio Daño por tick
+     * @param periodo Ticks entre aplicaciones
+     * @param repeticiones Cantidad de aplicaciones (al menos 1)
+     * @return Identificador para cancelarlo; invalido si el indice no esta registrado
+     */
+    IdTemporizador programarDanioPeriodico(int indice, int danio, uint32_t periodo, int repeticiones);
+
+    /**
+     * @brief Programa regeneracion periodica de estamina o mana
+     * @param indice Personaje afectado
+     * @param cantidad Recurso recuperado por aplicacion
+     * @param periodo Ticks entre aplicaciones
+     * @return Identificador para cancelarla; invalido si el indice no esta registrado
+     */
+    IdTemporizador programarRegeneracion(int indice, int cantidad, uint32_t periodo);
+
+    /**
+     * @brief Cancela un efecto programado
+     * @param id Identificador del efecto
+     * @return true si estaba pendiente
+     */
+    bool cancelar(IdTemporizador id);
+
+    /**
+     * @brief Avanza un tick y aplica los efectos que vencen
+     * @return Cantidad de efectos aplicados
+     */
+    size_t avanzar();
+
+    bool estaInvisible(int indice) const;
+    uint64_t getTickActual() const;
+    size_t getEfectosPendientes() const;
+
+private:
+    /**
+     * @brief Aplica un temporizador vencido
+     * @param evento Evento entregado por la rueda
+     */
+    void aplicar(const EventoTemporizador& evento);
+
+    /**
+     * @brief Agrega un buff a la pila del personaje y programa su fin
+     * @param indice Personaje afectado
+     * @param atributo Atributo que sube
+     * @param potencia Puntos planos
+     * @param duracion Ticks que dura; 0 para que no venza
+     */
+    void agregarBuff(int indice, AtributoPersonaje atributo, int potencia, uint32_t duracion);
+
+    /**
+     * @brief Quita el veneno activo de un personaje
+     * @param indice Personaje afectado
+     */
+    void curarVeneno(int indice);
+
+    RuedaTemporizadores rueda;
+    vector<EventoTemporizador> vencidos;
+    RegistroCombatientes registro;
+    vector<PilaModificadores*> pilas; ///< Pila de cada personaje, nullptr si no tiene
+    vector<int> invisibilidades;      ///< Invisibilidades activas (pueden superponerse)
+    vector<IdTemporizador> venenos;   ///< Veneno activo de cada personaje
+    vector<int> venenoRestante;       ///< Daño del veneno que falta aplicar
+    vector<int> ticksVeneno;          ///< Ticks del veneno que faltan
+};
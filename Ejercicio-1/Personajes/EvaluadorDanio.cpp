@@ -0,0 +1,154 @@
+#include "EvaluadorDanio.hpp"
+#include <algorithm>
+
+/**
+ * @brief Implementacion del constructor de EvaluadorDanio
+ */
+EvaluadorDanio::EvaluadorDanio() : aciertos(0), fallos(0) {}
+
+EstimacionDanio EvaluadorDanio::resumir(const DistribucionDanio& distribucion) {
+    double esperado = 0.0;
+    for (int i = 0; i < distribucion.cantidad; ++i) {
+        esperado += distribucion.valores[i] * distribucion.probabilidades[i];
+    }
+    // Desvios respecto de la media: con resultados iguales la varianza da 0 exacto
+    double varianza = 0.0;
+    for (int i = 0; i < distribucion.cantidad; ++i) {
+        double desvio = distribucion.valores[i] - esperado;
+        varianza += desvio * desvio * distribucion.probabilidades[i];
+    }
+    return EstimacionDanio{esperado, varianza};
+}
+
+/**
+ * @brief Implementacion del metodo firmaArma
+ *
+ * El checkpoint trae todo el estado mutable del arma; poder y durabilidad
+ * maxima distinguen armas del mismo tipo que ocuparon la misma direccion.
+ *
+ * @param arma Arma a resumir
+ * @return Firma del estado del arma
+ */
+uint64_t EvaluadorDanio::firmaArma(const InterfazArmas& arma) {
+    CheckpointArma estado = arma.guardarCheckpoint();
+    uint64_t firma = mezclarFirma(0, static_cast<long long>(estado.tipoDinamico));
+    firma = mezclarFirma(firma, arma.getPoder());
+    firma = mezclarFirma(firma, arma.getDurabilidadMaxima());
+    firma = mezclarFirma(firma, estado.durabilidadActual);
+    firma = mezclarFirma(firma, estado.nivelFilo);
+    firma = mezclarFirma(firma, estado.energiaArcanaActual);
+    firma = mezclarFirma(firma, estado.dosisRestantes);
+    firma = mezclarFirma(firma, estado.potenciaEfecto);
+    firma = mezclarFirma(firma, estado.efectoPocion);
+    firma = mezclarFirma(firma, estado.cantidadHechizos);
+    firma = mezclarFirma(firma, estado.estaSintonizado ? 1 : 0);
+    return mezclarFirma(firma, estado.preparadaContraCarga ? 1 : 0);
+}
+
+const TablaDanio& EvaluadorDanio::evaluar(const InterfazPersonaje& personaje, const InterfazArmas& arma) {
+    return evaluar(personaje, personaje.getFirmaCombate(), arma);
+}
+
+EstimacionDanio EvaluadorDanio::evaluar(const InterfazPersonaje& personaje, const InterfazArmas& arma,
+                                        MovimientoCombate movimiento) {
+    return evaluar(personaje, arma)[static_cast<int>(movimiento)];
+}
+
+/**
+ * @brief Implementacion del metodo ordenar
+ *
+ * La firma del personaje se calcula una sola vez para todas las armas.
+ *
+ * @param personaje Personaje que ataca
+ * @param armas Armas candidatas
+ * @param movimiento Movimiento de ataque
+ * @param orden Se reemplaza por las posiciones de las armas en el orden obtenido
+ */
+void EvaluadorDanio::ordenar(const InterfazPersonaje& personaje, const vector<const InterfazArmas*>& armas,
+                             MovimientoCombate movimiento, vector<size_t>& orden) {
+    uint64_t firmaPersonaje = personaje.getFirmaCombate();
+    vector<EstimacionDanio> estimaciones(armas.size());
+    orden.clear();
+    for (size_t i = 0; i < armas.size(); ++i) {
+        if (!armas[i]) continue;
+        estimaciones[i] = evaluar(personaje, firmaPersonaje, *armas[i])[static_cast<int>(movimiento)];
+        orden.push_back(i);
+    }
+    stable_sort(orden.begin(), orden.end(), [&estimaciones](size_t a, size_t b) {
+        if (estimaciones[a].esperado != estimaciones[b].esperado) {
+            return estimaciones[a].esperado > estimaciones[b].esperado;
+        }
+        return estimaciones[a].varianza < estimaciones[b].varianza;
+    });
+}
+
+int EvaluadorDanio::mejorDelInventario(const InterfazPersonaje& personaje, MovimientoCombate movimiento) {
+    uint64_t firmaPersonaje = personaje.getFirmaCombate();
+    int mejor = -1;
+    double mejorEsperado = 0.0;
+    for (int i = 0; i < MAX_ARMAS_CHECKPOINT; ++i) {
+        const InterfazArmas* arma = personaje.getArma(i);
+        if (!arma) continue;
+        double esperado = evaluar(personaje, firmaPersonaje, *arma)[static_cast<int>(movimiento)].esperado;
+        if (mejor < 0 || esperado > mejorEsperado) {
+            mejor = i;
+            mejorEsperado = esperado;
+        }
+    }
+    return mejor;
+}
+
+size_t EvaluadorDanio::invalidar(const InterfazArmas& arma) {
+    return erase_if(tablas, [&arma](const auto& par) { return par.first.arma == &arma; });
+}
+
+size_t EvaluadorDanio::invalidar(const InterfazPersonaje& personaje) {
+    return erase_if(tablas, [&personaje](const auto& par) { return par.first.personaje == &personaje; });
+}
+
+void EvaluadorDanio::limpiar() {
+    tablas.clear();
+}
+
+size_t EvaluadorDanio::getTablas() const { return tablas.size(); }
+size_t EvaluadorDanio::getAciertos() const { return aciertos; }
+size_t EvaluadorDanio::getFallos() const { return fallos; }
+
+bool EvaluadorDanio::Clave::operator==(const Clave& otra) const {
+    return personaje == otra.personaje && arma == otra.arma;
+}
+
+size_t EvaluadorDanio::HashClave::operator()(const Clave& clave) const {
+    uint64_t h = reinterpret_cast<uintptr_t>(clave.personaje) * 0x9E3779B97F4A7C15ull
+        ^ reinterpret_cast<uintptr_t>(clave.arma) * 0xC2B2AE3D27D4EB4Full;
+    return static_cast<size_t>(h ^ (h >> 29));
+}
+
+/**
+ * @brief Implementacion del metodo evaluar con la firma del personaje ya calculada
+ *
+ * Si la tabla guardada tiene las mismas firmas se devuelve tal cual; si no,
+ * se recalculan los tres movimientos y se reemplaza.
+ *
+ * @param personaje Personaje que ataca
+ * @param firmaPersonaje Firma de combate del personaje
+ * @param arma Arma con la que ataca
+ * @return Tabla por movimiento
+ */
+const TablaDanio& EvaluadorDanio::evaluar(const InterfazPersonaje& personaje, uint64_t firmaPersonaje,
+                                          const InterfazArmas& arma) {
+    uint64_t firma = firmaArma(arma);
+    auto [it, nueva] = tablas.try_emplace(Clave{&personaje, &arma});
+    Entrada& entrada = it->second;
+    if (!nueva && entrada.firmaPersonaje == firmaPersonaje && entrada.firmaArma == firma) {
+        ++aciertos;
+        return entrada.tabla;
+    }
+    ++fallos;
+    entrada.firmaPersonaje = firmaPersonaje;
+    entrada.firmaArma = firma;
+    for (int m = 0; m < CANTIDAD_MOVIMIENTOS; ++m) {
+        entrada.tabla[m] = resumir(personaje.estimarAtaque(static_cast<MovimientoCombate>(m), arma));
+    }
+    return entrada.tabla;
+}
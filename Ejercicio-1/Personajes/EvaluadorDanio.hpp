@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "InterfazPersonaje.hpp"
+#include "PilaModificadores.hpp"
+
+using namespace std;
+
+/**
+ * @brief Esperanza y varianza del daño de un ataque
+ */
+struct EstimacionDanio {
+    double esperado;
+    double varianza;
+};
+
+/// Estimacion de un par (personaje, arma), una por MovimientoCombate
+using TablaDanio = array<EstimacionDanio, CANTIDAD_MOVIMIENTOS>;
+
+/**
+ * @brief Daño esperado de cada par (personaje, arma) con tablas por movimiento memorizadas
+ *
+ * Evaluar no usa el arma ni toca al personaje: combina estimarUso del arma
+ * con las reglas de estimarAtaque del personaje y resume el resultado de
+ * cada movimiento en esperanza y varianza.
+ *
+ * Cada tabla se guarda junto con la firma de combate del personaje y una
+ * firma del estado del arma (su checkpoint, poder y durabilidad maxima). Si
+ * alguna cambio (subio un atributo, entro un modificador, se gasto
+ * durabilidad, filo, energia o dosis, se combino una pocion o se preparo
+ * una lanza contra carga) la tabla se recalcula al pedirla. Solo hay que
+ * invalidar un personaje o un arma antes de destruirlos.
+ */
+class EvaluadorDanio {
+public:
+    EvaluadorDanio();
+
+    /**
+     * @brief Calcula esperanza y varianza de una distribucion
+     * @param distribucion Distribucion a resumir
+     * @return Esperanza y varianza
+     */
+    static EstimacionDanio resumir(const DistribucionDanio& distribucion);
+
+    /**
+     * @brief Resume el estado de un arma que puede cambiar su daño
+     * @param arma Arma a resumir
+     * @return Firma que cambia cuando cambia el estado del arma
+     */
+    static uint64_t firmaArma(const InterfazArmas& arma);
+
+    /**
+     * @brief Obtiene la tabla de daño de un personaje con un arma
+     * @param personaje Personaje que ataca
+     * @param arma Arma con la que ataca (no tiene que estar en su inventario)
+     * @return Tabla por movimiento; vale hasta la proxima llamada que modifique el evaluador
+     */
+    const TablaDanio& evaluar(const InterfazPersonaje& personaje, const InterfazArmas& arma);
+
+    /**
+     * @brief Obtiene la estimacion de un movimiento
+     * @param personaje Personaje que ataca
+     * @param arma Arma con la que ataca
+     * @param movimiento Movimiento de ataque
+     * @return Esperanza y varianza del daño
+     */
+    EstimacionDanio evaluar(const InterfazPersonaje& personaje, const InterfazArmas& arma,
+                            MovimientoCombate movimiento);
+
+    /**
+     * @brief Ordena armas de mayor a menor daño esperado para un personaje
+     *
+     * A igual esperanza va primero la de menor varianza. Las armas nulas no
+     * aparecen en el resultado.
+     *
+     * @param personaje Personaje que ataca
+     * @param armas Armas candidatas
+     * @param movimiento Movimiento de ataque
+     * @param orden Se reemplaza por las posiciones de las armas en el orden obtenido
+     */
+    void ordenar(const InterfazPersonaje& personaje, const vector<const InterfazArmas*>& armas,
+                 MovimientoCombate movimiento, vector<size_t>& orden);
+
+    /**
+     * @brief Busca el arma del inventario con mayor daño esperado
+     * @param personaje Personaje a consultar
+     * @param movimiento Movimiento de ataque
+     * @return Posicion en el inventario, -1 si no tiene armas
+     */
+    int mejorDelInventario(const InterfazPersonaje& personaje, MovimientoCombate movimiento);
+
+    /**
+     * @brief Descarta las tablas de un arma
+     * @param arma Arma a descartar
+     * @return Cantidad de tablas descartadas
+     */
+    size_t invalidar(const InterfazArmas& arma);
+
+    /**
+     * @brief Descarta las tablas de un personaje
+     * @param personaje Personaje a descartar
+     * @return Cantidad de tablas descartadas
+     */
+    size_t invalidar(const InterfazPersonaje& personaje);
+
+    void limpiar();
+
+    size_t getTablas() const;
+    size_t getAciertos() const;
+    size_t getFallos() const;
+
+private:
+    struct Clave {
+        const InterfazPersonaje* personaje;
+        const InterfazArmas* arma;
+        bool operator==(const Clave& otra) const;
+    };
+
+    struct HashClave {
+        size_t operator()(const Clave& clave) const;
+    };
+
+    struct Entrada {
+        uint64_t firmaPersonaje;
+        uint64_t firmaArma;
+        TablaDanio tabla;
+    };
+
+    const TablaDanio& evaluar(const InterfazPersonaje& personaje, uint64_t firmaPersonaje,
+                              const InterfazArmas& arma);
+
+    unordered_map<Clave, Entrada, HashClave> tablas;
+    size_t aciertos;
+    size_t fallos;
+};
@@ -1,11 +1,12 @@
 #include "Guerrero.hpp"
+#include <typeinfo>
 
 /**
  * @brief Implementacion del constructor de Guerrero
  * 
  * Inicializa un guerrero con sus atributos basicos y especificos.
- * Ajusta valores no validos a minimos aceptables y aumenta los HP
- * basados en la resistencia fisica.
+ * Ajusta valores no validos a minimos aceptables. El bonus de HP por
+ * resistencia fisica se calcula en recalcularEstadisticas.
  */
 Guerrero::Guerrero(string n, int nivel, int hp, Raza r, int fue, int des, int con, int inte,
                    int estMax, EstiloCombate est, TipoArmadura ta, int defBase, int resFis)
@@ -17,13 +18,31 @@ Guerrero::Guerrero(string n, int nivel, int hp, Raza r, int fue, int des, int co
     
     if (nivel < 1) nivelPersonaje = 1;
     if (hpMax < 1) hpMax = 1;
-    hpActual = hpMax;
     if (estaminaMaxima < 0) estaminaMaxima = 0;
     estaminaActual = estaminaMaxima;
     
-    // Aumentamos el HP base por la resistencia física
-    hpMax += resistenciaFisica * 2;
-    hpActual = hpMax;
+    hpActual = getHPMaximo();
+    modificadores.setAlBajarHPMaximo([this]() { ajustarVidaAlMaximo(); });
+}
+
+/**
+ * @brief Implementacion del constructor de copia de Guerrero
+ * 
+ * El inventario se clona arma por arma y el checkpoint de combate PPT
+ * tambien se copia: un clon hecho en medio de un duelo restaura el mismo
+ * estado que el original.
+ */
+Guerrero::Guerrero(const Guerrero& otro) : InterfazPersonaje(otro) {
+    *this = otro;
+    modificadores.setAlBajarHPMaximo([this]() { ajustarVidaAlMaximo(); });
+}
+
+/**
+ * @brief Implementacion del metodo clonar
+ * @return Copia independiente del guerrero
+ */
+unique_ptr<InterfazPersonaje> Guerrero::clonar() const {
+    return unique_ptr<InterfazPersonaje>(new Guerrero(*this)); // el constructor de copia es protegido
 }
 
 // ==========================================
@@ -33,7 +52,7 @@ Guerrero::Guerrero(string n, int nivel, int hp, Raza r, int fue, int des, int co
 /**
  * @brief Implementacion de getters y setters basicos
  */
-string Guerrero::getNombre() const { return nombre; }
+const string& Guerrero::getNombre() const { return nombre; }
 void Guerrero::setNombre(const string& nuevoNombre) { nombre = nuevoNombre; }
 
 int Guerrero::getHP() const { return hpActual; }
@@ -53,7 +72,7 @@ bool Guerrero::recibirDanio(int cantidad, bool esCombatePPT) {
     
     if (!esCombatePPT) {
         hpActual = max(0, hpActual - cantidad);
-        cout << nombre << " recibe " << cantidad << " puntos de daño. HP: " << hpActual << "/" << hpMax << endl;
+        cout << nombre << " recibe " << cantidad << " puntos de daño. HP: " << hpActual << "/" << getHPMaximo() << endl;
         
         if (hpActual <= 0) {
             cout << "¡" << nombre << " ha caído!" << endl;
@@ -63,7 +82,7 @@ bool Guerrero::recibirDanio(int cantidad, bool esCombatePPT) {
         return true; // Sigue vivo
     } 
     hpActual = max(0, hpActual - 10);
-    cout << nombre << " recibe 10 puntos de daño. HP: " << hpActual << "/" << hpMax << endl;
+    cout << nombre << " recibe 10 puntos de daño. HP: " << hpActual << "/" << getHPMaximo() << endl;
         
     if (hpActual <= 0) {
         cout << "¡" << nombre << " ha caído!" << endl;
@@ -73,6 +92,14 @@ bool Guerrero::recibirDanio(int cantidad, bool esCombatePPT) {
     return true;
 }
 
+/**
+ * @brief Implementacion del metodo getReduccionDanio
+ * @return Sin reduccion: las defensas propias las agregan las subclases
+ */
+ReduccionDanio Guerrero::getReduccionDanio() const {
+    return ReduccionDanio{0, 0};
+}
+
 /**
  * @brief Implementacion del metodo curar
  * 
@@ -84,9 +111,9 @@ void Guerrero::curar(int cantidad) {
     if (cantidad <= 0) return;
     
     int hpPrevio = hpActual;
-    hpActual = min(hpMax, hpActual + cantidad);
+    hpActual = min(getHPMaximo(), hpActual + cantidad);
     
-    cout << nombre << " recupera " << (hpActual - hpPrevio) << " puntos de vida. HP: " << hpActual << "/" << hpMax << endl;
+    cout << nombre << " recupera " << (hpActual - hpPrevio) << " puntos de vida. HP: " << hpActual << "/" << getHPMaximo() << endl;
 }
 
 /**
@@ -171,6 +198,8 @@ InterfazArmas* Guerrero::getArma(int posicion) const {
     return inventarioArmas[posicion].get();
 }
 
+int Guerrero::getCapacidadArmas() const { return MAX_ARMAS; }
+
 /**
  * @brief Implementacion del metodo atacar
  * 
@@ -237,13 +266,16 @@ bool Guerrero::equiparArma(int posicion) {
 
 /**
  * @brief Implementacion de getters para atributos basicos
+ * 
+ * Los atributos se devuelven con los modificadores aplicados.
  */
 int Guerrero::getNivel() const { return nivelPersonaje; }
 Raza Guerrero::getRaza() const { return raza; }
-int Guerrero::getFuerza() const { return fuerza; }
-int Guerrero::getDestreza() const { return destreza; }
-int Guerrero::getConstitucion() const { return constitucion; }
-int Guerrero::getInteligencia() const { return inteligencia; }
+int Guerrero::getFuerza() const { return getEstadisticas().fuerza; }
+int Guerrero::getDestreza() const { return getEstadisticas().destreza; }
+int Guerrero::getConstitucion() const { return getEstadisticas().constitucion; }
+int Guerrero::getInteligencia() const { return getEstadisticas().inteligencia; }
+int Guerrero::getHPMaximo() const { return getEstadisticas().hpMaximo; }
 int Guerrero::getArmaEquipadaPos() const { return armaEquipadaPos; }
 
 /**
@@ -316,6 +348,7 @@ void Guerrero::recuperarEstamina(int cantidad) {
 EstiloCombate Guerrero::getEstiloCombate() const { return estilo; }
 TipoArmadura Guerrero::getTipoArmadura() const { return tipoArmadura; }
 int Guerrero::getDefensaBase() const { return defensaBase; }
+int Guerrero::getDefensa() const { return getEstadisticas().defensa; }
 int Guerrero::getResistenciaFisica() const { return resistenciaFisica; }
 
 // ==========================================
@@ -341,7 +374,7 @@ int Guerrero::ejecutarTecnicaEspecial() {
     cout << "¡" << nombre << " ejecuta un poderoso golpe!" << endl;
     
     // Daño basado en fuerza
-    return 10 + nivelPersonaje + fuerza;
+    return 10 + nivelPersonaje + getFuerza();
 }
 
 /**
@@ -360,7 +393,7 @@ int Guerrero::aumentarPosturaDefensiva() {
         return 0;
     }
     
-    int bonusDefensa = defensaBase + constitucion / 2;
+    int bonusDefensa = getDefensa() + getConstitucion() / 2;
     cout << nombre << " aumenta su defensa en " << bonusDefensa << " puntos temporalmente." << endl;
     
     return bonusDefensa; // Retorna el bonus de defensa
@@ -406,7 +439,7 @@ int Guerrero::cargarContra(string nombreEnemigo) {
     }
     
     cout << "¡" << nombre << " embiste con fuerza!" << endl;
-    return 8 + fuerza / 2 + constitucion / 4;
+    return 8 + getFuerza() / 2 + getConstitucion() / 4;
 }
 
 /**
@@ -431,7 +464,7 @@ int Guerrero::bloquearConEscudo() {
         return 0;
     }
     
-    int bonusDefensa = defensaBase + constitucion;
+    int bonusDefensa = getDefensa() + getConstitucion();
     cout << nombre << " bloquea " << bonusDefensa << " puntos de daño." << endl;
     
     return bonusDefensa; // Retorna la cantidad de daño bloqueado
@@ -456,7 +489,8 @@ void Guerrero::mostrarInfo() const {
  * 
  * Calcula el daño de un ataque basado en el movimiento y el arma.
  * Los guerreros tienen bonus en Golpe Fuerte por su fuerza y
- * en Defensa y Golpe por su constitucion.
+ * en Defensa y Golpe por su constitucion; ambos bonus y el daño extra
+ * de los modificadores se leen ya calculados de getEstadisticas.
  * 
  * @param movimiento Tipo de ataque a realizar
  * @param armaUsada Arma con la que se realiza el ataque
@@ -465,10 +499,11 @@ void Guerrero::mostrarInfo() const {
 int Guerrero::resolverMovimiento(MovimientoCombate movimiento, InterfazArmas* armaUsada) const {
     if (!armaUsada) return 0;
     
+    const EstadisticasDerivadas& stats = getEstadisticas();
     int danioBase = armaUsada->usar();
+    int bonus = stats.bonusMovimiento[static_cast<int>(movimiento)];
     
     if (movimiento == MovimientoCombate::GolpeFuerte) {
-        int bonus = fuerza / 3;
         if (bonus > 0) {
             cout << "¡Bonus de fuerza: +" << bonus << " al daño!" << endl;
             danioBase += bonus;
@@ -476,16 +511,173 @@ int Guerrero::resolverMovimiento(MovimientoCombate movimiento, InterfazArmas* ar
     }
     // También son buenos en Defensa y Golpe (bonus de constitución)
     else if (movimiento == MovimientoCombate::DefensaYGolpe) {
-        int bonus = constitucion / 4;
         if (bonus > 0) {
             cout << "¡Bonus de constitución: +" << bonus << " al daño y defensa!" << endl;
             danioBase += bonus;
         }
     }
     
+    if (danioBase > 0 && stats.danioExtra != 0) {
+        danioBase = max(0, danioBase + stats.danioExtra);
+    }
+    
     return danioBase;
 }
 
+/**
+ * @brief Implementacion del metodo estimarAtaque
+ *
+ * Aplica a cada resultado posible del arma los mismos bonus que resolverMovimiento.
+ *
+ * @param movimiento Tipo de movimiento de ataque
+ * @param arma Arma a evaluar
+ * @return Distribucion del daño del ataque
+ */
+DistribucionDanio Guerrero::estimarAtaque(MovimientoCombate movimiento, const InterfazArmas& arma) const {
+    const EstadisticasDerivadas& stats = getEstadisticas();
+    int bonus = stats.bonusMovimiento[static_cast<int>(movimiento)];
+    bool aplicaBonus = bonus > 0 && movimiento != MovimientoCombate::GolpeRapido;
+
+    DistribucionDanio distribucion = arma.estimarUso();
+    for (int i = 0; i < distribucion.cantidad; ++i) {
+        int danio = distribucion.valores[i] + (aplicaBonus ? bonus : 0);
+        if (danio > 0 && stats.danioExtra != 0) {
+            danio = max(0, danio + stats.danioExtra);
+        }
+        distribucion.valores[i] = danio;
+    }
+    return distribucion;
+}
+
+/**
+ * @brief Implementacion del metodo getFirmaCombate
+ * @return Firma del tipo, los bonus de GolpeFuerte y DefensaYGolpe y el daño extra
+ */
+uint64_t Guerrero::getFirmaCombate() const {
+    const EstadisticasDerivadas& stats = getEstadisticas();
+    uint64_t firma = mezclarFirma(0, static_cast<long long>(typeid(*this).hash_code()));
+    firma = mezclarFirma(firma, stats.bonusMovimiento[static_cast<int>(MovimientoCombate::GolpeFuerte)]);
+    firma = mezclarFirma(firma, stats.bonusMovimiento[static_cast<int>(MovimientoCombate::DefensaYGolpe)]);
+    return mezclarFirma(firma, stats.danioExtra);
+}
+
+// ==========================================
+// ESTADISTICAS DERIVADAS
+// ==========================================
+
+/**
+ * @brief Implementacion del metodo getEstadisticas
+ * 
+ * Solo recalcula si se marco un cambio en los atributos base o si la pila
+ * de modificadores cambio de version desde el ultimo calculo.
+ * 
+ * @return Estadisticas con todos los modificadores aplicados
+ */
+const EstadisticasDerivadas& Guerrero::getEstadisticas() const {
+    if (estadisticasSucias || versionModificadores != modificadores.getVersion()) {
+        recalcularEstadisticas();
+        estadisticasSucias = false;
+        versionModificadores = modificadores.getVersion();
+    }
+    return estadisticas;
+}
+
+PilaModificadores& Guerrero::getModificadores() { return modificadores; }
+const PilaModificadores& Guerrero::getModificadores() const { return modificadores; }
+
+AtributosPersonaje Guerrero::getAtributosBase() const {
+    return AtributosPersonaje{nivelPersonaje, hpMax, hpActual, raza, fuerza, destreza, constitucion,
+                              inteligencia, estaminaMaxima, estaminaActual};
+}
+
+/**
+ * @brief Implementacion del metodo setAtributosBase
+ * 
+ * @param atributos Atributos nuevos
+ */
+void Guerrero::setAtributosBase(const AtributosPersonaje& atributos) {
+    nivelPersonaje = atributos.nivel;
+    hpMax = atributos.hpMaximo;
+    raza = atributos.raza;
+    fuerza = atributos.fuerza;
+    destreza = atributos.destreza;
+    constitucion = atributos.constitucion;
+    inteligencia = atributos.inteligencia;
+    estaminaMaxima = atributos.recursoMaximo;
+    estaminaActual = atributos.recursoActual;
+    marcarEstadisticasSucias();
+    hpActual = min(atributos.hpActual, getHPMaximo());
+    hpOriginalParaCombatePPT = hpActual;
+}
+
+/**
+ * @brief Implementacion del metodo setInventario
+ * 
+ * @param armas Armas nuevas
+ * @param equipada Posicion del arma equipada, -1 si ninguna
+ */
+void Guerrero::setInventario(vector<unique_ptr<InterfazArmas>> armas, int equipada) {
+    inventarioArmas.swap(armas);
+    armaEquipadaPos = equipada >= 0 && equipada < static_cast<int>(inventarioArmas.size()) ? equipada : -1;
+}
+
+/**
+ * @brief Implementacion del metodo getEstadoClase
+ * 
+ * @return Rasgos de la clase, contadores y listas de la subclase
+ */
+EstadoClasePersonaje Guerrero::getEstadoClase() const {
+    EstadoClasePersonaje estado{};
+    estado.rasgos[0] = static_cast<int>(estilo);
+    estado.rasgos[1] = static_cast<int>(tipoArmadura);
+    estado.rasgos[2] = defensaBase;
+    estado.rasgos[3] = resistenciaFisica;
+    guardarEstadoClase(estado.contadores);
+    guardarElementosClase(estado.elementos);
+    return estado;
+}
+
+/**
+ * @brief Implementacion del metodo setEstadoClase
+ * 
+ * Las listas se reemplazan antes de restaurar los contadores, que solo las
+ * recortarian si fueran mas largas que las guardadas.
+ * 
+ * @param estado Estado obtenido con getEstadoClase
+ */
+void Guerrero::setEstadoClase(const EstadoClasePersonaje& estado) {
+    estilo = static_cast<EstiloCombate>(estado.rasgos[0]);
+    tipoArmadura = static_cast<TipoArmadura>(estado.rasgos[1]);
+    defensaBase = estado.rasgos[2];
+    resistenciaFisica = estado.rasgos[3];
+    restaurarElementosClase(estado.elementos);
+    restaurarEstadoClase(estado.contadores);
+    marcarEstadisticasSucias();
+}
+
+void Guerrero::marcarEstadisticasSucias() { estadisticasSucias = true; }
+void Guerrero::ajustarVidaAlMaximo() { hpActual = min(hpActual, getHPMaximo()); }
+
+/**
+ * @brief Implementacion del metodo recalcularEstadisticas
+ * 
+ * Los HP maximos incluyen 2 puntos por cada punto de resistencia fisica.
+ * Golpe Fuerte suma fuerza / 3 y Defensa y Golpe constitucion / 4.
+ */
+void Guerrero::recalcularEstadisticas() const {
+    estadisticas.fuerza = modificadores.aplicar(AtributoPersonaje::Fuerza, fuerza);
+    estadisticas.destreza = modificadores.aplicar(AtributoPersonaje::Destreza, destreza);
+    estadisticas.constitucion = modificadores.aplicar(AtributoPersonaje::Constitucion, constitucion);
+    estadisticas.inteligencia = modificadores.aplicar(AtributoPersonaje::Inteligencia, inteligencia);
+    estadisticas.hpMaximo = max(1, modificadores.aplicar(AtributoPersonaje::HPMaximo, hpMax + resistenciaFisica * 2));
+    estadisticas.defensa = modificadores.aplicar(AtributoPersonaje::Defensa, defensaBase);
+    estadisticas.danioExtra = modificadores.getPlano(AtributoPersonaje::Danio);
+    
+    estadisticas.bonusMovimiento[static_cast<int>(MovimientoCombate::GolpeFuerte)] = estadisticas.fuerza / 3;
+    estadisticas.bonusMovimiento[static_cast<int>(MovimientoCombate::GolpeRapido)] = 0;
+    estadisticas.bonusMovimiento[static_cast<int>(MovimientoCombate::DefensaYGolpe)] = estadisticas.constitucion / 4;
+}
+
 // ==========================================
 // METODOS PARA COMBATE PPT
 // ==========================================
@@ -494,7 +686,7 @@ int Guerrero::resolverMovimiento(MovimientoCombate movimiento, InterfazArmas* ar
  * @brief Implementacion del metodo setHPParaCombatePPT
  * 
  * Establece los HP exactamente en 100 para un combate PPT.
- * Guarda el HP actual para restaurarlo despues.
+ * Guarda un checkpoint completo (HP, recurso, armas) para restaurarlo despues.
  * 
  * @return true si se configuro correctamente, false si hubo un error
  */
@@ -503,6 +695,7 @@ bool Guerrero::setHPParaCombatePPT() {
         if (enModoCombatePPT) {
             return true;
         }
+        guardarCheckpoint(checkpointCombatePPT);
         hpOriginalParaCombatePPT = hpActual;
         
         hpActual = 100;
@@ -518,7 +711,8 @@ bool Guerrero::setHPParaCombatePPT() {
 /**
  * @brief Implementacion del metodo restaurarHPOriginal
  * 
- * Restaura el HP original despues de un combate PPT.
+ * Restaura el checkpoint guardado al entrar en combate PPT: HP, recurso,
+ * durabilidad y filo de las armas, energía, dosis y contadores de la subclase.
  * 
  * @return true si se restauro correctamente, false si hubo un error
  */
@@ -528,7 +722,7 @@ bool Guerrero::restaurarHPOriginal() {
             return true;
         }
         
-        hpActual = hpOriginalParaCombatePPT;
+        restaurarCheckpoint(checkpointCombatePPT);
         enModoCombatePPT = false;
         
         return true;
@@ -537,3 +731,98 @@ bool Guerrero::restaurarHPOriginal() {
         return false;
     }
 }
+
+// ==========================================
+// CHECKPOINT DE ESTADO
+// ==========================================
+
+/**
+ * @brief Implementacion del metodo guardarCheckpoint
+ * 
+ * Copia los valores que cambian durante un combate y el checkpoint de cada
+ * arma del inventario. No reserva memoria.
+ * 
+ * @param destino Checkpoint donde se escribe el estado
+ */
+void Guerrero::guardarCheckpoint(CheckpointPersonaje& destino) const {
+    destino = CheckpointPersonaje{};
+    destino.tipoDinamico = typeid(*this).hash_code();
+    destino.hpActual = hpActual;
+    destino.hpMax = hpMax;
+    destino.recursoActual = estaminaActual;
+    destino.fuerza = fuerza;
+    destino.destreza = destreza;
+    destino.constitucion = constitucion;
+    destino.inteligencia = inteligencia;
+    destino.armaEquipadaPos = armaEquipadaPos;
+    destino.cantidadArmas = static_cast<int>(min(inventarioArmas.size(), static_cast<size_t>(MAX_ARMAS_CHECKPOINT)));
+    for (int i = 0; i < destino.cantidadArmas; ++i) {
+        if (inventarioArmas[i]) {
+            destino.armas[i] = inventarioArmas[i]->guardarCheckpoint();
+        }
+    }
+    guardarEstadoClase(destino.estadoClase);
+}
+
+/**
+ * @brief Implementacion del metodo restaurarCheckpoint
+ * 
+ * Las armas se restauran por posicion; si el inventario cambio desde el
+ * checkpoint, las armas que no coinciden en tipo se dejan como estan.
+ * 
+ * @param origen Checkpoint a restaurar
+ * @return true si se restauro, false si el checkpoint no corresponde a el guerrero
+ */
+bool Guerrero::restaurarCheckpoint(const CheckpointPersonaje& origen) {
+    if (origen.tipoDinamico != typeid(*this).hash_code()) {
+        return false;
+    }
+    
+    hpActual = origen.hpActual;
+    hpMax = origen.hpMax;
+    estaminaActual = origen.recursoActual;
+    fuerza = origen.fuerza;
+    destreza = origen.destreza;
+    constitucion = origen.constitucion;
+    inteligencia = origen.inteligencia;
+    
+    int armas = min(origen.cantidadArmas, static_cast<int>(inventarioArmas.size()));
+    for (int i = 0; i < armas; ++i) {
+        if (inventarioArmas[i]) {
+            inventarioArmas[i]->restaurarCheckpoint(origen.armas[i]);
+        }
+    }
+    armaEquipadaPos = origen.armaEquipadaPos < static_cast<int>(inventarioArmas.size()) ? origen.armaEquipadaPos : -1;
+    
+    restaurarEstadoClase(origen.estadoClase);
+    marcarEstadisticasSucias();
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo guardarEstadoClase
+ * 
+ * Guerrero no tiene contadores propios; las subclases lo redefinen.
+ * 
+ */
+void Guerrero::guardarEstadoClase(int[MAX_ESTADO_CLASE]) const {}
+
+/**
+ * @brief Implementacion del metodo restaurarEstadoClase
+ * 
+ */
+void Guerrero::restaurarEstadoClase(const int[MAX_ESTADO_CLASE]) {}
+
+/**
+ * @brief Implementacion del metodo guardarElementosClase
+ * 
+ * Guerrero no tiene listas propias; las subclases que las tienen lo redefinen.
+ * 
+ */
+void Guerrero::guardarElementosClase(vector<ElementoClase>&) const {}
+
+/**
+ * @brief Implementacion del metodo restaurarElementosClase
+ * 
+ */
+void Guerrero::restaurarElementosClase(const vector<ElementoClase>&) {}
@@ -75,7 +75,7 @@ int Barbaro::gritarEnBatalla() {
         return 0;
     }
     
-    int efectoGrito = furiaCombate / 2 + fuerza / 3;
+    int efectoGrito = furiaCombate / 2 + getFuerza() / 3;
     cout << "¡El grito atemoriza a los enemigos, reduciendo su moral en " << efectoGrito << " puntos!" << endl;
     
     return efectoGrito;
@@ -96,7 +96,7 @@ void Barbaro::resistirDolor() {
         return;
     }
     
-    int hpRecuperados = resistenciaDolor / 2 + constitucion / 3;
+    int hpRecuperados = resistenciaDolor / 2 + getConstitucion() / 3;
     curar(hpRecuperados);
     
     cout << nombre << " ignora parte de sus heridas y continúa luchando con renovado vigor." << endl;
@@ -121,7 +121,7 @@ int Barbaro::golpeSalvaje() {
     
     cout << "¡" << nombre << " lanza un ataque devastador!" << endl;
     
-    int danioGolpe = fuerza + furiaCombate / 2;
+    int danioGolpe = getFuerza() + furiaCombate / 2;
     if (frenesi) {
         danioGolpe += furiaCombate;
     }
@@ -161,7 +161,7 @@ void Barbaro::mostrarInfo() const {
 bool Barbaro::recibirDanio(int cantidad, bool esCombatePPT) {
     if (!esCombatePPT) {
         if (frenesi && cantidad > 0) {
-            int reduccion = min(cantidad / 2, resistenciaDolor);
+            int reduccion = getReduccionDanio().calcular(cantidad);
             if (reduccion > 0) {
                 cout << nombre << " resiste " << reduccion << " puntos de daño gracias a su frenesí." << endl;
                 cantidad -= reduccion;
@@ -174,3 +174,48 @@ bool Barbaro::recibirDanio(int cantidad, bool esCombatePPT) {
     }
     return Guerrero::recibirDanio(cantidad, esCombatePPT); // Llamar al método base con el daño ajustado
 }
+
+/**
+ * @brief Implementacion del metodo getReduccionDanio
+ *
+ * En frenesi descuenta la mitad del golpe, hasta la resistencia al dolor.
+ *
+ * @return Reduccion vigente
+ */
+ReduccionDanio Barbaro::getReduccionDanio() const {
+    return frenesi ? ReduccionDanio{2, resistenciaDolor} : ReduccionDanio{0, 0};
+}
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Barbaro::clonar() const {
+    return make_unique<Barbaro>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: furiaCombate, superacionLimites, resistenciaDolor, frenesi.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Barbaro::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = furiaCombate;
+    estado[1] = superacionLimites;
+    estado[2] = resistenciaDolor;
+    estado[3] = frenesi ? 1 : 0;
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Barbaro::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    furiaCombate = estado[0];
+    superacionLimites = estado[1];
+    resistenciaDolor = estado[2];
+    frenesi = estado[3] != 0;
+}
@@ -16,6 +16,10 @@ private:
     string gritoBatalla;
     int superacionLimites;
 
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+
 public:
     // ==========================================
     // CONSTRUCTORES
@@ -96,6 +100,8 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementacion especializada para recibir daño
      * 
@@ -106,4 +112,10 @@ public:
      * @return true si sigue vivo, false si ha muerto
      */
     bool recibirDanio(int cantidad, bool esCombatePPT) override;
+
+    /**
+     * @brief Reduccion que recibirDanio aplica con el estado actual
+     * @return Reduccion vigente
+     */
+    ReduccionDanio getReduccionDanio() const override;
 };
@@ -17,6 +17,7 @@ Caballero::Caballero(string n, int nivel, int hp, Raza r, int fue, int des, int
     // Bonus especial por ser caballero con armadura pesada
     if (tipoArmadura == TipoArmadura::Pesada) {
         defensaBase += 5;
+        marcarEstadisticasSucias();
     }
 }
 
@@ -38,6 +39,7 @@ void Caballero::ganarHonor(int cantidad) {
     if (honor % 10 == 0) {
         cout << "¡" << nombre << " alcanza un nuevo umbral de honor!" << endl;
         defensaBase += 1;
+        marcarEstadisticasSucias();
         cout << "Defensa base aumentada a " << defensaBase << "." << endl;
     }
 }
@@ -63,6 +65,7 @@ void Caballero::perderHonor(int cantidad) {
         // Penalización moral
         int penalizacion = nivelPersonaje / 2;
         fuerza = max(1, fuerza - penalizacion);
+        marcarEstadisticasSucias();
         cout << "La fuerza de " << nombre << " se reduce a " << fuerza << " debido a la vergüenza." << endl;
     }
 }
@@ -90,7 +93,7 @@ int Caballero::cargarAcaballo() {
     }
     
     // Daño basado en fuerza, habilidad ecuestre y nivel
-    int danio = fuerza + habilidadEcuestre + nivelPersonaje / 2;
+    int danio = getFuerza() + habilidadEcuestre + nivelPersonaje / 2;
     cout << "¡La carga a caballo causa " << danio << " puntos de daño!" << endl;
     
     return danio;
@@ -123,6 +126,42 @@ int Caballero::defenderAliado(string nombreAliado) {
     return bonusDefensa;
 }
 
+/**
+ * @brief Implementacion del metodo defenderAliados
+ * 
+ * Igual que defenderAliado, pero el bonus se aplica por area durante
+ * DURACION_DEFENSA ticks a los aliados cercanos.
+ * 
+ * @param motor Motor de auras donde está registrado el caballero
+ * @param indice Indice del caballero en el motor
+ * @return Valor numerico que representa el bonus de defensa otorgado
+ */
+int Caballero::defenderAliados(MotorAuras& motor, int indice) {
+    const int DURACION_DEFENSA = 3;
+    
+    cout << nombre << " se posiciona para defender a sus aliados." << endl;
+    
+    int costoEstamina = 10;
+    if (!gastarEstamina(costoEstamina)) {
+        return 0;
+    }
+    
+    int tipo = motor.buscar("Defensa de Caballero");
+    if (tipo < 0) {
+        tipo = motor.definir(DefinicionAura{"Defensa de Caballero", AtributoPersonaje::Defensa, RADIO_DEFENSA_CABALLERO});
+    }
+    int bonusDefensa = defensaBase + honor / 5;
+    motor.desactivar(indice, tipo);
+    if (!motor.activar(indice, tipo, bonusDefensa, 0, DURACION_DEFENSA)) {
+        return 0;
+    }
+    cout << nombre << " proporciona " << bonusDefensa << " puntos de defensa a los aliados cercanos." << endl;
+    
+    ganarHonor(1);
+    
+    return bonusDefensa;
+}
+
 /**
  * @brief Implementacion del metodo juramentoSagrado
  * 
@@ -180,7 +219,7 @@ bool Caballero::recibirDanio(int cantidad, bool esCombatePPT) {
     if (!esCombatePPT) {
         // Posible reducción de daño basada en honor
         if (honor > 20 && cantidad > 0) {
-            int reduccion = min(cantidad / 4, honor / 10);
+            int reduccion = getReduccionDanio().calcular(cantidad);
             if (reduccion > 0) {
                 cout << "El honor de " << nombre << " reduce el daño en " << reduccion << " puntos." << endl;
                 cantidad -= reduccion;
@@ -189,3 +228,48 @@ bool Caballero::recibirDanio(int cantidad, bool esCombatePPT) {
     }
     return Guerrero::recibirDanio(cantidad, esCombatePPT);
 }
+
+/**
+ * @brief Implementacion del metodo getReduccionDanio
+ *
+ * Con más de 20 de honor descuenta un cuarto del golpe, hasta un décimo del honor.
+ *
+ * @return Reduccion vigente
+ */
+ReduccionDanio Caballero::getReduccionDanio() const {
+    return honor > 20 ? ReduccionDanio{4, honor / 10} : ReduccionDanio{0, 0};
+}
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Caballero::clonar() const {
+    return make_unique<Caballero>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: honor, habilidadEcuestre, montado, defensaBase.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Caballero::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = honor;
+    estado[1] = habilidadEcuestre;
+    estado[2] = montado ? 1 : 0;
+    estado[3] = defensaBase;  // El honor la aumenta al cruzar umbrales
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Caballero::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    honor = estado[0];
+    habilidadEcuestre = estado[1];
+    montado = estado[2] != 0;
+    defensaBase = estado[3];
+}
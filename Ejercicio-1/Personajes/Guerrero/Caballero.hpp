@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Guerrero.hpp"
+#include "../MotorAuras.hpp"
 
 /**
  * @brief Clase que representa un personaje de tipo Caballero
@@ -16,6 +17,10 @@ private:
     int habilidadEcuestre;
     string orden;
 
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+
 public:
     // ==========================================
     // CONSTRUCTORES
@@ -82,6 +87,18 @@ public:
      */
     int defenderAliado(string nombreAliado);
     
+    /**
+     * @brief Protege a todos los aliados dentro de RADIO_DEFENSA_CABALLERO
+     * 
+     * La protección dura unos pocos ticks del motor. Las protecciones de
+     * varios caballeros no se acumulan: cada aliado recibe la mayor.
+     * 
+     * @param motor Motor de auras donde está registrado el caballero
+     * @param indice Índice del caballero en el motor
+     * @return Valor numerico que representa el bonus de defensa otorgado
+     */
+    int defenderAliados(MotorAuras& motor, int indice);
+    
     /**
      * @brief Invoca el juramento sagrado del caballero
      * @return Valor numerico que representa el efecto del juramento
@@ -97,6 +114,8 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementacion especializada para recibir daño
      * 
@@ -107,4 +126,10 @@ public:
      * @return true si sigue vivo, false si ha muerto
      */
     bool recibirDanio(int cantidad, bool esCombatePPT) override;
+
+    /**
+     * @brief Reduccion que recibirDanio aplica con el estado actual
+     * @return Reduccion vigente
+     */
+    ReduccionDanio getReduccionDanio() const override;
 };
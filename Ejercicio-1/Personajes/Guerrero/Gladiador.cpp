@@ -18,6 +18,8 @@ Gladiador::Gladiador(string n, int nivel, int hp, Raza r, int fue, int des, int
     if (totalCombates > 0) {
         resistenciaFisica += totalCombates / 5; // Cada 5 combates aumenta la resistencia
         destreza += victorias / 3; // Cada 3 victorias aumenta la destreza
+        marcarEstadisticasSucias();
+        hpActual = getHPMaximo();
     }
 }
 
@@ -90,14 +92,46 @@ void Gladiador::registrarDerrota() {
     }
 }
 
+/**
+ * @brief Implementacion del metodo registrarTemporada
+ * 
+ * Cada victoria vale 10 de fama (15 si al terminar la temporada las
+ * victorias duplican a las derrotas) y cada derrota resta 5, pero en
+ * total la temporada no quita mas de un decimo de la fama acumulada.
+ * 
+ * @param nuevasVictorias Victorias de la temporada
+ * @param nuevasDerrotas Derrotas de la temporada
+ * @return Cambio neto de fama
+ */
+int Gladiador::registrarTemporada(int nuevasVictorias, int nuevasDerrotas) {
+    nuevasVictorias = max(0, nuevasVictorias);
+    nuevasDerrotas = max(0, nuevasDerrotas);
+    victorias += nuevasVictorias;
+    derrotas += nuevasDerrotas;
+    
+    int famaInicial = fama;
+    int porVictoria = victorias > derrotas * 2 ? 15 : 10;
+    ganarFama(nuevasVictorias * porVictoria);
+    int famaPerdida = min(5 * nuevasDerrotas, fama / 10);
+    fama -= famaPerdida;
+    
+    cout << nombre << " cierra la temporada con " << nuevasVictorias << " victorias y "
+         << nuevasDerrotas << " derrotas. Fama: " << fama << endl;
+    return fama - famaInicial;
+}
+
+int Gladiador::getFama() const { return fama; }
+int Gladiador::getVictorias() const { return victorias; }
+int Gladiador::getDerrotas() const { return derrotas; }
+
 /**
  * @brief Implementacion del metodo aprenderTecnica
  * 
- * Añade una nueva tecnica especial al repertorio del gladiador,
- * verificando que no la conozca ya.
+ * Si la tecnica no esta en el catalogo global, se registra con la formula
+ * por defecto.
  * 
  * @param nombreTecnica Nombre de la tecnica a aprender
- * @return true si se aprendio la tecnica, false si ya la conocia
+ * @return true si se aprendio con exito, false si ya la conocia
  */
 bool Gladiador::aprenderTecnica(const string& nombreTecnica) {
     if (nombreTecnica.empty()) {
@@ -105,13 +139,38 @@ bool Gladiador::aprenderTecnica(const string& nombreTecnica) {
         return false;
     }
     
+    return aprenderTecnica(CatalogoTecnicas::global().obtener(nombreTecnica));
+}
+
+/**
+ * @brief Implementacion del metodo aprenderTecnica por identificador
+ * 
+ * La formula se copia del catalogo en este momento, asi que usar la tecnica
+ * no vuelve a consultarlo.
+ * 
+ * @param idTecnica Identificador de la tecnica
+ * @return true si se aprendio con exito, false si ya la conocia o no existe
+ */
+bool Gladiador::aprenderTecnica(int idTecnica) {
+    const CatalogoTecnicas& catalogo = CatalogoTecnicas::global();
+    if (idTecnica < 0 || idTecnica >= static_cast<int>(catalogo.getCantidad())) {
+        cout << "La técnica no existe en el catálogo." << endl;
+        return false;
+    }
+    const string& nombreTecnica = catalogo.getNombre(idTecnica);
+    
     // Verifica si ya conoce la técnica
-    if (find(tecnicasEspeciales.begin(), tecnicasEspeciales.end(), nombreTecnica) != tecnicasEspeciales.end()) {
+    if (posicionTecnica(idTecnica) >= 0) {
         cout << nombre << " ya conoce la técnica \"" << nombreTecnica << "\"." << endl;
         return false;
     }
     
-    tecnicasEspeciales.push_back(nombreTecnica);
+    if (idTecnica >= static_cast<int>(posicionPorTecnica.size())) {
+        posicionPorTecnica.resize(idTecnica + 1, -1);
+    }
+    posicionPorTecnica[idTecnica] = static_cast<int>(tecnicasEspeciales.size());
+    tecnicasEspeciales.push_back(idTecnica);
+    formulasTecnicas.push_back(catalogo.getFormula(idTecnica));
     cout << nombre << " ha aprendido la técnica \"" << nombreTecnica << "\"." << endl;
     return true;
 }
@@ -119,31 +178,46 @@ bool Gladiador::aprenderTecnica(const string& nombreTecnica) {
 /**
  * @brief Implementacion del metodo usarTecnica
  * 
- * Permite al gladiador utilizar una de sus tecnicas especiales
- * en combate, causando daño basado en sus atributos.
- * Requiere gastar estamina.
+ * Resuelve el nombre con el catalogo global y usa la tecnica por su
+ * identificador.
  * 
  * @param nombreTecnica Nombre de la tecnica a utilizar
  * @return Valor numerico que representa el daño causado
  */
 int Gladiador::usarTecnica(const string& nombreTecnica) {
-    // Verifica si conoce la técnica
-    auto it = find(tecnicasEspeciales.begin(), tecnicasEspeciales.end(), nombreTecnica);
-    if (it == tecnicasEspeciales.end()) {
+    int idTecnica = CatalogoTecnicas::global().buscar(nombreTecnica);
+    if (posicionTecnica(idTecnica) < 0) {
         cout << nombre << " no conoce la técnica \"" << nombreTecnica << "\"." << endl;
         return 0;
     }
+    return usarTecnica(idTecnica);
+}
+
+/**
+ * @brief Implementacion del metodo usarTecnica por identificador
+ * 
+ * El daño sale de la formula copiada al aprender la tecnica mas un bonus por
+ * antiguedad (las tecnicas aprendidas antes son mas poderosas).
+ * 
+ * @param idTecnica Identificador de la tecnica en el catalogo global
+ * @return Valor numerico que representa el daño causado
+ */
+int Gladiador::usarTecnica(int idTecnica) {
+    int posicion = posicionTecnica(idTecnica);
+    if (posicion < 0) {
+        cout << nombre << " no conoce esa técnica." << endl;
+        return 0;
+    }
+    const FormulaTecnica& formula = formulasTecnicas[posicion];
     
-    int costoEstamina = 15;
-    if (!gastarEstamina(costoEstamina)) {
+    if (!gastarEstamina(formula.costoEstamina)) {
         return 0;
     }
     
-    cout << nombre << " ejecuta la técnica especial \"" << nombreTecnica << "\"!" << endl;
+    cout << nombre << " ejecuta la técnica especial \"" << CatalogoTecnicas::global().getNombre(idTecnica) << "\"!" << endl;
     
-    // Daño basado en fuerza, nivel, destreza y posición de la técnica (más antiguas, más poderosas)
-    int posicionTecnica = distance(tecnicasEspeciales.begin(), it);
-    int danio = fuerza + nivelPersonaje + destreza / 2 + (tecnicasEspeciales.size() - posicionTecnica);
+    int antiguedad = static_cast<int>(tecnicasEspeciales.size()) - posicion;
+    int danio = CatalogoTecnicas::calcularDanio(formula, getFuerza(), getDestreza(), nivelPersonaje) + antiguedad;
     
     cout << "La técnica causa " << danio << " puntos de daño!" << endl;
     
@@ -153,6 +227,13 @@ int Gladiador::usarTecnica(const string& nombreTecnica) {
     return danio;
 }
 
+const vector<int>& Gladiador::getTecnicas() const { return tecnicasEspeciales; }
+
+int Gladiador::posicionTecnica(int idTecnica) const {
+    return idTecnica >= 0 && idTecnica < static_cast<int>(posicionPorTecnica.size())
+        ? posicionPorTecnica[idTecnica] : -1;
+}
+
 /**
  * @brief Implementacion del metodo intimidar
  * 
@@ -226,7 +307,7 @@ void Gladiador::mostrarInfo() const {
     if (!tecnicasEspeciales.empty()) {
         cout << "    - ";
         for (size_t i = 0; i < tecnicasEspeciales.size(); ++i) {
-            cout << tecnicasEspeciales[i] << (i == tecnicasEspeciales.size() - 1 ? "" : ", ");
+            cout << CatalogoTecnicas::global().getNombre(tecnicasEspeciales[i]) << (i == tecnicasEspeciales.size() - 1 ? "" : ", ");
         }
         cout << endl;
     }
@@ -256,3 +337,110 @@ int Gladiador::atacar(MovimientoCombate movimiento) {
     
     return danioBase;
 }
+
+/**
+ * @brief Implementacion del metodo estimarAtaque
+ *
+ * @param movimiento Tipo de movimiento de ataque
+ * @param arma Arma a evaluar
+ * @return Distribucion del daño del ataque, con el bonus de experiencia en los golpes que hacen daño
+ */
+DistribucionDanio Gladiador::estimarAtaque(MovimientoCombate movimiento, const InterfazArmas& arma) const {
+    DistribucionDanio distribucion = Guerrero::estimarAtaque(movimiento, arma);
+    int bonusExperiencia = min(5, (victorias + derrotas) / 10);
+    for (int i = 0; i < distribucion.cantidad; ++i) {
+        if (distribucion.valores[i] > 0) {
+            distribucion.valores[i] += bonusExperiencia;
+        }
+    }
+    return distribucion;
+}
+
+uint64_t Gladiador::getFirmaCombate() const {
+    return mezclarFirma(Guerrero::getFirmaCombate(), min(5, (victorias + derrotas) / 10));
+}
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Gladiador::clonar() const {
+    return make_unique<Gladiador>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: fama, victorias, derrotas, cantidad de tecnicasEspeciales.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Gladiador::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = fama;
+    estado[1] = victorias;
+    estado[2] = derrotas;
+    estado[3] = static_cast<int>(tecnicasEspeciales.size());
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * Las listas se restauran descartando lo agregado después del checkpoint.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Gladiador::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    fama = estado[0];
+    victorias = estado[1];
+    derrotas = estado[2];
+    if (estado[3] >= 0 && static_cast<size_t>(estado[3]) < tecnicasEspeciales.size()) {
+        for (size_t i = estado[3]; i < tecnicasEspeciales.size(); ++i) {
+            posicionPorTecnica[tecnicasEspeciales[i]] = -1;
+        }
+        tecnicasEspeciales.resize(estado[3]);
+        formulasTecnicas.resize(estado[3]);
+    }
+}
+
+/**
+ * @brief Implementación del método guardarElementosClase
+ * 
+ * Guarda las técnicas por nombre: los identificadores dependen del orden en
+ * que se registraron en el catálogo de este proceso.
+ * 
+ * @param elementos Lista a completar
+ */
+void Gladiador::guardarElementosClase(vector<ElementoClase>& elementos) const {
+    const CatalogoTecnicas& catalogo = CatalogoTecnicas::global();
+    for (int idTecnica : tecnicasEspeciales) {
+        elementos.push_back(ElementoClase{catalogo.getNombre(idTecnica), {0, 0}});
+    }
+}
+
+/**
+ * @brief Implementación del método restaurarElementosClase
+ * 
+ * Las técnicas que no están en el catálogo se registran con la fórmula por
+ * defecto, igual que al aprenderlas por nombre.
+ * 
+ * @param elementos Técnicas guardadas con guardarElementosClase
+ */
+void Gladiador::restaurarElementosClase(const vector<ElementoClase>& elementos) {
+    for (int idTecnica : tecnicasEspeciales) {
+        posicionPorTecnica[idTecnica] = -1;
+    }
+    tecnicasEspeciales.clear();
+    formulasTecnicas.clear();
+    
+    CatalogoTecnicas& catalogo = CatalogoTecnicas::global();
+    for (const ElementoClase& elemento : elementos) {
+        int idTecnica = catalogo.obtener(elemento.texto);
+        if (idTecnica < 0 || posicionTecnica(idTecnica) >= 0) continue;
+        if (idTecnica >= static_cast<int>(posicionPorTecnica.size())) {
+            posicionPorTecnica.resize(idTecnica + 1, -1);
+        }
+        posicionPorTecnica[idTecnica] = static_cast<int>(tecnicasEspeciales.size());
+        tecnicasEspeciales.push_back(idTecnica);
+        formulasTecnicas.push_back(catalogo.getFormula(idTecnica));
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Guerrero.hpp"
+#include "../CatalogoTecnicas.hpp"
 
 /**
  * @brief Clase que representa un personaje de tipo Gladiador
@@ -15,7 +16,22 @@ private:
     int derrotas;
     string arenaPrincipal;
     string titulo;
-    vector<string> tecnicasEspeciales;
+    vector<int> tecnicasEspeciales;             ///< Ids del catalogo global, en orden de aprendizaje
+    vector<FormulaTecnica> formulasTecnicas;    ///< Formula de cada tecnica, en paralelo a tecnicasEspeciales
+    vector<int> posicionPorTecnica;             ///< Posicion en tecnicasEspeciales indexada por id, -1 si no la conoce
+    
+    /**
+     * @brief Busca la posicion de una tecnica conocida
+     * @param idTecnica Identificador de la tecnica
+     * @return Posicion en tecnicasEspeciales, -1 si no la conoce
+     */
+    int posicionTecnica(int idTecnica) const;
+
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+    void guardarElementosClase(vector<ElementoClase>& elementos) const override;
+    void restaurarElementosClase(const vector<ElementoClase>& elementos) override;
 
 public:
     // ==========================================
@@ -68,6 +84,22 @@ public:
      */
     void registrarDerrota();
     
+    /**
+     * @brief Registra de una vez los resultados de una temporada de liga
+     * 
+     * Equivale a registrar cada combate por separado, pero con un solo
+     * cambio de fama y un solo mensaje.
+     * 
+     * @param nuevasVictorias Victorias de la temporada
+     * @param nuevasDerrotas Derrotas de la temporada
+     * @return Cambio neto de fama
+     */
+    int registrarTemporada(int nuevasVictorias, int nuevasDerrotas);
+    
+    int getFama() const;
+    int getVictorias() const;
+    int getDerrotas() const;
+    
     // ==========================================
     // HABILIDADES DE GLADIADOR
     // ==========================================
@@ -79,6 +111,13 @@ public:
      */
     bool aprenderTecnica(const string& nombreTecnica);
     
+    /**
+     * @brief Aprende una tecnica del catalogo global por su identificador
+     * @param idTecnica Identificador de la tecnica
+     * @return true si se aprendio con exito, false si ya la conocia o no existe
+     */
+    bool aprenderTecnica(int idTecnica);
+    
     /**
      * @brief Usa una tecnica especial en combate
      * @param nombreTecnica Nombre de la tecnica a utilizar
@@ -86,6 +125,15 @@ public:
      */
     int usarTecnica(const string& nombreTecnica);
     
+    /**
+     * @brief Usa una tecnica especial por su identificador, sin comparar nombres
+     * @param idTecnica Identificador de la tecnica en el catalogo global
+     * @return Valor numerico que representa el daño causado
+     */
+    int usarTecnica(int idTecnica);
+    
+    const vector<int>& getTecnicas() const;
+    
     /**
      * @brief Intenta intimidar al oponente con su fama y presencia
      * @return Valor numerico que representa el efecto de intimidacion
@@ -107,10 +155,21 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementacion personalizada del ataque para gladiadores
      * @param movimiento Tipo de movimiento de ataque a realizar
      * @return Valor numerico que representa el daño causado
      */
     int atacar(MovimientoCombate movimiento) override;
+    
+    /**
+     * @brief Estimacion del ataque con el bonus por experiencia de arena
+     * @param movimiento Tipo de movimiento de ataque
+     * @param arma Arma a evaluar
+     * @return Distribucion del daño del ataque
+     */
+    DistribucionDanio estimarAtaque(MovimientoCombate movimiento, const InterfazArmas& arma) const override;
+    uint64_t getFirmaCombate() const override;
 };
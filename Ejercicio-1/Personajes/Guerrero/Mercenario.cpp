@@ -32,11 +32,12 @@ bool Mercenario::aceptarContrato(string objetivo, int recompensa) {
     }
     
     // Verificar si ya tiene este contrato
-    if (find(contratos.begin(), contratos.end(), objetivo) != contratos.end()) {
+    if (recompensasContratos.count(objetivo) > 0) {
         cout << nombre << " ya tiene un contrato para " << objetivo << "." << endl;
         return false;
     }
     
+    recompensasContratos[objetivo] = ContratoActivo{recompensa, contratos.size()};
     contratos.push_back(objetivo);
     cout << nombre << " ha aceptado un contrato para " << objetivo << " por " << recompensa << " monedas de oro." << endl;
     
@@ -47,19 +48,26 @@ bool Mercenario::aceptarContrato(string objetivo, int recompensa) {
  * @brief Implementación del método completarContrato
  * 
  * Marca un contrato como completado, eliminándolo de la lista activa
- * y aumentando la reputación del mercenario.
+ * (el último objetivo ocupa su lugar) y aumentando la reputación del
+ * mercenario.
  * 
  * @param objetivo Nombre del objetivo del contrato completado
  * @return true si se completa el contrato, false si no lo tenía
  */
 bool Mercenario::completarContrato(string objetivo) {
-    auto it = find(contratos.begin(), contratos.end(), objetivo);
-    if (it == contratos.end()) {
+    auto it = recompensasContratos.find(objetivo);
+    if (it == recompensasContratos.end()) {
         cout << nombre << " no tiene un contrato para " << objetivo << "." << endl;
         return false;
     }
     
-    contratos.erase(it);
+    const size_t posicion = it->second.posicion;
+    recompensasContratos.erase(it);
+    if (posicion + 1 < contratos.size()) {
+        contratos[posicion] = move(contratos.back());
+        recompensasContratos.at(contratos[posicion]).posicion = posicion;
+    }
+    contratos.pop_back();
     cout << nombre << " ha completado el contrato para " << objetivo << "." << endl;
     
     // Aumentar reputación al completar un contrato
@@ -69,6 +77,82 @@ bool Mercenario::completarContrato(string objetivo) {
     return true;
 }
 
+/**
+ * @brief Implementación del método tomarContrato
+ * 
+ * @param mercado Mercado de contratos
+ * @return true si consiguió un contrato
+ */
+bool Mercenario::tomarContrato(MercadoContratos& mercado) {
+    Contrato contrato;
+    if (!mercado.tomarMejor(reputacion, contrato)) {
+        cout << nombre << " no encuentra contratos a su altura." << endl;
+        return false;
+    }
+    
+    auto it = recompensasContratos.find(contrato.objetivo);
+    if (it != recompensasContratos.end()) {
+        it->second.recompensa += contrato.recompensa;
+        cout << nombre << " suma otra recompensa por " << contrato.objetivo << ": "
+             << it->second.recompensa << " monedas de oro en total." << endl;
+        return true;
+    }
+    if (!aceptarContrato(contrato.objetivo, contrato.recompensa)) {
+        mercado.devolver(contrato);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Implementación del método tomarContrato por objetivo
+ * 
+ * @param objetivo Nombre del objetivo
+ * @param mercado Mercado de contratos
+ * @return true si consiguió un contrato
+ */
+bool Mercenario::tomarContrato(const string& objetivo, MercadoContratos& mercado) {
+    Contrato contrato;
+    if (!mercado.tomarPorObjetivo(objetivo, reputacion, contrato)) {
+        cout << nombre << " no encuentra contratos sobre " << objetivo << "." << endl;
+        return false;
+    }
+    
+    auto it = recompensasContratos.find(objetivo);
+    if (it != recompensasContratos.end()) {
+        it->second.recompensa += contrato.recompensa;
+        return true;
+    }
+    if (!aceptarContrato(objetivo, contrato.recompensa)) {
+        mercado.devolver(contrato);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Implementación del método completarContrato con pago en el mercado
+ * 
+ * El pago es la recompensa acordada mejorada por la negociación del
+ * mercenario.
+ * 
+ * @param objetivo Nombre del objetivo del contrato completado
+ * @param mercado Mercado que paga la recompensa
+ * @return true si se completa el contrato, false si no lo tenía
+ */
+bool Mercenario::completarContrato(const string& objetivo, MercadoContratos& mercado) {
+    auto it = recompensasContratos.find(objetivo);
+    if (it == recompensasContratos.end()) {
+        cout << nombre << " no tiene un contrato para " << objetivo << "." << endl;
+        return false;
+    }
+    int recompensa = it->second.recompensa;
+    
+    completarContrato(objetivo);
+    mercado.registrarPago(this, negociarMejorPrecio(recompensa));
+    return true;
+}
+
 /**
  * @brief Implementación del método cobrarRecompensa
  * 
@@ -102,7 +186,7 @@ int Mercenario::atacarPorSorpresa() {
     }
     
     // Daño basado en destreza, sigilo y nivel
-    int danio = destreza + bonusSigilo + nivelPersonaje / 2;
+    int danio = getDestreza() + bonusSigilo + nivelPersonaje / 2;
     cout << "¡" << nombre << " ataca por sorpresa, causando " << danio << " puntos de daño!" << endl;
     
     return danio;
@@ -120,7 +204,7 @@ int Mercenario::atacarPorSorpresa() {
 int Mercenario::negociarMejorPrecio(int precioBase) {
     if (precioBase <= 0) return 0;
     
-    int bonusNegociacion = inteligencia / 2 + reputacion / 5;
+    int bonusNegociacion = getInteligencia() / 2 + reputacion / 5;
     int precioFinal = precioBase + bonusNegociacion;
     
     cout << nombre << " negocia un mejor precio. ";
@@ -130,6 +214,10 @@ int Mercenario::negociarMejorPrecio(int precioBase) {
     return precioFinal;
 }
 
+int Mercenario::getOro() const { return oro; }
+int Mercenario::getReputacion() const { return reputacion; }
+size_t Mercenario::getCantidadContratos() const { return contratos.size(); }
+
 /**
  * @brief Implementación del método mostrarInfo
  * 
@@ -170,7 +258,7 @@ int Mercenario::atacar(MovimientoCombate movimiento) {
     
     // Los mercenarios son especialmente efectivos con el Golpe Rápido
     if (movimiento == MovimientoCombate::GolpeRapido) {
-        int bonus = destreza / 4 + bonusSigilo / 2;
+        int bonus = getDestreza() / 4 + bonusSigilo / 2;
         if (bonus > 0) {
             cout << nombre << " aprovecha su velocidad y sigilo para un golpe más eficaz (+";
             cout << bonus << " al daño)." << endl;
@@ -180,3 +268,95 @@ int Mercenario::atacar(MovimientoCombate movimiento) {
     
     return danioBase;
 }
+
+/**
+ * @brief Implementación del método estimarAtaque
+ *
+ * @param movimiento Tipo de movimiento de ataque
+ * @param arma Arma a evaluar
+ * @return Distribución del daño del ataque, con el bonus de velocidad en GolpeRapido
+ */
+DistribucionDanio Mercenario::estimarAtaque(MovimientoCombate movimiento, const InterfazArmas& arma) const {
+    DistribucionDanio distribucion = Guerrero::estimarAtaque(movimiento, arma);
+    if (movimiento == MovimientoCombate::GolpeRapido) {
+        int bonus = getDestreza() / 4 + bonusSigilo / 2;
+        if (bonus > 0) {
+            for (int i = 0; i < distribucion.cantidad; ++i) {
+                distribucion.valores[i] += bonus;
+            }
+        }
+    }
+    return distribucion;
+}
+
+uint64_t Mercenario::getFirmaCombate() const {
+    return mezclarFirma(Guerrero::getFirmaCombate(), getDestreza() / 4 + bonusSigilo / 2);
+}
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Mercenario::clonar() const {
+    return make_unique<Mercenario>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: oro, reputacion, bonusSigilo, cantidad de contratos.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Mercenario::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = oro;
+    estado[1] = reputacion;
+    estado[2] = bonusSigilo;
+    estado[3] = static_cast<int>(contratos.size());
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * Las listas se restauran descartando lo agregado después del checkpoint.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Mercenario::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    oro = estado[0];
+    reputacion = estado[1];
+    bonusSigilo = estado[2];
+    if (estado[3] >= 0 && static_cast<size_t>(estado[3]) < contratos.size()) {
+        for (size_t i = estado[3]; i < contratos.size(); ++i) {
+            recompensasContratos.erase(contratos[i]);
+        }
+        contratos.resize(estado[3]);
+    }
+}
+
+/**
+ * @brief Implementación del método guardarElementosClase
+ * 
+ * Cada contrato guarda su objetivo y la recompensa acordada.
+ * 
+ * @param elementos Lista a completar
+ */
+void Mercenario::guardarElementosClase(vector<ElementoClase>& elementos) const {
+    for (const string& objetivo : contratos) {
+        elementos.push_back(ElementoClase{objetivo, {recompensasContratos.at(objetivo).recompensa, 0}});
+    }
+}
+
+/**
+ * @brief Implementación del método restaurarElementosClase
+ * @param elementos Contratos guardados con guardarElementosClase
+ */
+void Mercenario::restaurarElementosClase(const vector<ElementoClase>& elementos) {
+    contratos.clear();
+    recompensasContratos.clear();
+    for (const ElementoClase& elemento : elementos) {
+        if (recompensasContratos.count(elemento.texto) > 0) continue;
+        recompensasContratos[elemento.texto] = ContratoActivo{elemento.valores[0], contratos.size()};
+        contratos.push_back(elemento.texto);
+    }
+}
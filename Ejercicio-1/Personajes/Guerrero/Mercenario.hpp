@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../Guerrero.hpp"
+#include "../MercadoContratos.hpp"
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -12,11 +14,24 @@
 class Mercenario : public Guerrero {
 private:
     int oro;
+    /// Contrato activo: recompensa acordada y posición en la lista de objetivos
+    struct ContratoActivo {
+        int recompensa;
+        size_t posicion;
+    };
+
     vector<string> contratos;
+    unordered_map<string, ContratoActivo> recompensasContratos;  ///< Objetivo -> contrato activo
     int reputacion;
     int bonusSigilo;
     string ultimoEmpleador;
 
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+    void guardarElementosClase(vector<ElementoClase>& elementos) const override;
+    void restaurarElementosClase(const vector<ElementoClase>& elementos) override;
+
 public:
     // ==========================================
     // CONSTRUCTORES
@@ -65,6 +80,39 @@ public:
      */
     bool completarContrato(string objetivo);
     
+    /**
+     * @brief Toma del mercado el contrato mejor pago al que alcanza su reputación
+     * 
+     * Si ya tenía un contrato sobre el mismo objetivo, las recompensas se suman;
+     * si no lo puede aceptar, el contrato vuelve al mercado.
+     * 
+     * @param mercado Mercado de contratos
+     * @return true si consiguió un contrato
+     */
+    bool tomarContrato(MercadoContratos& mercado);
+    
+    /**
+     * @brief Toma del mercado el contrato mejor pago sobre un objetivo
+     * 
+     * Si no lo puede aceptar, el contrato vuelve al mercado.
+     * 
+     * @param objetivo Nombre del objetivo
+     * @param mercado Mercado de contratos
+     * @return true si consiguió un contrato
+     */
+    bool tomarContrato(const string& objetivo, MercadoContratos& mercado);
+    
+    /**
+     * @brief Completa un contrato y deja su pago pendiente en el mercado
+     * 
+     * El oro se acredita cuando el mercado liquida los pagos.
+     * 
+     * @param objetivo Nombre del objetivo del contrato completado
+     * @param mercado Mercado que paga la recompensa
+     * @return true si se completa el contrato, false si no lo tenía
+     */
+    bool completarContrato(const string& objetivo, MercadoContratos& mercado);
+    
     /**
      * @brief Añade oro al mercenario por una recompensa cobrada
      * @param cantidad Cantidad de oro a cobrar
@@ -88,6 +136,10 @@ public:
      */
     int negociarMejorPrecio(int precioBase);
     
+    int getOro() const;
+    int getReputacion() const;
+    size_t getCantidadContratos() const;
+    
     // ==========================================
     // SOBRESCRITURAS DE MÉTODOS BASE
     // ==========================================
@@ -97,10 +149,21 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementación especializada de ataque para mercenarios
      * @param movimiento Tipo de movimiento de ataque a realizar
      * @return Valor numérico que representa el daño causado
      */
     int atacar(MovimientoCombate movimiento) override;
+    
+    /**
+     * @brief Estimación del ataque con el bonus de velocidad y sigilo
+     * @param movimiento Tipo de movimiento de ataque
+     * @param arma Arma a evaluar
+     * @return Distribución del daño del ataque
+     */
+    DistribucionDanio estimarAtaque(MovimientoCombate movimiento, const InterfazArmas& arma) const override;
+    uint64_t getFirmaCombate() const override;
 };
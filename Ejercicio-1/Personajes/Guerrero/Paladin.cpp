@@ -64,7 +64,7 @@ int Paladin::castigarMalvados() {
     
     fe -= costoFe;
     
-    int danioCastigo = fuerza + poderSagrado + nivelDevocion / 3;
+    int danioCastigo = getFuerza() + poderSagrado + nivelDevocion / 3;
     cout << "¡El castigo divino causa " << danioCastigo << " puntos de daño!" << endl;
     cout << "Fe restante: " << fe << endl;
     
@@ -92,7 +92,7 @@ int Paladin::imponerManos(string objetivo) {
     
     fe -= costoFe;
     
-    int curacion = poderSagrado + nivelDevocion / 2 + constitucion / 4;
+    int curacion = poderSagrado + nivelDevocion / 2 + getConstitucion() / 4;
     cout << nombre << " cura " << curacion << " puntos de vida a " << objetivo << "." << endl;
     cout << "Fe restante: " << fe << endl;
     
@@ -150,6 +150,34 @@ bool Paladin::activarAuraDivina() {
     return true;
 }
 
+/**
+ * @brief Implementación del método activarAuraDivina sobre un motor de auras
+ * 
+ * Si el aura propia todavía no estaba activa, se paga su costo de fe.
+ * 
+ * @param motor Motor de auras donde está registrado el paladín
+ * @param indice Índice del paladín en el motor
+ * @return true si el aura quedó activa sobre el equipo
+ */
+bool Paladin::activarAuraDivina(MotorAuras& motor, int indice) {
+    if (!auraDivina && !activarAuraDivina()) {
+        return false;
+    }
+    
+    int tipo = motor.buscar("Aura Divina");
+    if (tipo < 0) {
+        tipo = motor.definir(DefinicionAura{"Aura Divina", AtributoPersonaje::Defensa, RADIO_AURA_DIVINA});
+    }
+    motor.desactivar(indice, tipo);
+    if (!motor.activar(indice, tipo, poderSagrado / 2, 0)) {
+        return false;
+    }
+    
+    cout << "El aura divina de " << nombre << " protege a los aliados cercanos (+"
+         << poderSagrado / 2 << " de defensa)." << endl;
+    return true;
+}
+
 /**
  * @brief Implementación del método mostrarInfo
  * 
@@ -181,7 +209,7 @@ bool Paladin::recibirDanio(int cantidad, bool esCombatePPT) {
     if (!esCombatePPT) {
         if (auraDivina && cantidad > 0) {
             // El aura divina reduce el daño recibido
-            int reduccion = min(cantidad / 3, poderSagrado / 2);
+            int reduccion = getReduccionDanio().calcular(cantidad);
             if (reduccion > 0) {
                 cout << "El aura divina de " << nombre << " reduce el daño en " << reduccion << " puntos." << endl;
                 cantidad -= reduccion;
@@ -192,6 +220,17 @@ bool Paladin::recibirDanio(int cantidad, bool esCombatePPT) {
     return Guerrero::recibirDanio(cantidad, esCombatePPT); // Llamamos al método base con el daño ajustado
 }
 
+/**
+ * @brief Implementación del método getReduccionDanio
+ *
+ * Con el aura divina activa descuenta un tercio del golpe, hasta la mitad del poder sagrado.
+ *
+ * @return Reducción vigente
+ */
+ReduccionDanio Paladin::getReduccionDanio() const {
+    return auraDivina ? ReduccionDanio{3, poderSagrado / 2} : ReduccionDanio{0, 0};
+}
+
 /**
  * @brief Implementación especializada del método curar
  * 
@@ -213,3 +252,37 @@ void Paladin::curar(int cantidad) {
     
     Guerrero::curar(cantidad); // Llamamos al método base con la curación ajustada
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Paladin::clonar() const {
+    return make_unique<Paladin>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: fe, poderSagrado, nivelDevocion, auraDivina.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Paladin::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = fe;
+    estado[1] = poderSagrado;
+    estado[2] = nivelDevocion;
+    estado[3] = auraDivina ? 1 : 0;
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Paladin::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    fe = estado[0];
+    poderSagrado = estado[1];
+    nivelDevocion = estado[2];
+    auraDivina = estado[3] != 0;
+}
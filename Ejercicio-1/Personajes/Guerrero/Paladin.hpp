@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Guerrero.hpp"
+#include "../MotorAuras.hpp"
 
 /**
  * @brief Clase que representa un personaje de tipo Paladín
@@ -16,6 +17,10 @@ private:
     bool auraDivina;
     int nivelDevocion;
 
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+
 public:
     // ==========================================
     // CONSTRUCTORES
@@ -80,6 +85,18 @@ public:
      */
     bool activarAuraDivina();
     
+    /**
+     * @brief Activa el aura divina y la extiende a los aliados cercanos
+     * 
+     * Los aliados dentro de RADIO_AURA_DIVINA reciben un bonus de defensa
+     * mientras el paladín siga en pie. Varias auras divinas no se acumulan.
+     * 
+     * @param motor Motor de auras donde está registrado el paladín
+     * @param indice Índice del paladín en el motor
+     * @return true si el aura quedó activa sobre el equipo
+     */
+    bool activarAuraDivina(MotorAuras& motor, int indice);
+    
     // ==========================================
     // SOBRESCRITURAS DE MÉTODOS BASE
     // ==========================================
@@ -89,6 +106,8 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementación especializada para recibir daño
      * 
@@ -99,6 +118,12 @@ public:
      * @return true si sigue vivo, false si ha muerto
      */
     bool recibirDanio(int cantidad, bool esCombatePPT) override;
+
+    /**
+     * @brief Reducción que recibirDanio aplica con el estado actual
+     * @return Reducción vigente
+     */
+    ReduccionDanio getReduccionDanio() const override;
     
     /**
      * @brief Implementación especializada para curar heridas
@@ -4,10 +4,110 @@
 #include <vector>
 #include <memory>
 #include "../Arma/InterfazArmas.hpp"
+#include "CheckpointPersonaje.hpp"
 #include "enumPersonajes.hpp"
 
 using namespace std;
 
+/**
+ * @brief Reduccion que aplica un personaje al daño recibido fuera del combate PPT
+ *
+ * Todas las defensas de las subclases tienen la forma
+ * min(cantidad / divisor, tope); divisor 0 indica que no hay reduccion.
+ */
+struct ReduccionDanio {
+    int divisor;
+    int tope;
+
+    /**
+     * @brief Calcula cuanto se descuenta de un golpe
+     * @param cantidad Daño del golpe
+     * @return Puntos descontados (puede ser 0)
+     */
+    int calcular(int cantidad) const {
+        if (divisor <= 0) return 0;
+        int reduccion = cantidad / divisor;
+        return reduccion < tope ? reduccion : tope;
+    }
+};
+
+/**
+ * @brief Inventario de armas que se duplica arma por arma al copiarse
+ *
+ * Los unique_ptr no se pueden copiar; con este tipo cada personaje puede
+ * copiarse con la asignacion implicita y solo el inventario sabe clonar sus
+ * armas.
+ */
+class InventarioArmas : public vector<unique_ptr<InterfazArmas>> {
+public:
+    InventarioArmas() = default;
+    InventarioArmas(InventarioArmas&&) = default;
+    InventarioArmas& operator=(InventarioArmas&&) = default;
+
+    InventarioArmas(const InventarioArmas& otro) {
+        reserve(otro.size());
+        for (const auto& arma : otro) {
+            push_back(arma ? arma->clonar() : nullptr);
+        }
+    }
+
+    InventarioArmas& operator=(const InventarioArmas& otro) {
+        if (this != &otro) {
+            InventarioArmas copia(otro);
+            swap(copia);
+        }
+        return *this;
+    }
+};
+
+/**
+ * @brief Atributos base de un personaje, sin modificadores
+ *
+ * Es lo que la fabrica sortea o lee de un roster para ajustar un clon del
+ * prototipo sin volver a pasar por el constructor.
+ */
+struct AtributosPersonaje {
+    int nivel;
+    int hpMaximo;
+    int hpActual;
+    Raza raza;
+    int fuerza;
+    int destreza;
+    int constitucion;
+    int inteligencia;
+    int recursoMaximo;    ///< Mana o estamina
+    int recursoActual;
+};
+
+/// Cantidad de rasgos fijos de clase que entran en EstadoClasePersonaje
+static const int MAX_RASGOS_CLASE = 4;
+
+/**
+ * @brief Elemento de una lista propia de una subclase (tecnica, contrato, servidor...)
+ *
+ * valores guarda lo que la subclase asocia al texto, por ejemplo la
+ * recompensa de un contrato o el HP y el daño de un servidor; 0 si no
+ * asocia nada.
+ */
+struct ElementoClase {
+    string texto;
+    int valores[2];
+};
+
+/**
+ * @brief Todo el estado de clase y subclase que no entra en AtributosPersonaje
+ *
+ * Sirve para guardar un personaje fuera del proceso y reconstruirlo desde un
+ * clon del prototipo. contadores son los mismos valores que guarda el
+ * checkpoint; elementos reemplaza por completo las listas de la subclase en
+ * lugar de solo recortarlas.
+ */
+struct EstadoClasePersonaje {
+    int rasgos[MAX_RASGOS_CLASE];         ///< Guerrero: estilo, armadura, defensa base y resistencia fisica; Mago: escuela y fuente
+    int contadores[MAX_ESTADO_CLASE];
+    vector<ElementoClase> elementos;
+};
+
 /**
  * @brief Interfaz base para todos los tipos de personajes del juego
  * 
@@ -23,9 +123,9 @@ public:
     
     /**
      * @brief Obtiene el nombre del personaje
-     * @return String con el nombre del personaje
+     * @return Referencia al nombre, valida mientras exista el personaje
      */
-    virtual string getNombre() const = 0;
+    virtual const string& getNombre() const = 0;
     
     /**
      * @brief Establece un nuevo nombre para el personaje
@@ -78,6 +178,12 @@ public:
      */
     virtual InterfazArmas* getArma(int posicion) const = 0;
 
+    /**
+     * @brief Obtiene cuantas armas entran en el inventario
+     * @return Cantidad maxima de armas
+     */
+    virtual int getCapacidadArmas() const = 0;
+
     // ==========================================
     // METODOS DE COMBATE
     // ==========================================
@@ -89,6 +195,16 @@ public:
      */
     virtual int atacar(MovimientoCombate movimiento) = 0;
 
+    /**
+     * @brief Obtiene la reduccion que recibirDanio aplica con el estado actual
+     *
+     * Permite que las simulaciones de combate descuenten lo mismo que el
+     * personaje real sin tocarlo.
+     *
+     * @return Reduccion vigente del personaje
+     */
+    virtual ReduccionDanio getReduccionDanio() const = 0;
+
     // ==========================================
     // METODOS DE VISUALIZACION
     // ==========================================
@@ -103,6 +219,12 @@ public:
      */
     virtual void mostrarInventario() const = 0;
 
+    /**
+     * @brief Crea una copia independiente del personaje (patrón Prototype)
+     * @return Puntero unico a la copia con el mismo tipo dinamico e inventario duplicado
+     */
+    virtual unique_ptr<InterfazPersonaje> clonar() const = 0;
+
     // ==========================================
     // METODOS PARA COMBATE PPT (PIEDRA-PAPEL-TIJERA)
     // ==========================================
@@ -114,11 +236,50 @@ public:
     virtual bool setHPParaCombatePPT() = 0;
     
     /**
-     * @brief Restaura los HP originales despues de un combate PPT
+     * @brief Restaura el estado guardado al entrar en combate PPT (HP, recurso y armas)
      * @return true si se restauro con exito, false si hubo un error
      */
     virtual bool restaurarHPOriginal() = 0;
 
+    // ==========================================
+    // CHECKPOINT DE ESTADO
+    // ==========================================
+    
+    /**
+     * @brief Guarda el estado mutable del personaje y de sus armas
+     * @param destino Checkpoint donde se escribe el estado
+     */
+    virtual void guardarCheckpoint(CheckpointPersonaje& destino) const = 0;
+    
+    /**
+     * @brief Restaura un estado guardado con guardarCheckpoint
+     * @param origen Checkpoint a restaurar
+     * @return true si se restauro, false si el checkpoint es de otro tipo de personaje
+     */
+    virtual bool restaurarCheckpoint(const CheckpointPersonaje& origen) = 0;
+
+    // ==========================================
+    // ESTIMACION DE DAÑO
+    // ==========================================
+    
+    /**
+     * @brief Calcula el daño que haria atacar con un arma, sin usarla
+     *
+     * Aplica las mismas reglas que atacar a la estimacion del proximo uso
+     * del arma. El arma no tiene que estar en el inventario.
+     *
+     * @param movimiento Tipo de movimiento de ataque
+     * @param arma Arma a evaluar
+     * @return Distribucion del daño del ataque
+     */
+    virtual DistribucionDanio estimarAtaque(MovimientoCombate movimiento, const InterfazArmas& arma) const = 0;
+    
+    /**
+     * @brief Resume los valores del personaje que usa estimarAtaque
+     * @return Firma que cambia cuando cambia alguno de esos valores
+     */
+    virtual uint64_t getFirmaCombate() const = 0;
+
     /**
      * @brief Destructor virtual para permitir destruccion polimorfica
      */
@@ -1,4 +1,5 @@
 #include "Mago.hpp"
+#include <typeinfo>
 #include <algorithm>
 
 /**
@@ -16,9 +17,30 @@ Mago::Mago(string n, int nivel, int hp, Raza r, int fue, int des, int con, int i
     
     if (nivel < 1) nivelPersonaje = 1;
     if (hpMax < 1) hpMax = 1;
-    hpActual = hpMax;
+    hpActual = getHPMaximo();
     if (manaMaximo < 0) manaMaximo = 0;
     manaActual = manaMaximo;
+    modificadores.setAlBajarHPMaximo([this]() { ajustarVidaAlMaximo(); });
+}
+
+/**
+ * @brief Implementacion del constructor de copia de Mago
+ * 
+ * El inventario se clona arma por arma y el checkpoint de combate PPT
+ * tambien se copia: un clon hecho en medio de un duelo restaura el mismo
+ * estado que el original.
+ */
+Mago::Mago(const Mago& otro) : InterfazPersonaje(otro) {
+    *this = otro;
+    modificadores.setAlBajarHPMaximo([this]() { ajustarVidaAlMaximo(); });
+}
+
+/**
+ * @brief Implementacion del metodo clonar
+ * @return Copia independiente del mago
+ */
+unique_ptr<InterfazPersonaje> Mago::clonar() const {
+    return unique_ptr<InterfazPersonaje>(new Mago(*this)); // el constructor de copia es protegido
 }
 
 // ==========================================
@@ -104,7 +126,7 @@ int Mago::lanzarHechizo(const string& nombreHechizo) {
     cout << nombre << " lanza el hechizo \"" << nombreHechizo << "\"!" << endl;
     
     // Simplificado: cada hechizo tiene un daño base + nivel + inteligencia
-    int efectoHechizo = 5 + nivelPersonaje + inteligencia / 2;
+    int efectoHechizo = 5 + nivelPersonaje + getInteligencia() / 2;
     
     return efectoHechizo;
 }
@@ -118,7 +140,7 @@ int Mago::lanzarHechizo(const string& nombreHechizo) {
 void Mago::meditar() {
     cout << nombre << " medita profundamente..." << endl;
     
-    int recuperacion = 5 + inteligencia / 2;
+    int recuperacion = 5 + getInteligencia() / 2;
     recuperarMana(recuperacion);
 }
 
@@ -177,6 +199,15 @@ bool Mago::conoceHechizo(const string& nombreHechizo) const {
     return find(hechizosConocidos.begin(), hechizosConocidos.end(), nombreHechizo) != hechizosConocidos.end();
 }
 
+/**
+ * @brief Implementacion del metodo getHechizosConocidos
+ * 
+ * @return Referencia constante a los hechizos conocidos
+ */
+const vector<string>& Mago::getHechizosConocidos() const {
+    return hechizosConocidos;
+}
+
 /**
  * @brief Implementacion del metodo mostrarInfo
  * 
@@ -203,20 +234,61 @@ void Mago::mostrarInfo() const {
 int Mago::resolverMovimiento(MovimientoCombate movimiento, InterfazArmas* armaUsada) const {
     if (!armaUsada) return 0;
     
+    const EstadisticasDerivadas& stats = getEstadisticas();
     int danioBase = armaUsada->usar(); // Usar el arma para su efecto básico
     
     // Los magos son mejores con Golpe Rápido (bonus de inteligencia)
     if (movimiento == MovimientoCombate::GolpeRapido) {
-        int bonus = inteligencia / 4;
+        int bonus = stats.bonusMovimiento[static_cast<int>(movimiento)];
         if (bonus > 0) {
             cout << "¡Bonus de inteligencia: +" << bonus << " al daño!" << endl;
             danioBase += bonus;
         }
     }
     
+    if (danioBase > 0 && stats.danioExtra != 0) {
+        danioBase = max(0, danioBase + stats.danioExtra);
+    }
+    
     return danioBase;
 }
 
+/**
+ * @brief Implementacion del metodo estimarAtaque
+ *
+ * Aplica a cada resultado posible del arma los mismos bonus que resolverMovimiento.
+ *
+ * @param movimiento Tipo de movimiento de ataque
+ * @param arma Arma a evaluar
+ * @return Distribucion del daño del ataque
+ */
+DistribucionDanio Mago::estimarAtaque(MovimientoCombate movimiento, const InterfazArmas& arma) const {
+    const EstadisticasDerivadas& stats = getEstadisticas();
+    int bonus = stats.bonusMovimiento[static_cast<int>(movimiento)];
+    bool aplicaBonus = bonus > 0 && movimiento == MovimientoCombate::GolpeRapido;
+
+    DistribucionDanio distribucion = arma.estimarUso();
+    for (int i = 0; i < distribucion.cantidad; ++i) {
+        int danio = distribucion.valores[i] + (aplicaBonus ? bonus : 0);
+        if (danio > 0 && stats.danioExtra != 0) {
+            danio = max(0, danio + stats.danioExtra);
+        }
+        distribucion.valores[i] = danio;
+    }
+    return distribucion;
+}
+
+/**
+ * @brief Implementacion del metodo getFirmaCombate
+ * @return Firma del tipo, el bonus de GolpeRapido y el daño extra
+ */
+uint64_t Mago::getFirmaCombate() const {
+    const EstadisticasDerivadas& stats = getEstadisticas();
+    uint64_t firma = mezclarFirma(0, static_cast<long long>(typeid(*this).hash_code()));
+    firma = mezclarFirma(firma, stats.bonusMovimiento[static_cast<int>(MovimientoCombate::GolpeRapido)]);
+    return mezclarFirma(firma, stats.danioExtra);
+}
+
 /**
  * @brief Implementacion del metodo invocarElemental
  * 
@@ -236,7 +308,7 @@ int Mago::invocarElemental() {
     cout << "¡Un elemental aparece para ayudar a " << nombre << "!" << endl;
     
     // Daño basado en nivel e inteligencia
-    return 15 + nivelPersonaje + inteligencia;
+    return 15 + nivelPersonaje + getInteligencia();
 }
 
 /**
@@ -258,14 +330,14 @@ int Mago::proyectilMagico() {
     cout << "¡El proyectil mágico vuela velozmente hacia el objetivo!" << endl;
     
     // Daño basado en nivel e inteligencia
-    return 8 + nivelPersonaje / 2 + inteligencia / 2;
+    return 8 + nivelPersonaje / 2 + getInteligencia() / 2;
 }
 
 // ==========================================
 // IMPLEMENTACIONES DE INTERFAZPERSONAJE
 // ==========================================
 
-string Mago::getNombre() const { return nombre; }
+const string& Mago::getNombre() const { return nombre; }
 void Mago::setNombre(const string& nuevoNombre) { nombre = nuevoNombre; }
 
 int Mago::getHP() const { return hpActual; }
@@ -285,7 +357,7 @@ bool Mago::recibirDanio(int cantidad, bool esCombatePPT) {
     
     if (!esCombatePPT) {
         hpActual = max(0, hpActual - cantidad);
-        cout << nombre << " recibe " << cantidad << " puntos de daño. HP: " << hpActual << "/" << hpMax << endl;
+        cout << nombre << " recibe " << cantidad << " puntos de daño. HP: " << hpActual << "/" << getHPMaximo() << endl;
         
         if (hpActual <= 0) {
             cout << "¡" << nombre << " ha caído!" << endl;
@@ -295,7 +367,7 @@ bool Mago::recibirDanio(int cantidad, bool esCombatePPT) {
         return true; // Sigue vivo
     } 
     hpActual = max(0, hpActual - 10);
-    cout << nombre << " recibe 10 puntos de daño. HP: " << hpActual << "/" << hpMax << endl;
+    cout << nombre << " recibe 10 puntos de daño. HP: " << hpActual << "/" << getHPMaximo() << endl;
         
     if (hpActual <= 0) {
         cout << "¡" << nombre << " ha caído!" << endl;
@@ -305,6 +377,14 @@ bool Mago::recibirDanio(int cantidad, bool esCombatePPT) {
     return true;
 }
 
+/**
+ * @brief Implementacion del metodo getReduccionDanio
+ * @return Sin reduccion: las defensas propias las agregan las subclases
+ */
+ReduccionDanio Mago::getReduccionDanio() const {
+    return ReduccionDanio{0, 0};
+}
+
 /**
  * @brief Implementacion del metodo curar
  * 
@@ -316,9 +396,9 @@ void Mago::curar(int cantidad) {
     if (cantidad <= 0) return;
     
     int hpPrevio = hpActual;
-    hpActual = min(hpMax, hpActual + cantidad);
+    hpActual = min(getHPMaximo(), hpActual + cantidad);
     
-    cout << nombre << " recupera " << (hpActual - hpPrevio) << " puntos de vida. HP: " << hpActual << "/" << hpMax << endl;
+    cout << nombre << " recupera " << (hpActual - hpPrevio) << " puntos de vida. HP: " << hpActual << "/" << getHPMaximo() << endl;
 }
 
 /**
@@ -403,6 +483,8 @@ InterfazArmas* Mago::getArma(int posicion) const {
     return inventarioArmas[posicion].get();
 }
 
+int Mago::getCapacidadArmas() const { return MAX_ARMAS; }
+
 /**
  * @brief Implementacion del metodo atacar
  * 
@@ -466,10 +548,11 @@ bool Mago::equiparArma(int posicion) {
 // Implementación de getters para atributos básicos
 int Mago::getNivel() const { return nivelPersonaje; }
 Raza Mago::getRaza() const { return raza; }
-int Mago::getFuerza() const { return fuerza; }
-int Mago::getDestreza() const { return destreza; }
-int Mago::getConstitucion() const { return constitucion; }
-int Mago::getInteligencia() const { return inteligencia; }
+int Mago::getFuerza() const { return getEstadisticas().fuerza; }
+int Mago::getDestreza() const { return getEstadisticas().destreza; }
+int Mago::getConstitucion() const { return getEstadisticas().constitucion; }
+int Mago::getInteligencia() const { return getEstadisticas().inteligencia; }
+int Mago::getHPMaximo() const { return getEstadisticas().hpMaximo; }
 int Mago::getArmaEquipadaPos() const { return armaEquipadaPos; }
 
 /**
@@ -484,6 +567,121 @@ InterfazArmas* Mago::getArmaEquipada() const {
     return nullptr;
 }
 
+// ==========================================
+// ESTADISTICAS DERIVADAS
+// ==========================================
+
+/**
+ * @brief Implementacion del metodo getEstadisticas
+ * 
+ * Solo recalcula si se marco un cambio en los atributos base o si la pila
+ * de modificadores cambio de version desde el ultimo calculo.
+ * 
+ * @return Estadisticas con todos los modificadores aplicados
+ */
+const EstadisticasDerivadas& Mago::getEstadisticas() const {
+    if (estadisticasSucias || versionModificadores != modificadores.getVersion()) {
+        recalcularEstadisticas();
+        estadisticasSucias = false;
+        versionModificadores = modificadores.getVersion();
+    }
+    return estadisticas;
+}
+
+PilaModificadores& Mago::getModificadores() { return modificadores; }
+const PilaModificadores& Mago::getModificadores() const { return modificadores; }
+
+AtributosPersonaje Mago::getAtributosBase() const {
+    return AtributosPersonaje{nivelPersonaje, hpMax, hpActual, raza, fuerza, destreza, constitucion,
+                              inteligencia, manaMaximo, manaActual};
+}
+
+/**
+ * @brief Implementacion del metodo setAtributosBase
+ * 
+ * @param atributos Atributos nuevos
+ */
+void Mago::setAtributosBase(const AtributosPersonaje& atributos) {
+    nivelPersonaje = atributos.nivel;
+    hpMax = atributos.hpMaximo;
+    raza = atributos.raza;
+    fuerza = atributos.fuerza;
+    destreza = atributos.destreza;
+    constitucion = atributos.constitucion;
+    inteligencia = atributos.inteligencia;
+    manaMaximo = atributos.recursoMaximo;
+    manaActual = atributos.recursoActual;
+    marcarEstadisticasSucias();
+    hpActual = min(atributos.hpActual, getHPMaximo());
+    hpOriginalParaCombatePPT = hpActual;
+}
+
+/**
+ * @brief Implementacion del metodo setInventario
+ * 
+ * @param armas Armas nuevas
+ * @param equipada Posicion del arma equipada, -1 si ninguna
+ */
+void Mago::setInventario(vector<unique_ptr<InterfazArmas>> armas, int equipada) {
+    inventarioArmas.swap(armas);
+    armaEquipadaPos = equipada >= 0 && equipada < static_cast<int>(inventarioArmas.size()) ? equipada : -1;
+}
+
+/**
+ * @brief Implementacion del metodo getEstadoClase
+ * 
+ * @return Rasgos de la clase, contadores y listas de la subclase
+ */
+EstadoClasePersonaje Mago::getEstadoClase() const {
+    EstadoClasePersonaje estado{};
+    estado.rasgos[0] = static_cast<int>(escuela);
+    estado.rasgos[1] = static_cast<int>(fuentePoder);
+    guardarEstadoClase(estado.contadores);
+    guardarElementosClase(estado.elementos);
+    return estado;
+}
+
+/**
+ * @brief Implementacion del metodo setEstadoClase
+ * 
+ * Las listas se reemplazan antes de restaurar los contadores, que solo las
+ * recortarian si fueran mas largas que las guardadas.
+ * 
+ * @param estado Estado obtenido con getEstadoClase
+ */
+void Mago::setEstadoClase(const EstadoClasePersonaje& estado) {
+    escuela = static_cast<EscuelaMagia>(estado.rasgos[0]);
+    fuentePoder = static_cast<FuentePoder>(estado.rasgos[1]);
+    restaurarElementosClase(estado.elementos);
+    restaurarEstadoClase(estado.contadores);
+    marcarEstadisticasSucias();
+}
+
+void Mago::setHechizosConocidos(vector<string> hechizos) { hechizosConocidos = move(hechizos); }
+
+void Mago::marcarEstadisticasSucias() { estadisticasSucias = true; }
+void Mago::ajustarVidaAlMaximo() { hpActual = min(hpActual, getHPMaximo()); }
+
+/**
+ * @brief Implementacion del metodo recalcularEstadisticas
+ * 
+ * Los magos no tienen defensa base; solo la que aporten los modificadores.
+ * Golpe Rapido suma inteligencia / 4.
+ */
+void Mago::recalcularEstadisticas() const {
+    estadisticas.fuerza = modificadores.aplicar(AtributoPersonaje::Fuerza, fuerza);
+    estadisticas.destreza = modificadores.aplicar(AtributoPersonaje::Destreza, destreza);
+    estadisticas.constitucion = modificadores.aplicar(AtributoPersonaje::Constitucion, constitucion);
+    estadisticas.inteligencia = modificadores.aplicar(AtributoPersonaje::Inteligencia, inteligencia);
+    estadisticas.hpMaximo = max(1, modificadores.aplicar(AtributoPersonaje::HPMaximo, hpMax));
+    estadisticas.defensa = modificadores.aplicar(AtributoPersonaje::Defensa, 0);
+    estadisticas.danioExtra = modificadores.getPlano(AtributoPersonaje::Danio);
+    
+    estadisticas.bonusMovimiento[static_cast<int>(MovimientoCombate::GolpeFuerte)] = 0;
+    estadisticas.bonusMovimiento[static_cast<int>(MovimientoCombate::GolpeRapido)] = estadisticas.inteligencia / 4;
+    estadisticas.bonusMovimiento[static_cast<int>(MovimientoCombate::DefensaYGolpe)] = 0;
+}
+
 // ==========================================
 // METODOS PARA COMBATE PPT
 // ==========================================
@@ -492,7 +690,7 @@ InterfazArmas* Mago::getArmaEquipada() const {
  * @brief Implementacion del metodo setHPParaCombatePPT
  * 
  * Establece los HP exactamente en 100 para un combate PPT.
- * Guarda el HP actual para restaurarlo despues.
+ * Guarda un checkpoint completo (HP, recurso, armas) para restaurarlo despues.
  * 
  * @return true si se configuro correctamente, false si hubo un error
  */
@@ -503,7 +701,8 @@ bool Mago::setHPParaCombatePPT() {
             return true;
         }
         
-        // Guarda el HP actual para poder restaurarlo después
+        // Guarda el estado actual para poder restaurarlo después
+        guardarCheckpoint(checkpointCombatePPT);
         hpOriginalParaCombatePPT = hpActual;
         
         // Establece el HP exactamente a 100
@@ -520,7 +719,8 @@ bool Mago::setHPParaCombatePPT() {
 /**
  * @brief Implementacion del metodo restaurarHPOriginal
  * 
- * Restaura el HP original despues de un combate PPT.
+ * Restaura el checkpoint guardado al entrar en combate PPT: HP, recurso,
+ * durabilidad y filo de las armas, energía, dosis y contadores de la subclase.
  * 
  * @return true si se restauro correctamente, false si hubo un error
  */
@@ -531,8 +731,8 @@ bool Mago::restaurarHPOriginal() {
             return true;
         }
         
-        // Restaura el HP original
-        hpActual = hpOriginalParaCombatePPT;
+        // Restaura HP, recurso, armas y contadores de la subclase
+        restaurarCheckpoint(checkpointCombatePPT);
         enModoCombatePPT = false;
         
         return true;
@@ -549,4 +749,104 @@ bool Mago::restaurarHPOriginal() {
  */
 bool Mago::getEsCombatePPT() const {
     return enModoCombatePPT;
-}
\ No newline at end of file
+}
+
+// ==========================================
+// CHECKPOINT DE ESTADO
+// ==========================================
+
+/**
+ * @brief Implementacion del metodo guardarCheckpoint
+ * 
+ * Copia los valores que cambian durante un combate y el checkpoint de cada
+ * arma del inventario. No reserva memoria.
+ * 
+ * @param destino Checkpoint donde se escribe el estado
+ */
+void Mago::guardarCheckpoint(CheckpointPersonaje& destino) const {
+    destino = CheckpointPersonaje{};
+    destino.tipoDinamico = typeid(*this).hash_code();
+    destino.hpActual = hpActual;
+    destino.hpMax = hpMax;
+    destino.recursoActual = manaActual;
+    destino.fuerza = fuerza;
+    destino.destreza = destreza;
+    destino.constitucion = constitucion;
+    destino.inteligencia = inteligencia;
+    destino.armaEquipadaPos = armaEquipadaPos;
+    destino.cantidadHechizos = static_cast<int>(hechizosConocidos.size());
+    destino.cantidadArmas = static_cast<int>(min(inventarioArmas.size(), static_cast<size_t>(MAX_ARMAS_CHECKPOINT)));
+    for (int i = 0; i < destino.cantidadArmas; ++i) {
+        if (inventarioArmas[i]) {
+            destino.armas[i] = inventarioArmas[i]->guardarCheckpoint();
+        }
+    }
+    guardarEstadoClase(destino.estadoClase);
+}
+
+/**
+ * @brief Implementacion del metodo restaurarCheckpoint
+ * 
+ * Las armas se restauran por posicion; si el inventario cambio desde el
+ * checkpoint, las armas que no coinciden en tipo se dejan como estan.
+ * 
+ * @param origen Checkpoint a restaurar
+ * @return true si se restauro, false si el checkpoint no corresponde a el mago
+ */
+bool Mago::restaurarCheckpoint(const CheckpointPersonaje& origen) {
+    if (origen.tipoDinamico != typeid(*this).hash_code()) {
+        return false;
+    }
+    
+    hpActual = origen.hpActual;
+    hpMax = origen.hpMax;
+    manaActual = origen.recursoActual;
+    fuerza = origen.fuerza;
+    destreza = origen.destreza;
+    constitucion = origen.constitucion;
+    inteligencia = origen.inteligencia;
+    // Se descartan los hechizos aprendidos después del checkpoint
+    if (origen.cantidadHechizos >= 0 && static_cast<size_t>(origen.cantidadHechizos) < hechizosConocidos.size()) {
+        hechizosConocidos.resize(origen.cantidadHechizos);
+    }
+    
+    int armas = min(origen.cantidadArmas, static_cast<int>(inventarioArmas.size()));
+    for (int i = 0; i < armas; ++i) {
+        if (inventarioArmas[i]) {
+            inventarioArmas[i]->restaurarCheckpoint(origen.armas[i]);
+        }
+    }
+    armaEquipadaPos = origen.armaEquipadaPos < static_cast<int>(inventarioArmas.size()) ? origen.armaEquipadaPos : -1;
+    
+    restaurarEstadoClase(origen.estadoClase);
+    marcarEstadisticasSucias();
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo guardarEstadoClase
+ * 
+ * Mago no tiene contadores propios; las subclases lo redefinen.
+ * 
+ */
+void Mago::guardarEstadoClase(int[MAX_ESTADO_CLASE]) const {}
+
+/**
+ * @brief Implementacion del metodo restaurarEstadoClase
+ * 
+ */
+void Mago::restaurarEstadoClase(const int[MAX_ESTADO_CLASE]) {}
+
+/**
+ * @brief Implementacion del metodo guardarElementosClase
+ * 
+ * Mago no tiene listas propias; las subclases que las tienen lo redefinen.
+ * 
+ */
+void Mago::guardarElementosClase(vector<ElementoClase>&) const {}
+
+/**
+ * @brief Implementacion del metodo restaurarElementosClase
+ * 
+ */
+void Mago::restaurarElementosClase(const vector<ElementoClase>&) {}
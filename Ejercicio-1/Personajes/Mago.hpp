@@ -1,6 +1,7 @@
 #pragma once
 
 #include "InterfazPersonaje.hpp"
+#include "PilaModificadores.hpp"
 #include <iostream>
 #include <algorithm>
 #include <cstdlib>
@@ -26,13 +27,20 @@ protected:
     int destreza;
     int constitucion;
     int inteligencia;
-    vector<unique_ptr<InterfazArmas>> inventarioArmas;
+    InventarioArmas inventarioArmas;
     int armaEquipadaPos; // -1 si no hay arma equipada, 0+ para índice en el inventario
     static const int MAX_ARMAS = 2;
     
     // Atributos para combate PPT
     int hpOriginalParaCombatePPT = 100;
     bool enModoCombatePPT = false;
+    CheckpointPersonaje checkpointCombatePPT{};  // Estado guardado al entrar en combate PPT
+    
+    // Modificadores y estadisticas derivadas (se recalculan solo si cambio algo)
+    PilaModificadores modificadores;
+    mutable EstadisticasDerivadas estadisticas{};
+    mutable bool estadisticasSucias = true;
+    mutable uint32_t versionModificadores = 0;
     
     // ==========================================
     // ATRIBUTOS ESPECIFICOS DE MAGO
@@ -44,6 +52,73 @@ protected:
     FuentePoder fuentePoder;
     vector<string> hechizosConocidos;
     
+    // ==========================================
+    // CONSTRUCTOR DE COPIA (PATRON PROTOTYPE)
+    // ==========================================
+    
+    /**
+     * @brief Constructor de copia usado por clonar()
+     * 
+     * Copia los atributos con la asignacion implicita (el inventario se
+     * duplica solo) y registra en la pila copiada el aviso de esta copia.
+     * 
+     * @param otro Mago a copiar
+     */
+    Mago(const Mago& otro);
+    Mago& operator=(const Mago& otro) = default;
+    
+    // ==========================================
+    // CHECKPOINT DE LA SUBCLASE
+    // ==========================================
+    
+    /**
+     * @brief Guarda los contadores propios de la subclase en el checkpoint
+     * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+     */
+    virtual void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const;
+    
+    /**
+     * @brief Restaura los contadores propios de la subclase desde el checkpoint
+     * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+     */
+    virtual void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]);
+    
+    /**
+     * @brief Copia las listas propias de la subclase (tecnicas, contratos...)
+     * @param elementos Lista a completar, en el orden que define la subclase
+     */
+    virtual void guardarElementosClase(vector<ElementoClase>& elementos) const;
+    
+    /**
+     * @brief Reemplaza las listas propias de la subclase sin mostrar mensajes
+     * @param elementos Elementos guardados con guardarElementosClase
+     */
+    virtual void restaurarElementosClase(const vector<ElementoClase>& elementos);
+    
+    // ==========================================
+    // ESTADISTICAS DERIVADAS
+    // ==========================================
+    
+    /**
+     * @brief Indica que cambio un atributo base y hay que recalcular las estadisticas
+     * 
+     * Debe llamarse despues de modificar fuerza, destreza, constitucion,
+     * inteligencia, hpMax u otro valor del que dependan las estadisticas.
+     */
+    void marcarEstadisticasSucias();
+    
+    /**
+     * @brief Baja la vida actual al HP maximo efectivo si lo supera
+     * 
+     * La pila de modificadores lo llama cuando un cambio baja el HP maximo.
+     */
+    void ajustarVidaAlMaximo();
+    
+    /**
+     * @brief Recalcula las estadisticas derivadas a partir de la base y los modificadores
+     */
+    void recalcularEstadisticas() const;
+    
 public:
     // ==========================================
     // CONSTRUCTORES
@@ -70,7 +145,7 @@ public:
     // IMPLEMENTACIONES DE INTERFAZPERSONAJE
     // ==========================================
     
-    string getNombre() const override;
+    const string& getNombre() const override;
     void setNombre(const string& nombre) override;
     int getHP() const override;
     bool recibirDanio(int cantidad, bool esCombatePPT) override;
@@ -78,11 +153,18 @@ public:
     bool agregarArma(unique_ptr<InterfazArmas> arma) override;
     unique_ptr<InterfazArmas> quitarArma(int posicion) override;
     InterfazArmas* getArma(int posicion) const override;
+    int getCapacidadArmas() const override;
     int atacar(MovimientoCombate movimiento) override;
+    ReduccionDanio getReduccionDanio() const override;
     void mostrarInfo() const override;
     void mostrarInventario() const override;
+    unique_ptr<InterfazPersonaje> clonar() const override;
     bool setHPParaCombatePPT() override;
     bool restaurarHPOriginal() override;
+    void guardarCheckpoint(CheckpointPersonaje& destino) const override;
+    bool restaurarCheckpoint(const CheckpointPersonaje& origen) override;
+    DistribucionDanio estimarAtaque(MovimientoCombate movimiento, const InterfazArmas& arma) const override;
+    uint64_t getFirmaCombate() const override;
     
     // ==========================================
     // GETTERS Y SETTERS GENERALES
@@ -107,29 +189,93 @@ public:
     Raza getRaza() const;
     
     /**
-     * @brief Obtiene los puntos de fuerza del personaje
+     * @brief Obtiene los puntos de fuerza del personaje, con modificadores
      * @return Puntos de fuerza
      */
     int getFuerza() const;
     
     /**
-     * @brief Obtiene los puntos de destreza del personaje
+     * @brief Obtiene los puntos de destreza del personaje, con modificadores
      * @return Puntos de destreza
      */
     int getDestreza() const;
     
     /**
-     * @brief Obtiene los puntos de constitucion del personaje
+     * @brief Obtiene los puntos de constitucion del personaje, con modificadores
      * @return Puntos de constitucion
      */
     int getConstitucion() const;
     
     /**
-     * @brief Obtiene los puntos de inteligencia del personaje
+     * @brief Obtiene los puntos de inteligencia del personaje, con modificadores
      * @return Puntos de inteligencia
      */
     int getInteligencia() const;
     
+    /**
+     * @brief Obtiene los HP maximos, con modificadores
+     * @return HP maximos
+     */
+    int getHPMaximo() const;
+    
+    /**
+     * @brief Obtiene las estadisticas derivadas, recalculandolas solo si cambio algun valor
+     * @return Estadisticas con todos los modificadores aplicados
+     */
+    const EstadisticasDerivadas& getEstadisticas() const;
+    
+    /**
+     * @brief Obtiene la pila de modificadores (equipo, buffs, auras, maldiciones)
+     * @return Pila de modificadores del personaje
+     */
+    PilaModificadores& getModificadores();
+    const PilaModificadores& getModificadores() const;
+    
+    /**
+     * @brief Obtiene los atributos base, sin modificadores
+     * @return Atributos base del personaje
+     */
+    AtributosPersonaje getAtributosBase() const;
+    
+    /**
+     * @brief Reemplaza los atributos base sin validarlos ni mostrar mensajes
+     * 
+     * La vida actual se recorta al HP maximo efectivo y pasa a ser la que se
+     * restaura al salir de un combate PPT.
+     * 
+     * @param atributos Atributos nuevos
+     */
+    void setAtributosBase(const AtributosPersonaje& atributos);
+    
+    /**
+     * @brief Reemplaza el inventario sin mostrar mensajes ni equipar nada
+     * @param armas Armas nuevas (como mucho getCapacidadArmas())
+     * @param equipada Posicion del arma equipada, -1 si ninguna
+     */
+    void setInventario(vector<unique_ptr<InterfazArmas>> armas, int equipada);
+    
+    /**
+     * @brief Obtiene el estado de clase y subclase que no entra en los atributos base
+     * @return Rasgos de la clase, contadores y listas de la subclase
+     */
+    EstadoClasePersonaje getEstadoClase() const;
+    
+    /**
+     * @brief Reemplaza el estado de clase y subclase sin mostrar mensajes
+     * 
+     * Debe aplicarse antes que setAtributosBase: los rasgos pueden cambiar
+     * el HP maximo al que se recorta la vida actual.
+     * 
+     * @param estado Estado obtenido con getEstadoClase
+     */
+    void setEstadoClase(const EstadoClasePersonaje& estado);
+    
+    /**
+     * @brief Reemplaza los hechizos conocidos sin mostrar mensajes
+     * @param hechizos Hechizos nuevos
+     */
+    void setHechizosConocidos(vector<string> hechizos);
+    
     // ==========================================
     // GESTION DE ARMAS
     // ==========================================
@@ -231,6 +377,12 @@ public:
      */
     virtual bool conoceHechizo(const string& nombreHechizo) const;
     
+    /**
+     * @brief Obtiene la lista de hechizos conocidos
+     * @return Referencia constante a los hechizos conocidos
+     */
+    const vector<string>& getHechizosConocidos() const;
+    
     /**
      * @brief Invoca un elemental para atacar
      * @return Valor numerico que representa el daño causado por el elemental
@@ -50,16 +50,15 @@ int Brujo::invocarPatron() {
 }
 
 /**
- * @brief Implementación del método lanzarMaleficio
+ * @brief Implementación del método prepararMaleficio
  * 
- * Lanza un maleficio específico contra un objetivo, causando daño
- * basado en el pacto demoníaco, nivel y corrupción del alma.
- * Requiere conocer el maleficio y gastar maná.
+ * Requiere conocer el maleficio y gastar maná. El poder depende del pacto
+ * demoníaco, el nivel y la corrupción del alma.
  * 
- * @param nombreMaleficio Nombre del maleficio a lanzar
- * @return Valor numérico que representa el daño causado
+ * @param nombreMaleficio Nombre del maleficio
+ * @return Poder del maleficio, 0 si no se pudo lanzar
  */
-int Brujo::lanzarMaleficio(const string& nombreMaleficio) {
+int Brujo::prepararMaleficio(const string& nombreMaleficio) {
     auto it = find(maleficiosConocidos.begin(), maleficiosConocidos.end(), nombreMaleficio);
     if (it == maleficiosConocidos.end()) {
         cout << nombre << " no conoce el maleficio \"" << nombreMaleficio << "\"." << endl;
@@ -73,12 +72,66 @@ int Brujo::lanzarMaleficio(const string& nombreMaleficio) {
     
     cout << nombre << " lanza el maleficio \"" << nombreMaleficio << "\"!" << endl;
     
-    int poderMaleficio = pactoDemoniaco + nivelPersonaje + corrupcionAlma / 2;
-    cout << "El maleficio causa " << poderMaleficio << " puntos de daño oscuro." << endl;
-    
+    return pactoDemoniaco + nivelPersonaje + corrupcionAlma / 2;
+}
+
+/**
+ * @brief Implementación del método lanzarMaleficio
+ * 
+ * Lanza un maleficio específico contra un objetivo, causando todo su
+ * daño en el momento.
+ * 
+ * @param nombreMaleficio Nombre del maleficio a lanzar
+ * @return Valor numérico que representa el daño causado
+ */
+int Brujo::lanzarMaleficio(const string& nombreMaleficio) {
+    int poderMaleficio = prepararMaleficio(nombreMaleficio);
+    if (poderMaleficio > 0) {
+        cout << "El maleficio causa " << poderMaleficio << " puntos de daño oscuro." << endl;
+    }
     return poderMaleficio;
 }
 
+/**
+ * @brief Implementación del método lanzarMaleficio sobre un motor de maleficios
+ * 
+ * El objetivo se valida antes de preparar el maleficio, así que un objetivo
+ * inválido o caído no gasta maná.
+ * 
+ * @param nombreMaleficio Nombre del maleficio a lanzar
+ * @param motor Motor donde queda activo el maleficio
+ * @param objetivo Índice del objetivo en el motor
+ * @return Daño total que causará el maleficio, 0 si no se pudo lanzar
+ */
+int Brujo::lanzarMaleficio(const string& nombreMaleficio, MotorMaleficios& motor, int objetivo) {
+    if (!motor.esObjetivoValido(objetivo)) {
+        cout << "El maleficio no encuentra a su objetivo." << endl;
+        return 0;
+    }
+    int poderMaleficio = prepararMaleficio(nombreMaleficio);
+    if (poderMaleficio <= 0) {
+        return 0;
+    }
+    
+    int id = motor.buscar(nombreMaleficio);
+    if (id < 0) {
+        id = motor.definir(DefinicionMaleficio{nombreMaleficio, 6, 1, ReglaApilamiento::Renovar, 1,
+                                               AtributoPersonaje::Fuerza, 0});
+    }
+    const DefinicionMaleficio& definicion = motor.getDefinicion(id);
+    int aplicaciones = max(1, definicion.duracion / definicion.periodo);
+    int danioPorTick = max(1, poderMaleficio / aplicaciones);
+    
+    if (!motor.aplicar(objetivo, id, danioPorTick)) {
+        cout << "El maleficio no encuentra a su objetivo." << endl;
+        return 0;
+    }
+    cout << "El maleficio causará " << danioPorTick << " puntos de daño oscuro durante "
+         << aplicaciones << " turnos." << endl;
+    
+    return danioPorTick * aplicaciones;
+}
+
 /**
  * @brief Implementación del método aprenderMaleficio
  * 
@@ -135,7 +188,7 @@ void Brujo::sacrificarVida(int cantidad) {
     int manaGanado = cantidad * 2;
     manaActual = min(manaMaximo, manaActual + manaGanado);
     
-    cout << nombre << " pierde " << cantidad << " PV (HP: " << hpActual << "/" << hpMax << ")";
+    cout << nombre << " pierde " << cantidad << " PV (HP: " << hpActual << "/" << getHPMaximo() << ")";
     cout << " pero gana " << manaGanado << " de maná (Maná: " << manaActual << "/" << manaMaximo << ")." << endl;
     
     // Aumentar corrupción
@@ -160,7 +213,7 @@ int Brujo::drenajeDePoder() {
         return 0;
     }
     
-    int poderDrenaje = pactoDemoniaco + inteligencia / 2;
+    int poderDrenaje = pactoDemoniaco + getInteligencia() / 2;
     cout << "¡" << nombre << " drena " << poderDrenaje << " puntos de vida del objetivo!" << endl;
     
     // Recuperar parte como vida
@@ -257,3 +310,62 @@ int Brujo::lanzarHechizo(const string& nombreHechizo) {
     
     return efectoBase;
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Brujo::clonar() const {
+    return make_unique<Brujo>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: corrupcionAlma, pactoDemoniaco, maldicionActiva, cantidad de maleficiosConocidos.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Brujo::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = corrupcionAlma;
+    estado[1] = pactoDemoniaco;
+    estado[2] = maldicionActiva ? 1 : 0;
+    estado[3] = static_cast<int>(maleficiosConocidos.size());
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * Las listas se restauran descartando lo agregado después del checkpoint.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Brujo::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    corrupcionAlma = estado[0];
+    pactoDemoniaco = estado[1];
+    maldicionActiva = estado[2] != 0;
+    if (estado[3] >= 0 && static_cast<size_t>(estado[3]) < maleficiosConocidos.size()) {
+        maleficiosConocidos.resize(estado[3]);
+    }
+}
+
+/**
+ * @brief Implementación del método guardarElementosClase
+ * @param elementos Lista a completar con los maleficios conocidos
+ */
+void Brujo::guardarElementosClase(vector<ElementoClase>& elementos) const {
+    for (const string& maleficio : maleficiosConocidos) {
+        elementos.push_back(ElementoClase{maleficio, {0, 0}});
+    }
+}
+
+/**
+ * @brief Implementación del método restaurarElementosClase
+ * @param elementos Maleficios guardados con guardarElementosClase
+ */
+void Brujo::restaurarElementosClase(const vector<ElementoClase>& elementos) {
+    maleficiosConocidos.clear();
+    for (const ElementoClase& elemento : elementos) {
+        maleficiosConocidos.push_back(elemento.texto);
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Mago.hpp"
+#include "../MotorMaleficios.hpp"
 #include <vector>  // Añadir inclusión para vector
 
 /**
@@ -16,6 +17,19 @@ private:
     vector<string> maleficiosConocidos;
     int corrupcionAlma;
     bool maldicionActiva;
+    
+    /**
+     * @brief Verifica que conoce el maleficio, gasta el maná y calcula su poder
+     * @param nombreMaleficio Nombre del maleficio
+     * @return Poder del maleficio, 0 si no se pudo lanzar
+     */
+    int prepararMaleficio(const string& nombreMaleficio);
+
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+    void guardarElementosClase(vector<ElementoClase>& elementos) const override;
+    void restaurarElementosClase(const vector<ElementoClase>& elementos) override;
 
 public:
     // ==========================================
@@ -61,6 +75,20 @@ public:
      */
     int lanzarMaleficio(const string& nombreMaleficio);
     
+    /**
+     * @brief Lanza un maleficio como efecto con duración sobre un objetivo
+     * 
+     * El poder del maleficio se reparte entre los ticks de su duración. Si el
+     * motor no tiene una definición con ese nombre, se usa una por defecto
+     * (6 ticks, daño cada tick, se renueva al relanzarlo).
+     * 
+     * @param nombreMaleficio Nombre del maleficio a lanzar
+     * @param motor Motor donde queda activo el maleficio
+     * @param objetivo Índice del objetivo en el motor
+     * @return Daño total que causará el maleficio, 0 si no se pudo lanzar
+     */
+    int lanzarMaleficio(const string& nombreMaleficio, MotorMaleficios& motor, int objetivo);
+    
     /**
      * @brief Aprende un nuevo maleficio
      * @param nombreMaleficio Nombre del maleficio a aprender
@@ -89,6 +117,8 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementación especializada de gasto de maná
      * 
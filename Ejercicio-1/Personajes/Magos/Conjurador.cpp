@@ -17,9 +17,28 @@ Conjurador::Conjurador(string n, int nivel, int hp, Raza r, int fue, int des, in
     
     if (!pactoActual.empty()) {
         criaturasPactadas.push_back(pactoActual);
+        indicePactos[pactoActual] = 0;
     }
 }
 
+/**
+ * @brief Implementación del método truncarPactos
+ * 
+ * Solo toca las entradas del índice de las criaturas descartadas.
+ * 
+ * @param cantidad Cantidad de criaturas que se conservan
+ */
+void Conjurador::truncarPactos(size_t cantidad) {
+    for (size_t i = cantidad; i < criaturasPactadas.size(); ++i) {
+        indicePactos.erase(criaturasPactadas[i]);
+    }
+    criaturasPactadas.resize(cantidad);
+}
+
+bool Conjurador::tienePacto(const string& nombreCriatura) const {
+    return indicePactos.count(nombreCriatura) > 0;
+}
+
 /**
  * @brief Implementación del método realizarPacto
  * 
@@ -36,7 +55,7 @@ bool Conjurador::realizarPacto(const string& nombreCriatura) {
         return false;
     }
     
-    if (find(criaturasPactadas.begin(), criaturasPactadas.end(), nombreCriatura) != criaturasPactadas.end()) {
+    if (tienePacto(nombreCriatura)) {
         cout << nombre << " ya tiene un pacto con " << nombreCriatura << "." << endl;
         return false;
     }
@@ -46,6 +65,7 @@ bool Conjurador::realizarPacto(const string& nombreCriatura) {
         return false;
     }
     
+    indicePactos[nombreCriatura] = criaturasPactadas.size();
     criaturasPactadas.push_back(nombreCriatura);
     pactoActual = nombreCriatura;
     
@@ -54,16 +74,16 @@ bool Conjurador::realizarPacto(const string& nombreCriatura) {
 }
 
 /**
- * @brief Implementación del método invocarCriatura
+ * @brief Implementación del método prepararInvocacion
  * 
- * Invoca a una criatura pactada para que ataque a los enemigos.
- * Verifica que exista un pacto con la criatura y gasta maná.
+ * Verifica que exista un pacto con la criatura y gasta maná. El poder
+ * depende del poder de invocación, la inteligencia y el nivel.
  * 
- * @param nombreCriatura Nombre de la criatura a invocar
- * @return Valor numérico que representa el daño causado por la criatura
+ * @param nombreCriatura Nombre de la criatura
+ * @return Poder de la invocación, 0 si no se pudo invocar
  */
-int Conjurador::invocarCriatura(const string& nombreCriatura) {
-    if (find(criaturasPactadas.begin(), criaturasPactadas.end(), nombreCriatura) == criaturasPactadas.end()) {
+int Conjurador::prepararInvocacion(const string& nombreCriatura) {
+    if (!tienePacto(nombreCriatura)) {
         cout << nombre << " no tiene un pacto con " << nombreCriatura << "." << endl;
         return 0;
     }
@@ -75,12 +95,67 @@ int Conjurador::invocarCriatura(const string& nombreCriatura) {
     
     cout << nombre << " invoca a " << nombreCriatura << "!" << endl;
     
-    int poderInvocado = poderInvocacion + inteligencia / 2 + nivelPersonaje;
-    cout << nombreCriatura << " causa " << poderInvocado << " puntos de daño!" << endl;
-    
+    return poderInvocacion + getInteligencia() / 2 + nivelPersonaje;
+}
+
+/**
+ * @brief Implementación del método invocarCriatura
+ * 
+ * Invoca a una criatura pactada para que ataque a los enemigos
+ * causando todo su daño en el momento.
+ * 
+ * @param nombreCriatura Nombre de la criatura a invocar
+ * @return Valor numérico que representa el daño causado por la criatura
+ */
+int Conjurador::invocarCriatura(const string& nombreCriatura) {
+    int poderInvocado = prepararInvocacion(nombreCriatura);
+    if (poderInvocado > 0) {
+        cout << nombreCriatura << " causa " << poderInvocado << " puntos de daño!" << endl;
+    }
     return poderInvocado;
 }
 
+/**
+ * @brief Implementación del método invocarCriatura sobre un motor de invocaciones
+ * 
+ * El poder de la invocación se reparte entre los turnos que dura la
+ * criatura y se suma al daño base de su plantilla. Invocador y objetivo se
+ * validan antes de preparar la invocación, así que no se gasta maná en vano.
+ * 
+ * @param nombreCriatura Nombre de la criatura a invocar
+ * @param motor Motor donde queda activa la criatura
+ * @param invocador Índice del conjurador en el motor
+ * @param objetivo Índice del objetivo en el motor
+ * @return Daño total que causará la criatura, 0 si no se pudo invocar
+ */
+int Conjurador::invocarCriatura(const string& nombreCriatura, MotorInvocaciones& motor, int invocador, int objetivo) {
+    if (!motor.esPersonajeValido(invocador) || !motor.esPersonajeValido(objetivo)) {
+        cout << nombreCriatura << " no encuentra a su objetivo y no llega a invocarse." << endl;
+        return 0;
+    }
+    int poderInvocado = prepararInvocacion(nombreCriatura);
+    if (poderInvocado <= 0) {
+        return 0;
+    }
+    
+    int id = motor.buscar(nombreCriatura);
+    if (id < 0) {
+        id = motor.definir(PlantillaCriatura{nombreCriatura, 20 + poderInvocacion, 0, 3});
+    }
+    const PlantillaCriatura& plantilla = motor.getPlantilla(id);
+    int danioExtra = max(1, poderInvocado / plantilla.duracion);
+    
+    if (!motor.invocar(id, invocador, objetivo, danioExtra)) {
+        cout << nombreCriatura << " no encuentra a su objetivo y se desvanece." << endl;
+        return 0;
+    }
+    int danioPorTurno = plantilla.danio + danioExtra;
+    cout << nombreCriatura << " atacará durante " << plantilla.duracion << " turnos causando "
+         << danioPorTurno << " puntos de daño por turno." << endl;
+    
+    return danioPorTurno * plantilla.duracion;
+}
+
 /**
  * @brief Implementación del método dibujarCirculoProteccion
  * 
@@ -119,7 +194,7 @@ void Conjurador::canalizarElementos() {
         return;
     }
     
-    energiaElemental += 10 + inteligencia / 3;
+    energiaElemental += 10 + getInteligencia() / 3;
     cout << nombre << " acumula energía elemental. Energía elemental total: " << energiaElemental << endl;
 }
 
@@ -144,9 +219,16 @@ int Conjurador::romperPacto() {
     cout << "¡La ruptura del pacto libera " << explosionEnergia << " de energía explosiva!" << endl;
     
     // Remover la criatura de la lista
-    auto it = find(criaturasPactadas.begin(), criaturasPactadas.end(), pactoActual);
-    if (it != criaturasPactadas.end()) {
-        criaturasPactadas.erase(it);
+    // Borrado por intercambio con el último: solo cambia el índice de la criatura movida
+    auto it = indicePactos.find(pactoActual);
+    if (it != indicePactos.end()) {
+        size_t posicion = it->second;
+        indicePactos.erase(it);
+        if (posicion + 1 != criaturasPactadas.size()) {
+            criaturasPactadas[posicion] = std::move(criaturasPactadas.back());
+            indicePactos[criaturasPactadas[posicion]] = posicion;
+        }
+        criaturasPactadas.pop_back();
     }
     
     // Reiniciar variables
@@ -207,3 +289,72 @@ int Conjurador::lanzarHechizo(const string& nombreHechizo) {
     
     return danioBase;
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Conjurador::clonar() const {
+    return make_unique<Conjurador>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: energiaElemental, poderInvocacion, circuloProteccion, cantidad de criaturasPactadas.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Conjurador::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = energiaElemental;
+    estado[1] = poderInvocacion;
+    estado[2] = circuloProteccion ? 1 : 0;
+    estado[3] = static_cast<int>(criaturasPactadas.size());
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * Las listas se restauran descartando lo agregado después del checkpoint.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Conjurador::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    energiaElemental = estado[0];
+    poderInvocacion = estado[1];
+    circuloProteccion = estado[2] != 0;
+    if (estado[3] >= 0 && static_cast<size_t>(estado[3]) < criaturasPactadas.size()) {
+        truncarPactos(static_cast<size_t>(estado[3]));
+    }
+}
+
+/**
+ * @brief Implementación del método guardarElementosClase
+ * 
+ * Cada pacto guarda el nombre de la criatura; el primer valor marca el
+ * pacto actual.
+ * 
+ * @param elementos Lista a completar
+ */
+void Conjurador::guardarElementosClase(vector<ElementoClase>& elementos) const {
+    for (const string& criatura : criaturasPactadas) {
+        elementos.push_back(ElementoClase{criatura, {criatura == pactoActual ? 1 : 0, 0}});
+    }
+}
+
+/**
+ * @brief Implementación del método restaurarElementosClase
+ * @param elementos Pactos guardados con guardarElementosClase
+ */
+void Conjurador::restaurarElementosClase(const vector<ElementoClase>& elementos) {
+    truncarPactos(0);
+    pactoActual.clear();
+    for (const ElementoClase& elemento : elementos) {
+        if (tienePacto(elemento.texto)) continue;
+        indicePactos[elemento.texto] = criaturasPactadas.size();
+        criaturasPactadas.push_back(elemento.texto);
+        if (elemento.valores[0] != 0) {
+            pactoActual = elemento.texto;
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../Mago.hpp"
+#include "../MotorInvocaciones.hpp"
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -12,10 +14,30 @@
 class Conjurador : public Mago {
 private:
     vector<string> criaturasPactadas;
+    unordered_map<string, size_t> indicePactos;  ///< Criatura -> posición en criaturasPactadas
     int poderInvocacion;
     bool circuloProteccion;
     int energiaElemental;
     string pactoActual;
+    
+    /**
+     * @brief Descarta las criaturas pactadas a partir de una posición
+     * @param cantidad Cantidad de criaturas que se conservan
+     */
+    void truncarPactos(size_t cantidad);
+    
+    /**
+     * @brief Verifica el pacto, gasta el maná y calcula el poder de la invocación
+     * @param nombreCriatura Nombre de la criatura
+     * @return Poder de la invocación, 0 si no se pudo invocar
+     */
+    int prepararInvocacion(const string& nombreCriatura);
+
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+    void guardarElementosClase(vector<ElementoClase>& elementos) const override;
+    void restaurarElementosClase(const vector<ElementoClase>& elementos) override;
 
 public:
     // ==========================================
@@ -62,6 +84,27 @@ public:
      */
     int invocarCriatura(const string& nombreCriatura);
     
+    /**
+     * @brief Invoca una criatura pactada que ataca durante varios turnos
+     * 
+     * Si el motor no tiene plantilla para la criatura, se define una a partir
+     * del poder de invocación del conjurador.
+     * 
+     * @param nombreCriatura Nombre de la criatura a invocar
+     * @param motor Motor donde queda activa la criatura
+     * @param invocador Índice del conjurador en el motor
+     * @param objetivo Índice del objetivo en el motor
+     * @return Daño total que causará la criatura, 0 si no se pudo invocar
+     */
+    int invocarCriatura(const string& nombreCriatura, MotorInvocaciones& motor, int invocador, int objetivo);
+    
+    /**
+     * @brief Indica si hay un pacto con una criatura
+     * @param nombreCriatura Nombre de la criatura
+     * @return true si existe el pacto
+     */
+    bool tienePacto(const string& nombreCriatura) const;
+    
     // ==========================================
     // HABILIDADES DE CONJURADOR
     // ==========================================
@@ -92,6 +135,8 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementación especializada de lanzamiento de hechizos
      * 
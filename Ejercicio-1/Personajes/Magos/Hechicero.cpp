@@ -105,7 +105,7 @@ int Hechicero::alterarTiempo() {
     
     cout << nombre << " altera el flujo temporal..." << endl;
     
-    int efectoMagico = manipulacionTiempo + inteligencia + nivelPersonaje;
+    int efectoMagico = manipulacionTiempo + getInteligencia() + nivelPersonaje;
     cout << "¡El tiempo se distorsiona alrededor, causando " << efectoMagico << " de daño!" << endl;
     
     return efectoMagico;
@@ -159,3 +159,37 @@ int Hechicero::lanzarHechizo(const string& nombreHechizo) {
     
     return danioBase;
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Hechicero::clonar() const {
+    return make_unique<Hechicero>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: poderArcano, manipulacionTiempo, bastionArcano, familiarActivo.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Hechicero::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = poderArcano;
+    estado[1] = manipulacionTiempo;
+    estado[2] = bastionArcano ? 1 : 0;
+    estado[3] = familiarActivo ? 1 : 0;
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Hechicero::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    poderArcano = estado[0];
+    manipulacionTiempo = estado[1];
+    bastionArcano = estado[2] != 0;
+    familiarActivo = estado[3] != 0;
+}
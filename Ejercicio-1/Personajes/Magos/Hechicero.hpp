@@ -16,6 +16,10 @@ private:
     string familiarNombre;
     bool familiarActivo;
 
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+
 public:
     // ==========================================
     // CONSTRUCTORES
@@ -89,6 +93,8 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementación especializada de lanzamiento de hechizos
      * 
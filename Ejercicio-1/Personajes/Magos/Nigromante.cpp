@@ -12,7 +12,47 @@ Nigromante::Nigromante(string n, int nivel, int hp, Raza r, int fue, int des, in
                        int manaMax, EscuelaMagia esc, FuentePoder fp,
                        int poderNec, int energia, bool filact, int resistencia)
     : Mago(n, nivel, hp, r, fue, des, con, inte, manaMax, esc, fp),
-      poderNecromantico(poderNec), energiaMuerte(energia), filacteria(filact), resistenciaMuerte(resistencia) {
+      poderNecromantico(poderNec), mundo(nullptr), servidoresEnPie(0), servidoresCaidos(0),
+      energiaMuerte(energia), filacteria(filact), resistenciaMuerte(resistencia) {
+}
+
+/**
+ * @brief Implementación del constructor de copia de Nigromante
+ * 
+ * Duplica cada servidor en pie para que original y copia no compartan
+ * no-muertos: en el mismo pool si el original usa uno compartido, o en un
+ * pool privado nuevo si el original usa el suyo.
+ * 
+ * @param otro Nigromante a copiar
+ */
+Nigromante::Nigromante(const Nigromante& otro)
+    : Mago(otro), poderNecromantico(otro.poderNecromantico),
+      mundo(otro.mundoPropio ? nullptr : otro.mundo), servidoresEnPie(0), servidoresCaidos(0),
+      energiaMuerte(otro.energiaMuerte), filacteria(otro.filacteria), resistenciaMuerte(otro.resistenciaMuerte) {
+    if (otro.servidoresEnPie == 0) {
+        return;
+    }
+    PoolNoMuertos& destino = pool();
+    servidoresNoMuertos.reserve(otro.servidoresEnPie);
+    for (IdNoMuerto id : otro.servidoresNoMuertos) {
+        if (!otro.servidorEnPie(id)) continue;
+        IdNoMuerto copia = destino.crear(otro.mundo->getNombre(id), otro.mundo->getHP(id), otro.mundo->getDanio(id));
+        servidoresNoMuertos.push_back(copia);
+        servidoresPorNombre[destino.getNombre(copia)].push_back(copia);
+        ++servidoresEnPie;
+    }
+}
+
+/**
+ * @brief Implementación del destructor de Nigromante
+ * 
+ * Sus servidores no sobreviven al nigromante: se liberan en el pool.
+ */
+Nigromante::~Nigromante() {
+    if (!mundo) return;
+    for (IdNoMuerto id : servidoresNoMuertos) {
+        mundo->destruir(id);
+    }
 }
 
 /**
@@ -40,7 +80,7 @@ int Nigromante::levantarNoMuerto(string nombreNoMuerto) {
     energiaMuerte -= 10;
     
     // Añadir a la lista de servidores
-    servidoresNoMuertos.push_back(nombreNoMuerto);
+    crearServidor(nombreNoMuerto);
     
     cout << "¡" << nombre << " ha levantado a " << nombreNoMuerto << " de entre los muertos!" << endl;
     cout << "Energía de muerte restante: " << energiaMuerte << endl;
@@ -53,14 +93,13 @@ int Nigromante::levantarNoMuerto(string nombreNoMuerto) {
  * @brief Implementación del método controlarNoMuerto
  * 
  * Refuerza el control sobre un servidor no-muerto ya existente.
- * Verifica que el no-muerto esté en la lista de control y gasta maná.
+ * Verifica que tenga un no-muerto en pie con ese nombre y gasta maná.
  * 
  * @param nombreNoMuerto Nombre del no-muerto a controlar
  * @return true si el control fue exitoso, false si no tenía el no-muerto o faltó maná
  */
 bool Nigromante::controlarNoMuerto(string nombreNoMuerto) {
-    auto it = find(servidoresNoMuertos.begin(), servidoresNoMuertos.end(), nombreNoMuerto);
-    if (it == servidoresNoMuertos.end()) {
+    if (!servidorEnPie(buscarServidor(nombreNoMuerto))) {
         cout << nombre << " no controla a ningún no-muerto llamado " << nombreNoMuerto << "." << endl;
         return false;
     }
@@ -91,7 +130,7 @@ int Nigromante::tocoDeLaMuerte() {
         return 0;
     }
     
-    int poderToco = poderNecromantico + inteligencia / 2;
+    int poderToco = poderNecromantico + getInteligencia() / 2;
     cout << "¡" << nombre << " inflige " << poderToco << " puntos de daño necrótico con su toco!" << endl;
     
     // Ganar energía de muerte
@@ -111,8 +150,8 @@ int Nigromante::tocoDeLaMuerte() {
  * @return Cantidad de puntos de vida absorbidos
  */
 int Nigromante::drenarVidaNoMuerto(string nombreNoMuerto) {
-    auto it = find(servidoresNoMuertos.begin(), servidoresNoMuertos.end(), nombreNoMuerto);
-    if (it == servidoresNoMuertos.end()) {
+    IdNoMuerto servidor = buscarServidor(nombreNoMuerto);
+    if (!servidorEnPie(servidor)) {
         cout << nombre << " no controla a ningún no-muerto llamado " << nombreNoMuerto << "." << endl;
         return 0;
     }
@@ -128,7 +167,9 @@ int Nigromante::drenarVidaNoMuerto(string nombreNoMuerto) {
     // El no-muerto se debilita o destruye
     if (rand() % 3 == 0) { // 33% de probabilidad de destrucción
         cout << nombreNoMuerto << " se desintegra tras ser drenado." << endl;
-        servidoresNoMuertos.erase(it);
+        mundo->destruir(servidor);
+        servidoresPorNombre[nombreNoMuerto].pop_back();
+        registrarBajas(1, true);
     } else {
         cout << nombreNoMuerto << " se debilita pero sigue en pie." << endl;
     }
@@ -167,10 +208,11 @@ void Nigromante::crearFilacteria() {
     filacteria = true;
     // Reducir HP máximo como costo permanente
     hpMax -= hpMax / 10;
-    if (hpActual > hpMax) hpActual = hpMax;
+    marcarEstadisticasSucias();
+    if (hpActual > getHPMaximo()) hpActual = getHPMaximo();
     
     cout << "¡Filacteria creada! " << nombre << " ha dado un paso hacia la inmortalidad." << endl;
-    cout << "HP reducido permanentemente a " << hpMax << " debido al ritual." << endl;
+    cout << "HP reducido permanentemente a " << getHPMaximo() << " debido al ritual." << endl;
 }
 
 /**
@@ -189,12 +231,18 @@ void Nigromante::mostrarInfo() const {
     cout << "  Resistencia a Muerte: " << resistenciaMuerte << endl;
     
     cout << "  Servidores No-Muertos: ";
-    if (servidoresNoMuertos.empty()) {
+    if (getCantidadServidores() == 0) {
         cout << "Ninguno" << endl;
     } else {
         cout << endl;
-        for (const auto& noMuerto : servidoresNoMuertos) {
-            cout << "    - " << noMuerto << endl;
+        for (const auto& [nombreServidor, servidores] : servidoresPorNombre) {
+            size_t enPie = count_if(servidores.begin(), servidores.end(),
+                                    [this](IdNoMuerto id) { return servidorEnPie(id); });
+            if (enPie == 1) {
+                cout << "    - " << nombreServidor << endl;
+            } else if (enPie > 1) {
+                cout << "    - " << nombreServidor << " x" << enPie << endl;
+            }
         }
     }
 }
@@ -214,7 +262,7 @@ bool Nigromante::recibirDanio(int cantidad, bool esCombatePPT) {
     if (!esCombatePPT) {
         if (cantidad > 0) {
             // Resistencia a daño necrótico
-            int reduccion = min(cantidad / 4, resistenciaMuerte);
+            int reduccion = getReduccionDanio().calcular(cantidad);
             if (reduccion > 0) {
                 cout << nombre << " resiste " << reduccion << " puntos de daño gracias a su conexión con la muerte." << endl;
                 cantidad -= reduccion;
@@ -223,7 +271,7 @@ bool Nigromante::recibirDanio(int cantidad, bool esCombatePPT) {
             // Si tiene filacteria y el daño lo mataría, salvarse una vez
             if (filacteria && hpActual <= cantidad) {
                 cout << "¡La filacteria de " << nombre << " lo salva de la muerte!" << endl;
-                hpActual = hpMax / 3; // Restaurar una parte de la vida
+                hpActual = getHPMaximo() / 3; // Restaurar una parte de la vida
                 filacteria = false; // La filacteria se consume
                 cout << "La filacteria se ha consumido, pero " << nombre << " sobrevive con " << hpActual << " puntos de vida." << endl;
                 return true;
@@ -233,6 +281,21 @@ bool Nigromante::recibirDanio(int cantidad, bool esCombatePPT) {
     return Mago::recibirDanio(cantidad, esCombatePPT);
 }
 
+/**
+ * @brief Implementación del método getReduccionDanio
+ *
+ * Descuenta un cuarto del golpe, hasta la resistencia a la muerte.
+ *
+ * @return Reducción vigente
+ */
+ReduccionDanio Nigromante::getReduccionDanio() const {
+    return ReduccionDanio{4, resistenciaMuerte};
+}
+
+bool Nigromante::tieneFilacteria() const {
+    return filacteria;
+}
+
 /**
  * @brief Implementación especializada del método meditar
  * 
@@ -248,3 +311,310 @@ void Nigromante::meditar() {
     energiaMuerte += recuperacion;
     cout << nombre << " absorbe energía necrótica del ambiente. Energía de muerte: " << energiaMuerte << endl;
 }
+
+/**
+ * @brief Implementación del método clonar
+ * @return Puntero único a la copia del personaje
+ */
+unique_ptr<InterfazPersonaje> Nigromante::clonar() const {
+    return make_unique<Nigromante>(*this);
+}
+
+/**
+ * @brief Implementación del método guardarEstadoClase
+ * 
+ * Orden de los valores: energiaMuerte, poderNecromantico, filacteria, cantidad de servidoresNoMuertos.
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores a completar
+ */
+void Nigromante::guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const {
+    estado[0] = energiaMuerte;
+    estado[1] = poderNecromantico;
+    estado[2] = filacteria ? 1 : 0;
+    estado[3] = static_cast<int>(getCantidadServidores());
+}
+
+/**
+ * @brief Implementación del método restaurarEstadoClase
+ * 
+ * Los servidores levantados después del checkpoint se destruyen en el pool
+ * (los más recientes primero).
+ * 
+ * @param estado Arreglo de MAX_ESTADO_CLASE valores guardados
+ */
+void Nigromante::restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) {
+    energiaMuerte = estado[0];
+    poderNecromantico = estado[1];
+    filacteria = estado[2] != 0;
+    purgarServidores();
+    if (estado[3] >= 0 && static_cast<size_t>(estado[3]) < servidoresNoMuertos.size()) {
+        while (static_cast<size_t>(estado[3]) < servidoresNoMuertos.size()) {
+            mundo->destruir(servidoresNoMuertos.back());
+            servidoresNoMuertos.pop_back();
+        }
+        purgarServidores();  // quita de las listas por nombre a los destruidos
+    }
+}
+
+/**
+ * @brief Implementación del método guardarElementosClase
+ * 
+ * Cada servidor en pie guarda su nombre, su HP y su daño.
+ * 
+ * @param elementos Lista a completar
+ */
+void Nigromante::guardarElementosClase(vector<ElementoClase>& elementos) const {
+    for (IdNoMuerto id : servidoresNoMuertos) {
+        if (!servidorEnPie(id)) continue;
+        elementos.push_back(ElementoClase{mundo->getNombre(id), {mundo->getHP(id), mundo->getDanio(id)}});
+    }
+}
+
+/**
+ * @brief Implementación del método restaurarElementosClase
+ * 
+ * Libera los servidores actuales y crea los guardados en el pool del
+ * nigromante.
+ * 
+ * @param elementos Servidores guardados con guardarElementosClase
+ */
+void Nigromante::restaurarElementosClase(const vector<ElementoClase>& elementos) {
+    if (mundo) {
+        for (IdNoMuerto id : servidoresNoMuertos) {
+            mundo->destruir(id);
+        }
+    }
+    servidoresNoMuertos.clear();
+    servidoresPorNombre.clear();
+    servidoresEnPie = 0;
+    servidoresCaidos = 0;
+    
+    for (const ElementoClase& elemento : elementos) {
+        IdNoMuerto id = pool().crear(elemento.texto, elemento.valores[0], elemento.valores[1]);
+        servidoresNoMuertos.push_back(id);
+        servidoresPorNombre[elemento.texto].push_back(id);
+        ++servidoresEnPie;
+    }
+}
+
+// ==========================================
+// EJERCITO DE NO-MUERTOS
+// ==========================================
+
+/**
+ * @brief Implementación del método levantarHorda
+ * 
+ * @param nombreNoMuerto Nombre de los servidores
+ * @param cantidad Cantidad de servidores a levantar
+ * @return Cantidad de servidores levantados
+ */
+int Nigromante::levantarHorda(const string& nombreNoMuerto, int cantidad) {
+    if (cantidad <= 0) return 0;
+    
+    cout << nombre << " comienza el ritual para levantar una horda de " << cantidad << " no-muertos..." << endl;
+    
+    if (!gastarMana(20)) {
+        return 0;
+    }
+    if (energiaMuerte < 10) {
+        cout << "Energía de muerte insuficiente (necesitas al menos 10)." << endl;
+        return 0;
+    }
+    energiaMuerte -= 10;
+    
+    int poderServidor = poderNecromantico + nivelPersonaje;
+    int hp = (10 + poderServidor) / 2;
+    int danio = max(1, poderServidor / 6);
+    
+    PoolNoMuertos& destino = pool();
+    servidoresNoMuertos.reserve(servidoresNoMuertos.size() + cantidad);
+    vector<IdNoMuerto>& mismoNombre = servidoresPorNombre[nombreNoMuerto];
+    for (int i = 0; i < cantidad; ++i) {
+        IdNoMuerto id = destino.crear(nombreNoMuerto, hp, danio);
+        servidoresNoMuertos.push_back(id);
+        mismoNombre.push_back(id);
+    }
+    servidoresEnPie += static_cast<size_t>(cantidad);
+    
+    cout << "¡" << cantidad << " " << nombreNoMuerto << " se levantan bajo el mando de " << nombre << "!" << endl;
+    return cantidad;
+}
+
+/**
+ * @brief Implementación del método ordenarAtaque
+ * 
+ * Primero purga las listas si hay servidores caídos y después suma el daño
+ * de todos los que siguen en pie.
+ * 
+ * @param objetivo Personaje atacado
+ * @return Daño total causado
+ */
+int Nigromante::ordenarAtaque(InterfazPersonaje& objetivo) {
+    if (servidoresCaidos > 0) {
+        purgarServidores();
+    }
+    int danioTotal = 0;
+    for (IdNoMuerto id : servidoresNoMuertos) {
+        danioTotal += mundo->getDanio(id);
+    }
+    
+    if (danioTotal > 0) {
+        cout << "Los " << servidoresEnPie << " servidores de " << nombre << " atacan a " << objetivo.getNombre() << "." << endl;
+        objetivo.recibirDanio(danioTotal, false);
+    }
+    return danioTotal;
+}
+
+/**
+ * @brief Implementación del método herirServidor
+ * 
+ * @param id Servidor que recibe el daño
+ * @param cantidad Daño recibido
+ * @return true si sigue en pie
+ */
+bool Nigromante::herirServidor(IdNoMuerto id, int cantidad) {
+    if (!servidorEnPie(id)) {
+        return false;
+    }
+    if (mundo->recibirDanio(id, cantidad)) {
+        return true;
+    }
+    registrarBajas(1, false);
+    return false;
+}
+
+/**
+ * @brief Implementación del método herirServidores
+ * 
+ * Los servidores absorben el daño en orden de creación.
+ * 
+ * @param cantidad Daño a repartir
+ * @return Servidores que cayeron
+ */
+int Nigromante::herirServidores(int cantidad) {
+    int caidos = 0;
+    for (size_t i = 0; i < servidoresNoMuertos.size() && cantidad > 0; ++i) {
+        IdNoMuerto id = servidoresNoMuertos[i];
+        if (!servidorEnPie(id)) continue;
+        int absorbido = min(cantidad, mundo->getHP(id));
+        cantidad -= absorbido;
+        if (!mundo->recibirDanio(id, absorbido)) {
+            ++caidos;
+        }
+    }
+    registrarBajas(static_cast<size_t>(caidos), true);
+    return caidos;
+}
+
+const vector<IdNoMuerto>& Nigromante::getServidores() {
+    if (servidoresCaidos > 0) {
+        purgarServidores();
+    }
+    return servidoresNoMuertos;
+}
+
+size_t Nigromante::getCantidadServidores() const { return servidoresEnPie; }
+
+/**
+ * @brief Implementación del método setMundo
+ * 
+ * @param nuevoMundo Pool a usar
+ * @return true si se cambió, false si todavía tiene servidores en el pool actual
+ */
+bool Nigromante::setMundo(PoolNoMuertos& nuevoMundo) {
+    if (getCantidadServidores() > 0) {
+        cout << nombre << " no puede cambiar de mundo mientras tenga servidores." << endl;
+        return false;
+    }
+    mundo = &nuevoMundo;
+    mundoPropio.reset();
+    servidoresNoMuertos.clear();
+    servidoresPorNombre.clear();
+    servidoresCaidos = 0;
+    return true;
+}
+
+PoolNoMuertos& Nigromante::getMundo() { return pool(); }
+
+PoolNoMuertos& Nigromante::pool() {
+    if (!mundo) {
+        mundoPropio = make_unique<PoolNoMuertos>();
+        mundo = mundoPropio.get();
+    }
+    return *mundo;
+}
+
+bool Nigromante::servidorEnPie(IdNoMuerto id) const { return mundo && mundo->esValido(id); }
+
+/**
+ * @brief Implementación del método crearServidor
+ * 
+ * @param nombreNoMuerto Nombre del servidor
+ * @return Identificador del servidor
+ */
+IdNoMuerto Nigromante::crearServidor(const string& nombreNoMuerto) {
+    int poderServidor = poderNecromantico + nivelPersonaje;
+    IdNoMuerto id = pool().crear(nombreNoMuerto, 10 + poderServidor, max(1, poderServidor / 3));
+    servidoresNoMuertos.push_back(id);
+    servidoresPorNombre[nombreNoMuerto].push_back(id);
+    ++servidoresEnPie;
+    return id;
+}
+
+/**
+ * @brief Implementación del método buscarServidor
+ * 
+ * Todos los servidores con el mismo nombre son equivalentes, así que se
+ * devuelve el último en pie; los destruidos del final se descartan por el
+ * camino y el resto los quita purgarServidores.
+ * 
+ * @param nombreNoMuerto Nombre del servidor
+ * @return Identificador, inválido si no hay ninguno
+ */
+IdNoMuerto Nigromante::buscarServidor(const string& nombreNoMuerto) {
+    auto it = servidoresPorNombre.find(nombreNoMuerto);
+    if (it == servidoresPorNombre.end()) {
+        return PoolNoMuertos::invalido();
+    }
+    vector<IdNoMuerto>& servidores = it->second;
+    while (!servidores.empty() && !servidorEnPie(servidores.back())) {
+        servidores.pop_back();
+    }
+    return servidores.empty() ? PoolNoMuertos::invalido() : servidores.back();
+}
+
+/**
+ * @brief Implementación del método registrarBajas
+ * 
+ * Purgar cuando cae más de la mitad hace que cada baja cueste O(1)
+ * amortizado, y las listas nunca tienen más del doble de los servidores vivos.
+ * 
+ * @param cantidad Servidores destruidos
+ * @param purgar false si hay referencias a las listas en uso
+ */
+void Nigromante::registrarBajas(size_t cantidad, bool purgar) {
+    servidoresEnPie -= min(cantidad, servidoresEnPie);
+    servidoresCaidos += cantidad;
+    if (purgar && servidoresCaidos > servidoresEnPie) {
+        purgarServidores();
+    }
+}
+
+/**
+ * @brief Implementación del método purgarServidores
+ * 
+ * Compacta la lista por orden de creación y las listas por nombre (quitando
+ * los nombres sin servidores), y vuelve a contar los servidores en pie.
+ */
+void Nigromante::purgarServidores() {
+    auto caido = [this](IdNoMuerto id) { return !servidorEnPie(id); };
+    servidoresNoMuertos.erase(remove_if(servidoresNoMuertos.begin(), servidoresNoMuertos.end(), caido),
+                              servidoresNoMuertos.end());
+    for (auto it = servidoresPorNombre.begin(); it != servidoresPorNombre.end();) {
+        vector<IdNoMuerto>& servidores = it->second;
+        servidores.erase(remove_if(servidores.begin(), servidores.end(), caido), servidores.end());
+        it = servidores.empty() ? servidoresPorNombre.erase(it) : next(it);
+    }
+    servidoresEnPie = servidoresNoMuertos.size();
+    servidoresCaidos = 0;
+}
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../Mago.hpp"
+#include "../PoolNoMuertos.hpp"
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -12,10 +15,60 @@
 class Nigromante : public Mago {
 private:
     int poderNecromantico;
-    vector<string> servidoresNoMuertos;
+    PoolNoMuertos* mundo;                    // Pool donde viven sus servidores, nullptr hasta el primero
+    unique_ptr<PoolNoMuertos> mundoPropio;   // Pool privado si no se le asignó uno compartido
+    vector<IdNoMuerto> servidoresNoMuertos;  // En orden de creación; los destruidos se purgan por lotes
+    unordered_map<string, vector<IdNoMuerto>> servidoresPorNombre;
+    size_t servidoresEnPie;                  // Servidores vivos, sin recorrer las listas
+    size_t servidoresCaidos;                 // Destruidos que todavía ocupan lugar en las listas
     int energiaMuerte;
     bool filacteria;
     int resistenciaMuerte;
+    
+    /**
+     * @brief Crea un servidor en el pool con la fuerza actual del nigromante
+     * @param nombreNoMuerto Nombre del servidor
+     * @return Identificador del servidor
+     */
+    IdNoMuerto crearServidor(const string& nombreNoMuerto);
+    
+    /**
+     * @brief Busca un servidor en pie con ese nombre, descartando los destruidos
+     * @param nombreNoMuerto Nombre del servidor
+     * @return Identificador, inválido si no hay ninguno
+     */
+    IdNoMuerto buscarServidor(const string& nombreNoMuerto);
+    
+    /**
+     * @brief Obtiene el pool de los servidores, creando el privado si no tiene ninguno
+     * @return Pool de no-muertos
+     */
+    PoolNoMuertos& pool();
+    
+    /**
+     * @brief Indica si un servidor sigue en pie en el pool
+     * @param id Identificador del servidor
+     * @return true si es válido
+     */
+    bool servidorEnPie(IdNoMuerto id) const;
+    
+    /**
+     * @brief Descuenta servidores destruidos y purga las listas si más de la mitad ya cayó
+     * @param cantidad Servidores destruidos
+     * @param purgar false si hay referencias a las listas en uso
+     */
+    void registrarBajas(size_t cantidad, bool purgar);
+    
+    /**
+     * @brief Quita de las listas los servidores que ya no están en pie
+     */
+    void purgarServidores();
+
+protected:
+    void guardarEstadoClase(int estado[MAX_ESTADO_CLASE]) const override;
+    void restaurarEstadoClase(const int estado[MAX_ESTADO_CLASE]) override;
+    void guardarElementosClase(vector<ElementoClase>& elementos) const override;
+    void restaurarElementosClase(const vector<ElementoClase>& elementos) override;
 
 public:
     // ==========================================
@@ -44,6 +97,20 @@ public:
                int manaMax, EscuelaMagia esc, FuentePoder fp,
                int poderNec, int energiaMuerte, bool filact, int resistenciaMuerte);
     
+    /**
+     * @brief Constructor de copia
+     * 
+     * La copia recibe servidores propios, duplicados en el mismo pool.
+     * 
+     * @param otro Nigromante a copiar
+     */
+    Nigromante(const Nigromante& otro);
+    
+    /**
+     * @brief Destructor: destruye a sus servidores en el pool
+     */
+    ~Nigromante() override;
+    
     // ==========================================
     // HABILIDADES DE NIGROMANTE
     // ==========================================
@@ -80,6 +147,81 @@ public:
      */
     void crearFilacteria();
     
+    // ==========================================
+    // EJERCITO DE NO-MUERTOS
+    // ==========================================
+    
+    /**
+     * @brief Levanta muchos servidores iguales con un solo ritual
+     * 
+     * Cuesta lo mismo que levantar un no-muerto, pero cada servidor de la
+     * horda tiene la mitad de HP y de daño.
+     * 
+     * @param nombreNoMuerto Nombre de los servidores
+     * @param cantidad Cantidad de servidores a levantar
+     * @return Cantidad de servidores levantados
+     */
+    int levantarHorda(const string& nombreNoMuerto, int cantidad);
+    
+    /**
+     * @brief Todos los servidores en pie atacan a un objetivo
+     * @param objetivo Personaje atacado (recibe un solo golpe con el daño sumado)
+     * @return Daño total causado
+     */
+    int ordenarAtaque(InterfazPersonaje& objetivo);
+    
+    /**
+     * @brief Daña a un servidor; si cae se destruye en el pool
+     * 
+     * No purga las listas, así que la referencia de getServidores sigue
+     * siendo válida mientras se recorre.
+     * 
+     * @param id Servidor que recibe el daño
+     * @param cantidad Daño recibido
+     * @return true si sigue en pie
+     */
+    bool herirServidor(IdNoMuerto id, int cantidad);
+    
+    /**
+     * @brief Reparte daño entre los servidores, empezando por el más antiguo
+     * @param cantidad Daño a repartir
+     * @return Servidores que cayeron
+     */
+    int herirServidores(int cantidad);
+    
+    /**
+     * @brief Obtiene los servidores en pie
+     * @return Identificadores de los servidores en el pool
+     */
+    const vector<IdNoMuerto>& getServidores();
+    
+    /**
+     * @brief Cuenta los servidores en pie
+     * 
+     * Los servidores deben dañarse y destruirse a través del nigromante
+     * para que la cuenta siga al día.
+     * 
+     * @return Cantidad de servidores
+     */
+    size_t getCantidadServidores() const;
+    
+    /**
+     * @brief Cambia el pool donde se crean los servidores
+     * 
+     * Sin pool asignado, el nigromante usa uno privado que crea con su
+     * primer servidor.
+     * 
+     * @param nuevoMundo Pool a usar (debe vivir más que el nigromante)
+     * @return true si se cambio, false si todavia tiene servidores en el pool actual
+     */
+    bool setMundo(PoolNoMuertos& nuevoMundo);
+    
+    /**
+     * @brief Obtiene el pool donde viven sus servidores
+     * @return Pool de no-muertos (el privado si no se asignó otro)
+     */
+    PoolNoMuertos& getMundo();
+    
     // ==========================================
     // SOBRESCRITURAS DE MÉTODOS BASE
     // ==========================================
@@ -89,6 +231,8 @@ public:
      */
     void mostrarInfo() const override;
     
+    unique_ptr<InterfazPersonaje> clonar() const override;
+    
     /**
      * @brief Implementación especializada para recibir daño
      * 
@@ -100,6 +244,18 @@ public:
      * @return true si sigue vivo, false si ha muerto
      */
     bool recibirDanio(int cantidad, bool esCombatePPT) override;
+
+    /**
+     * @brief Reducción que recibirDanio aplica con el estado actual
+     * @return Reducción vigente
+     */
+    ReduccionDanio getReduccionDanio() const override;
+
+    /**
+     * @brief Indica si la filacteria todavía puede salvarlo de un golpe mortal
+     * @return true si conserva la filacteria
+     */
+    bool tieneFilacteria() const;
     
     /**
      * @brief Implementación especializada de meditación
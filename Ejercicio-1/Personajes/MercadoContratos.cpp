@@ -0,0 +1,231 @@
+#include "MercadoContratos.hpp"
+#include <algorithm>
+#include <functional>
+#include "Guerrero/Mercenario.hpp"
+
+/**
+ * @brief Implementacion del constructor de MercadoContratos
+ */
+MercadoContratos::MercadoContratos() : siguienteId(1) {}
+
+/**
+ * @brief Implementacion del metodo publicar
+ *
+ * El identificador es contador * PARTICIONES + particion del objetivo: el
+ * contador atomico ordena los contratos por antiguedad entre hilos y la
+ * particion se recupera del identificador.
+ *
+ * @param objetivo Nombre del objetivo
+ * @param recompensa Oro ofrecido (minimo 1)
+ * @param reputacionMinima Reputacion necesaria para tomarlo
+ * @return Identificador del contrato, 0 si el objetivo es vacio
+ */
+uint64_t MercadoContratos::publicar(const string& objetivo, int recompensa, int reputacionMinima) {
+    if (objetivo.empty()) {
+        return 0;
+    }
+    const size_t indice = particionDeObjetivo(objetivo);
+    uint64_t id = siguienteId.fetch_add(1, memory_order_relaxed) * PARTICIONES + indice;
+
+    Particion& particion = particiones[indice];
+    lock_guard<mutex> bloqueo(particion.cerrojo);
+    insertar(particion, Contrato{id, objetivo, max(1, recompensa), max(0, reputacionMinima)});
+    return id;
+}
+
+/**
+ * @brief Implementacion del metodo cancelar
+ *
+ * @param id Identificador del contrato
+ * @return true si seguia abierto
+ */
+bool MercadoContratos::cancelar(uint64_t id) {
+    Particion& particion = particiones[particionDeId(id)];
+    lock_guard<mutex> bloqueo(particion.cerrojo);
+    Contrato descartado;
+    return extraer(particion, id, descartado);
+}
+
+/**
+ * @brief Implementacion del metodo tomarMejor
+ *
+ * Busca el mejor candidato recorriendo las particiones de a una (sin tener
+ * dos cerrojos a la vez) y despues intenta extraerlo. Si otro hilo lo tomo
+ * en el medio, vuelve a buscar.
+ *
+ * @param reputacion Reputacion de quien lo toma
+ * @param contrato Contrato tomado
+ * @return true si habia alguno
+ */
+bool MercadoContratos::tomarMejor(int reputacion, Contrato& contrato) {
+    while (true) {
+        bool hayCandidato = false;
+        Clave candidato{0, 0};
+        for (Particion& particion : particiones) {
+            Clave mejor{0, 0};
+            lock_guard<mutex> bloqueo(particion.cerrojo);
+            if (mejorElegible(particion.porReputacion, reputacion, mejor) && (!hayCandidato || mejor < candidato)) {
+                candidato = mejor;
+                hayCandidato = true;
+            }
+        }
+        if (!hayCandidato) return false;
+
+        Particion& particion = particiones[particionDeId(candidato.id)];
+        lock_guard<mutex> bloqueo(particion.cerrojo);
+        if (extraer(particion, candidato.id, contrato)) return true;
+    }
+}
+
+/**
+ * @brief Implementacion del metodo tomarPorObjetivo
+ *
+ * Todos los contratos de un objetivo estan en la misma particion, asi que
+ * basta su cerrojo para buscar y extraer.
+ *
+ * @param objetivo Nombre del objetivo
+ * @param reputacion Reputacion de quien lo toma
+ * @param contrato Contrato tomado
+ * @return true si habia alguno
+ */
+bool MercadoContratos::tomarPorObjetivo(const string& objetivo, int reputacion, Contrato& contrato) {
+    Particion& particion = particiones[particionDeObjetivo(objetivo)];
+    lock_guard<mutex> bloqueo(particion.cerrojo);
+    auto it = particion.porObjetivo.find(objetivo);
+    Clave mejor{0, 0};
+    if (it == particion.porObjetivo.end() || !mejorElegible(it->second, reputacion, mejor)) {
+        return false;
+    }
+    return extraer(particion, mejor.id, contrato);
+}
+
+/**
+ * @brief Implementacion del metodo devolver
+ *
+ * @param contrato Contrato devuelto por tomarMejor o tomarPorObjetivo
+ * @return true si se reabrio
+ */
+bool MercadoContratos::devolver(const Contrato& contrato) {
+    if (contrato.objetivo.empty() || particionDeId(contrato.id) != particionDeObjetivo(contrato.objetivo)) {
+        return false;
+    }
+    Particion& particion = particiones[particionDeId(contrato.id)];
+    lock_guard<mutex> bloqueo(particion.cerrojo);
+    if (particion.contratos.count(contrato.id) > 0) {
+        return false;
+    }
+    insertar(particion, contrato);
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo registrarPago
+ *
+ * Los pagos se reparten entre las particiones segun el mercenario, para que
+ * los hilos que cobran no compitan todos por el mismo cerrojo.
+ *
+ * @param mercenario Mercenario que cobra
+ * @param recompensa Oro a pagar
+ */
+void MercadoContratos::registrarPago(Mercenario* mercenario, int recompensa) {
+    if (!mercenario || recompensa <= 0) return;
+    Particion& particion = particiones[hash<Mercenario*>()(mercenario) % PARTICIONES];
+    lock_guard<mutex> bloqueo(particion.cerrojo);
+    particion.pagos.emplace_back(mercenario, recompensa);
+}
+
+/**
+ * @brief Implementacion del metodo liquidar
+ *
+ * Suma los pagos pendientes por mercenario y acredita cada total con un
+ * unico cobrarRecompensa.
+ *
+ * @return Cantidad de mercenarios que cobraron
+ */
+size_t MercadoContratos::liquidar() {
+    vector<pair<Mercenario*, int>> pendientes;
+    for (Particion& particion : particiones) {
+        lock_guard<mutex> bloqueo(particion.cerrojo);
+        pendientes.insert(pendientes.end(), particion.pagos.begin(), particion.pagos.end());
+        particion.pagos.clear();
+    }
+
+    unordered_map<Mercenario*, long long> totales;
+    vector<Mercenario*> orden;
+    for (const auto& [mercenario, recompensa] : pendientes) {
+        auto [it, nuevo] = totales.try_emplace(mercenario, 0);
+        if (nuevo) orden.push_back(mercenario);
+        it->second += recompensa;
+    }
+    for (Mercenario* mercenario : orden) {
+        long long total = min<long long>(totales[mercenario], INT32_MAX);
+        mercenario->cobrarRecompensa(static_cast<int>(total));
+    }
+    return orden.size();
+}
+
+size_t MercadoContratos::getAbiertos() const {
+    size_t abiertos = 0;
+    for (const Particion& particion : particiones) {
+        lock_guard<mutex> bloqueo(particion.cerrojo);
+        abiertos += particion.contratos.size();
+    }
+    return abiertos;
+}
+
+size_t MercadoContratos::getPagosPendientes() const {
+    size_t pendientes = 0;
+    for (const Particion& particion : particiones) {
+        lock_guard<mutex> bloqueo(particion.cerrojo);
+        pendientes += particion.pagos.size();
+    }
+    return pendientes;
+}
+
+/**
+ * @brief Implementacion de mejorElegible
+ *
+ * Compara el primero de cada nivel de reputacion minima que no supere la
+ * reputacion dada; cada nivel ya esta ordenado por prioridad.
+ */
+bool MercadoContratos::mejorElegible(const NivelesReputacion& niveles, int reputacion, Clave& mejor) {
+    bool encontrado = false;
+    for (auto it = niveles.begin(); it != niveles.end() && it->first <= reputacion; ++it) {
+        const Clave& primero = *it->second.begin();
+        if (!encontrado || primero < mejor) {
+            mejor = primero;
+            encontrado = true;
+        }
+    }
+    return encontrado;
+}
+
+void MercadoContratos::insertar(Particion& particion, Contrato contrato) {
+    Clave clave{contrato.recompensa, contrato.id};
+    particion.porReputacion[contrato.reputacionMinima].insert(clave);
+    particion.porObjetivo[contrato.objetivo][contrato.reputacionMinima].insert(clave);
+    particion.contratos.emplace(contrato.id, move(contrato));
+}
+
+bool MercadoContratos::extraer(Particion& particion, uint64_t id, Contrato& contrato) {
+    auto it = particion.contratos.find(id);
+    if (it == particion.contratos.end()) return false;
+    contrato = move(it->second);
+    particion.contratos.erase(it);
+
+    Clave clave{contrato.recompensa, id};
+    auto nivel = particion.porReputacion.find(contrato.reputacionMinima);
+    nivel->second.erase(clave);
+    if (nivel->second.empty()) particion.porReputacion.erase(nivel);
+
+    auto delObjetivo = particion.porObjetivo.find(contrato.objetivo);
+    NivelesReputacion& niveles = delObjetivo->second;
+    auto nivelObjetivo = niveles.find(contrato.reputacionMinima);
+    nivelObjetivo->second.erase(clave);
+    if (nivelObjetivo->second.empty()) niveles.erase(nivelObjetivo);
+    if (niveles.empty()) particion.porObjetivo.erase(delObjetivo);
+    return true;
+}
+
+size_t MercadoContratos::particionDeObjetivo(const string& objetivo) { return hash<string>()(objetivo) % PARTICIONES; }
+size_t MercadoContratos::particionDeId(uint64_t id) { return static_cast<size_t>(id % PARTICIONES); }
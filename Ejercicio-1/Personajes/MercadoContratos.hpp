@@ -0,0 +1,160 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class Mercenario;
+
+/**
+ * @brief Contrato publicado en un MercadoContratos
+ */
+struct Contrato {
+    uint64_t id;                ///< Tambien define la prioridad por antiguedad
+    string objetivo;
+    int recompensa;
+    int reputacionMinima;       ///< Reputacion necesaria para tomarlo
+};
+
+/**
+ * @brief Mercado de contratos compartido por muchos mercenarios
+ *
+ * Los contratos abiertos se reparten en particiones segun su objetivo, cada
+ * una con su propio cerrojo, asi que varios hilos pueden publicar y tomar
+ * contratos a la vez. La particion va codificada en el identificador.
+ * Dentro de cada particion los contratos estan ordenados por recompensa
+ * (mayor primero) y, a igual recompensa, por antiguedad, agrupados por
+ * reputacion minima: en total y para cada objetivo.
+ *
+ * - tomarPorObjetivo bloquea una sola particion y compara el primero de
+ *   cada nivel de reputacion del objetivo: O(niveles + log n).
+ * - tomarMejor recorre las PARTICIONES de a una con el mismo criterio:
+ *   O(PARTICIONES * niveles + log n).
+ *
+ * Los pagos de los contratos cumplidos se encolan y se acreditan en lote con
+ * liquidar: un solo cobro por mercenario.
+ */
+class MercadoContratos {
+public:
+    MercadoContratos();
+
+    /**
+     * @brief Publica un contrato
+     * @param objetivo Nombre del objetivo
+     * @param recompensa Oro ofrecido (minimo 1)
+     * @param reputacionMinima Reputacion necesaria para tomarlo
+     * @return Identificador del contrato, 0 si el objetivo es vacio
+     */
+    uint64_t publicar(const string& objetivo, int recompensa, int reputacionMinima = 0);
+
+    /**
+     * @brief Retira un contrato que nadie tomo
+     * @param id Identificador del contrato
+     * @return true si seguia abierto
+     */
+    bool cancelar(uint64_t id);
+
+    /**
+     * @brief Toma el contrato mejor pago al que alcanza la reputacion
+     * @param reputacion Reputacion de quien lo toma
+     * @param contrato Contrato tomado
+     * @return true si habia alguno
+     */
+    bool tomarMejor(int reputacion, Contrato& contrato);
+
+    /**
+     * @brief Toma el contrato mejor pago sobre un objetivo
+     * @param objetivo Nombre del objetivo
+     * @param reputacion Reputacion de quien lo toma
+     * @param contrato Contrato tomado
+     * @return true si habia alguno
+     */
+    bool tomarPorObjetivo(const string& objetivo, int reputacion, Contrato& contrato);
+
+    /**
+     * @brief Vuelve a abrir un contrato tomado que no se pudo aceptar
+     *
+     * Conserva el identificador, asi que recupera su prioridad por antiguedad.
+     *
+     * @param contrato Contrato devuelto por tomarMejor o tomarPorObjetivo
+     * @return true si se reabrio; false si el identificador no es valido o ya esta abierto
+     */
+    bool devolver(const Contrato& contrato);
+
+    /**
+     * @brief Encola el pago de un contrato cumplido
+     * @param mercenario Mercenario que cobra
+     * @param recompensa Oro a pagar
+     */
+    void registrarPago(Mercenario* mercenario, int recompensa);
+
+    /**
+     * @brief Acredita todos los pagos pendientes
+     *
+     * No debe llamarse mientras otros hilos usan a los mercenarios que cobran.
+     *
+     * @return Cantidad de mercenarios que cobraron
+     */
+    size_t liquidar();
+
+    size_t getAbiertos() const;
+    size_t getPagosPendientes() const;
+
+private:
+    static constexpr size_t PARTICIONES = 16;
+
+    /**
+     * @brief Orden de prioridad: mayor recompensa y, a igualdad, mas antiguo
+     */
+    struct Clave {
+        int recompensa;
+        uint64_t id;
+
+        bool operator<(const Clave& otra) const {
+            if (recompensa != otra.recompensa) return recompensa > otra.recompensa;
+            return id < otra.id;
+        }
+    };
+
+    /// Reputacion minima -> contratos de ese nivel
+    using NivelesReputacion = map<int, set<Clave>>;
+
+    struct Particion {
+        mutable mutex cerrojo;
+        unordered_map<uint64_t, Contrato> contratos;
+        NivelesReputacion porReputacion;
+        unordered_map<string, NivelesReputacion> porObjetivo;
+        vector<pair<Mercenario*, int>> pagos;
+    };
+
+    /**
+     * @brief Busca el mejor contrato elegible entre niveles de reputacion
+     * @return true si encontro alguno
+     */
+    static bool mejorElegible(const NivelesReputacion& niveles, int reputacion, Clave& mejor);
+
+    /**
+     * @brief Agrega un contrato a los indices (con el cerrojo tomado)
+     */
+    static void insertar(Particion& particion, Contrato contrato);
+
+    /**
+     * @brief Quita un contrato de los indices (con el cerrojo tomado)
+     */
+    static bool extraer(Particion& particion, uint64_t id, Contrato& contrato);
+
+    static size_t particionDeObjetivo(const string& objetivo);
+    static size_t particionDeId(uint64_t id);
+
+    array<Particion, PARTICIONES> particiones;
+    atomic<uint64_t> siguienteId;
+};
@@ -0,0 +1,327 @@
+#include "MotorAuras.hpp"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @brief Implementacion del constructor de MotorAuras
+ *
+ * @param ancho Ancho del campo en metros
+ * @param alto Alto del campo en metros
+ * @param tamanioCelda Lado de cada celda de las cuadriculas de equipo
+ */
+MotorAuras::MotorAuras(double ancho, double alto, double tamanioCelda)
+    : ancho(ancho), alto(alto), tamanioCelda(tamanioCelda), radioMaximo(-1.0) {}
+
+/**
+ * @brief Implementacion del metodo registrar
+ *
+ * @param personaje Personaje a registrar
+ * @param equipo Numero de equipo (desde 0)
+ * @param posicion Posicion inicial
+ * @return Indice del personaje, -1 si es nulo o el equipo es negativo
+ */
+int MotorAuras::registrar(InterfazPersonaje* personaje, int equipo, const Posicion& posicion) {
+    if (!personaje || equipo < 0) {
+        cerr << "Error: no se puede registrar el personaje en el motor de auras." << endl;
+        return -1;
+    }
+    while (static_cast<int>(cuadriculas.size()) <= equipo) {
+        cuadriculas.emplace_back(ancho, alto, tamanioCelda);
+    }
+
+    int indice = static_cast<int>(personajes.size());
+    personajes.push_back(personaje);
+    equipos.push_back(equipo);
+    posiciones.push_back(posicion);
+    cuadriculas[equipo].insertar(indice, posicion);
+    aurasDe.emplace_back();
+    posicionConBonus.push_back(-1);
+    marcado.push_back(0);
+    for (int a = 0; a < CANTIDAD_ATRIBUTOS; ++a) {
+        planoAplicado.push_back(0);
+        porcentajeAplicado.push_back(0);
+        modificadorAplicado.push_back(-1);
+    }
+    marcar(indice);
+    return indice;
+}
+
+/**
+ * @brief Implementacion del metodo mover
+ *
+ * Si quien se mueve emite auras, se marcan los aliados a su alcance en la
+ * posicion vieja (pueden dejar de recibirlas) y en la nueva.
+ *
+ * @param indice Indice del personaje
+ * @param posicion Nueva posicion
+ */
+void MotorAuras::mover(int indice, const Posicion& posicion) {
+    if (indice < 0 || indice >= static_cast<int>(personajes.size())) return;
+    const double radio = radioDe(indice);
+    marcarAlcance(indice, radio);
+    posiciones[indice] = posicion;
+    cuadriculas[equipos[indice]].mover(indice, posicion);
+    marcarAlcance(indice, radio);
+    marcar(indice);
+}
+
+/**
+ * @brief Implementacion del metodo definir
+ *
+ * Reemplazar un tipo puede cambiar su radio o su atributo, asi que marca a
+ * todos los personajes.
+ *
+ * @param definicion Definicion del aura
+ * @return Identificador del tipo
+ */
+int MotorAuras::definir(const DefinicionAura& definicion) {
+    DefinicionAura ajustada = definicion;
+    ajustada.radio = max(0.0, ajustada.radio);
+
+    auto it = porNombre.find(ajustada.nombre);
+    if (it != porNombre.end()) {
+        definiciones[it->second] = ajustada;
+        radioMaximo = -1.0;
+        for (const DefinicionAura& definida : definiciones) {
+            radioMaximo = max(radioMaximo, definida.radio);
+        }
+        for (size_t p = 0; p < personajes.size(); ++p) {
+            marcar(static_cast<int>(p));
+        }
+        return it->second;
+    }
+    int id = static_cast<int>(definiciones.size());
+    definiciones.push_back(ajustada);
+    porNombre[ajustada.nombre] = id;
+    radioMaximo = max(radioMaximo, ajustada.radio);
+    beneficioPlano.push_back(0);
+    perjuicioPlano.push_back(0);
+    beneficioPorcentaje.push_back(0);
+    perjuicioPorcentaje.push_back(0);
+    tipoAlcanzado.push_back(0);
+    return id;
+}
+
+int MotorAuras::buscar(const string& nombre) const {
+    auto it = porNombre.find(nombre);
+    return it != porNombre.end() ? it->second : -1;
+}
+
+/**
+ * @brief Implementacion del metodo activar
+ *
+ * @param fuente Indice de quien emite el aura
+ * @param tipo Identificador del tipo de aura
+ * @param plano Bonus plano que otorga
+ * @param porcentaje Bonus porcentual que otorga
+ * @param duracion Ticks que dura, -1 para que no venza
+ * @return true si se activo
+ */
+bool MotorAuras::activar(int fuente, int tipo, int plano, int porcentaje, int duracion) {
+    if (fuente < 0 || fuente >= static_cast<int>(personajes.size())
+        || tipo < 0 || tipo >= static_cast<int>(definiciones.size()) || duracion == 0) {
+        return false;
+    }
+    fuentes.push_back(fuente);
+    tipos.push_back(tipo);
+    planos.push_back(plano);
+    porcentajes.push_back(porcentaje);
+    restantes.push_back(duracion < 0 ? -1 : duracion);
+    aurasDe[fuente].push_back(static_cast<int>(fuentes.size()) - 1);
+    marcarAlcance(fuente, definiciones[tipo].radio);
+    return true;
+}
+
+int MotorAuras::desactivar(int fuente, int tipo) {
+    if (fuente < 0 || fuente >= static_cast<int>(personajes.size())) return 0;
+    int quitadas = 0;
+    for (size_t k = aurasDe[fuente].size(); k-- > 0;) {
+        const size_t i = static_cast<size_t>(aurasDe[fuente][k]);
+        if (tipos[i] == tipo) {
+            quitarAura(i);
+            ++quitadas;
+        }
+    }
+    return quitadas;
+}
+
+/**
+ * @brief Implementacion del metodo avanzar
+ *
+ * 1. Vencen las auras sin duracion y las de personajes caidos.
+ * 2. Se marcan los personajes con bonus que cayeron.
+ * 3. Se recalculan solo los marcados.
+ *
+ * @return Cantidad de personajes cuyo bonus cambio
+ */
+size_t MotorAuras::avanzar() {
+    for (size_t i = fuentes.size(); i-- > 0;) {
+        bool vence = restantes[i] > 0 && --restantes[i] == 0;
+        if (vence || personajes[fuentes[i]]->getHP() <= 0) {
+            quitarAura(i);
+        }
+    }
+    for (int personaje : conBonus) {
+        if (personajes[personaje]->getHP() <= 0) {
+            marcar(personaje);
+        }
+    }
+
+    size_t cambiados = 0;
+    for (int personaje : marcados) {
+        marcado[personaje] = 0;
+        if (recalcular(personaje)) ++cambiados;
+    }
+    marcados.clear();
+    return cambiados;
+}
+
+int MotorAuras::getBonusPlano(int indice, AtributoPersonaje atributo) const {
+    if (indice < 0 || indice >= static_cast<int>(personajes.size())) return 0;
+    return planoAplicado[indice * CANTIDAD_ATRIBUTOS + static_cast<int>(atributo)];
+}
+
+size_t MotorAuras::getAuras() const { return fuentes.size(); }
+size_t MotorAuras::getPersonajes() const { return personajes.size(); }
+
+void MotorAuras::marcar(int personaje) {
+    if (!marcado[personaje]) {
+        marcado[personaje] = 1;
+        marcados.push_back(personaje);
+    }
+}
+
+void MotorAuras::marcarAlcance(int fuente, double radio) {
+    if (radio < 0.0) return;
+    vecinos.clear();
+    cuadriculas[equipos[fuente]].enRango(posiciones[fuente], radio, vecinos);
+    for (int aliado : vecinos) {
+        marcar(aliado);
+    }
+}
+
+double MotorAuras::radioDe(int fuente) const {
+    double radio = -1.0;
+    for (int aura : aurasDe[fuente]) {
+        radio = max(radio, definiciones[tipos[aura]].radio);
+    }
+    return radio;
+}
+
+/**
+ * @brief Implementacion del metodo recalcular
+ *
+ * Busca en la cuadricula del equipo las fuentes a radioMaximo y, de cada
+ * aura que lo alcanza, guarda por tipo el mayor beneficio y el mayor
+ * perjuicio. Un personaje caido no recibe auras. Solo si el total de un
+ * atributo difiere del aplicado se reemplaza el modificador en la pila.
+ *
+ * @param personaje Indice del personaje
+ * @return true si algun bonus cambio
+ */
+bool MotorAuras::recalcular(int personaje) {
+    int planoNuevo[CANTIDAD_ATRIBUTOS] = {};
+    int porcentajeNuevo[CANTIDAD_ATRIBUTOS] = {};
+
+    if (personajes[personaje]->getHP() > 0 && radioMaximo >= 0.0) {
+        const Posicion& posicion = posiciones[personaje];
+        vecinos.clear();
+        cuadriculas[equipos[personaje]].enRango(posicion, radioMaximo, vecinos);
+        for (int fuente : vecinos) {
+            if (aurasDe[fuente].empty()) continue;
+            const double distancia = distanciaCuadrada(posiciones[fuente], posicion);
+            for (int aura : aurasDe[fuente]) {
+                const int tipo = tipos[aura];
+                const double radio = definiciones[tipo].radio;
+                if (distancia > radio * radio) continue;
+                if (!tipoAlcanzado[tipo]) {
+                    tipoAlcanzado[tipo] = 1;
+                    tiposAlcanzados.push_back(tipo);
+                }
+                beneficioPlano[tipo] = max(beneficioPlano[tipo], planos[aura]);
+                perjuicioPlano[tipo] = min(perjuicioPlano[tipo], planos[aura]);
+                beneficioPorcentaje[tipo] = max(beneficioPorcentaje[tipo], porcentajes[aura]);
+                perjuicioPorcentaje[tipo] = min(perjuicioPorcentaje[tipo], porcentajes[aura]);
+            }
+        }
+        for (int tipo : tiposAlcanzados) {
+            const int atributo = static_cast<int>(definiciones[tipo].atributo);
+            planoNuevo[atributo] += beneficioPlano[tipo] + perjuicioPlano[tipo];
+            porcentajeNuevo[atributo] += beneficioPorcentaje[tipo] + perjuicioPorcentaje[tipo];
+            beneficioPlano[tipo] = perjuicioPlano[tipo] = 0;
+            beneficioPorcentaje[tipo] = perjuicioPorcentaje[tipo] = 0;
+            tipoAlcanzado[tipo] = 0;
+        }
+        tiposAlcanzados.clear();
+    }
+
+    bool cambio = false;
+    bool tieneBonus = false;
+    PilaModificadores* pila = pilaModificadoresDe(personajes[personaje]);
+    for (int a = 0; a < CANTIDAD_ATRIBUTOS; ++a) {
+        const int k = personaje * CANTIDAD_ATRIBUTOS + a;
+        const int plano = planoNuevo[a];
+        const int porcentaje = porcentajeNuevo[a];
+        if (plano != 0 || porcentaje != 0) tieneBonus = true;
+        if (plano == planoAplicado[k] && porcentaje == porcentajeAplicado[k]) continue;
+
+        cambio = true;
+        planoAplicado[k] = plano;
+        porcentajeAplicado[k] = porcentaje;
+        if (!pila) continue;
+        if (modificadorAplicado[k] >= 0) {
+            pila->quitar(modificadorAplicado[k]);
+            modificadorAplicado[k] = -1;
+        }
+        if (plano != 0 || porcentaje != 0) {
+            modificadorAplicado[k] = pila->agregar(Modificador{static_cast<AtributoPersonaje>(a),
+                                                               OrigenModificador::Aura, plano, porcentaje});
+        }
+    }
+
+    if (tieneBonus && posicionConBonus[personaje] < 0) {
+        posicionConBonus[personaje] = static_cast<int>(conBonus.size());
+        conBonus.push_back(personaje);
+    } else if (!tieneBonus && posicionConBonus[personaje] >= 0) {
+        const int posicion = posicionConBonus[personaje];
+        conBonus[posicion] = conBonus.back();
+        posicionConBonus[conBonus[posicion]] = posicion;
+        conBonus.pop_back();
+        posicionConBonus[personaje] = -1;
+    }
+    return cambio;
+}
+
+/**
+ * @brief Implementacion del metodo quitarAura
+ *
+ * Marca a los aliados que alcanzaba y la borra por intercambio con la
+ * ultima; el orden de las auras no importa, pero la lista de auras de la
+ * fuente de la ultima pasa a apuntar a la nueva posicion.
+ *
+ * @param i Posicion del aura
+ */
+void MotorAuras::quitarAura(size_t i) {
+    const int aura = static_cast<int>(i);
+    const int ultima = static_cast<int>(fuentes.size()) - 1;
+    marcarAlcance(fuentes[i], definiciones[tipos[i]].radio);
+
+    vector<int>& propias = aurasDe[fuentes[i]];
+    *find(propias.begin(), propias.end(), aura) = propias.back();
+    propias.pop_back();
+    if (aura != ultima) {
+        vector<int>& deLaUltima = aurasDe[fuentes[ultima]];
+        *find(deLaUltima.begin(), deLaUltima.end(), ultima) = aura;
+    }
+
+    fuentes[i] = fuentes[ultima];
+    tipos[i] = tipos[ultima];
+    planos[i] = planos[ultima];
+    porcentajes[i] = porcentajes[ultima];
+    restantes[i] = restantes[ultima];
+    fuentes.pop_back();
+    tipos.pop_back();
+    planos.pop_back();
+    porcentajes.pop_back();
+    restantes.pop_back();
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "CuadriculaEspacial.hpp"
+#include "InterfazPersonaje.hpp"
+#include "PilaModificadores.hpp"
+
+using namespace std;
+
+/// Radio del aura divina de un paladin, en metros
+static const double RADIO_AURA_DIVINA = 12.0;
+
+/// Radio de la zona que protege un caballero al defender aliados, en metros
+static const double RADIO_DEFENSA_CABALLERO = 4.0;
+
+/**
+ * @brief Tipo de aura: que atributo mejora y hasta donde llega
+ *
+ * Dos auras del mismo tipo no se acumulan sobre un aliado: cuenta el
+ * beneficio mas fuerte y el perjuicio (valor negativo) mas fuerte, por
+ * separado para el bonus plano y el porcentual. Auras de tipos distintos
+ * si se suman.
+ */
+struct DefinicionAura {
+    string nombre;
+    AtributoPersonaje atributo;
+    double radio;
+};
+
+/**
+ * @brief Auras y protecciones de area sobre los aliados de cada equipo
+ *
+ * Cada equipo tiene su propia CuadriculaEspacial, asi que los destinatarios
+ * de un aura se obtienen con una consulta de rango que solo recorre aliados
+ * cercanos. Los cambios marcan solo a los personajes afectados:
+ *
+ * - mover marca a quien se movio y, si emite auras, a los aliados a su
+ *   alcance antes y despues del movimiento.
+ * - activar, desactivar y el vencimiento de un aura marcan a los aliados a
+ *   su alcance.
+ * - Un aliado con bonus que cae se marca y deja de recibir auras.
+ *
+ * avanzar recalcula solo a los marcados, buscando las fuentes cercanas en
+ * la cuadricula de su equipo, y toca la pila de modificadores (origen Aura)
+ * solo de los personajes cuyo bonus cambio. Si no hay marcados, el tick
+ * solo revisa vencimientos y caidos.
+ */
+class MotorAuras {
+public:
+    /**
+     * @brief Constructor
+     * @param ancho Ancho del campo en metros
+     * @param alto Alto del campo en metros
+     * @param tamanioCelda Lado de cada celda de las cuadriculas de equipo
+     */
+    MotorAuras(double ancho = 1000.0, double alto = 1000.0, double tamanioCelda = 10.0);
+
+    /**
+     * @brief Registra un personaje en un equipo y una posicion
+     * @param personaje Personaje (no pasa a ser propiedad del motor)
+     * @param equipo Numero de equipo (desde 0)
+     * @param posicion Posicion inicial
+     * @return Indice del personaje, -1 si es nulo o el equipo es negativo
+     */
+    int registrar(InterfazPersonaje* personaje, int equipo, const Posicion& posicion);
+
+    /**
+     * @brief Mueve un personaje registrado
+     * @param indice Indice del personaje
+     * @param posicion Nueva posicion
+     */
+    void mover(int indice, const Posicion& posicion);
+
+    /**
+     * @brief Define un tipo de aura (o reemplaza el que tenga el mismo nombre)
+     * @param definicion Definicion del aura
+     * @return Identificador del tipo
+     */
+    int definir(const DefinicionAura& definicion);
+
+    /**
+     * @brief Busca un tipo de aura por nombre
+     * @param nombre Nombre del aura
+     * @return Identificador, -1 si no esta definido
+     */
+    int buscar(const string& nombre) const;
+
+    /**
+     * @brief Activa un aura alrededor de un personaje
+     *
+     * El aura alcanza tambien a quien la emite y desaparece si este cae.
+     *
+     * @param fuente Indice de quien emite el aura
+     * @param tipo Identificador del tipo de aura
+     * @param plano Bonus plano que otorga
+     * @param porcentaje Bonus porcentual que otorga
+     * @param duracion Ticks que dura, -1 para que no venza
+     * @return true si se activo
+     */
+    bool activar(int fuente, int tipo, int plano, int porcentaje, int duracion = -1);
+
+    /**
+     * @brief Quita las auras de un tipo que emite un personaje
+     * @param fuente Indice de quien emite
+     * @param tipo Identificador del tipo de aura
+     * @return Cantidad de auras quitadas
+     */
+    int desactivar(int fuente, int tipo);
+
+    /**
+     * @brief Avanza un tick: vence auras y actualiza los bonus de los aliados
+     * @return Cantidad de personajes cuyo bonus cambio
+     */
+    size_t avanzar();
+
+    /**
+     * @brief Obtiene el bonus plano que un personaje recibe de las auras
+     * @param indice Indice del personaje
+     * @param atributo Atributo
+     * @return Bonus plano aplicado en el ultimo tick
+     */
+    int getBonusPlano(int indice, AtributoPersonaje atributo) const;
+
+    size_t getAuras() const;
+    size_t getPersonajes() const;
+
+private:
+    /**
+     * @brief Marca a los aliados que alcanza un radio alrededor de una fuente
+     * @param fuente Indice de quien emite
+     * @param radio Radio a marcar
+     */
+    void marcarAlcance(int fuente, double radio);
+
+    /**
+     * @brief Radio de la mayor aura que emite un personaje
+     * @param fuente Indice de quien emite
+     * @return Radio, negativo si no emite ninguna
+     */
+    double radioDe(int fuente) const;
+
+    /**
+     * @brief Recalcula los bonus de un personaje y actualiza su pila
+     * @param personaje Indice del personaje
+     * @return true si algun bonus cambio
+     */
+    bool recalcular(int personaje);
+
+    void marcar(int personaje);
+    void quitarAura(size_t i);
+
+    double ancho;
+    double alto;
+    double tamanioCelda;
+
+    vector<InterfazPersonaje*> personajes;
+    vector<int> equipos;
+    vector<Posicion> posiciones;
+    vector<CuadriculaEspacial> cuadriculas;     ///< Una por equipo
+
+    vector<DefinicionAura> definiciones;
+    unordered_map<string, int> porNombre;
+    double radioMaximo;                         ///< Mayor radio entre los tipos definidos
+
+    // Auras activas, un arreglo por campo
+    vector<int> fuentes;
+    vector<int> tipos;
+    vector<int> planos;
+    vector<int> porcentajes;
+    vector<int> restantes;
+    vector<vector<int>> aurasDe;                ///< Auras que emite cada personaje
+
+    // Bonus aplicados por (personaje, atributo)
+    vector<int> planoAplicado;
+    vector<int> porcentajeAplicado;
+    vector<int> modificadorAplicado;            ///< Id en la pila del personaje, -1 si no tiene
+    vector<int> conBonus;                       ///< Personajes con algun bonus aplicado
+    vector<int> posicionConBonus;               ///< Posicion en conBonus, -1 si no tiene bonus
+
+    // Personajes a recalcular en el proximo tick
+    vector<char> marcado;
+    vector<int> marcados;
+
+    // Memoria de trabajo de recalcular, por tipo de aura
+    vector<int> beneficioPlano;
+    vector<int> perjuicioPlano;
+    vector<int> beneficioPorcentaje;
+    vector<int> perjuicioPorcentaje;
+    vector<char> tipoAlcanzado;
+    vector<int> tiposAlcanzados;
+    vector<int> vecinos;
+};
@@ -0,0 +1,318 @@
+#include "MotorInvocaciones.hpp"
+#include <algorithm>
+
+/**
+ * @brief Implementacion del constructor de MotorInvocaciones
+ */
+MotorInvocaciones::MotorInvocaciones() : activas(0), tick(0), reasignaciones(0) {}
+
+/**
+ * @brief Implementacion del metodo registrar
+ *
+ * @param personaje Personaje a registrar
+ * @param bando Bando del personaje (-1 = sin bando)
+ * @return Indice del personaje, -1 si es nulo
+ */
+int MotorInvocaciones::registrar(InterfazPersonaje* personaje, int bando) {
+    int indice = registro.registrar(personaje);
+    if (indice < 0) {
+        return -1;
+    }
+    bando = max(-1, bando);
+    bandos.push_back(bando);
+    if (bando >= 0) {
+        if (bando >= static_cast<int>(miembrosBando.size())) {
+            miembrosBando.resize(bando + 1);
+        }
+        posicionEnBando.push_back(static_cast<int>(miembrosBando[bando].size()));
+        miembrosBando[bando].push_back(indice);
+    } else {
+        posicionEnBando.push_back(-1);
+    }
+    primeras.push_back(-1);
+    ultimas.push_back(-1);
+    cantidades.push_back(0);
+    enPie.push_back(1);
+    reemplazos.push_back(-1);
+    tickReemplazo.push_back(0);
+    return indice;
+}
+
+/**
+ * @brief Implementacion del metodo definir
+ *
+ * Ajusta HP, daño y duracion a minimos validos.
+ *
+ * @param plantilla Estadisticas de la criatura
+ * @return Identificador de la plantilla
+ */
+int MotorInvocaciones::definir(const PlantillaCriatura& plantilla) {
+    PlantillaCriatura ajustada = plantilla;
+    ajustada.hp = max(1, ajustada.hp);
+    ajustada.danio = max(0, ajustada.danio);
+    ajustada.duracion = max(1, ajustada.duracion);
+    return plantillas.definir(ajustada);
+}
+
+int MotorInvocaciones::buscar(const string& nombre) const { return plantillas.buscar(nombre); }
+
+bool MotorInvocaciones::esPersonajeValido(int indice) const {
+    return registro.esValido(indice) && registro.get(indice)->getHP() > 0;
+}
+
+/**
+ * @brief Implementacion del metodo invocar
+ *
+ * La criatura se agrega al final de la lista de su invocador. Si mas de la
+ * mitad de los lugares son de criaturas retiradas, se compacta antes.
+ *
+ * @param plantilla Identificador de la plantilla
+ * @param invocador Indice de quien la invoca
+ * @param objetivo Indice del objetivo
+ * @param danioExtra Daño por turno que se suma al de la plantilla
+ * @return true si se invoco
+ */
+bool MotorInvocaciones::invocar(int plantilla, int invocador, int objetivo, int danioExtra) {
+    if (!plantillas.esValido(plantilla) || !registro.esValido(invocador) || !registro.esValido(objetivo)) {
+        return false;
+    }
+    if (tipos.size() > 2 * activas + 16) {
+        compactar();
+    }
+
+    const PlantillaCriatura& datos = plantillas[plantilla];
+    const int posicion = static_cast<int>(tipos.size());
+    tipos.push_back(plantilla);
+    invocadores.push_back(invocador);
+    objetivos.push_back(objetivo);
+    hps.push_back(datos.hp);
+    danios.push_back(datos.danio + max(0, danioExtra));
+    restantes.push_back(datos.duracion);
+    anteriores.push_back(ultimas[invocador]);
+    siguientes.push_back(-1);
+
+    if (ultimas[invocador] >= 0) {
+        siguientes[ultimas[invocador]] = posicion;
+    } else {
+        primeras[invocador] = posicion;
+    }
+    ultimas[invocador] = posicion;
+    ++cantidades[invocador];
+    ++activas;
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo herirInvocaciones
+ *
+ * Las criaturas del invocador absorben el daño en orden de invocacion.
+ *
+ * @param invocador Indice del invocador
+ * @param cantidad Daño a repartir
+ * @return Criaturas que cayeron
+ */
+int MotorInvocaciones::herirInvocaciones(int invocador, int cantidad) {
+    if (!registro.esValido(invocador)) {
+        return 0;
+    }
+    int caidas = 0;
+    int actual = primeras[invocador];
+    while (actual >= 0 && cantidad > 0) {
+        int siguiente = siguientes[actual];
+        int absorbido = min(cantidad, hps[actual]);
+        hps[actual] -= absorbido;
+        cantidad -= absorbido;
+        if (hps[actual] == 0) {
+            retirar(actual);
+            ++caidas;
+        }
+        actual = siguiente;
+    }
+    return caidas;
+}
+
+/**
+ * @brief Implementacion del metodo desterrar
+ *
+ * @param invocador Indice del invocador
+ * @return Cantidad de criaturas quitadas
+ */
+int MotorInvocaciones::desterrar(int invocador) {
+    if (!registro.esValido(invocador)) {
+        return 0;
+    }
+    int quitadas = 0;
+    while (primeras[invocador] >= 0) {
+        retirar(primeras[invocador]);
+        ++quitadas;
+    }
+    return quitadas;
+}
+
+/**
+ * @brief Implementacion del metodo avanzar
+ *
+ * Primero se consulta una vez el HP de cada personaje registrado; la pasada
+ * sobre las criaturas solo lee arreglos. Una criatura cuyo invocador cayo
+ * desaparece sin atacar, y una cuyo objetivo cayo ataca a su reemplazo.
+ *
+ * @return Cantidad de objetivos que recibieron daño
+ */
+size_t MotorInvocaciones::avanzar() {
+    ++tick;
+    for (size_t p = 0; p < registro.getCantidad(); ++p) {
+        enPie[p] = registro.get(static_cast<int>(p))->getHP() > 0 ? 1 : 0;
+    }
+
+    const size_t total = tipos.size();
+    for (size_t i = 0; i < total; ++i) {
+        if (restantes[i] <= 0) {
+            continue;
+        }
+        if (!enPie[invocadores[i]]) {
+            retirar(i);
+            continue;
+        }
+        int objetivo = objetivoEnPie(i);
+        if (objetivo >= 0 && danios[i] > 0) {
+            registro.acumularDanio(objetivo, danios[i]);
+        }
+        if (--restantes[i] == 0) {
+            retirar(i);
+        }
+    }
+
+    size_t objetivosDaniados = registro.aplicarDanio();
+    compactar();
+    return objetivosDaniados;
+}
+
+int MotorInvocaciones::getInvocaciones(int invocador) const {
+    return registro.esValido(invocador) ? cantidades[invocador] : 0;
+}
+
+const PlantillaCriatura& MotorInvocaciones::getPlantilla(int plantilla) const { return plantillas.get(plantilla); }
+size_t MotorInvocaciones::getActivos() const { return activas; }
+long long MotorInvocaciones::getDanioTotal() const { return registro.getDanioTotal(); }
+long long MotorInvocaciones::getReasignaciones() const { return reasignaciones; }
+
+/**
+ * @brief Implementacion del metodo retirar
+ *
+ * @param i Posicion de la criatura
+ */
+void MotorInvocaciones::retirar(size_t i) {
+    const int invocador = invocadores[i];
+    const int anterior = anteriores[i];
+    const int siguiente = siguientes[i];
+    if (anterior >= 0) {
+        siguientes[anterior] = siguiente;
+    } else {
+        primeras[invocador] = siguiente;
+    }
+    if (siguiente >= 0) {
+        anteriores[siguiente] = anterior;
+    } else {
+        ultimas[invocador] = anterior;
+    }
+    restantes[i] = 0;
+    --cantidades[invocador];
+    --activas;
+}
+
+/**
+ * @brief Implementacion del metodo objetivoEnPie
+ *
+ * @param i Posicion de la criatura
+ * @return Indice del objetivo, -1 si no queda nadie a quien atacar
+ */
+int MotorInvocaciones::objetivoEnPie(size_t i) {
+    int objetivo = objetivos[i];
+    if (enPie[objetivo]) {
+        return objetivo;
+    }
+    int reemplazo = buscarReemplazo(objetivo);
+    if (reemplazo >= 0) {
+        objetivos[i] = reemplazo;
+        ++reasignaciones;
+    }
+    return reemplazo;
+}
+
+/**
+ * @brief Implementacion del metodo buscarReemplazo
+ *
+ * Recorre el bando a partir del caido, asi que las criaturas de distintos
+ * caidos se reparten entre distintos reemplazos. El resultado se guarda
+ * durante el tick: cada caido se resuelve una sola vez.
+ *
+ * @param caido Indice del personaje caido
+ * @return Indice del reemplazo, -1 si no hay
+ */
+int MotorInvocaciones::buscarReemplazo(int caido) {
+    if (tickReemplazo[caido] == tick) {
+        return reemplazos[caido];
+    }
+    int reemplazo = -1;
+    if (bandos[caido] >= 0) {
+        const vector<int>& miembros = miembrosBando[bandos[caido]];
+        const size_t cantidad = miembros.size();
+        const size_t inicio = static_cast<size_t>(posicionEnBando[caido]);
+        for (size_t k = 1; k < cantidad; ++k) {
+            int candidato = miembros[(inicio + k) % cantidad];
+            if (enPie[candidato]) {
+                reemplazo = candidato;
+                break;
+            }
+        }
+    }
+    reemplazos[caido] = reemplazo;
+    tickReemplazo[caido] = tick;
+    return reemplazo;
+}
+
+/**
+ * @brief Implementacion del metodo moverInstancia
+ *
+ * Los vecinos de la lista del invocador pasan a apuntar a la nueva posicion.
+ *
+ * @param desde Posicion actual
+ * @param hasta Posicion nueva (menor)
+ */
+void MotorInvocaciones::moverInstancia(size_t desde, size_t hasta) {
+    tipos[hasta] = tipos[desde];
+    invocadores[hasta] = invocadores[desde];
+    objetivos[hasta] = objetivos[desde];
+    hps[hasta] = hps[desde];
+    danios[hasta] = danios[desde];
+    restantes[hasta] = restantes[desde];
+    anteriores[hasta] = anteriores[desde];
+    siguientes[hasta] = siguientes[desde];
+
+    const int posicion = static_cast<int>(hasta);
+    const int invocador = invocadores[hasta];
+    if (anteriores[hasta] >= 0) {
+        siguientes[anteriores[hasta]] = posicion;
+    } else {
+        primeras[invocador] = posicion;
+    }
+    if (siguientes[hasta] >= 0) {
+        anteriores[siguientes[hasta]] = posicion;
+    } else {
+        ultimas[invocador] = posicion;
+    }
+}
+
+/**
+ * @brief Implementacion del metodo compactar
+ *
+ * Quita las criaturas retiradas conservando el orden del resto.
+ */
+void MotorInvocaciones::compactar() {
+    size_t quedan = compactarInstancias(tipos.size(),
+        [this](size_t i) { return restantes[i] > 0; },
+        [this](size_t desde, size_t hasta) { moverInstancia(desde, hasta); },
+        [](size_t) {});
+    if (quedan == tipos.size()) return;
+    redimensionarCampos(quedan, tipos, invocadores, objetivos, hps, danios, restantes, anteriores, siguientes);
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "InterfazPersonaje.hpp"
+#include "RegistroCombatientes.hpp"
+
+using namespace std;
+
+/**
+ * @brief Plantilla de estadisticas de una criatura invocable
+ *
+ * Cada invocacion parte de estos valores; quien invoca suma su propio poder
+ * al daño por turno.
+ */
+struct PlantillaCriatura {
+    string nombre;
+    int hp;           ///< Puntos de vida de cada invocacion
+    int danio;        ///< Daño base por turno
+    int duracion;     ///< Turnos que permanece invocada
+};
+
+/**
+ * @brief Criaturas invocadas de muchos personajes a la vez
+ *
+ * Las plantillas se registran una vez y se buscan por nombre en O(1). Las
+ * invocaciones activas viven en arreglos contiguos (uno por campo) y avanzar
+ * las recorre una sola vez por tick: cada criatura suma su daño al de su
+ * objetivo y despues se aplica un unico recibirDanio por objetivo. Las
+ * criaturas vencidas, muertas o cuyo invocador cayo se compactan en la misma
+ * pasada. El registro de personajes, el catalogo por nombre y la
+ * compactacion son los de RegistroCombatientes, compartidos con
+ * MotorMaleficios.
+ *
+ * Las criaturas de cada invocador forman una lista enlazada en orden de
+ * invocacion, asi que herirInvocaciones, desterrar y getInvocaciones solo
+ * tocan las criaturas de ese invocador.
+ *
+ * Si el objetivo de una criatura cae y el objetivo se registro con un bando,
+ * la criatura pasa a atacar al siguiente personaje en pie de ese bando. El
+ * invocador no deberia pertenecer al bando de sus objetivos.
+ */
+class MotorInvocaciones {
+public:
+    MotorInvocaciones();
+
+    /**
+     * @brief Registra un personaje como invocador u objetivo
+     * @param personaje Personaje (no pasa a ser propiedad del motor)
+     * @param bando Bando del personaje para reasignar objetivos (-1 = sin bando)
+     * @return Indice del personaje, -1 si es nulo
+     */
+    int registrar(InterfazPersonaje* personaje, int bando = -1);
+
+    /**
+     * @brief Define una plantilla (o reemplaza la que tenga el mismo nombre)
+     * @param plantilla Estadisticas de la criatura
+     * @return Identificador de la plantilla
+     */
+    int definir(const PlantillaCriatura& plantilla);
+
+    /**
+     * @brief Busca una plantilla por nombre
+     * @param nombre Nombre de la criatura
+     * @return Identificador, -1 si no esta definida
+     */
+    int buscar(const string& nombre) const;
+
+    /**
+     * @brief Indica si un indice corresponde a un personaje registrado y en pie
+     * @param indice Indice a validar
+     * @return true si puede invocar o ser atacado
+     */
+    bool esPersonajeValido(int indice) const;
+
+    /**
+     * @brief Invoca una criatura que atacara a un objetivo en cada tick
+     * @param plantilla Identificador de la plantilla
+     * @param invocador Indice de quien la invoca
+     * @param objetivo Indice del objetivo
+     * @param danioExtra Daño por turno que se suma al de la plantilla
+     * @return true si se invoco
+     */
+    bool invocar(int plantilla, int invocador, int objetivo, int danioExtra);
+
+    /**
+     * @brief Daña a las criaturas de un invocador, empezando por la mas antigua
+     * @param invocador Indice del invocador
+     * @param cantidad Daño a repartir
+     * @return Criaturas que cayeron
+     */
+    int herirInvocaciones(int invocador, int cantidad);
+
+    /**
+     * @brief Hace desaparecer todas las criaturas de un invocador
+     * @param invocador Indice del invocador
+     * @return Cantidad de criaturas quitadas
+     */
+    int desterrar(int invocador);
+
+    /**
+     * @brief Avanza un tick: todas las criaturas atacan y se quitan las vencidas
+     * @return Cantidad de objetivos que recibieron daño
+     */
+    size_t avanzar();
+
+    /**
+     * @brief Cuenta las criaturas activas de un invocador
+     * @param invocador Indice del invocador
+     * @return Cantidad de criaturas
+     */
+    int getInvocaciones(int invocador) const;
+
+    const PlantillaCriatura& getPlantilla(int plantilla) const;
+    size_t getActivos() const;
+    long long getDanioTotal() const;
+
+    /**
+     * @brief Veces que una criatura cambio de objetivo porque el suyo cayo
+     * @return Cantidad de reasignaciones
+     */
+    long long getReasignaciones() const;
+
+private:
+    /**
+     * @brief Quita una criatura de la lista de su invocador y la marca para compactar
+     * @param i Posicion de la criatura
+     */
+    void retirar(size_t i);
+
+    /**
+     * @brief Obtiene el objetivo en pie de una criatura, reasignandolo si hace falta
+     * @param i Posicion de la criatura
+     * @return Indice del objetivo, -1 si no queda nadie a quien atacar
+     */
+    int objetivoEnPie(size_t i);
+
+    /**
+     * @brief Busca al siguiente personaje en pie del bando de uno que cayo
+     * @param caido Indice del personaje caido
+     * @return Indice del reemplazo, -1 si no hay
+     */
+    int buscarReemplazo(int caido);
+
+    void moverInstancia(size_t desde, size_t hasta);
+    void compactar();
+
+    RegistroCombatientes registro;
+    CatalogoPorNombre<PlantillaCriatura> plantillas;
+
+    // Datos por personaje
+    vector<int> bandos;
+    vector<int> posicionEnBando;        ///< Indice en miembrosBando[bando]
+    vector<vector<int>> miembrosBando;
+    vector<int> primeras;               ///< Criatura mas antigua de cada invocador, -1 si no tiene
+    vector<int> ultimas;                ///< Criatura mas reciente de cada invocador, -1 si no tiene
+    vector<int> cantidades;             ///< Criaturas activas de cada invocador
+    vector<char> enPie;                 ///< Personajes con HP en el tick actual
+    vector<int> reemplazos;             ///< Reemplazo calculado en este tick para cada caido
+    vector<uint64_t> tickReemplazo;     ///< Tick en que se calculo cada reemplazo
+
+    // Criaturas, un arreglo por campo (las retiradas tienen restantes == 0)
+    vector<int> tipos;
+    vector<int> invocadores;
+    vector<int> objetivos;
+    vector<int> hps;
+    vector<int> danios;
+    vector<int> restantes;
+    vector<int> anteriores;             ///< Criatura anterior del mismo invocador, -1 si es la primera
+    vector<int> siguientes;             ///< Criatura siguiente del mismo invocador, -1 si es la ultima
+
+    size_t activas;
+    uint64_t tick;
+    long long reasignaciones;
+};
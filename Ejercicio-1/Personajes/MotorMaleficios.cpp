@@ -0,0 +1,217 @@
+#include "MotorMaleficios.hpp"
+#include <algorithm>
+
+/**
+ * @brief Implementacion del metodo registrar
+ *
+ * @param personaje Personaje a registrar
+ * @return Indice del personaje, -1 si es nulo
+ */
+int MotorMaleficios::registrar(InterfazPersonaje* personaje) {
+    return registro.registrar(personaje);
+}
+
+/**
+ * @brief Implementacion del metodo definir
+ *
+ * Ajusta duracion, periodo y acumulaciones a minimos validos.
+ *
+ * @param definicion Definicion del maleficio
+ * @return Identificador del maleficio
+ */
+int MotorMaleficios::definir(const DefinicionMaleficio& definicion) {
+    DefinicionMaleficio ajustada = definicion;
+    ajustada.duracion = max(1, ajustada.duracion);
+    ajustada.periodo = max(1, ajustada.periodo);
+    ajustada.maxAcumulaciones = max(1, ajustada.maxAcumulaciones);
+    return definiciones.definir(ajustada);
+}
+
+int MotorMaleficios::buscar(const string& nombre) const { return definiciones.buscar(nombre); }
+
+bool MotorMaleficios::esObjetivoValido(int objetivo) const {
+    return registro.esValido(objetivo) && registro.get(objetivo)->getHP() > 0;
+}
+
+/**
+ * @brief Implementacion del metodo aplicar
+ *
+ * - Renovar: reinicia la duracion y conserva el daño mayor.
+ * - Acumular: suma una acumulacion (hasta el maximo), reinicia la duracion
+ *   y conserva el daño mayor; el daño por tick se multiplica por las acumulaciones.
+ * - Independiente: agrega otra instancia.
+ *
+ * @param objetivo Indice del objetivo
+ * @param maleficio Identificador del maleficio
+ * @param danioPorTick Daño por aplicacion (por acumulacion)
+ * @return true si se aplico
+ */
+bool MotorMaleficios::aplicar(int objetivo, int maleficio, int danioPorTick) {
+    if (!registro.esValido(objetivo) || !definiciones.esValido(maleficio)) {
+        return false;
+    }
+    danioPorTick = max(1, danioPorTick);
+    const DefinicionMaleficio& definicion = definiciones[maleficio];
+
+    if (definicion.regla != ReglaApilamiento::Independiente) {
+        auto it = apilables.find(clave(objetivo, maleficio));
+        if (it != apilables.end()) {
+            size_t i = it->second;
+            restantes[i] = definicion.duracion;
+            danios[i] = max(danios[i], danioPorTick);
+            if (definicion.regla == ReglaApilamiento::Acumular && acumulaciones[i] < definicion.maxAcumulaciones) {
+                ++acumulaciones[i];
+                actualizarPenalizacion(i);
+            }
+            return true;
+        }
+    }
+
+    agregarInstancia(objetivo, maleficio, danioPorTick);
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo disipar
+ *
+ * @param objetivo Indice del objetivo
+ * @return Cantidad de maleficios quitados
+ */
+int MotorMaleficios::disipar(int objetivo) {
+    int quitados = 0;
+    for (size_t i = 0; i < objetivos.size(); ++i) {
+        if (objetivos[i] == objetivo) {
+            restantes[i] = 0;
+            ++quitados;
+        }
+    }
+    if (quitados > 0) {
+        compactar();
+    }
+    return quitados;
+}
+
+/**
+ * @brief Implementacion del metodo avanzar
+ *
+ * Una pasada sobre los arreglos descuenta la duracion y suma el daño que
+ * corresponde a cada objetivo; despues se aplica un solo golpe por
+ * objetivo (los caidos no reciben mas daño) y se compactan los vencidos.
+ *
+ * @return Cantidad de objetivos que recibieron daño
+ */
+size_t MotorMaleficios::avanzar() {
+    const size_t activos = objetivos.size();
+    for (size_t i = 0; i < activos; ++i) {
+        --restantes[i];
+        if (--hastaProximo[i] > 0) {
+            continue;
+        }
+        hastaProximo[i] = definiciones[maleficios[i]].periodo;
+        registro.acumularDanio(objetivos[i], danios[i] * acumulaciones[i]);
+    }
+
+    size_t objetivosDaniados = registro.aplicarDanio();
+    compactar();
+    return objetivosDaniados;
+}
+
+/**
+ * @brief Implementacion del metodo getAcumulaciones
+ *
+ * @param objetivo Indice del objetivo
+ * @param maleficio Identificador del maleficio
+ * @return Acumulaciones, 0 si no lo tiene
+ */
+int MotorMaleficios::getAcumulaciones(int objetivo, int maleficio) const {
+    auto it = apilables.find(clave(objetivo, maleficio));
+    return it != apilables.end() ? acumulaciones[it->second] : 0;
+}
+
+const DefinicionMaleficio& MotorMaleficios::getDefinicion(int maleficio) const { return definiciones.get(maleficio); }
+size_t MotorMaleficios::getActivos() const { return objetivos.size(); }
+long long MotorMaleficios::getDanioTotal() const { return registro.getDanioTotal(); }
+
+uint64_t MotorMaleficios::clave(int objetivo, int maleficio) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(objetivo)) << 32) | static_cast<uint32_t>(maleficio);
+}
+
+void MotorMaleficios::agregarInstancia(int objetivo, int maleficio, int danioPorTick) {
+    const DefinicionMaleficio& definicion = definiciones[maleficio];
+    size_t i = objetivos.size();
+    objetivos.push_back(objetivo);
+    maleficios.push_back(maleficio);
+    danios.push_back(danioPorTick);
+    acumulaciones.push_back(1);
+    restantes.push_back(definicion.duracion);
+    hastaProximo.push_back(definicion.periodo);
+    modificadores.push_back(-1);
+
+    if (definicion.regla != ReglaApilamiento::Independiente) {
+        apilables[clave(objetivo, maleficio)] = i;
+    }
+    actualizarPenalizacion(i);
+}
+
+/**
+ * @brief Implementacion del metodo actualizarPenalizacion
+ *
+ * Reemplaza el modificador del maleficio por uno acorde a sus acumulaciones.
+ *
+ * @param i Posicion del maleficio activo
+ */
+void MotorMaleficios::actualizarPenalizacion(size_t i) {
+    const DefinicionMaleficio& definicion = definiciones[maleficios[i]];
+    if (definicion.porcentaje == 0) return;
+    PilaModificadores* pila = pilaModificadoresDe(registro.get(objetivos[i]));
+    if (!pila) return;
+
+    if (modificadores[i] >= 0) {
+        pila->quitar(modificadores[i]);
+    }
+    modificadores[i] = pila->agregar(Modificador{definicion.atributo, OrigenModificador::Maldicion,
+                                                 0, definicion.porcentaje * acumulaciones[i]});
+}
+
+void MotorMaleficios::quitarPenalizacion(size_t i) {
+    if (modificadores[i] < 0) return;
+    if (PilaModificadores* pila = pilaModificadoresDe(registro.get(objetivos[i]))) {
+        pila->quitar(modificadores[i]);
+    }
+    modificadores[i] = -1;
+}
+
+void MotorMaleficios::moverInstancia(size_t desde, size_t hasta) {
+    objetivos[hasta] = objetivos[desde];
+    maleficios[hasta] = maleficios[desde];
+    danios[hasta] = danios[desde];
+    acumulaciones[hasta] = acumulaciones[desde];
+    restantes[hasta] = restantes[desde];
+    hastaProximo[hasta] = hastaProximo[desde];
+    modificadores[hasta] = modificadores[desde];
+
+    auto it = apilables.find(clave(objetivos[hasta], maleficios[hasta]));
+    if (it != apilables.end() && it->second == desde) {
+        it->second = hasta;
+    }
+}
+
+/**
+ * @brief Implementacion del metodo compactar
+ *
+ * Quita los maleficios sin duracion restante conservando el orden del resto.
+ */
+void MotorMaleficios::compactar() {
+    size_t quedan = compactarInstancias(objetivos.size(),
+        [this](size_t i) { return restantes[i] > 0; },
+        [this](size_t desde, size_t hasta) { moverInstancia(desde, hasta); },
+        [this](size_t i) {
+            quitarPenalizacion(i);
+            auto it = apilables.find(clave(objetivos[i], maleficios[i]));
+            if (it != apilables.end() && it->second == i) {
+                apilables.erase(it);
+            }
+        });
+    if (quedan == objetivos.size()) return;
+    redimensionarCampos(quedan, objetivos, maleficios, danios, acumulaciones, restantes, hastaProximo, modificadores);
+}
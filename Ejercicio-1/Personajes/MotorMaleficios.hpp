@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "InterfazPersonaje.hpp"
+#include "PilaModificadores.hpp"
+#include "RegistroCombatientes.hpp"
+
+using namespace std;
+
+/**
+ * @enum ReglaApilamiento
+ * @brief Que pasa al aplicar un maleficio que el objetivo ya tiene
+ */
+enum class ReglaApilamiento {
+    Renovar,        ///< Reinicia la duracion y se queda con el daño mayor
+    Acumular,       ///< Suma una acumulacion (hasta el maximo) y reinicia la duracion
+    Independiente   ///< Cada aplicacion es una instancia aparte
+};
+
+/**
+ * @brief Definicion de un maleficio con duracion
+ *
+ * El daño por tick no es parte de la definicion: lo decide quien lo lanza.
+ */
+struct DefinicionMaleficio {
+    string nombre;
+    int duracion;                   ///< Ticks que dura
+    int periodo;                    ///< Ticks entre aplicaciones de daño
+    ReglaApilamiento regla;
+    int maxAcumulaciones;           ///< Solo para ReglaApilamiento::Acumular
+    AtributoPersonaje atributo;     ///< Atributo que debilita mientras esta activo
+    int porcentaje;                 ///< Penalizacion por acumulacion (negativo); 0 = ninguna
+};
+
+/**
+ * @brief Maleficios y daño periodico de muchos personajes a la vez
+ *
+ * Los maleficios activos viven en arreglos contiguos (uno por campo) y
+ * avanzar recorre esos arreglos una sola vez por tick: acumula el daño de
+ * cada objetivo y despues aplica un unico recibirDanio por objetivo. Los
+ * maleficios vencidos se compactan al final de la misma pasada. El registro
+ * de personajes, el catalogo por nombre y la compactacion son los de
+ * RegistroCombatientes, compartidos con MotorInvocaciones.
+ *
+ * Mientras un maleficio esta activo, su penalizacion se agrega como
+ * modificador de origen Maldicion en la pila del objetivo.
+ */
+class MotorMaleficios {
+public:
+    /**
+     * @brief Registra un personaje como posible objetivo
+     * @param personaje Personaje (no pasa a ser propiedad del motor)
+     * @return Indice del personaje, -1 si es nulo
+     */
+    int registrar(InterfazPersonaje* personaje);
+
+    /**
+     * @brief Define un maleficio (o reemplaza la definicion con el mismo nombre)
+     * @param definicion Definicion del maleficio
+     * @return Identificador del maleficio
+     */
+    int definir(const DefinicionMaleficio& definicion);
+
+    /**
+     * @brief Busca un maleficio por nombre
+     * @param nombre Nombre del maleficio
+     * @return Identificador, -1 si no esta definido
+     */
+    int buscar(const string& nombre) const;
+
+    /**
+     * @brief Indica si un indice corresponde a un personaje registrado y en pie
+     * @param objetivo Indice a validar
+     * @return true si se le puede aplicar un maleficio
+     */
+    bool esObjetivoValido(int objetivo) const;
+
+    /**
+     * @brief Aplica un maleficio sobre un objetivo respetando su regla de apilamiento
+     * @param objetivo Indice del objetivo
+     * @param maleficio Identificador del maleficio
+     * @param danioPorTick Daño por aplicacion (por acumulacion)
+     * @return true si se aplico
+     */
+    bool aplicar(int objetivo, int maleficio, int danioPorTick);
+
+    /**
+     * @brief Quita todos los maleficios de un objetivo
+     * @param objetivo Indice del objetivo
+     * @return Cantidad de maleficios quitados
+     */
+    int disipar(int objetivo);
+
+    /**
+     * @brief Avanza un tick: aplica el daño de todos los maleficios y quita los vencidos
+     * @return Cantidad de objetivos que recibieron daño
+     */
+    size_t avanzar();
+
+    /**
+     * @brief Obtiene las acumulaciones de un maleficio sobre un objetivo
+     * @param objetivo Indice del objetivo
+     * @param maleficio Identificador del maleficio
+     * @return Acumulaciones (0 si no lo tiene; no cuenta instancias independientes)
+     */
+    int getAcumulaciones(int objetivo, int maleficio) const;
+
+    const DefinicionMaleficio& getDefinicion(int maleficio) const;
+    size_t getActivos() const;
+    long long getDanioTotal() const;
+
+private:
+    static uint64_t clave(int objetivo, int maleficio);
+
+    void agregarInstancia(int objetivo, int maleficio, int danioPorTick);
+    void actualizarPenalizacion(size_t i);
+    void quitarPenalizacion(size_t i);
+    void moverInstancia(size_t desde, size_t hasta);
+    void compactar();
+
+    RegistroCombatientes registro;
+    CatalogoPorNombre<DefinicionMaleficio> definiciones;
+
+    // Maleficios activos, un arreglo por campo
+    vector<int> objetivos;
+    vector<int> maleficios;
+    vector<int> danios;
+    vector<int> acumulaciones;
+    vector<int> restantes;
+    vector<int> hastaProximo;
+    vector<int> modificadores;      ///< Id del modificador en la pila del objetivo, -1 si no tiene
+
+    unordered_map<uint64_t, size_t> apilables;   ///< (objetivo, maleficio) -> posicion, salvo Independiente
+};
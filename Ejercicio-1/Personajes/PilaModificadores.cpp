@@ -0,0 +1,198 @@
+#include "PilaModificadores.hpp"
+#include <algorithm>
+#include "Mago.hpp"
+#include "Guerrero.hpp"
+
+namespace {
+const int HP_MAXIMO = static_cast<int>(AtributoPersonaje::HPMaximo);
+}
+
+/**
+ * @brief Implementacion del constructor de PilaModificadores
+ */
+PilaModificadores::PilaModificadores()
+    : plano{}, porcentaje{}, siguienteId(0), version(0) {}
+
+/**
+ * @brief Implementacion del constructor de copia de PilaModificadores
+ *
+ * Copia los modificadores pero no el aviso de HP maximo.
+ *
+ * @param otra Pila a copiar
+ */
+PilaModificadores::PilaModificadores(const PilaModificadores& otra)
+    : entradas(otra.entradas), posicionPorId(otra.posicionPorId),
+      siguienteId(otra.siguienteId), version(otra.version) {
+    copy(begin(otra.plano), end(otra.plano), begin(plano));
+    copy(begin(otra.porcentaje), end(otra.porcentaje), begin(porcentaje));
+}
+
+/**
+ * @brief Implementacion del operador de asignacion de PilaModificadores
+ *
+ * Conserva el aviso propio y lo llama si el HP maximo quedo mas bajo.
+ *
+ * @param otra Pila a copiar
+ * @return Esta pila
+ */
+PilaModificadores& PilaModificadores::operator=(const PilaModificadores& otra) {
+    if (this != &otra) {
+        int planoPrevio = plano[HP_MAXIMO];
+        int porcentajePrevio = porcentaje[HP_MAXIMO];
+        entradas = otra.entradas;
+        posicionPorId = otra.posicionPorId;
+        copy(begin(otra.plano), end(otra.plano), begin(plano));
+        copy(begin(otra.porcentaje), end(otra.porcentaje), begin(porcentaje));
+        siguienteId = otra.siguienteId;
+        ++version;
+        avisarSiBajoHPMaximo(planoPrevio, porcentajePrevio);
+    }
+    return *this;
+}
+
+void PilaModificadores::setAlBajarHPMaximo(function<void()> aviso) { alBajarHPMaximo = std::move(aviso); }
+
+/**
+ * @brief Implementacion del metodo agregar
+ *
+ * @param modificador Modificador a agregar
+ * @return Identificador para quitarlo
+ */
+int PilaModificadores::agregar(const Modificador& modificador) {
+    int planoPrevio = plano[HP_MAXIMO];
+    int porcentajePrevio = porcentaje[HP_MAXIMO];
+    int id = siguienteId++;
+    posicionPorId[id] = entradas.size();
+    entradas.push_back(Entrada{id, modificador});
+    acumular(modificador, 1);
+    avisarSiBajoHPMaximo(planoPrevio, porcentajePrevio);
+    return id;
+}
+
+/**
+ * @brief Implementacion del metodo quitar
+ *
+ * Ubica la entrada por el indice de ids y la borra por intercambio con la
+ * ultima; el orden de la pila no importa.
+ *
+ * @param id Identificador devuelto por agregar
+ * @return true si estaba en la pila
+ */
+bool PilaModificadores::quitar(int id) {
+    auto it = posicionPorId.find(id);
+    if (it == posicionPorId.end()) {
+        return false;
+    }
+    int planoPrevio = plano[HP_MAXIMO];
+    int porcentajePrevio = porcentaje[HP_MAXIMO];
+    quitarEn(it->second);
+    avisarSiBajoHPMaximo(planoPrevio, porcentajePrevio);
+    return true;
+}
+
+/**
+ * @brief Implementacion del metodo quitarOrigen
+ *
+ * @param origen Origen a quitar
+ * @return Cantidad de modificadores quitados
+ */
+int PilaModificadores::quitarOrigen(OrigenModificador origen) {
+    int planoPrevio = plano[HP_MAXIMO];
+    int porcentajePrevio = porcentaje[HP_MAXIMO];
+    int quitados = 0;
+    for (size_t i = 0; i < entradas.size();) {
+        if (entradas[i].modificador.origen == origen) {
+            quitarEn(i);
+            ++quitados;
+        } else {
+            ++i;
+        }
+    }
+    avisarSiBajoHPMaximo(planoPrevio, porcentajePrevio);
+    return quitados;
+}
+
+void PilaModificadores::limpiar() {
+    if (entradas.empty()) return;
+    int planoPrevio = plano[HP_MAXIMO];
+    int porcentajePrevio = porcentaje[HP_MAXIMO];
+    entradas.clear();
+    posicionPorId.clear();
+    fill(begin(plano), end(plano), 0);
+    fill(begin(porcentaje), end(porcentaje), 0);
+    ++version;
+    avisarSiBajoHPMaximo(planoPrevio, porcentajePrevio);
+}
+
+/**
+ * @brief Implementacion del metodo aplicar
+ *
+ * @param atributo Atributo a aplicar
+ * @param base Valor sin modificar
+ * @return Valor efectivo (nunca negativo)
+ */
+int PilaModificadores::aplicar(AtributoPersonaje atributo, int base) const {
+    int i = static_cast<int>(atributo);
+    int valor = (base + plano[i]) * (100 + porcentaje[i]) / 100;
+    return max(0, valor);
+}
+
+int PilaModificadores::getPlano(AtributoPersonaje atributo) const { return plano[static_cast<int>(atributo)]; }
+int PilaModificadores::getPorcentaje(AtributoPersonaje atributo) const { return porcentaje[static_cast<int>(atributo)]; }
+size_t PilaModificadores::getCantidad() const { return entradas.size(); }
+uint32_t PilaModificadores::getVersion() const { return version; }
+
+void PilaModificadores::acumular(const Modificador& modificador, int signo) {
+    int i = static_cast<int>(modificador.atributo);
+    plano[i] += signo * modificador.plano;
+    porcentaje[i] += signo * modificador.porcentaje;
+    ++version;
+}
+
+/**
+ * @brief Implementacion del metodo quitarEn
+ *
+ * Borra por intercambio y actualiza el indice de la entrada movida.
+ *
+ * @param posicion Indice en entradas
+ */
+void PilaModificadores::quitarEn(size_t posicion) {
+    acumular(entradas[posicion].modificador, -1);
+    posicionPorId.erase(entradas[posicion].id);
+    if (posicion + 1 != entradas.size()) {
+        entradas[posicion] = entradas.back();
+        posicionPorId[entradas[posicion].id] = posicion;
+    }
+    entradas.pop_back();
+}
+
+/**
+ * @brief Implementacion del metodo avisarSiBajoHPMaximo
+ *
+ * Solo compara la suma de planos y porcentajes: si bajo alguno, el maximo
+ * efectivo pudo bajar y el dueño ajusta su vida (ajustar de mas no cambia nada).
+ *
+ * @param planoPrevio Suma de planos de HPMaximo antes del cambio
+ * @param porcentajePrevio Suma de porcentajes de HPMaximo antes del cambio
+ */
+void PilaModificadores::avisarSiBajoHPMaximo(int planoPrevio, int porcentajePrevio) {
+    if (alBajarHPMaximo && (plano[HP_MAXIMO] < planoPrevio || porcentaje[HP_MAXIMO] < porcentajePrevio)) {
+        alBajarHPMaximo();
+    }
+}
+
+/**
+ * @brief Implementacion de pilaModificadoresDe
+ *
+ * @param personaje Personaje
+ * @return Su pila de modificadores, nullptr si no es Mago ni Guerrero
+ */
+PilaModificadores* pilaModificadoresDe(InterfazPersonaje* personaje) {
+    if (auto mago = dynamic_cast<Mago*>(personaje)) {
+        return &mago->getModificadores();
+    }
+    if (auto guerrero = dynamic_cast<Guerrero*>(personaje)) {
+        return &guerrero->getModificadores();
+    }
+    return nullptr;
+}
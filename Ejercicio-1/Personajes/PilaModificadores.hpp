@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include "enumPersonajes.hpp"
+
+using namespace std;
+
+/**
+ * @enum AtributoPersonaje
+ * @brief Atributos que pueden alterarse con modificadores
+ */
+enum class AtributoPersonaje {
+    Fuerza,
+    Destreza,
+    Constitucion,
+    Inteligencia,
+    HPMaximo,
+    Defensa,
+    Danio          ///< Daño plano que se suma a cada ataque
+};
+
+const int CANTIDAD_ATRIBUTOS = 7;
+const int CANTIDAD_MOVIMIENTOS = 3;
+
+/**
+ * @enum OrigenModificador
+ * @brief De donde proviene un modificador
+ */
+enum class OrigenModificador {
+    Equipo,
+    Buff,
+    Aura,
+    Maldicion
+};
+
+/**
+ * @brief Modificador sobre un atributo
+ *
+ * El valor efectivo de un atributo es (base + suma de planos) ajustado por
+ * la suma de porcentajes. Los negativos representan penalizaciones.
+ */
+struct Modificador {
+    AtributoPersonaje atributo;
+    OrigenModificador origen;
+    int plano;        ///< Se suma al valor base
+    int porcentaje;   ///< Se aplica despues de la suma (10 = +10%, -25 = -25%)
+};
+
+/**
+ * @brief Estadisticas de un personaje ya calculadas con sus modificadores
+ *
+ * Es lo que lee el camino de ataque en lugar de recalcular cada formula.
+ */
+struct EstadisticasDerivadas {
+    int fuerza;
+    int destreza;
+    int constitucion;
+    int inteligencia;
+    int hpMaximo;
+    int defensa;
+    int danioExtra;                               ///< Daño plano sumado a cada ataque
+    int bonusMovimiento[CANTIDAD_MOVIMIENTOS];    ///< Bonus por MovimientoCombate
+};
+
+/**
+ * @brief Pila de modificadores de un personaje
+ *
+ * Guarda los modificadores de equipo, buffs, auras y maldiciones y mantiene
+ * al dia la suma de planos y porcentajes de cada atributo, asi que aplicar
+ * un atributo no recorre la pila. Cada cambio incrementa la version, que el
+ * personaje compara para saber si sus estadisticas derivadas quedaron viejas.
+ *
+ * Cada modificador se ubica por id en un indice, asi que quitar es O(1).
+ * Cuando un cambio baja el HP maximo se llama al aviso del dueño, que ajusta
+ * su vida actual al nuevo maximo. El aviso no se copia con la pila: el
+ * personaje que la copia registra el suyo.
+ */
+class PilaModificadores {
+public:
+    PilaModificadores();
+    PilaModificadores(const PilaModificadores& otra);
+    PilaModificadores& operator=(const PilaModificadores& otra);
+
+    /**
+     * @brief Registra el aviso que se llama cuando baja el HP maximo
+     * @param aviso Funcion del dueño de la pila (vacia para quitarlo)
+     */
+    void setAlBajarHPMaximo(function<void()> aviso);
+
+    /**
+     * @brief Agrega un modificador
+     * @param modificador Modificador a agregar
+     * @return Identificador para quitarlo
+     */
+    int agregar(const Modificador& modificador);
+
+    /**
+     * @brief Quita un modificador
+     * @param id Identificador devuelto por agregar
+     * @return true si estaba en la pila
+     */
+    bool quitar(int id);
+
+    /**
+     * @brief Quita todos los modificadores de un origen (por ejemplo, al cambiar de equipo)
+     * @param origen Origen a quitar
+     * @return Cantidad de modificadores quitados
+     */
+    int quitarOrigen(OrigenModificador origen);
+
+    /**
+     * @brief Quita todos los modificadores
+     */
+    void limpiar();
+
+    /**
+     * @brief Aplica los modificadores de un atributo a un valor base
+     * @param atributo Atributo a aplicar
+     * @param base Valor sin modificar
+     * @return Valor efectivo (nunca negativo)
+     */
+    int aplicar(AtributoPersonaje atributo, int base) const;
+
+    int getPlano(AtributoPersonaje atributo) const;
+    int getPorcentaje(AtributoPersonaje atributo) const;
+    size_t getCantidad() const;
+    uint32_t getVersion() const;
+
+private:
+    struct Entrada {
+        int id;
+        Modificador modificador;
+    };
+
+    void acumular(const Modificador& modificador, int signo);
+    void quitarEn(size_t posicion);
+    void avisarSiBajoHPMaximo(int planoPrevio, int porcentajePrevio);
+
+    vector<Entrada> entradas;
+    unordered_map<int, size_t> posicionPorId;   ///< id -> indice en entradas
+    function<void()> alBajarHPMaximo;
+    int plano[CANTIDAD_ATRIBUTOS];
+    int porcentaje[CANTIDAD_ATRIBUTOS];
+    int siguienteId;
+    uint32_t version;
+};
+
+class InterfazPersonaje;
+
+/**
+ * @brief Obtiene la pila de modificadores de un personaje
+ * @param personaje Personaje
+ * @return Su pila de modificadores, nullptr si no es Mago ni Guerrero
+ */
+PilaModificadores* pilaModificadoresDe(InterfazPersonaje* personaje);
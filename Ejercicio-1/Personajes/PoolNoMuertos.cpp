@@ -0,0 +1,128 @@
+#include "PoolNoMuertos.hpp"
+#include <algorithm>
+
+/**
+ * @brief Implementacion del constructor de PoolNoMuertos
+ *
+ * @param capacidad No-muertos para los que se reserva memoria
+ */
+PoolNoMuertos::PoolNoMuertos(size_t capacidad)
+    : primeraLibre(NULO), activos(0) {
+    ranuras.reserve(capacidad);
+}
+
+/**
+ * @brief Implementacion del metodo crear
+ *
+ * Reutiliza el primer lugar libre; si no hay, agrega uno al final.
+ *
+ * @param nombre Nombre del no-muerto
+ * @param hp Puntos de vida (minimo 1)
+ * @param danio Daño por ataque
+ * @return Identificador del no-muerto
+ */
+IdNoMuerto PoolNoMuertos::crear(const string& nombre, int hp, int danio) {
+    uint32_t indice;
+    if (primeraLibre != NULO) {
+        indice = primeraLibre;
+        primeraLibre = ranuras[indice].siguienteLibre;
+    } else {
+        indice = static_cast<uint32_t>(ranuras.size());
+        ranuras.push_back(Ranura{0, 0, 0, 0, NULO, false});
+    }
+
+    Ranura& ranura = ranuras[indice];
+    ranura.hp = max(1, hp);
+    ranura.danio = max(0, danio);
+    ranura.nombre = registrarNombre(nombre);
+    ranura.siguienteLibre = NULO;
+    ranura.enUso = true;
+    ++activos;
+
+    return IdNoMuerto{indice, ranura.generacion};
+}
+
+/**
+ * @brief Implementacion del metodo duplicar
+ *
+ * @param id No-muerto a copiar
+ * @return Identificador de la copia, invalido si el original no existe
+ */
+IdNoMuerto PoolNoMuertos::duplicar(IdNoMuerto id) {
+    if (!esValido(id)) {
+        return invalido();
+    }
+    Ranura original = ranuras[id.indice];  // copia: crear puede reubicar el arreglo
+    return crear(nombres[original.nombre], original.hp, original.danio);
+}
+
+/**
+ * @brief Implementacion del metodo destruir
+ *
+ * Incrementa la generacion para invalidar los identificadores viejos.
+ *
+ * @param id No-muerto a destruir
+ * @return true si existia
+ */
+bool PoolNoMuertos::destruir(IdNoMuerto id) {
+    if (!esValido(id)) {
+        return false;
+    }
+    Ranura& ranura = ranuras[id.indice];
+    ranura.enUso = false;
+    ++ranura.generacion;
+    ranura.siguienteLibre = primeraLibre;
+    primeraLibre = id.indice;
+    --activos;
+    return true;
+}
+
+bool PoolNoMuertos::esValido(IdNoMuerto id) const {
+    return id.indice < ranuras.size()
+        && ranuras[id.indice].enUso
+        && ranuras[id.indice].generacion == id.generacion;
+}
+
+/**
+ * @brief Implementacion del metodo recibirDanio
+ *
+ * @param id No-muerto que recibe el daño
+ * @param cantidad Daño recibido
+ * @return true si sigue en pie
+ */
+bool PoolNoMuertos::recibirDanio(IdNoMuerto id, int cantidad) {
+    if (!esValido(id)) {
+        return false;
+    }
+    Ranura& ranura = ranuras[id.indice];
+    ranura.hp -= max(0, cantidad);
+    if (ranura.hp <= 0) {
+        destruir(id);
+        return false;
+    }
+    return true;
+}
+
+IdNoMuerto PoolNoMuertos::invalido() { return IdNoMuerto{NULO, 0}; }
+
+int PoolNoMuertos::getHP(IdNoMuerto id) const { return esValido(id) ? ranuras[id.indice].hp : 0; }
+int PoolNoMuertos::getDanio(IdNoMuerto id) const { return esValido(id) ? ranuras[id.indice].danio : 0; }
+
+const string& PoolNoMuertos::getNombre(IdNoMuerto id) const {
+    static const string vacio;
+    return esValido(id) ? nombres[ranuras[id.indice].nombre] : vacio;
+}
+
+size_t PoolNoMuertos::getActivos() const { return activos; }
+size_t PoolNoMuertos::getCapacidad() const { return ranuras.size(); }
+
+uint32_t PoolNoMuertos::registrarNombre(const string& nombre) {
+    auto it = indiceNombres.find(nombre);
+    if (it != indiceNombres.end()) {
+        return it->second;
+    }
+    uint32_t indice = static_cast<uint32_t>(nombres.size());
+    nombres.push_back(nombre);
+    indiceNombres[nombre] = indice;
+    return indice;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Identificador de un no-muerto dentro de un PoolNoMuertos
+ *
+ * La generacion permite detectar identificadores de no-muertos ya
+ * destruidos aunque su lugar en el pool se haya reutilizado.
+ */
+struct IdNoMuerto {
+    uint32_t indice;
+    uint32_t generacion;
+};
+
+/**
+ * @brief Pool de no-muertos de un mundo
+ *
+ * Cada no-muerto es una entidad liviana (nombre, HP y daño) guardada en un
+ * arreglo contiguo. Los lugares libres forman una lista enlazada dentro del
+ * mismo arreglo, asi que crear y destruir son O(1) y no reservan memoria una
+ * vez que el pool alcanzo su tamaño. Los nombres se guardan una sola vez
+ * aunque miles de no-muertos los compartan.
+ *
+ * No hay un pool global: cada nigromante usa uno privado salvo que se le
+ * pase uno con setMundo, y varios nigromantes pueden compartir el mismo.
+ */
+class PoolNoMuertos {
+public:
+    /**
+     * @brief Constructor
+     * @param capacidad No-muertos para los que se reserva memoria
+     */
+    explicit PoolNoMuertos(size_t capacidad = 0);
+
+    /**
+     * @brief Crea un no-muerto
+     * @param nombre Nombre del no-muerto
+     * @param hp Puntos de vida (minimo 1)
+     * @param danio Daño por ataque
+     * @return Identificador del no-muerto
+     */
+    IdNoMuerto crear(const string& nombre, int hp, int danio);
+
+    /**
+     * @brief Crea una copia de un no-muerto existente
+     * @param id No-muerto a copiar
+     * @return Identificador de la copia, invalido si el original no existe
+     */
+    IdNoMuerto duplicar(IdNoMuerto id);
+
+    /**
+     * @brief Destruye un no-muerto y libera su lugar
+     * @param id No-muerto a destruir
+     * @return true si existia
+     */
+    bool destruir(IdNoMuerto id);
+
+    /**
+     * @brief Indica si el identificador corresponde a un no-muerto en pie
+     * @param id Identificador a verificar
+     * @return true si es valido
+     */
+    bool esValido(IdNoMuerto id) const;
+
+    /**
+     * @brief Aplica daño a un no-muerto; si llega a 0 HP se destruye
+     * @param id No-muerto que recibe el daño
+     * @param cantidad Daño recibido
+     * @return true si sigue en pie
+     */
+    bool recibirDanio(IdNoMuerto id, int cantidad);
+
+    /**
+     * @brief Identificador que nunca es valido
+     * @return Identificador invalido
+     */
+    static IdNoMuerto invalido();
+
+    int getHP(IdNoMuerto id) const;
+    int getDanio(IdNoMuerto id) const;
+    const string& getNombre(IdNoMuerto id) const;
+    size_t getActivos() const;
+    size_t getCapacidad() const;
+
+private:
+    static constexpr uint32_t NULO = 0xFFFFFFFFu;
+
+    /**
+     * @brief Lugar del pool; si esta libre, siguienteLibre enlaza la lista de libres
+     */
+    struct Ranura {
+        int hp;
+        int danio;
+        uint32_t nombre;
+        uint32_t generacion;
+        uint32_t siguienteLibre;
+        bool enUso;
+    };
+
+    uint32_t registrarNombre(const string& nombre);
+
+    vector<Ranura> ranuras;
+    uint32_t primeraLibre;
+    size_t activos;
+    vector<string> nombres;
+    unordered_map<string, uint32_t> indiceNombres;
+};
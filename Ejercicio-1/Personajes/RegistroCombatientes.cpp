@@ -0,0 +1,63 @@
+#include "RegistroCombatientes.hpp"
+#include <iostream>
+
+/**
+ * @brief Implementacion del constructor de RegistroCombatientes
+ */
+RegistroCombatientes::RegistroCombatientes() : danioTotal(0) {}
+
+/**
+ * @brief Implementacion del metodo registrar
+ *
+ * @param personaje Personaje a registrar
+ * @return Indice del personaje, -1 si es nulo
+ */
+int RegistroCombatientes::registrar(InterfazPersonaje* personaje) {
+    if (!personaje) {
+        cerr << "Error: no se puede registrar un personaje nulo." << endl;
+        return -1;
+    }
+    personajes.push_back(personaje);
+    danioPendiente.push_back(0);
+    return static_cast<int>(personajes.size()) - 1;
+}
+
+void RegistroCombatientes::reservar(size_t capacidad) {
+    personajes.reserve(capacidad);
+    danioPendiente.reserve(capacidad);
+}
+
+bool RegistroCombatientes::esValido(int indice) const {
+    return indice >= 0 && indice < static_cast<int>(personajes.size());
+}
+
+InterfazPersonaje* RegistroCombatientes::get(int indice) const { return personajes[indice]; }
+size_t RegistroCombatientes::getCantidad() const { return personajes.size(); }
+long long RegistroCombatientes::getDanioTotal() const { return danioTotal; }
+
+void RegistroCombatientes::acumularDanio(int objetivo, int cantidad) {
+    if (danioPendiente[objetivo] == 0) {
+        golpeados.push_back(objetivo);
+    }
+    danioPendiente[objetivo] += cantidad;
+}
+
+/**
+ * @brief Implementacion del metodo aplicarDanio
+ *
+ * @return Cantidad de objetivos que recibieron daño
+ */
+size_t RegistroCombatientes::aplicarDanio() {
+    size_t objetivosDaniados = 0;
+    for (int objetivo : golpeados) {
+        InterfazPersonaje* personaje = personajes[objetivo];
+        if (personaje->getHP() > 0) {
+            personaje->recibirDanio(danioPendiente[objetivo], false);
+            danioTotal += danioPendiente[objetivo];
+            ++objetivosDaniados;
+        }
+        danioPendiente[objetivo] = 0;
+    }
+    golpeados.clear();
+    return objetivosDaniados;
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "InterfazPersonaje.hpp"
+
+using namespace std;
+
+/**
+ * @brief Personajes registrados en un motor y daño acumulado por tick
+ *
+ * Es la parte comun de los motores que trabajan con indices de personaje
+ * (maleficios, invocaciones, efectos temporales): registrar valida el
+ * puntero y devuelve el indice, y el daño de un tick se acumula por
+ * objetivo para aplicar un solo recibirDanio a cada uno.
+ */
+class RegistroCombatientes {
+public:
+    RegistroCombatientes();
+
+    /**
+     * @brief Registra un personaje
+     * @param personaje Personaje (no pasa a ser propiedad del registro)
+     * @return Indice del personaje, -1 si es nulo
+     */
+    int registrar(InterfazPersonaje* personaje);
+
+    void reservar(size_t capacidad);
+
+    /**
+     * @brief Indica si un indice corresponde a un personaje registrado
+     * @param indice Indice a validar
+     * @return true si es valido
+     */
+    bool esValido(int indice) const;
+
+    InterfazPersonaje* get(int indice) const;
+    size_t getCantidad() const;
+
+    /**
+     * @brief Suma daño al objetivo para el proximo aplicarDanio
+     * @param objetivo Indice del objetivo
+     * @param cantidad Daño a sumar (positivo)
+     */
+    void acumularDanio(int objetivo, int cantidad);
+
+    /**
+     * @brief Aplica un recibirDanio por objetivo con el daño acumulado
+     *
+     * Los objetivos que ya cayeron no reciben daño.
+     *
+     * @return Cantidad de objetivos que recibieron daño
+     */
+    size_t aplicarDanio();
+
+    long long getDanioTotal() const;
+
+private:
+    vector<InterfazPersonaje*> personajes;
+    vector<int> danioPendiente;     ///< Daño acumulado por objetivo en el tick actual
+    vector<int> golpeados;          ///< Objetivos con daño pendiente
+    long long danioTotal;
+};
+
+/**
+ * @brief Definiciones de un motor buscables por nombre en O(1)
+ *
+ * T debe tener un miembro string nombre. Definir con un nombre existente
+ * reemplaza la definicion y conserva su identificador.
+ */
+template <typename T>
+class CatalogoPorNombre {
+public:
+    /**
+     * @brief Define (o reemplaza) una entrada
+     * @param definicion Entrada ya ajustada por el motor
+     * @return Identificador de la entrada
+     */
+    int definir(const T& definicion) {
+        auto it = porNombre.find(definicion.nombre);
+        if (it != porNombre.end()) {
+            entradas[it->second] = definicion;
+            return it->second;
+        }
+        int id = static_cast<int>(entradas.size());
+        entradas.push_back(definicion);
+        porNombre[definicion.nombre] = id;
+        return id;
+    }
+
+    int buscar(const string& nombre) const {
+        auto it = porNombre.find(nombre);
+        return it != porNombre.end() ? it->second : -1;
+    }
+
+    bool esValido(int id) const { return id >= 0 && id < static_cast<int>(entradas.size()); }
+    const T& get(int id) const { return entradas.at(id); }
+    const T& operator[](int id) const { return entradas[id]; }
+
+private:
+    vector<T> entradas;
+    unordered_map<string, int> porNombre;
+};
+
+/**
+ * @brief Compacta instancias guardadas en arreglos paralelos (uno por campo)
+ *
+ * Recorre las posiciones en orden y conserva el orden relativo de las que
+ * quedan. El motor mueve sus campos en mover y libera lo que haga falta en
+ * quitar; despues redimensiona cada arreglo al valor devuelto.
+ *
+ * @param cantidad Instancias actuales
+ * @param conservar conservar(i): true si la instancia sigue activa
+ * @param mover mover(desde, hasta): copia la instancia a una posicion menor
+ * @param quitar quitar(i): se llama por cada instancia descartada
+ * @return Instancias que quedan
+ */
+template <typename Conservar, typename Mover, typename Quitar>
+size_t compactarInstancias(size_t cantidad, Conservar conservar, Mover mover, Quitar quitar) {
+    size_t escritura = 0;
+    for (size_t i = 0; i < cantidad; ++i) {
+        if (conservar(i)) {
+            if (escritura != i) {
+                mover(i, escritura);
+            }
+            ++escritura;
+        } else {
+            quitar(i);
+        }
+    }
+    return escritura;
+}
+
+/**
+ * @brief Redimensiona varios arreglos paralelos a la vez
+ * @param cantidad Nuevo tamaño
+ * @param campos Arreglos a redimensionar
+ */
+template <typename... Campos>
+void redimensionarCampos(size_t cantidad, Campos&... campos) {
+    (campos.resize(cantidad), ...);
+}
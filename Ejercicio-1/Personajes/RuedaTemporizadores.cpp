@@ -0,0 +1,215 @@
+#include "RuedaTemporizadores.hpp"
+#include <algorithm>
+
+/**
+ * @brief Implementacion del constructor de RuedaTemporizadores
+ *
+ * @param capacidadInicial Temporizadores para los que se reserva memoria
+ */
+RuedaTemporizadores::RuedaTemporizadores(size_t capacidadInicial)
+    : ahora(0), pendientes(0) {
+    nodos.reserve(capacidadInicial);
+    fill(begin(cabezas), end(cabezas), NULO);
+}
+
+/**
+ * @brief Implementacion del metodo programar
+ *
+ * Reutiliza un nodo libre del pool si hay alguno.
+ *
+ * @param retraso Ticks hasta el primer vencimiento (minimo 1)
+ * @param objetivo Dato libre
+ * @param tipo Dato libre
+ * @param valor Dato libre
+ * @param periodo Ticks entre repeticiones (0 = una sola vez)
+ * @param repeticiones Vencimientos totales para periodicos (negativo = sin limite; 0 no programa nada)
+ * @return Identificador para cancelarlo; con periodo y 0 repeticiones, uno que nunca esta pendiente
+ */
+IdTemporizador RuedaTemporizadores::programar(uint64_t retraso, int objetivo, int tipo, int valor,
+                                              uint32_t periodo, int repeticiones) {
+    if (periodo > 0 && repeticiones == 0) {
+        // Cero vencimientos: no hay nada que programar
+        return IdTemporizador{NULO, 0};
+    }
+    uint32_t indice;
+    if (!libres.empty()) {
+        indice = libres.back();
+        libres.pop_back();
+    } else {
+        indice = static_cast<uint32_t>(nodos.size());
+        nodos.push_back(Nodo{0, NULO, NULO, NULO, 0, 0, 0, 0, 0, 0});
+    }
+
+    Nodo& nodo = nodos[indice];
+    nodo.vencimiento = ahora + max<uint64_t>(retraso, 1);
+    nodo.periodo = periodo;
+    nodo.repeticiones = (periodo == 0) ? 1 : repeticiones;
+    nodo.objetivo = objetivo;
+    nodo.tipo = tipo;
+    nodo.valor = valor;
+    ubicar(indice);
+    ++pendientes;
+
+    return IdTemporizador{indice, nodo.generacion};
+}
+
+/**
+ * @brief Implementacion del metodo cancelar
+ *
+ * @param id Identificador devuelto por programar
+ * @return true si estaba pendiente y se cancelo
+ */
+bool RuedaTemporizadores::cancelar(IdTemporizador id) {
+    if (!estaPendiente(id)) {
+        return false;
+    }
+    desenlazar(id.indice);
+    liberar(id.indice);
+    return true;
+}
+
+bool RuedaTemporizadores::estaPendiente(IdTemporizador id) const {
+    return id.indice < nodos.size()
+        && nodos[id.indice].generacion == id.generacion
+        && nodos[id.indice].ranura != NULO;
+}
+
+/**
+ * @brief Implementacion del metodo avanzar
+ *
+ * Primero reparte las ranuras de los niveles superiores que completan su
+ * vuelta (del mas alto al mas bajo) y despues vacia la ranura actual del
+ * nivel 0, donde estan justo los temporizadores que vencen en este tick.
+ *
+ * @param vencidos Vector donde se agregan los eventos
+ * @return Cantidad de eventos agregados
+ */
+size_t RuedaTemporizadores::avanzar(vector<EventoTemporizador>& vencidos) {
+    ++ahora;
+
+    int nivelesEnVuelta = 0;
+    while (nivelesEnVuelta < NIVELES - 1
+           && ((ahora >> (BITS_POR_NIVEL * (nivelesEnVuelta + 1))) << (BITS_POR_NIVEL * (nivelesEnVuelta + 1))) == ahora) {
+        ++nivelesEnVuelta;
+    }
+    for (int nivel = nivelesEnVuelta; nivel >= 1; --nivel) {
+        cascada(nivel);
+    }
+
+    const uint32_t ranura = static_cast<uint32_t>(ahora & (RANURAS - 1));
+    uint32_t actual = cabezas[ranura];
+    cabezas[ranura] = NULO;
+
+    size_t agregados = 0;
+    while (actual != NULO) {
+        Nodo& nodo = nodos[actual];
+        uint32_t siguiente = nodo.siguiente;
+
+        bool repetir = nodo.periodo > 0 && nodo.repeticiones != 1;
+        vencidos.push_back(EventoTemporizador{
+            IdTemporizador{actual, nodo.generacion}, nodo.objetivo, nodo.tipo, nodo.valor, !repetir});
+        ++agregados;
+
+        if (repetir) {
+            if (nodo.repeticiones > 0) {
+                --nodo.repeticiones;
+            }
+            nodo.vencimiento = ahora + nodo.periodo;
+            ubicar(actual);
+        } else {
+            nodo.ranura = NULO;
+            liberar(actual);
+        }
+        actual = siguiente;
+    }
+    return agregados;
+}
+
+uint64_t RuedaTemporizadores::getTickActual() const { return ahora; }
+size_t RuedaTemporizadores::getPendientes() const { return pendientes; }
+
+/**
+ * @brief Implementacion del metodo ubicar
+ *
+ * El nivel se elige por la distancia al vencimiento: menos de 256 ticks va
+ * al nivel 0, menos de 65536 al nivel 1, etc. La ranura sale de los bits
+ * del vencimiento correspondientes a ese nivel.
+ *
+ * @param indice Nodo a ubicar
+ */
+void RuedaTemporizadores::ubicar(uint32_t indice) {
+    Nodo& nodo = nodos[indice];
+    uint64_t distancia = nodo.vencimiento - ahora;
+
+    int nivel = 0;
+    while (nivel < NIVELES - 1 && distancia >= (uint64_t(1) << (BITS_POR_NIVEL * (nivel + 1)))) {
+        ++nivel;
+    }
+
+    uint64_t vencimiento = nodo.vencimiento;
+    if (nivel == NIVELES - 1 && distancia >= (uint64_t(1) << (BITS_POR_NIVEL * NIVELES))) {
+        // Fuera del alcance de la rueda: espera en la ultima ranura posible y se reubica en la cascada
+        vencimiento = ahora + (uint64_t(1) << (BITS_POR_NIVEL * NIVELES)) - 1;
+    }
+
+    uint32_t ranura = static_cast<uint32_t>((vencimiento >> (BITS_POR_NIVEL * nivel)) & (RANURAS - 1));
+    enlazar(indice, static_cast<uint32_t>(nivel * RANURAS) + ranura);
+}
+
+void RuedaTemporizadores::enlazar(uint32_t indice, uint32_t ranura) {
+    Nodo& nodo = nodos[indice];
+    nodo.ranura = ranura;
+    nodo.anterior = NULO;
+    nodo.siguiente = cabezas[ranura];
+    if (nodo.siguiente != NULO) {
+        nodos[nodo.siguiente].anterior = indice;
+    }
+    cabezas[ranura] = indice;
+}
+
+void RuedaTemporizadores::desenlazar(uint32_t indice) {
+    Nodo& nodo = nodos[indice];
+    if (nodo.anterior != NULO) {
+        nodos[nodo.anterior].siguiente = nodo.siguiente;
+    } else {
+        cabezas[nodo.ranura] = nodo.siguiente;
+    }
+    if (nodo.siguiente != NULO) {
+        nodos[nodo.siguiente].anterior = nodo.anterior;
+    }
+    nodo.ranura = NULO;
+}
+
+/**
+ * @brief Implementacion del metodo liberar
+ *
+ * Incrementa la generacion para invalidar los identificadores viejos.
+ *
+ * @param indice Nodo a liberar
+ */
+void RuedaTemporizadores::liberar(uint32_t indice) {
+    nodos[indice].ranura = NULO;
+    ++nodos[indice].generacion;
+    libres.push_back(indice);
+    --pendientes;
+}
+
+/**
+ * @brief Implementacion del metodo cascada
+ *
+ * Vacia la ranura actual de un nivel superior y vuelve a ubicar cada
+ * temporizador segun la distancia que le queda.
+ *
+ * @param nivel Nivel a repartir (1 o mas)
+ */
+void RuedaTemporizadores::cascada(int nivel) {
+    uint32_t ranura = static_cast<uint32_t>(nivel * RANURAS)
+                    + static_cast<uint32_t>((ahora >> (BITS_POR_NIVEL * nivel)) & (RANURAS - 1));
+    uint32_t actual = cabezas[ranura];
+    cabezas[ranura] = NULO;
+    while (actual != NULO) {
+        uint32_t siguiente = nodos[actual].siguiente;
+        ubicar(actual);
+        actual = siguiente;
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Identificador de un temporizador programado
+ *
+ * La generacion permite detectar identificadores viejos: cancelar un
+ * temporizador que ya vencio (y cuyo lugar se reutilizo) no tiene efecto.
+ */
+struct IdTemporizador {
+    uint32_t indice;
+    uint32_t generacion;
+};
+
+/**
+ * @brief Temporizador vencido, tal como lo entrega la rueda
+ *
+ * objetivo, tipo y valor son datos libres del que programa el temporizador.
+ */
+struct EventoTemporizador {
+    IdTemporizador id;
+    int objetivo;
+    int tipo;
+    int valor;
+    bool ultimaRepeticion;   ///< true si el temporizador ya no se repetira
+};
+
+/**
+ * @brief Rueda de temporizadores jerarquica
+ *
+ * Cuatro niveles de 256 ranuras cubren 2^32 ticks. Cada temporizador vive
+ * en una lista doblemente enlazada (por indices, dentro de un pool) de la
+ * ranura que corresponde a su vencimiento, asi que programar y cancelar son
+ * O(1). Al completar una vuelta de un nivel, la ranura siguiente del nivel
+ * superior se reparte en los niveles inferiores (cascada). Avanzar un tick
+ * solo toca la ranura actual.
+ *
+ * Los temporizadores periodicos se vuelven a programar solos al vencer.
+ */
+class RuedaTemporizadores {
+public:
+    static constexpr int NIVELES = 4;
+    static constexpr int BITS_POR_NIVEL = 8;
+    static constexpr int RANURAS = 1 << BITS_POR_NIVEL;
+
+    /**
+     * @brief Constructor
+     * @param capacidadInicial Temporizadores para los que se reserva memoria
+     */
+    explicit RuedaTemporizadores(size_t capacidadInicial = 0);
+
+    /**
+     * @brief Programa un temporizador
+     * @param retraso Ticks hasta el primer vencimiento (minimo 1)
+     * @param objetivo Dato libre (por ejemplo, indice de personaje)
+     * @param tipo Dato libre (por ejemplo, tipo de efecto)
+     * @param valor Dato libre (por ejemplo, cantidad)
+     * @param periodo Ticks entre repeticiones (0 = una sola vez)
+     * @param repeticiones Vencimientos totales para periodicos (negativo = sin limite; 0 no programa nada)
+     * @return Identificador para cancelarlo; con periodo y 0 repeticiones, uno que nunca esta pendiente
+     */
+    IdTemporizador programar(uint64_t retraso, int objetivo, int tipo, int valor,
+                             uint32_t periodo = 0, int repeticiones = -1);
+
+    /**
+     * @brief Cancela un temporizador pendiente
+     * @param id Identificador devuelto por programar
+     * @return true si estaba pendiente y se cancelo
+     */
+    bool cancelar(IdTemporizador id);
+
+    /**
+     * @brief Indica si un temporizador sigue pendiente
+     * @param id Identificador devuelto por programar
+     * @return true si esta pendiente
+     */
+    bool estaPendiente(IdTemporizador id) const;
+
+    /**
+     * @brief Avanza un tick y recoge los temporizadores vencidos
+     * @param vencidos Vector donde se agregan los eventos (no se vacia)
+     * @return Cantidad de eventos agregados
+     */
+    size_t avanzar(vector<EventoTemporizador>& vencidos);
+
+    uint64_t getTickActual() const;
+    size_t getPendientes() const;
+
+private:
+    static constexpr uint32_t NULO = 0xFFFFFFFFu;
+
+    /**
+     * @brief Nodo del pool de temporizadores
+     */
+    struct Nodo {
+        uint64_t vencimiento;
+        uint32_t anterior;
+        uint32_t siguiente;
+        uint32_t ranura;        ///< Ranura global (nivel * RANURAS + indice), NULO si esta libre
+        uint32_t generacion;
+        uint32_t periodo;
+        int repeticiones;
+        int objetivo;
+        int tipo;
+        int valor;
+    };
+
+    void ubicar(uint32_t indice);
+    void enlazar(uint32_t indice, uint32_t ranura);
+    void desenlazar(uint32_t indice);
+    void liberar(uint32_t indice);
+    void cascada(int nivel);
+
+    vector<Nodo> nodos;
+    vector<uint32_t> libres;
+    uint32_t cabezas[NIVELES * RANURAS];
+    uint64_t ahora;
+    size_t pendientes;
+};
@@ -49,6 +49,7 @@
 #include "Personajes/Guerrero/Caballero.hpp"
 #include "Personajes/Guerrero/Mercenario.hpp"
 #include "Personajes/Guerrero/Gladiador.hpp"
+#include "Personajes/BatallaEquipos.hpp"
 
 using namespace std;
 
@@ -1078,44 +1079,24 @@ void probarInteracciones() {
         personaje->setHPParaCombatePPT();
     }
     
-    const int RONDAS_TOTALES = 5;
-    MovimientoCombate movimientos[] = {
-        MovimientoCombate::GolpeFuerte, 
-        MovimientoCombate::GolpeRapido, 
-        MovimientoCombate::DefensaYGolpe
-    };
+    // Magos contra guerreros; la iniciativa la decide la destreza de cada uno
+    BatallaEquipos batalla(PoliticaObjetivo::MenorHP, static_cast<uint64_t>(rand()));
+    batalla.agregar(mago.get(), 0);
+    batalla.agregar(nigromante.get(), 0);
+    batalla.agregar(guerrero.get(), 1);
+    batalla.agregar(paladin.get(), 1);
     
-    for (int ronda = 1; ronda <= RONDAS_TOTALES; ++ronda) {
-        cout << "\n>> RONDA " << ronda << " <<" << endl;
-        
-        // Cada personaje ataca al siguiente en la lista
-        for (size_t i = 0; i < participantes.size(); ++i) {
-            auto atacante = participantes[i];
-            auto defensor = participantes[(i + 1) % participantes.size()];
-            
-            // Elegir un movimiento aleatorio para el atacante
-            MovimientoCombate movimiento = movimientos[rand() % 3];
-            
-            cout << "\n" << atacante->getNombre() << " (" << atacante->getHP() << " HP) ataca a " 
-                 << defensor->getNombre() << " (" << defensor->getHP() << " HP)" << endl;
-            
-            cout << "Usando " << movimientoCombateToString(movimiento) << endl;
-            int danio = atacante->atacar(movimiento);
-            
-            if (danio > 0) {
-                cout << "¡Golpe efectivo! Causando " << danio << " puntos de daño." << endl;
-                defensor->recibirDanio(danio, false);
-                cout << defensor->getNombre() << " queda con " << defensor->getHP() << " HP." << endl;
-            } else {
-                cout << "¡El ataque no tuvo efecto!" << endl;
-            }
-        }
-        
-        // Mostrar estado después de la ronda
-        cout << "\nEstado después de la ronda " << ronda << ":" << endl;
-        for (auto personaje : participantes) {
-            cout << "- " << personaje->getNombre() << ": " << personaje->getHP() << " HP" << endl;
-        }
+    ResultadoBatalla resultado = batalla.ejecutar(0, true);
+    
+    cout << "\nEstado final tras " << resultado.acciones << " acciones:" << endl;
+    for (auto personaje : participantes) {
+        cout << "- " << personaje->getNombre() << ": " << personaje->getHP() << " HP" << endl;
+    }
+    if (resultado.equipoGanador >= 0) {
+        cout << "Gana el equipo " << (resultado.equipoGanador == 0 ? "de los magos" : "de los guerreros")
+             << " con " << resultado.supervivientes[resultado.equipoGanador] << " superviviente(s)." << endl;
+    } else {
+        cout << "La batalla termina sin ganador (límite de acciones alcanzado)." << endl;
     }
     
     // Restaurar HP original
@@ -0,0 +1,396 @@
+#include "Armeria.hpp"
+#include <algorithm>
+#include <queue>
+
+/**
+ * @brief Implementación del constructor de Armeria
+ */
+Armeria::Armeria() : cantidad(0) {}
+
+/**
+ * @brief Implementación del método agregar
+ *
+ * Agrega una fila a las columnas de su tipo. Los índices del tipo se
+ * reordenan recién en la próxima consulta, así una carga masiva ordena
+ * una sola vez.
+ *
+ * @param arma Arma a guardar
+ * @return Identificador del arma, NINGUNA si es nula
+ */
+uint32_t Armeria::agregar(unique_ptr<InterfazArmas> arma) {
+    if (!arma) {
+        cerr << "Error: no se puede guardar un arma nula en la armería." << endl;
+        return NINGUNA;
+    }
+    int tipo = static_cast<int>(PersonajeFactory::obtenerTipoArma(*arma));
+    Columnas& columna = columnas[tipo];
+    uint32_t fila = static_cast<uint32_t>(columna.armas.size());
+
+    columna.poder.push_back(arma->getPoder());
+    columna.durabilidad.push_back(durabilidadPorMil(*arma));
+    columna.rareza.push_back(static_cast<uint8_t>(arma->getRareza()));
+    columna.disponible.push_back(1);
+    columna.prestada.push_back(nullptr);
+    columna.armas.push_back(move(arma));
+    columna.indicesDesactualizados = true;
+    ++cantidad;
+    return armarId(tipo, fila);
+}
+
+void Armeria::indexar() {
+    for (Columnas& columna : columnas) {
+        actualizarIndices(columna);
+    }
+}
+
+/**
+ * @brief Implementación del método mejores
+ *
+ * @param consulta Filtro
+ * @param k Cantidad máxima de armas
+ * @param salida Identificadores de mayor a menor poder
+ * @return Cantidad de armas encontradas
+ */
+size_t Armeria::mejores(const ConsultaArmeria& consulta, size_t k, vector<uint32_t>& salida) {
+    salida.clear();
+    if (k == 0) return 0;
+    if (candidatas(consulta, k, salida)) {
+        // El índice de durabilidad no ordena por poder: se ordenan solo las k primeras
+        auto porPoder = [this](uint32_t a, uint32_t b) {
+            int poderA = getPoder(a);
+            int poderB = getPoder(b);
+            return poderA != poderB ? poderA > poderB : a < b;
+        };
+        size_t tope = min(k, salida.size());
+        partial_sort(salida.begin(), salida.begin() + tope, salida.end(), porPoder);
+        salida.resize(tope);
+    }
+    return salida.size();
+}
+
+size_t Armeria::buscar(const ConsultaArmeria& consulta, vector<uint32_t>& salida) {
+    salida.clear();
+    candidatas(consulta, SIZE_MAX, salida);
+    return salida.size();
+}
+
+/**
+ * @brief Implementación del método retirar
+ *
+ * La fila sale de los índices, así las consultas no recorren armas
+ * prestadas; reponer la vuelve a agregar.
+ *
+ * @param id Identificador del arma
+ * @return El arma, nullptr si no existe o ya está prestada
+ */
+unique_ptr<InterfazArmas> Armeria::retirar(uint32_t id) {
+    if (!estaDisponible(id)) {
+        return nullptr;
+    }
+    Columnas& columna = columnas[static_cast<int>(getTipo(id))];
+    uint32_t fila = filaDe(id);
+    quitarDeIndices(columna, fila);
+    columna.disponible[fila] = 0;
+    columna.prestada[fila] = columna.armas[fila].get();
+    prestadas[columna.prestada[fila]] = id;
+    return move(columna.armas[fila]);
+}
+
+/**
+ * @brief Implementación del método reponer
+ *
+ * Relee poder, durabilidad y rareza del arma (pueden haber cambiado
+ * mientras estuvo prestada) y vuelve a insertar solo su fila en los índices.
+ *
+ * @param arma Arma a devolver
+ * @return Identificador del arma, NINGUNA si es nula
+ */
+uint32_t Armeria::reponer(unique_ptr<InterfazArmas> arma) {
+    if (!arma) {
+        return NINGUNA;
+    }
+    auto it = prestadas.find(arma.get());
+    if (it == prestadas.end()) {
+        return agregar(move(arma));
+    }
+    uint32_t id = it->second;
+    prestadas.erase(it);
+
+    Columnas& columna = columnas[static_cast<int>(getTipo(id))];
+    uint32_t fila = filaDe(id);
+    columna.poder[fila] = arma->getPoder();
+    columna.durabilidad[fila] = durabilidadPorMil(*arma);
+    columna.rareza[fila] = static_cast<uint8_t>(arma->getRareza());
+    columna.armas[fila] = move(arma);
+    columna.disponible[fila] = 1;
+    columna.prestada[fila] = nullptr;
+    agregarAIndices(columna, fila);
+    return id;
+}
+
+/**
+ * @brief Implementación del método darDeBaja
+ *
+ * Borra la dirección del arma de las prestadas. La fila ya salió de los
+ * índices al retirarla y no vuelve a estar disponible.
+ *
+ * @param id Identificador del arma
+ * @return true si el arma estaba prestada
+ */
+bool Armeria::darDeBaja(uint32_t id) {
+    if (!existe(id)) {
+        return false;
+    }
+    Columnas& columna = columnas[static_cast<int>(getTipo(id))];
+    uint32_t fila = filaDe(id);
+    if (!columna.prestada[fila]) {
+        return false;
+    }
+    prestadas.erase(columna.prestada[fila]);
+    columna.prestada[fila] = nullptr;
+    --cantidad;
+    return true;
+}
+
+/**
+ * @brief Implementación del método entregar
+ *
+ * Verifica antes que el personaje tenga lugar en su inventario, porque
+ * agregarArma descarta el arma si está lleno.
+ *
+ * @param id Identificador del arma
+ * @param personaje Personaje que la recibe
+ * @return true si se entregó
+ */
+bool Armeria::entregar(uint32_t id, InterfazPersonaje& personaje) {
+    if (!estaDisponible(id) || personaje.getArma(personaje.getCapacidadArmas() - 1) != nullptr) {
+        return false;
+    }
+    return personaje.agregarArma(retirar(id));
+}
+
+/**
+ * @brief Implementación del método devolver
+ *
+ * @param personaje Personaje que tiene el arma
+ * @param posicion Posición del arma en su inventario
+ * @return Identificador del arma, NINGUNA si no es de la armería
+ */
+uint32_t Armeria::devolver(InterfazPersonaje& personaje, int posicion) {
+    InterfazArmas* arma = personaje.getArma(posicion);
+    if (!arma || prestadas.find(arma) == prestadas.end()) {
+        return NINGUNA;
+    }
+    return reponer(personaje.quitarArma(posicion));
+}
+
+const InterfazArmas* Armeria::getArma(uint32_t id) const {
+    return existe(id) ? columnas[static_cast<int>(getTipo(id))].armas[filaDe(id)].get() : nullptr;
+}
+
+TipoArma Armeria::getTipo(uint32_t id) { return static_cast<TipoArma>(id & 0xF); }
+int Armeria::getPoder(uint32_t id) const { return existe(id) ? columnas[id & 0xF].poder[filaDe(id)] : 0; }
+int Armeria::getDurabilidad(uint32_t id) const { return existe(id) ? columnas[id & 0xF].durabilidad[filaDe(id)] : 0; }
+
+Rarity Armeria::getRareza(uint32_t id) const {
+    return existe(id) ? static_cast<Rarity>(columnas[id & 0xF].rareza[filaDe(id)]) : Rarity::Comun;
+}
+
+bool Armeria::estaDisponible(uint32_t id) const {
+    return existe(id) && columnas[id & 0xF].disponible[filaDe(id)] != 0;
+}
+
+size_t Armeria::getCantidad() const { return cantidad; }
+size_t Armeria::getPrestadas() const { return prestadas.size(); }
+
+uint32_t Armeria::armarId(int tipo, uint32_t fila) { return (fila << 4) | static_cast<uint32_t>(tipo); }
+uint32_t Armeria::filaDe(uint32_t id) { return id >> 4; }
+
+int Armeria::durabilidadPorMil(const InterfazArmas& arma) {
+    int maxima = arma.getDurabilidadMaxima();
+    return maxima > 0 ? static_cast<int>(1000LL * arma.getDurabilidadActual() / maxima) : 0;
+}
+
+bool Armeria::existe(uint32_t id) const {
+    uint32_t tipo = id & 0xF;
+    return tipo < static_cast<uint32_t>(CANTIDAD_TIPOS) && filaDe(id) < columnas[tipo].armas.size();
+}
+
+/**
+ * @brief Implementación del método actualizarIndices
+ *
+ * Reconstruye los índices de un tipo ordenando sus filas disponibles.
+ *
+ * @param columna Columnas del tipo
+ */
+void Armeria::actualizarIndices(Columnas& columna) {
+    if (!columna.indicesDesactualizados) return;
+
+    for (vector<uint32_t>& indice : columna.porPoder) {
+        indice.clear();
+    }
+    const uint32_t filas = static_cast<uint32_t>(columna.armas.size());
+    columna.porDurabilidad.clear();
+    for (uint32_t fila = 0; fila < filas; ++fila) {
+        if (columna.disponible[fila]) {
+            columna.porPoder[columna.rareza[fila]].push_back(fila);
+            columna.porDurabilidad.push_back(fila);
+        }
+    }
+    const vector<int>& poder = columna.poder;
+    for (vector<uint32_t>& indice : columna.porPoder) {
+        sort(indice.begin(), indice.end(), [&poder](uint32_t a, uint32_t b) {
+            return poder[a] != poder[b] ? poder[a] > poder[b] : a < b;
+        });
+    }
+
+    const vector<int>& durabilidad = columna.durabilidad;
+    sort(columna.porDurabilidad.begin(), columna.porDurabilidad.end(), [&durabilidad](uint32_t a, uint32_t b) {
+        return durabilidad[a] != durabilidad[b] ? durabilidad[a] > durabilidad[b] : a < b;
+    });
+    columna.indicesDesactualizados = false;
+}
+
+void Armeria::quitarDeIndices(Columnas& columna, uint32_t fila) {
+    if (columna.indicesDesactualizados) return;
+
+    const vector<int>& poder = columna.poder;
+    vector<uint32_t>& porPoder = columna.porPoder[columna.rareza[fila]];
+    auto itPoder = lower_bound(porPoder.begin(), porPoder.end(), fila, [&poder](uint32_t a, uint32_t b) {
+        return poder[a] != poder[b] ? poder[a] > poder[b] : a < b;
+    });
+    porPoder.erase(itPoder);
+
+    const vector<int>& durabilidad = columna.durabilidad;
+    vector<uint32_t>& porDurabilidad = columna.porDurabilidad;
+    auto itDurabilidad = lower_bound(porDurabilidad.begin(), porDurabilidad.end(), fila,
+                                     [&durabilidad](uint32_t a, uint32_t b) {
+        return durabilidad[a] != durabilidad[b] ? durabilidad[a] > durabilidad[b] : a < b;
+    });
+    porDurabilidad.erase(itDurabilidad);
+}
+
+void Armeria::agregarAIndices(Columnas& columna, uint32_t fila) {
+    if (columna.indicesDesactualizados) return;
+
+    const vector<int>& poder = columna.poder;
+    vector<uint32_t>& porPoder = columna.porPoder[columna.rareza[fila]];
+    porPoder.insert(lower_bound(porPoder.begin(), porPoder.end(), fila, [&poder](uint32_t a, uint32_t b) {
+        return poder[a] != poder[b] ? poder[a] > poder[b] : a < b;
+    }), fila);
+
+    const vector<int>& durabilidad = columna.durabilidad;
+    vector<uint32_t>& porDurabilidad = columna.porDurabilidad;
+    porDurabilidad.insert(lower_bound(porDurabilidad.begin(), porDurabilidad.end(), fila,
+                                      [&durabilidad](uint32_t a, uint32_t b) {
+        return durabilidad[a] != durabilidad[b] ? durabilidad[a] > durabilidad[b] : a < b;
+    }), fila);
+}
+
+bool Armeria::cumple(const Columnas& columna, uint32_t fila, const ConsultaArmeria& consulta) const {
+    Rarity rareza = static_cast<Rarity>(columna.rareza[fila]);
+    return columna.poder[fila] >= consulta.poderMinimo && columna.poder[fila] <= consulta.poderMaximo
+        && columna.durabilidad[fila] >= consulta.durabilidadMinima
+        && rareza >= consulta.rarezaMinima && rareza <= consulta.rarezaMaxima;
+}
+
+/**
+ * @brief Implementación del método candidatas
+ *
+ * Cuenta con búsquedas binarias cuántas filas deja cada índice y recorre
+ * el más chico:
+ * - Por poder: mezcla los tramos de cada (tipo, rareza) de mayor a menor
+ *   poder y corta al juntar k armas (sin k, recorre los tramos de corrido).
+ * - Por durabilidad: recorre las filas con durabilidad suficiente y
+ *   filtra el resto; mejores ordena después por poder.
+ *
+ * @param consulta Filtro
+ * @param k Cantidad máxima de armas (solo corta el recorrido por poder)
+ * @param salida Identificadores encontrados
+ * @return true si se usó el índice de durabilidad
+ */
+bool Armeria::candidatas(const ConsultaArmeria& consulta, size_t k, vector<uint32_t>& salida) {
+    int primerTipo = consulta.tipo < 0 ? 0 : consulta.tipo;
+    int ultimoTipo = consulta.tipo < 0 ? CANTIDAD_TIPOS - 1 : consulta.tipo;
+    if (primerTipo >= CANTIDAD_TIPOS || consulta.rarezaMinima > consulta.rarezaMaxima
+        || consulta.poderMinimo > consulta.poderMaximo) {
+        return false;
+    }
+    int primeraRareza = static_cast<int>(consulta.rarezaMinima);
+    int ultimaRareza = static_cast<int>(consulta.rarezaMaxima);
+
+    // Tramo de un índice por poder que cumple el rango de poder
+    struct Tramo {
+        int tipo;
+        const uint32_t* actual;
+        const uint32_t* fin;
+    };
+    vector<Tramo> tramos;
+    size_t porPoder = 0;
+    size_t porDurabilidad = 0;
+    for (int tipo = primerTipo; tipo <= ultimoTipo; ++tipo) {
+        Columnas& columna = columnas[tipo];
+        actualizarIndices(columna);
+        const vector<int>& poder = columna.poder;
+        for (int rareza = primeraRareza; rareza <= ultimaRareza; ++rareza) {
+            const vector<uint32_t>& indice = columna.porPoder[rareza];
+            auto desde = partition_point(indice.begin(), indice.end(),
+                                         [&](uint32_t fila) { return poder[fila] > consulta.poderMaximo; });
+            auto hasta = partition_point(desde, indice.end(),
+                                         [&](uint32_t fila) { return poder[fila] >= consulta.poderMinimo; });
+            if (desde != hasta) {
+                tramos.push_back(Tramo{tipo, indice.data() + (desde - indice.begin()), indice.data() + (hasta - indice.begin())});
+                porPoder += static_cast<size_t>(hasta - desde);
+            }
+        }
+        const vector<int>& durabilidad = columna.durabilidad;
+        porDurabilidad += static_cast<size_t>(partition_point(columna.porDurabilidad.begin(), columna.porDurabilidad.end(),
+            [&](uint32_t fila) { return durabilidad[fila] >= consulta.durabilidadMinima; }) - columna.porDurabilidad.begin());
+    }
+
+    if (consulta.durabilidadMinima > 0 && porDurabilidad < porPoder) {
+        for (int tipo = primerTipo; tipo <= ultimoTipo; ++tipo) {
+            const Columnas& columna = columnas[tipo];
+            for (uint32_t fila : columna.porDurabilidad) {
+                if (columna.durabilidad[fila] < consulta.durabilidadMinima) break;
+                if (cumple(columna, fila, consulta)) {
+                    salida.push_back(armarId(tipo, fila));
+                }
+            }
+        }
+        return true;
+    }
+
+    if (k == SIZE_MAX) {
+        for (const Tramo& tramo : tramos) {
+            const Columnas& columna = columnas[tramo.tipo];
+            for (const uint32_t* fila = tramo.actual; fila != tramo.fin; ++fila) {
+                if (columna.durabilidad[*fila] >= consulta.durabilidadMinima) {
+                    salida.push_back(armarId(tramo.tipo, *fila));
+                }
+            }
+        }
+        return false;
+    }
+
+    // Mezcla de los tramos: el de la cima del montículo tiene la próxima arma más poderosa
+    auto menosPoderoso = [this](const Tramo& a, const Tramo& b) {
+        int poderA = columnas[a.tipo].poder[*a.actual];
+        int poderB = columnas[b.tipo].poder[*b.actual];
+        return poderA != poderB ? poderA < poderB : armarId(a.tipo, *a.actual) > armarId(b.tipo, *b.actual);
+    };
+    priority_queue<Tramo, vector<Tramo>, decltype(menosPoderoso)> monticulo(menosPoderoso, move(tramos));
+    while (!monticulo.empty() && salida.size() < k) {
+        Tramo tramo = monticulo.top();
+        monticulo.pop();
+        const Columnas& columna = columnas[tramo.tipo];
+        uint32_t fila = *tramo.actual;
+        if (columna.durabilidad[fila] >= consulta.durabilidadMinima) {
+            salida.push_back(armarId(tramo.tipo, fila));
+        }
+        if (++tramo.actual != tramo.fin) {
+            monticulo.push(tramo);
+        }
+    }
+    return false;
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "PersonajeFactory.hpp"
+
+using namespace std;
+
+/**
+ * @brief Filtro de una consulta a la armería
+ *
+ * Los campos sin cambiar no filtran nada. La durabilidad se expresa en
+ * milésimos de la durabilidad máxima (500 = al menos la mitad).
+ */
+struct ConsultaArmeria {
+    int tipo = -1;                              ///< Valor de TipoArma, -1 para cualquier tipo
+    Rarity rarezaMinima = Rarity::Comun;
+    Rarity rarezaMaxima = Rarity::Legendario;
+    int poderMinimo = INT_MIN;
+    int poderMaximo = INT_MAX;
+    int durabilidadMinima = 0;                  ///< Por mil de la durabilidad máxima
+};
+
+/**
+ * @brief Depósito de armas con almacenamiento por columnas e índices secundarios
+ *
+ * Las armas se guardan separadas por tipo; dentro de cada tipo, poder,
+ * durabilidad, rareza y disponibilidad viven en arreglos propios, así que
+ * las consultas recorren enteros contiguos y no tocan los objetos.
+ *
+ * Cada tipo tiene dos índices: uno por rareza con las armas ordenadas por
+ * poder y otro ordenado por durabilidad. Una consulta elige el índice que
+ * deja menos candidatas. Los índices se ordenan la primera vez que se los
+ * consulta después de agregar armas; al retirar o devolver un arma solo
+ * se mueve su entrada.
+ *
+ * Las armas prestadas a un personaje salen de los índices, así que las
+ * consultas no las recorren, y vuelven a entrar al devolverlas. Un arma
+ * prestada se reconoce por su dirección, así que si se destruye afuera hay
+ * que darla de baja: otra arma podría ocupar la misma dirección y
+ * confundirse con ella al reponerla.
+ */
+class Armeria {
+public:
+    static constexpr uint32_t NINGUNA = 0xFFFFFFFFu;
+
+    Armeria();
+
+    /**
+     * @brief Guarda un arma en la armería
+     * @param arma Arma (pasa a ser propiedad de la armería)
+     * @return Identificador del arma, NINGUNA si es nula
+     */
+    uint32_t agregar(unique_ptr<InterfazArmas> arma);
+
+    /**
+     * @brief Ordena los índices de los tipos que recibieron armas nuevas
+     *
+     * Las consultas lo hacen solas si hace falta; llamarlo después de una
+     * carga masiva evita que la primera consulta pague el ordenamiento.
+     */
+    void indexar();
+
+    /**
+     * @brief Busca las k armas disponibles más poderosas que cumplen el filtro
+     * @param consulta Filtro
+     * @param k Cantidad máxima de armas
+     * @param salida Se reemplaza por los identificadores, de mayor a menor poder
+     * @return Cantidad de armas encontradas
+     */
+    size_t mejores(const ConsultaArmeria& consulta, size_t k, vector<uint32_t>& salida);
+
+    /**
+     * @brief Busca todas las armas disponibles que cumplen el filtro
+     * @param consulta Filtro
+     * @param salida Se reemplaza por los identificadores (sin orden garantizado)
+     * @return Cantidad de armas encontradas
+     */
+    size_t buscar(const ConsultaArmeria& consulta, vector<uint32_t>& salida);
+
+    /**
+     * @brief Saca un arma de la armería
+     * @param id Identificador del arma
+     * @return El arma, nullptr si no existe o ya está prestada
+     */
+    unique_ptr<InterfazArmas> retirar(uint32_t id);
+
+    /**
+     * @brief Devuelve un arma retirada a su lugar y actualiza sus columnas e índices
+     *
+     * Un arma que no salió de esta armería se agrega como nueva.
+     *
+     * @param arma Arma a devolver
+     * @return Identificador del arma, NINGUNA si es nula
+     */
+    uint32_t reponer(unique_ptr<InterfazArmas> arma);
+
+    /**
+     * @brief Olvida un arma prestada que no va a volver (por ejemplo, porque se destruyó)
+     *
+     * La fila queda como no disponible y el arma deja de contarse.
+     *
+     * @param id Identificador del arma
+     * @return true si el arma estaba prestada
+     */
+    bool darDeBaja(uint32_t id);
+
+    /**
+     * @brief Presta un arma a un personaje (agregarArma)
+     * @param id Identificador del arma
+     * @param personaje Personaje que la recibe
+     * @return true si el arma estaba disponible y el personaje tenía lugar
+     */
+    bool entregar(uint32_t id, InterfazPersonaje& personaje);
+
+    /**
+     * @brief Recupera un arma prestada del inventario de un personaje (quitarArma)
+     * @param personaje Personaje que la tiene
+     * @param posicion Posición del arma en su inventario
+     * @return Identificador del arma, NINGUNA si esa arma no es de la armería
+     */
+    uint32_t devolver(InterfazPersonaje& personaje, int posicion);
+
+    /**
+     * @brief Obtiene un arma sin sacarla
+     * @param id Identificador del arma
+     * @return Puntero al arma, nullptr si no existe o está prestada
+     */
+    const InterfazArmas* getArma(uint32_t id) const;
+
+    static TipoArma getTipo(uint32_t id);
+    int getPoder(uint32_t id) const;
+    int getDurabilidad(uint32_t id) const;      ///< Por mil de la durabilidad máxima
+    Rarity getRareza(uint32_t id) const;
+    bool estaDisponible(uint32_t id) const;
+    size_t getCantidad() const;
+    size_t getPrestadas() const;
+
+private:
+    static constexpr int CANTIDAD_TIPOS = static_cast<int>(TipoArma::Garrote) + 1;
+    static constexpr int CANTIDAD_RAREZAS = static_cast<int>(Rarity::Legendario) + 1;
+
+    /**
+     * @brief Armas de un tipo: una columna por atributo y sus índices
+     */
+    struct Columnas {
+        vector<unique_ptr<InterfazArmas>> armas;    ///< nullptr mientras está prestada
+        vector<int> poder;
+        vector<int> durabilidad;
+        vector<uint8_t> rareza;
+        vector<uint8_t> disponible;
+        vector<const InterfazArmas*> prestada;      ///< Arma fuera de la armería, nullptr si no está prestada
+        array<vector<uint32_t>, CANTIDAD_RAREZAS> porPoder;  ///< Filas disponibles por rareza, de mayor a menor poder
+        vector<uint32_t> porDurabilidad;                     ///< Filas disponibles de mayor a menor durabilidad
+        bool indicesDesactualizados = false;
+    };
+
+    static uint32_t armarId(int tipo, uint32_t fila);
+    static uint32_t filaDe(uint32_t id);
+    static int durabilidadPorMil(const InterfazArmas& arma);
+
+    bool existe(uint32_t id) const;
+    void actualizarIndices(Columnas& columna);
+    void quitarDeIndices(Columnas& columna, uint32_t fila);
+    void agregarAIndices(Columnas& columna, uint32_t fila);
+    bool cumple(const Columnas& columna, uint32_t fila, const ConsultaArmeria& consulta) const;
+
+    /**
+     * @brief Recorre las candidatas de la consulta con el índice más selectivo
+     * @return true si se usó el índice de durabilidad (las filas no salen ordenadas por poder)
+     */
+    bool candidatas(const ConsultaArmeria& consulta, size_t k, vector<uint32_t>& salida);
+
+    array<Columnas, CANTIDAD_TIPOS> columnas;
+    unordered_map<const InterfazArmas*, uint32_t> prestadas;   ///< Arma fuera de la armería -> identificador
+    size_t cantidad;
+};
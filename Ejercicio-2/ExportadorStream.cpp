@@ -0,0 +1,453 @@
+#include "ExportadorStream.hpp"
+#include <charconv>
+#include <cstring>
+#include <iostream>
+
+// Nombres constantes para no construir un string por campo
+static const char* const NOMBRES_TIPO_PERSONAJE[] = {
+    "Hechicero", "Conjurador", "Brujo", "Nigromante", "Barbaro",
+    "Paladin", "Caballero", "Mercenario", "Gladiador"
+};
+static const char* const NOMBRES_TIPO_ARMA[] = {
+    "Baston", "LibroHechizos", "Pocion", "Amuleto", "HachaSimple",
+    "HachaDoble", "Espada", "Lanza", "Garrote"
+};
+static const char* const NOMBRES_RAZA[] = {"Humano", "Elfo", "Enano", "Orco", "Gnomo"};
+static const char* const NOMBRES_RAREZA[] = {"Comun", "PocoComun", "Raro", "Epico", "Legendario"};
+
+// Encabezados CSV; el orden coincide con el de los campos de cada registro
+static const char ENCABEZADO_PERSONAJE[] =
+    "id,tipo,clase,nombre,raza,nivel,hp,fuerza,destreza,constitucion,inteligencia,recurso,armas,armaEquipada\n";
+static const char ENCABEZADO_ARMA[] =
+    "idPersonaje,posicion,tipo,nombre,rareza,poder,durabilidadActual,durabilidadMaxima,peso\n";
+static const char ENCABEZADO_DUELO[] =
+    "jugador1,jugador2,ganador,turnos,hpFinal1,hpFinal2,danioFijo\n";
+
+/**
+ * @brief Obtiene un nombre de una tabla constante con control de rango
+ * @param tabla Tabla de nombres
+ * @param indice Índice buscado
+ * @return Nombre correspondiente o "Desconocido"
+ */
+template <size_t N>
+static const char* nombreDeTabla(const char* const (&tabla)[N], int indice) {
+    return (indice >= 0 && static_cast<size_t>(indice) < N) ? tabla[indice] : "Desconocido";
+}
+
+/**
+ * @brief Implementación del constructor de ExportadorStream
+ */
+ExportadorStream::ExportadorStream(FormatoExportacion formato, size_t capacidadBuffer)
+    : formato(formato), buffer(capacidadBuffer < 4096 ? 4096 : capacidadBuffer), usado(0),
+      tipoActual(TipoRegistro::Ninguno), errorEscritura(false),
+      omitirEncabezado(false), registrosEscritos(0), bytesEscritos(0), campoActual(0) {}
+
+ExportadorStream::~ExportadorStream() {
+    cerrar();
+}
+
+/**
+ * @brief Implementación del método abrir
+ *
+ * Si se agrega al final de un CSV que ya tiene contenido, se asume que el
+ * encabezado existente corresponde al tipo del primer registro que se escriba.
+ *
+ * @param ruta Ruta del archivo
+ * @param agregarAlFinal true para agregar al final en lugar de truncar
+ * @return true si se abrió correctamente
+ */
+bool ExportadorStream::abrir(const string& ruta, bool agregarAlFinal) {
+    cerrar();
+
+    archivo.open(ruta, ios::binary | (agregarAlFinal ? ios::app : ios::trunc));
+    if (!archivo) {
+        cerr << "Error: no se pudo abrir el archivo de exportación " << ruta << endl;
+        return false;
+    }
+
+    usado = 0;
+    tipoActual = TipoRegistro::Ninguno;
+    errorEscritura = false;
+    registrosEscritos = 0;
+    bytesEscritos = 0;
+
+    // Con un CSV no vacío el encabezado ya fue escrito en una apertura anterior
+    archivo.seekp(0, ios::end);
+    omitirEncabezado = agregarAlFinal && archivo.tellp() > 0;
+    return true;
+}
+
+/**
+ * @brief Implementación del método cerrar
+ * @return true si todas las escrituras fueron correctas
+ */
+bool ExportadorStream::cerrar() {
+    if (!archivo.is_open()) {
+        return !errorEscritura;
+    }
+    vaciar();
+    archivo.close();
+    return !errorEscritura;
+}
+
+bool ExportadorStream::estaAbierto() const { return archivo.is_open(); }
+uint64_t ExportadorStream::getRegistrosEscritos() const { return registrosEscritos; }
+uint64_t ExportadorStream::getBytesEscritos() const { return bytesEscritos; }
+
+/**
+ * @brief Implementación del método vaciar
+ *
+ * Vuelca todo el buffer con una sola llamada a write.
+ *
+ * @return true si la escritura fue correcta
+ */
+bool ExportadorStream::vaciar() {
+    if (usado > 0 && archivo.is_open()) {
+        archivo.write(buffer.data(), static_cast<streamsize>(usado));
+        if (!archivo) {
+            if (!errorEscritura) {
+                cerr << "Error: falló la escritura del archivo de exportación." << endl;
+            }
+            errorEscritura = true;
+        }
+    }
+    usado = 0;
+    return !errorEscritura;
+}
+
+/**
+ * @brief Implementación del método asegurarEspacio
+ * @param bytes Cantidad de bytes necesarios
+ */
+void ExportadorStream::asegurarEspacio(size_t bytes) {
+    if (usado + bytes <= buffer.size()) {
+        return;
+    }
+    vaciar();
+    if (bytes > buffer.size()) {
+        buffer.resize(bytes);
+    }
+}
+
+/**
+ * @brief Implementación del método agregarCrudo
+ * @param texto Texto a copiar
+ */
+void ExportadorStream::agregarCrudo(string_view texto) {
+    asegurarEspacio(texto.size());
+    memcpy(buffer.data() + usado, texto.data(), texto.size());
+    usado += texto.size();
+    bytesEscritos += texto.size();
+}
+
+/**
+ * @brief Implementación del método comenzarRegistro
+ * @param tipo Tipo del registro
+ * @return false si el archivo no está abierto o el tipo no coincide en CSV
+ */
+bool ExportadorStream::comenzarRegistro(TipoRegistro tipo) {
+    if (!archivo.is_open()) {
+        cerr << "Error: el exportador no tiene un archivo abierto." << endl;
+        return false;
+    }
+
+    if (formato == FormatoExportacion::CSV) {
+        if (tipoActual == TipoRegistro::Ninguno) {
+            tipoActual = tipo;
+            if (!omitirEncabezado) {
+                if (tipo == TipoRegistro::Personaje) agregarCrudo(ENCABEZADO_PERSONAJE);
+                else if (tipo == TipoRegistro::Arma) agregarCrudo(ENCABEZADO_ARMA);
+                else agregarCrudo(ENCABEZADO_DUELO);
+            }
+        } else if (tipoActual != tipo) {
+            cerr << "Error: un archivo CSV solo puede contener un tipo de registro." << endl;
+            return false;
+        }
+        campoActual = 0;
+        return true;
+    }
+
+    campoActual = 0;
+    agregarCrudo("{");
+    if (tipo == TipoRegistro::Personaje) campoTexto("registro", "personaje");
+    else if (tipo == TipoRegistro::Arma) campoTexto("registro", "arma");
+    else campoTexto("registro", "duelo");
+    return true;
+}
+
+/**
+ * @brief Implementación del método terminarRegistro
+ */
+void ExportadorStream::terminarRegistro() {
+    agregarCrudo(formato == FormatoExportacion::CSV ? "\n" : "}\n");
+    registrosEscritos++;
+}
+
+/**
+ * @brief Implementación del método separarCampo
+ * @param clave Nombre del campo
+ */
+void ExportadorStream::separarCampo(const char* clave) {
+    if (campoActual++ > 0) {
+        agregarCrudo(",");
+    }
+    if (formato == FormatoExportacion::NDJSON) {
+        agregarCrudo("\"");
+        agregarCrudo(clave);
+        agregarCrudo("\":");
+    }
+}
+
+/**
+ * @brief Implementación del método campoEntero
+ * @param clave Nombre del campo
+ * @param valor Valor a escribir
+ */
+void ExportadorStream::campoEntero(const char* clave, int64_t valor) {
+    separarCampo(clave);
+    asegurarEspacio(24);
+    char* inicio = buffer.data() + usado;
+    char* fin = to_chars(inicio, inicio + 24, valor).ptr;
+    usado += static_cast<size_t>(fin - inicio);
+    bytesEscritos += static_cast<size_t>(fin - inicio);
+}
+
+/**
+ * @brief Implementación del método campoDecimal
+ *
+ * Usa dos decimales fijos; si el valor no entra en el espacio reservado
+ * (magnitudes absurdas) recurre a la notación científica.
+ *
+ * @param clave Nombre del campo
+ * @param valor Valor a escribir
+ */
+void ExportadorStream::campoDecimal(const char* clave, double valor) {
+    separarCampo(clave);
+    asegurarEspacio(64);
+    char* inicio = buffer.data() + usado;
+    to_chars_result r = to_chars(inicio, inicio + 64, valor, chars_format::fixed, 2);
+    if (r.ec != errc()) {
+        r = to_chars(inicio, inicio + 64, valor, chars_format::scientific, 6);
+    }
+    usado += static_cast<size_t>(r.ptr - inicio);
+    bytesEscritos += static_cast<size_t>(r.ptr - inicio);
+}
+
+/**
+ * @brief Implementación del método campoTexto
+ *
+ * En CSV el texto se encierra entre comillas solo si contiene separadores,
+ * comillas o saltos de línea. En NDJSON se escapan comillas, barras y
+ * caracteres de control; el resto de UTF-8 se copia sin cambios.
+ *
+ * @param clave Nombre del campo
+ * @param valor Texto a escribir
+ */
+void ExportadorStream::campoTexto(const char* clave, string_view valor) {
+    separarCampo(clave);
+    // Peor caso: cada byte se convierte en \u00XX
+    asegurarEspacio(valor.size() * 6 + 2);
+    char* destino = buffer.data() + usado;
+    char* inicio = destino;
+
+    if (formato == FormatoExportacion::CSV) {
+        bool necesitaComillas = valor.find_first_of(",\"\r\n") != string_view::npos;
+        if (!necesitaComillas) {
+            memcpy(destino, valor.data(), valor.size());
+            destino += valor.size();
+        } else {
+            *destino++ = '"';
+            for (char c : valor) {
+                if (c == '"') *destino++ = '"';
+                *destino++ = c;
+            }
+            *destino++ = '"';
+        }
+    } else {
+        static const char HEX[] = "0123456789abcdef";
+        *destino++ = '"';
+        for (char c : valor) {
+            unsigned char u = static_cast<unsigned char>(c);
+            if (c == '"' || c == '\\') {
+                *destino++ = '\\';
+                *destino++ = c;
+            } else if (u < 0x20) {
+                memcpy(destino, "\\u00", 4);
+                destino[4] = HEX[u >> 4];
+                destino[5] = HEX[u & 0xF];
+                destino += 6;
+            } else {
+                *destino++ = c;
+            }
+        }
+        *destino++ = '"';
+    }
+
+    usado += static_cast<size_t>(destino - inicio);
+    bytesEscritos += static_cast<size_t>(destino - inicio);
+}
+
+/**
+ * @brief Implementación del método campoBooleano
+ * @param clave Nombre del campo
+ * @param valor Valor a escribir
+ */
+void ExportadorStream::campoBooleano(const char* clave, bool valor) {
+    separarCampo(clave);
+    agregarCrudo(valor ? "true" : "false");
+}
+
+/**
+ * @brief Implementación del método escribirPersonaje
+ * @param personaje Personaje a exportar
+ * @param id Identificador del personaje dentro de la exportación
+ * @return true si se escribió
+ */
+bool ExportadorStream::escribirPersonaje(const InterfazPersonaje& personaje, uint64_t id) {
+    if (!comenzarRegistro(TipoRegistro::Personaje)) {
+        return false;
+    }
+
+    const Mago* mago = dynamic_cast<const Mago*>(&personaje);
+    const Guerrero* guerrero = mago ? nullptr : dynamic_cast<const Guerrero*>(&personaje);
+
+    int cantidadArmas = 0;
+    while (personaje.getArma(cantidadArmas) != nullptr) {
+        cantidadArmas++;
+    }
+
+    campoEntero("id", static_cast<int64_t>(id));
+    campoTexto("tipo", nombreDeTabla(NOMBRES_TIPO_PERSONAJE,
+                                     static_cast<int>(PersonajeFactory::obtenerTipoPersonaje(personaje))));
+    campoTexto("clase", mago ? "Mago" : "Guerrero");
+    campoTexto("nombre", personaje.getNombre());
+
+    if (mago) {
+        campoTexto("raza", nombreDeTabla(NOMBRES_RAZA, static_cast<int>(mago->getRaza())));
+        campoEntero("nivel", mago->getNivel());
+        campoEntero("hp", mago->getHP());
+        campoEntero("fuerza", mago->getFuerza());
+        campoEntero("destreza", mago->getDestreza());
+        campoEntero("constitucion", mago->getConstitucion());
+        campoEntero("inteligencia", mago->getInteligencia());
+        campoEntero("recurso", mago->getMana());
+        campoEntero("armas", cantidadArmas);
+        campoEntero("armaEquipada", mago->getArmaEquipadaPos());
+    } else if (guerrero) {
+        campoTexto("raza", nombreDeTabla(NOMBRES_RAZA, static_cast<int>(guerrero->getRaza())));
+        campoEntero("nivel", guerrero->getNivel());
+        campoEntero("hp", guerrero->getHP());
+        campoEntero("fuerza", guerrero->getFuerza());
+        campoEntero("destreza", guerrero->getDestreza());
+        campoEntero("constitucion", guerrero->getConstitucion());
+        campoEntero("inteligencia", guerrero->getInteligencia());
+        campoEntero("recurso", guerrero->getEstamina());
+        campoEntero("armas", cantidadArmas);
+        campoEntero("armaEquipada", guerrero->getArmaEquipadaPos());
+    } else {
+        // Personaje de otra jerarquía: solo los datos de la interfaz
+        campoTexto("raza", "");
+        campoEntero("nivel", 0);
+        campoEntero("hp", personaje.getHP());
+        campoEntero("fuerza", 0);
+        campoEntero("destreza", 0);
+        campoEntero("constitucion", 0);
+        campoEntero("inteligencia", 0);
+        campoEntero("recurso", 0);
+        campoEntero("armas", cantidadArmas);
+        campoEntero("armaEquipada", -1);
+    }
+
+    terminarRegistro();
+    return true;
+}
+
+/**
+ * @brief Implementación del método escribirArma
+ * @param arma Arma a exportar
+ * @param idPersonaje Identificador del personaje que la lleva
+ * @param posicion Posición del arma en el inventario
+ * @return true si se escribió
+ */
+bool ExportadorStream::escribirArma(const InterfazArmas& arma, uint64_t idPersonaje, int posicion) {
+    if (!comenzarRegistro(TipoRegistro::Arma)) {
+        return false;
+    }
+
+    double peso = 0.0;
+    if (const ArmaDeCombate* combate = dynamic_cast<const ArmaDeCombate*>(&arma)) {
+        peso = combate->getPeso();
+    } else if (const ObjetoMagico* objeto = dynamic_cast<const ObjetoMagico*>(&arma)) {
+        peso = objeto->getPeso();
+    }
+
+    campoEntero("idPersonaje", static_cast<int64_t>(idPersonaje));
+    campoEntero("posicion", posicion);
+    campoTexto("tipo", nombreDeTabla(NOMBRES_TIPO_ARMA, static_cast<int>(PersonajeFactory::obtenerTipoArma(arma))));
+    campoTexto("nombre", arma.getNombre());
+    campoTexto("rareza", nombreDeTabla(NOMBRES_RAREZA, static_cast<int>(arma.getRareza())));
+    campoEntero("poder", arma.getPoder());
+    campoEntero("durabilidadActual", arma.getDurabilidadActual());
+    campoEntero("durabilidadMaxima", arma.getDurabilidadMaxima());
+    campoDecimal("peso", peso);
+
+    terminarRegistro();
+    return true;
+}
+
+/**
+ * @brief Implementación del método escribirResultadoDuelo
+ * @param resultado Resultado a exportar
+ * @return true si se escribió
+ */
+bool ExportadorStream::escribirResultadoDuelo(const ResultadoDuelo& resultado) {
+    if (!comenzarRegistro(TipoRegistro::Duelo)) {
+        return false;
+    }
+
+    campoTexto("jugador1", resultado.jugador1);
+    campoTexto("jugador2", resultado.jugador2);
+    campoEntero("ganador", resultado.ganador);
+    campoEntero("turnos", resultado.turnos);
+    campoEntero("hpFinal1", resultado.hpFinal1);
+    campoEntero("hpFinal2", resultado.hpFinal2);
+    campoBooleano("danioFijo", resultado.danioFijo);
+
+    terminarRegistro();
+    return true;
+}
+
+/**
+ * @brief Implementación del método escribirPersonajes
+ * @param personajes Personajes a exportar
+ * @param primerId Id del primer personaje
+ * @return Cantidad de personajes escritos
+ */
+size_t ExportadorStream::escribirPersonajes(const vector<shared_ptr<InterfazPersonaje>>& personajes, uint64_t primerId) {
+    size_t escritos = 0;
+    for (size_t i = 0; i < personajes.size(); ++i) {
+        if (personajes[i] && escribirPersonaje(*personajes[i], primerId + i)) {
+            escritos++;
+        }
+    }
+    return escritos;
+}
+
+/**
+ * @brief Implementación del método escribirArmas
+ * @param personajes Personajes cuyas armas se exportan
+ * @param primerId Id del primer personaje
+ * @return Cantidad de armas escritas
+ */
+size_t ExportadorStream::escribirArmas(const vector<shared_ptr<InterfazPersonaje>>& personajes, uint64_t primerId) {
+    size_t escritos = 0;
+    for (size_t i = 0; i < personajes.size(); ++i) {
+        if (!personajes[i]) continue;
+        for (int pos = 0; InterfazArmas* arma = personajes[i]->getArma(pos); ++pos) {
+            if (escribirArma(*arma, primerId + i, pos)) {
+                escritos++;
+            }
+        }
+    }
+    return escritos;
+}
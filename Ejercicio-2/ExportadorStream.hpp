@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "PersonajeFactory.hpp"
+
+using namespace std;
+
+/**
+ * @brief Formatos de salida soportados por el exportador
+ */
+enum class FormatoExportacion {
+    CSV = 0,   ///< Valores separados por comas, con una fila de encabezado por archivo
+    NDJSON     ///< Un objeto JSON por línea
+};
+
+/**
+ * @brief Resultado resumido de un duelo, listo para exportar
+ */
+struct ResultadoDuelo {
+    string jugador1;
+    string jugador2;
+    int ganador;        ///< 1 o 2 según quién ganó, 0 si no hubo ganador
+    int turnos;
+    int hpFinal1;
+    int hpFinal2;
+    bool danioFijo;
+};
+
+/**
+ * @brief Exportador por streaming de personajes, armas y resultados de duelos
+ *
+ * Los registros se formatean directamente en un buffer de caracteres
+ * reutilizable (números con to_chars, textos copiados y escapados en el
+ * lugar, nombres de enums desde tablas constantes), sin crear un string por
+ * campo. Cuando el buffer se llena se vuelca al archivo con una única
+ * escritura grande, de modo que exportar millones de registros queda
+ * limitado por el disco y no por el formateo.
+ *
+ * En CSV cada archivo guarda un solo tipo de registro: el encabezado se
+ * escribe con el primer registro y mezclar tipos es un error. En NDJSON cada
+ * línea lleva el campo "registro", así que los tipos pueden mezclarse.
+ */
+class ExportadorStream {
+public:
+    /**
+     * @brief Constructor del exportador
+     * @param formato Formato de salida
+     * @param capacidadBuffer Tamaño del buffer en bytes (1 MiB por defecto)
+     */
+    explicit ExportadorStream(FormatoExportacion formato, size_t capacidadBuffer = 1 << 20);
+
+    /**
+     * @brief Destructor que vuelca lo pendiente y cierra el archivo
+     */
+    ~ExportadorStream();
+
+    ExportadorStream(const ExportadorStream&) = delete;
+    ExportadorStream& operator=(const ExportadorStream&) = delete;
+
+    /**
+     * @brief Abre el archivo de salida
+     * @param ruta Ruta del archivo
+     * @param agregarAlFinal true para agregar al final en lugar de truncar
+     * @return true si se abrió correctamente, false en caso contrario
+     */
+    bool abrir(const string& ruta, bool agregarAlFinal = false);
+
+    /**
+     * @brief Vuelca lo pendiente y cierra el archivo
+     * @return true si todas las escrituras fueron correctas
+     */
+    bool cerrar();
+
+    /**
+     * @brief Indica si hay un archivo abierto
+     * @return true si el exportador está abierto
+     */
+    bool estaAbierto() const;
+
+    /**
+     * @brief Escribe un registro con los atributos de un personaje
+     * @param personaje Personaje a exportar
+     * @param id Identificador del personaje dentro de la exportación
+     * @return true si se escribió, false si el archivo no admite el registro
+     */
+    bool escribirPersonaje(const InterfazPersonaje& personaje, uint64_t id);
+
+    /**
+     * @brief Escribe un registro con el estado de un arma
+     * @param arma Arma a exportar
+     * @param idPersonaje Identificador del personaje que la lleva
+     * @param posicion Posición del arma en el inventario
+     * @return true si se escribió, false si el archivo no admite el registro
+     */
+    bool escribirArma(const InterfazArmas& arma, uint64_t idPersonaje, int posicion);
+
+    /**
+     * @brief Escribe un registro con el resultado de un duelo
+     * @param resultado Resultado a exportar
+     * @return true si se escribió, false si el archivo no admite el registro
+     */
+    bool escribirResultadoDuelo(const ResultadoDuelo& resultado);
+
+    /**
+     * @brief Escribe cada personaje de un grupo con ids consecutivos
+     * @param personajes Personajes a exportar
+     * @param primerId Id del primer personaje
+     * @return Cantidad de personajes escritos
+     */
+    size_t escribirPersonajes(const vector<shared_ptr<InterfazPersonaje>>& personajes, uint64_t primerId = 0);
+
+    /**
+     * @brief Escribe las armas de cada personaje de un grupo con ids consecutivos
+     * @param personajes Personajes cuyas armas se exportan
+     * @param primerId Id del primer personaje
+     * @return Cantidad de armas escritas
+     */
+    size_t escribirArmas(const vector<shared_ptr<InterfazPersonaje>>& personajes, uint64_t primerId = 0);
+
+    /**
+     * @brief Vuelca el contenido del buffer al archivo
+     * @return true si la escritura fue correcta
+     */
+    bool vaciar();
+
+    /**
+     * @brief Obtiene la cantidad de registros escritos desde la apertura
+     * @return Cantidad de registros
+     */
+    uint64_t getRegistrosEscritos() const;
+
+    /**
+     * @brief Obtiene la cantidad de bytes generados desde la apertura
+     * @return Cantidad de bytes
+     */
+    uint64_t getBytesEscritos() const;
+
+private:
+    /**
+     * @brief Tipos de registro, usados para el encabezado CSV y el campo "registro"
+     */
+    enum class TipoRegistro { Ninguno, Personaje, Arma, Duelo };
+
+    FormatoExportacion formato;
+    ofstream archivo;
+    vector<char> buffer;
+    size_t usado;
+    TipoRegistro tipoActual;
+    bool errorEscritura;
+    bool omitirEncabezado;   // true al agregar a un CSV que ya tiene encabezado
+    uint64_t registrosEscritos;
+    uint64_t bytesEscritos;
+    size_t campoActual;
+
+    /**
+     * @brief Prepara el comienzo de un registro (encabezado CSV, llave y tipo NDJSON)
+     * @param tipo Tipo del registro
+     * @return false si el archivo no está abierto o el tipo no coincide en CSV
+     */
+    bool comenzarRegistro(TipoRegistro tipo);
+
+    /**
+     * @brief Cierra el registro actual con su fin de línea
+     */
+    void terminarRegistro();
+
+    /**
+     * @brief Garantiza espacio libre en el buffer, volcándolo o agrandándolo si hace falta
+     * @param bytes Cantidad de bytes necesarios
+     */
+    void asegurarEspacio(size_t bytes);
+
+    /**
+     * @brief Copia texto tal cual al buffer
+     * @param texto Texto a copiar
+     */
+    void agregarCrudo(string_view texto);
+
+    /**
+     * @brief Escribe el separador y, en NDJSON, la clave del campo
+     * @param clave Nombre del campo
+     */
+    void separarCampo(const char* clave);
+
+    void campoEntero(const char* clave, int64_t valor);
+    void campoDecimal(const char* clave, double valor);
+    void campoTexto(const char* clave, string_view valor);
+    void campoBooleano(const char* clave, bool valor);
+};
@@ -0,0 +1,110 @@
+#include "GeneradorLotes.hpp"
+#include <utility>
+
+/**
+ * @brief Finalizador de SplitMix64
+ *
+ * Convierte un contador en un valor de 64 bits bien mezclado. Al depender
+ * solo de su entrada, cada iteración del bucle es independiente.
+ *
+ * @param x Valor a mezclar
+ * @return Valor mezclado
+ */
+static inline uint64_t mezclarSplitMix64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+static const uint64_t INCREMENTO_DORADO = 0x9E3779B97F4A7C15ULL;
+
+// ==========================================
+// COLUMNAS DE ATRIBUTOS
+// ==========================================
+
+/**
+ * @brief Implementación del método redimensionar
+ * @param cantidad Cantidad de personajes del lote
+ */
+void ColumnasAtributos::redimensionar(size_t cantidad) {
+    nivel.resize(cantidad);
+    hp.resize(cantidad);
+    raza.resize(cantidad);
+    fuerza.resize(cantidad);
+    destreza.resize(cantidad);
+    constitucion.resize(cantidad);
+    inteligencia.resize(cantidad);
+    recurso.resize(cantidad);
+    indiceNombre.resize(cantidad);
+}
+
+size_t ColumnasAtributos::getCantidad() const { return nivel.size(); }
+
+/**
+ * @brief Implementación del método getFila
+ * @param indice Fila a copiar
+ * @return Atributos de esa fila
+ */
+FilaAtributos ColumnasAtributos::getFila(size_t indice) const {
+    return FilaAtributos{nivel[indice], hp[indice], raza[indice], fuerza[indice], destreza[indice],
+                         constitucion[indice], inteligencia[indice], recurso[indice], indiceNombre[indice]};
+}
+
+// ==========================================
+// GENERADOR POR LOTES
+// ==========================================
+
+/**
+ * @brief Implementación del constructor de GeneradorLotes
+ */
+GeneradorLotes::GeneradorLotes(uint64_t semillaInicial)
+    : semilla(mezclarSplitMix64(semillaInicial)), contador(0) {}
+
+/**
+ * @brief Implementación del método llenarEnteros
+ *
+ * Para cada posición i calcula SplitMix64(semilla + (contador + i) * dorado),
+ * toma los 32 bits altos y los escala al rango con una multiplicación de
+ * 64 bits y un desplazamiento (método de Lemire).
+ *
+ * @param destino Arreglo a llenar
+ * @param cantidad Cantidad de elementos
+ * @param min Valor mínimo
+ * @param max Valor máximo
+ */
+void GeneradorLotes::llenarEnteros(int* destino, size_t cantidad, int min, int max) {
+    if (min > max) {
+        std::swap(min, max);
+    }
+
+    const uint64_t rango = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+    const uint64_t base = semilla + contador * INCREMENTO_DORADO;
+
+    for (size_t i = 0; i < cantidad; ++i) {
+        uint64_t x = mezclarSplitMix64(base + static_cast<uint64_t>(i) * INCREMENTO_DORADO);
+        uint64_t alto = x >> 32;
+        destino[i] = min + static_cast<int>((alto * rango) >> 32);
+    }
+
+    contador += cantidad;
+}
+
+/**
+ * @brief Implementación del método llenarColumna
+ * @param columna Vector a llenar
+ * @param min Valor mínimo
+ * @param max Valor máximo
+ */
+void GeneradorLotes::llenarColumna(vector<int>& columna, int min, int max) {
+    llenarEnteros(columna.data(), columna.size(), min, max);
+}
+
+/**
+ * @brief Implementación del método siguiente
+ * @return Valor aleatorio de 64 bits
+ */
+uint64_t GeneradorLotes::siguiente() {
+    uint64_t x = mezclarSplitMix64(semilla + contador * INCREMENTO_DORADO);
+    ++contador;
+    return x;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Atributos base de un solo personaje
+ *
+ * Es una fila de ColumnasAtributos; la creación individual la llena en la
+ * pila, sin reservar memoria.
+ */
+struct FilaAtributos {
+    int nivel;
+    int hp;
+    int raza;
+    int fuerza;
+    int destreza;
+    int constitucion;
+    int inteligencia;
+    int recurso;
+    int indiceNombre;
+};
+
+/**
+ * @brief Atributos base de un lote de personajes, guardados por columnas
+ *
+ * Cada vector tiene un elemento por personaje. Los valores son los mismos
+ * que recibiría el constructor en crearPersonaje (antes de los bonus que
+ * aplican las subclases).
+ */
+struct ColumnasAtributos {
+    vector<int> nivel;
+    vector<int> hp;
+    vector<int> raza;
+    vector<int> fuerza;
+    vector<int> destreza;
+    vector<int> constitucion;
+    vector<int> inteligencia;
+    vector<int> recurso;       // maná para magos, estamina para guerreros
+    vector<int> indiceNombre;  // índice en la lista de nombres de la fábrica
+
+    /**
+     * @brief Redimensiona todas las columnas
+     * @param cantidad Cantidad de personajes del lote
+     */
+    void redimensionar(size_t cantidad);
+
+    /**
+     * @brief Obtiene la cantidad de personajes del lote
+     * @return Cantidad de filas
+     */
+    size_t getCantidad() const;
+
+    /**
+     * @brief Copia los atributos de un personaje del lote
+     * @param indice Fila a copiar
+     * @return Atributos de esa fila
+     */
+    FilaAtributos getFila(size_t indice) const;
+};
+
+/**
+ * @brief Generador de números aleatorios por lotes para la creación masiva
+ *
+ * En lugar de llamar a rand() y aplicar un módulo por cada atributo, llena
+ * una columna completa de enteros acotados en un solo bucle escalar. Cada
+ * posición se calcula con SplitMix64 a partir de un contador y se acota con
+ * la reducción por multiplicación de Lemire (sin divisiones). La ganancia
+ * frente a obtenerNumeroAleatorio sale de no pasar por el bloqueo interno
+ * de rand(), el módulo y las comprobaciones de cada llamada; no depende de
+ * que el compilador vectorice el bucle.
+ */
+class GeneradorLotes {
+public:
+    /**
+     * @brief Constructor del generador
+     * @param semilla Semilla de 64 bits del lote
+     */
+    explicit GeneradorLotes(uint64_t semilla);
+
+    /**
+     * @brief Llena un arreglo con enteros uniformes en [min, max]
+     *
+     * El sesgo de la reducción de Lemire sin rechazo es de a lo sumo
+     * (max - min + 1) / 2^32, despreciable para rangos de atributos.
+     *
+     * @param destino Arreglo a llenar
+     * @param cantidad Cantidad de elementos
+     * @param min Valor mínimo
+     * @param max Valor máximo
+     */
+    void llenarEnteros(int* destino, size_t cantidad, int min, int max);
+
+    /**
+     * @brief Llena un vector completo con enteros uniformes en [min, max]
+     * @param columna Vector a llenar (se usa su tamaño actual)
+     * @param min Valor mínimo
+     * @param max Valor máximo
+     */
+    void llenarColumna(vector<int>& columna, int min, int max);
+
+    /**
+     * @brief Obtiene un único valor de 64 bits del flujo del generador
+     * @return Valor aleatorio de 64 bits
+     */
+    uint64_t siguiente();
+
+private:
+    uint64_t semilla;
+    uint64_t contador;  // Posición dentro del flujo; avanza con cada valor generado
+};
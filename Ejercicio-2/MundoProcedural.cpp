@@ -0,0 +1,90 @@
+#include "MundoProcedural.hpp"
+
+/**
+ * @brief Implementación del constructor de MundoProcedural
+ *
+ * Una capacidad de 0 se ajusta a 1 para que siempre haya lugar para el
+ * personaje recién materializado.
+ */
+MundoProcedural::MundoProcedural(uint64_t semilla, size_t capacidadCache)
+    : semillaMundo(semilla), capacidad(capacidadCache), aciertos(0), fallos(0) {
+    if (capacidad == 0) capacidad = 1;
+    cache.reserve(capacidad);
+}
+
+/**
+ * @brief Implementación del método obtenerHandle
+ * @param id Índice del personaje
+ * @return Handle con la semilla del mundo y el índice
+ */
+HandlePersonaje MundoProcedural::obtenerHandle(uint64_t id) const {
+    return HandlePersonaje{semillaMundo, id};
+}
+
+/**
+ * @brief Implementación del método getTipo
+ * @param handle Handle del personaje
+ * @return Tipo de personaje, calculado sin crear el objeto
+ */
+TipoPersonaje MundoProcedural::getTipo(const HandlePersonaje& handle) const {
+    return PersonajeFactory::tipoProcedural(handle.semilla, handle.id);
+}
+
+/**
+ * @brief Implementación del método materializar
+ *
+ * Busca el índice en la caché; si está, lo mueve al frente de la lista de
+ * uso. Si no, crea el personaje con la fábrica y, de ser necesario, expulsa
+ * la entrada menos usada recientemente. Todas las operaciones son O(1).
+ *
+ * @param handle Handle del personaje
+ * @return Puntero compartido al personaje completo
+ */
+shared_ptr<InterfazPersonaje> MundoProcedural::materializar(const HandlePersonaje& handle) {
+    // Un handle de otro mundo no se cachea: se crea y se entrega directamente
+    if (handle.semilla != semillaMundo) {
+        ++fallos;
+        return PersonajeFactory::crearPersonajeProcedural(handle.semilla, handle.id);
+    }
+
+    auto it = cache.find(handle.id);
+    if (it != cache.end()) {
+        ++aciertos;
+        ordenUso.splice(ordenUso.begin(), ordenUso, it->second.posicionUso);
+        return it->second.personaje;
+    }
+
+    ++fallos;
+    shared_ptr<InterfazPersonaje> personaje = PersonajeFactory::crearPersonajeProcedural(handle.semilla, handle.id);
+
+    if (cache.size() >= capacidad) {
+        cache.erase(ordenUso.back());
+        ordenUso.pop_back();
+    }
+
+    ordenUso.push_front(handle.id);
+    cache.emplace(handle.id, EntradaCache{personaje, ordenUso.begin()});
+    return personaje;
+}
+
+/**
+ * @brief Implementación del método limpiarCache
+ */
+void MundoProcedural::limpiarCache() {
+    cache.clear();
+    ordenUso.clear();
+}
+
+uint64_t MundoProcedural::getSemilla() const { return semillaMundo; }
+size_t MundoProcedural::getTamanioCache() const { return cache.size(); }
+size_t MundoProcedural::getAciertosCache() const { return aciertos; }
+size_t MundoProcedural::getFallosCache() const { return fallos; }
+
+/**
+ * @brief Implementación del método mostrarEstadisticas
+ */
+void MundoProcedural::mostrarEstadisticas() const {
+    cout << "Mundo procedural (semilla " << semillaMundo << ")" << endl;
+    cout << "  Personajes en caché: " << cache.size() << "/" << capacidad << endl;
+    cout << "  Aciertos: " << aciertos << " - Fallos: " << fallos << endl;
+}
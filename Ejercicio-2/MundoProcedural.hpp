@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include "PersonajeFactory.hpp"
+
+using namespace std;
+
+/**
+ * @brief Referencia liviana a un personaje procedural
+ *
+ * Solo guarda la semilla del mundo y el índice; el personaje completo se
+ * reconstruye a partir de ellos cuando hace falta.
+ */
+struct HandlePersonaje {
+    uint64_t semilla;
+    uint64_t id;
+};
+
+/**
+ * @brief Mundo de personajes generados a partir de una semilla
+ *
+ * Cada personaje queda completamente determinado por (semilla, id), así que
+ * el mundo no guarda millones de objetos en memoria: entrega handles y
+ * materializa el Guerrero/Mago armado recién cuando se lo pide (por ejemplo,
+ * al entrar en combate). Los últimos personajes materializados se conservan
+ * en una caché LRU de capacidad acotada.
+ */
+class MundoProcedural {
+public:
+    /**
+     * @brief Constructor del mundo procedural
+     * @param semilla Semilla de 64 bits que determina a todos los personajes
+     * @param capacidadCache Cantidad máxima de personajes materializados en caché
+     */
+    MundoProcedural(uint64_t semilla, size_t capacidadCache = 1024);
+
+    /**
+     * @brief Obtiene el handle del personaje con el índice dado
+     * @param id Índice del personaje
+     * @return Handle liviano del personaje
+     */
+    HandlePersonaje obtenerHandle(uint64_t id) const;
+
+    /**
+     * @brief Obtiene el tipo de un personaje sin materializarlo
+     * @param handle Handle del personaje
+     * @return Tipo de personaje
+     */
+    TipoPersonaje getTipo(const HandlePersonaje& handle) const;
+
+    /**
+     * @brief Materializa el personaje de un handle, usando la caché si ya estaba
+     *
+     * Si el personaje no está en caché se crea con la fábrica y, si la caché
+     * está llena, se descarta el usado hace más tiempo. Quien conserve el
+     * puntero compartido lo mantiene vivo aunque salga de la caché.
+     *
+     * @param handle Handle del personaje
+     * @return Puntero compartido al personaje completo
+     */
+    shared_ptr<InterfazPersonaje> materializar(const HandlePersonaje& handle);
+
+    /**
+     * @brief Vacía la caché de personajes materializados
+     */
+    void limpiarCache();
+
+    /**
+     * @brief Obtiene la semilla del mundo
+     * @return Semilla de 64 bits
+     */
+    uint64_t getSemilla() const;
+
+    /**
+     * @brief Obtiene la cantidad de personajes en caché
+     * @return Cantidad de entradas en caché
+     */
+    size_t getTamanioCache() const;
+
+    /**
+     * @brief Obtiene la cantidad de materializaciones resueltas desde la caché
+     * @return Cantidad de aciertos
+     */
+    size_t getAciertosCache() const;
+
+    /**
+     * @brief Obtiene la cantidad de materializaciones que tuvieron que crear el personaje
+     * @return Cantidad de fallos
+     */
+    size_t getFallosCache() const;
+
+    /**
+     * @brief Muestra el estado de la caché por consola
+     */
+    void mostrarEstadisticas() const;
+
+private:
+    /**
+     * @brief Entrada de la caché: personaje y su posición en la lista de uso
+     */
+    struct EntradaCache {
+        shared_ptr<InterfazPersonaje> personaje;
+        list<uint64_t>::iterator posicionUso;
+    };
+
+    uint64_t semillaMundo;
+    size_t capacidad;
+    list<uint64_t> ordenUso;                       // Frente: usado más recientemente
+    unordered_map<uint64_t, EntradaCache> cache;  // id -> entrada
+    size_t aciertos;
+    size_t fallos;
+};
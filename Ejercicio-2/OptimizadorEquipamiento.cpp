@@ -0,0 +1,385 @@
+#include "OptimizadorEquipamiento.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <thread>
+
+/**
+ * @brief Implementación del constructor de OptimizadorEquipamiento
+ *
+ * Precalcula la probabilidad de ganar según los golpes que le faltan a
+ * cada uno. Los empates no cambian quién gana, así que cada ronda
+ * decisiva es una moneda: P(k, l) = (P(k-1, l) + P(k, l-1)) / 2.
+ *
+ * @param rivales Rivales y sus pesos
+ * @param hilos Hilos para indexar y para equipar rosters
+ */
+OptimizadorEquipamiento::OptimizadorEquipamiento(const vector<RivalObjetivo>& rivales, int hilos)
+    : hilos(max(1, hilos)) {
+    const int lado = MAX_GOLPES + 1;
+    vector<double> probabilidad(lado * lado, 0.0);
+    for (int k = 0; k < lado; ++k) {
+        for (int l = 0; l < lado; ++l) {
+            if (k == 0 || l == 0) {
+                probabilidad[k * lado + l] = (k == 0 && l > 0) ? 1.0 : 0.0;
+            } else {
+                probabilidad[k * lado + l] = 0.5 * (probabilidad[(k - 1) * lado + l] + probabilidad[k * lado + l - 1]);
+            }
+        }
+    }
+
+    vector<RivalObjetivo> distribucion;
+    double pesoTotal = 0.0;
+    for (const RivalObjetivo& rival : rivales) {
+        if (rival.peso > 0.0) {
+            distribucion.push_back(rival);
+            pesoTotal += rival.peso;
+        }
+    }
+    if (distribucion.empty()) {
+        distribucion.push_back(RivalObjetivo{static_cast<double>(DANIO_BASE_DUELO), 1.0});
+        pesoTotal = 1.0;
+    }
+
+    victoriaPorGolpes.fill(0.0);
+    for (const RivalObjetivo& rival : distribucion) {
+        int golpesRival = static_cast<int>(ceil(VIDA_DUELO / max(1.0, rival.danioPorGolpe) - 1e-9));
+        golpesRival = clamp(golpesRival, 1, MAX_GOLPES);
+        for (int k = 0; k < lado; ++k) {
+            victoriaPorGolpes[k] += rival.peso / pesoTotal * probabilidad[k * lado + golpesRival];
+        }
+    }
+}
+
+/**
+ * @brief Implementación de enParalelo
+ *
+ * Cada hilo recibe un bloque contiguo; el hilo que llama procesa el último.
+ */
+template <typename Tarea>
+void OptimizadorEquipamiento::enParalelo(size_t cantidad, Tarea tarea) const {
+    const size_t bloques = min<size_t>(static_cast<size_t>(hilos), max<size_t>(1, cantidad));
+    vector<thread> auxiliares;
+    for (size_t h = 0; h + 1 < bloques; ++h) {
+        auxiliares.emplace_back(tarea, cantidad * h / bloques, cantidad * (h + 1) / bloques);
+    }
+    tarea(cantidad * (bloques - 1) / bloques, cantidad);
+    for (thread& auxiliar : auxiliares) {
+        auxiliar.join();
+    }
+}
+
+RivalObjetivo OptimizadorEquipamiento::describirRival(const InterfazPersonaje& rival, const InterfazArmas* arma,
+                                                      double peso) {
+    if (!arma) {
+        return RivalObjetivo{static_cast<double>(DANIO_BASE_DUELO), peso};
+    }
+    EvaluadorDanio evaluadorRival;
+    return RivalObjetivo{danioPorGolpe(evaluadorRival.evaluar(rival, *arma)), peso};
+}
+
+/**
+ * @brief Implementación del método indexar
+ *
+ * Lo que no depende del personaje (mayor resultado posible y usos) se
+ * calcula en paralelo por bloques; después se ordena una sola vez.
+ *
+ * @param pool Armas candidatas
+ */
+void OptimizadorEquipamiento::indexar(const vector<const InterfazArmas*>& pool) {
+    this->pool = pool;
+    evaluador.limpiar();
+    candidatas.clear();
+    for (uint32_t posicion = 0; posicion < pool.size(); ++posicion) {
+        if (pool[posicion]) {
+            candidatas.push_back(Candidata{posicion, 0, 0});
+        }
+    }
+
+    enParalelo(candidatas.size(), [this](size_t desde, size_t hasta) {
+        for (size_t i = desde; i < hasta; ++i) {
+            const InterfazArmas& arma = *this->pool[candidatas[i].posicion];
+            DistribucionDanio distribucion = arma.estimarUso();
+            candidatas[i].valorMaximo = *max_element(distribucion.valores, distribucion.valores + distribucion.cantidad);
+            candidatas[i].usos = arma.estimarUsosRestantes();
+        }
+    });
+    sort(candidatas.begin(), candidatas.end(), [](const Candidata& a, const Candidata& b) {
+        if (a.valorMaximo != b.valorMaximo) return a.valorMaximo > b.valorMaximo;
+        if (a.usos != b.usos) return a.usos > b.usos;
+        return a.posicion < b.posicion;
+    });
+
+    todas.resize(candidatas.size());
+    iota(todas.begin(), todas.end(), 0u);
+}
+
+Equipamiento OptimizadorEquipamiento::optimizar(const InterfazPersonaje& personaje) {
+    ultimos = Contadores{};
+    return buscarMejor(personaje, evaluador, todas, nullptr, ultimos);
+}
+
+/**
+ * @brief Implementación del método optimizarRoster
+ *
+ * Cada parte tiene su propio evaluador y su propio arreglo de saltos, y
+ * cada personaje se lee desde un único hilo, así que no hace falta
+ * sincronizar nada.
+ *
+ * @param roster Personajes a equipar
+ * @param resultado Se reemplaza por un equipamiento por personaje
+ * @return Cantidad de personajes que recibieron al menos un arma
+ */
+size_t OptimizadorEquipamiento::optimizarRoster(const vector<InterfazPersonaje*>& roster,
+                                                vector<Equipamiento>& resultado) {
+    resultado.assign(roster.size(), Equipamiento{NINGUNA, NINGUNA, 0.0});
+    array<vector<uint32_t>, PARTICIONES> partes;
+    for (uint32_t k = 0; k < candidatas.size(); ++k) {
+        partes[k % PARTICIONES].push_back(k);
+    }
+
+    array<Contadores, PARTICIONES> contadores{};
+    enParalelo(PARTICIONES, [this, &roster, &resultado, &partes, &contadores](size_t desde, size_t hasta) {
+        for (size_t parte = desde; parte < hasta; ++parte) {
+            EvaluadorDanio evaluadorParte;
+            vector<uint32_t> siguiente(partes[parte].size() + 1);
+            iota(siguiente.begin(), siguiente.end(), 0u);
+            for (size_t i = parte; i < roster.size(); i += PARTICIONES) {
+                if (roster[i]) {
+                    resultado[i] = buscarMejor(*roster[i], evaluadorParte, partes[parte], &siguiente, contadores[parte]);
+                }
+            }
+        }
+    });
+
+    ultimos = Contadores{};
+    for (const Contadores& parcial : contadores) {
+        ultimos.evaluados += parcial.evaluados;
+        ultimos.revisadas += parcial.revisadas;
+    }
+    return count_if(resultado.begin(), resultado.end(),
+                    [](const Equipamiento& equipamiento) { return equipamiento.equipada != NINGUNA; });
+}
+
+/**
+ * @brief Implementación del método equiparRoster
+ *
+ * Indexa las armas disponibles, resuelve el roster y recién entonces
+ * entrega las armas elegidas (la equipada primero). Si la armería no
+ * puede entregar un arma (el personaje no tiene lugar), ese lugar queda
+ * en NINGUNA; si solo llegó la reserva, pasa a ser la equipada, y la
+ * probabilidad de victoria se recalcula con lo que el personaje recibió.
+ * Al terminar el pool queda vacío: sus armas ya no están en la armería.
+ *
+ * @param roster Personajes a equipar
+ * @param armeria Armería de la que salen las armas
+ * @param resultado Se reemplaza por un equipamiento por personaje, con identificadores de la armería
+ * @return Cantidad de personajes que recibieron al menos un arma
+ */
+size_t OptimizadorEquipamiento::equiparRoster(const vector<InterfazPersonaje*>& roster, Armeria& armeria,
+                                              vector<Equipamiento>& resultado) {
+    vector<uint32_t> ids;
+    armeria.buscar(ConsultaArmeria{}, ids);
+    vector<const InterfazArmas*> disponibles(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        disponibles[i] = armeria.getArma(ids[i]);
+    }
+    indexar(disponibles);
+
+    optimizarRoster(roster, resultado);
+    size_t equipados = 0;
+    for (size_t i = 0; i < roster.size(); ++i) {
+        Equipamiento& equipamiento = resultado[i];
+        bool completo = true;
+        if (equipamiento.equipada != NINGUNA) {
+            equipamiento.equipada = ids[equipamiento.equipada];
+            if (!armeria.entregar(equipamiento.equipada, *roster[i])) {
+                equipamiento.equipada = NINGUNA;
+                completo = false;
+            }
+        }
+        if (equipamiento.reserva != NINGUNA) {
+            equipamiento.reserva = ids[equipamiento.reserva];
+            if (!armeria.entregar(equipamiento.reserva, *roster[i])) {
+                equipamiento.reserva = NINGUNA;
+                completo = false;
+            }
+        }
+        if (!completo) {
+            if (equipamiento.equipada == NINGUNA) {
+                swap(equipamiento.equipada, equipamiento.reserva);
+            }
+            equipamiento.victoria = probabilidadVictoria(*roster[i], roster[i]->getArma(0), roster[i]->getArma(1));
+        }
+        if (equipamiento.equipada != NINGUNA) ++equipados;
+    }
+    indexar({});
+    return equipados;
+}
+
+double OptimizadorEquipamiento::probabilidadVictoria(const InterfazPersonaje& personaje, const InterfazArmas* equipada,
+                                                     const InterfazArmas* reserva) {
+    double danioEquipada = equipada ? danioPorGolpe(evaluador.evaluar(personaje, *equipada)) : 1.0;
+    double danioReserva = reserva ? danioPorGolpe(evaluador.evaluar(personaje, *reserva)) : 1.0;
+    return valorar(danioEquipada, equipada ? equipada->estimarUsosRestantes() : 0,
+                   danioReserva, reserva ? reserva->estimarUsosRestantes() : 0);
+}
+
+size_t OptimizadorEquipamiento::getCandidatas() const { return candidatas.size(); }
+size_t OptimizadorEquipamiento::getEvaluados() const { return ultimos.evaluados; }
+size_t OptimizadorEquipamiento::getRevisadas() const { return ultimos.revisadas; }
+
+/**
+ * @brief Implementación de danioPorGolpe
+ * @param tabla Tabla de daño del personaje con el arma
+ * @return Daño por ronda ganada: base más un décimo del promedio entre movimientos (al menos 1)
+ */
+double OptimizadorEquipamiento::danioPorGolpe(const TablaDanio& tabla) {
+    double suma = 0.0;
+    for (const EstimacionDanio& estimacion : tabla) {
+        suma += estimacion.esperado;
+    }
+    return max(1.0, DANIO_BASE_DUELO + suma / CANTIDAD_MOVIMIENTOS / 10.0);
+}
+
+/**
+ * @brief Implementación de cotaPorGolpe
+ *
+ * Usa el mayor resultado de cada movimiento en lugar del esperado. Como el
+ * ataque nunca baja cuando sube el resultado del arma, también acota a
+ * todas las armas que vienen después en el índice.
+ *
+ * @param personaje Personaje que ataca
+ * @param arma Arma del índice
+ * @return Cota del daño por ronda ganada
+ */
+double OptimizadorEquipamiento::cotaPorGolpe(const InterfazPersonaje& personaje, const InterfazArmas& arma) {
+    double suma = 0.0;
+    for (int m = 0; m < CANTIDAD_MOVIMIENTOS; ++m) {
+        DistribucionDanio distribucion = personaje.estimarAtaque(static_cast<MovimientoCombate>(m), arma);
+        suma += *max_element(distribucion.valores, distribucion.valores + distribucion.cantidad);
+    }
+    return max(1.0, DANIO_BASE_DUELO + suma / CANTIDAD_MOVIMIENTOS / 10.0);
+}
+
+/**
+ * @brief Implementación de disponible
+ *
+ * siguiente[p] == p si la candidata p está libre; si no, apunta más
+ * adelante. Los caminos recorridos se acortan para la próxima búsqueda.
+ *
+ * @param siguiente Arreglo de saltos (con un centinela al final)
+ * @param posicion Posición desde la que buscar
+ * @return Primera posición libre desde posicion (el centinela si no hay)
+ */
+uint32_t OptimizadorEquipamiento::disponible(vector<uint32_t>& siguiente, uint32_t posicion) {
+    uint32_t libre = posicion;
+    while (siguiente[libre] != libre) {
+        libre = siguiente[libre];
+    }
+    while (siguiente[posicion] != libre) {
+        uint32_t proxima = siguiente[posicion];
+        siguiente[posicion] = libre;
+        posicion = proxima;
+    }
+    return libre;
+}
+
+/**
+ * @brief Implementación de golpesNecesarios
+ *
+ * Pega con la equipada mientras tenga usos, después con la reserva y al
+ * final con el daño base.
+ *
+ * @return Rondas ganadas que necesita para sacar VIDA_DUELO HP (como máximo MAX_GOLPES)
+ */
+int OptimizadorEquipamiento::golpesNecesarios(double danioEquipada, int usosEquipada,
+                                              double danioReserva, int usosReserva) const {
+    const double danios[3] = {danioEquipada, danioReserva, static_cast<double>(DANIO_BASE_DUELO)};
+    const int usos[3] = {usosEquipada, usosReserva, MAX_GOLPES};
+    double restante = VIDA_DUELO;
+    int golpes = 0;
+    for (int i = 0; i < 3 && restante > 1e-9; ++i) {
+        int necesarios = static_cast<int>(ceil(restante / danios[i] - 1e-9));
+        int dados = min(usos[i], necesarios);
+        golpes += dados;
+        restante -= dados * danios[i];
+    }
+    return min(golpes, MAX_GOLPES);
+}
+
+double OptimizadorEquipamiento::valorar(double danioEquipada, int usosEquipada,
+                                        double danioReserva, int usosReserva) const {
+    return victoriaPorGolpes[golpesNecesarios(danioEquipada, usosEquipada, danioReserva, usosReserva)];
+}
+
+/**
+ * @brief Implementación del método buscarMejor
+ *
+ * Recorre las candidatas libres como arma equipada y, para cada una, las
+ * siguientes como reserva (la de más daño siempre conviene equipada). Antes
+ * de evaluar un arma calcula su cota con usos ilimitados: si ni así supera
+ * al mejor equipamiento, tampoco lo supera ninguna de las que siguen y se
+ * corta el recorrido. Si la equipada alcanza sola, ninguna reserva cambia
+ * el resultado y se toma la primera libre.
+ *
+ * @return Mejor equipamiento, con posiciones del pool
+ */
+Equipamiento OptimizadorEquipamiento::buscarMejor(const InterfazPersonaje& personaje, EvaluadorDanio& evaluador,
+                                                  const vector<uint32_t>& orden, vector<uint32_t>* siguiente,
+                                                  Contadores& contadores) const {
+    const uint32_t cantidad = static_cast<uint32_t>(orden.size());
+    auto libreDesde = [siguiente](uint32_t posicion) {
+        return siguiente ? disponible(*siguiente, posicion) : posicion;
+    };
+
+    Equipamiento mejor{NINGUNA, NINGUNA, valorar(1.0, 0, 1.0, 0)};
+    uint32_t mejorEquipada = cantidad;
+    uint32_t mejorReserva = cantidad;
+    for (uint32_t i = libreDesde(0); i < cantidad; i = libreDesde(i + 1)) {
+        const Candidata& equipada = candidatas[orden[i]];
+        const InterfazArmas& armaEquipada = *pool[equipada.posicion];
+        ++contadores.revisadas;
+        if (valorar(cotaPorGolpe(personaje, armaEquipada), MAX_GOLPES, 1.0, 0) <= mejor.victoria) {
+            break;
+        }
+        double danioEquipada = danioPorGolpe(evaluador.evaluar(personaje, armaEquipada));
+        bool alcanzaSola = golpesNecesarios(danioEquipada, equipada.usos, 1.0, 0)
+            == golpesNecesarios(danioEquipada, MAX_GOLPES, 1.0, 0);
+
+        // Si la equipada alcanza sola, la reserva no cambia el resultado y no se consume
+        uint32_t j = libreDesde(i + 1);
+        if (alcanzaSola || j >= cantidad) {
+            ++contadores.evaluados;
+            double valor = valorar(danioEquipada, equipada.usos, 1.0, 0);
+            if (valor > mejor.victoria) {
+                mejor = Equipamiento{equipada.posicion, NINGUNA, valor};
+                mejorEquipada = i;
+                mejorReserva = cantidad;
+            }
+            continue;
+        }
+        for (; j < cantidad; j = libreDesde(j + 1)) {
+            const Candidata& reserva = candidatas[orden[j]];
+            const InterfazArmas& armaReserva = *pool[reserva.posicion];
+            ++contadores.revisadas;
+            if (valorar(danioEquipada, equipada.usos, cotaPorGolpe(personaje, armaReserva), MAX_GOLPES) <= mejor.victoria) {
+                break;
+            }
+            ++contadores.evaluados;
+            double valor = valorar(danioEquipada, equipada.usos,
+                                   danioPorGolpe(evaluador.evaluar(personaje, armaReserva)), reserva.usos);
+            if (valor > mejor.victoria) {
+                mejor = Equipamiento{equipada.posicion, reserva.posicion, valor};
+                mejorEquipada = i;
+                mejorReserva = j;
+            }
+        }
+    }
+
+    if (siguiente) {
+        if (mejorEquipada < cantidad) (*siguiente)[mejorEquipada] = mejorEquipada + 1;
+        if (mejorReserva < cantidad) (*siguiente)[mejorReserva] = mejorReserva + 1;
+    }
+    return mejor;
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Armeria.hpp"
+#include "../Ejercicio-1/Personajes/EvaluadorDanio.hpp"
+
+using namespace std;
+
+/**
+ * @brief Rival del que se quiere ganar, con su peso dentro de la distribución de rivales
+ */
+struct RivalObjetivo {
+    double danioPorGolpe;       ///< HP que quita por ronda ganada
+    double peso;                ///< Frecuencia relativa con la que aparece
+};
+
+/**
+ * @brief Equipamiento elegido para un personaje: arma equipada y arma de reserva
+ */
+struct Equipamiento {
+    uint32_t equipada;          ///< Posición en el pool (o identificador de la armería), NINGUNA si no hay
+    uint32_t reserva;           ///< Segunda arma del inventario, NINGUNA si no hay o la equipada alcanza sola
+    double victoria;            ///< Probabilidad de victoria esperada contra los rivales
+};
+
+/**
+ * @brief Elige las armas de un personaje que maximizan su probabilidad de ganar un duelo
+ *
+ * El duelo sigue las reglas de CombatePPT: ambos empiezan con VIDA_DUELO HP
+ * y cada ronda tiene un ganador o un empate. Quien gana la ronda pega
+ * DANIO_BASE_DUELO más un décimo del daño esperado de su ataque
+ * (EvaluadorDanio, promediado entre los tres movimientos). El arma
+ * equipada pega mientras le queden usos (estimarUsosRestantes); después
+ * pega la de reserva y, sin armas, solo el daño base.
+ *
+ * La probabilidad de ganar según los golpes que necesita el personaje se
+ * precalcula una vez por distribución de rivales, así que valorar un
+ * equipamiento cuesta unas pocas divisiones.
+ *
+ * indexar ordena el pool (en paralelo) por el mayor resultado posible de
+ * cada arma. Como las reglas de ataque de todos los personajes nunca bajan
+ * el daño cuando sube el del arma, ese orden sirve de cota para todos: la
+ * búsqueda recorre las armas en orden y corta en cuanto la cota de la
+ * siguiente no puede superar al mejor equipamiento encontrado. En la
+ * práctica revisa unas pocas armas por personaje aunque el pool tenga
+ * millones.
+ */
+class OptimizadorEquipamiento {
+public:
+    static constexpr uint32_t NINGUNA = 0xFFFFFFFFu;
+    static constexpr int VIDA_DUELO = 100;
+    static constexpr int DANIO_BASE_DUELO = 10;
+
+    /**
+     * @brief Crea el optimizador para una distribución de rivales
+     * @param rivales Rivales y sus pesos (una lista vacía equivale a un rival con daño base)
+     * @param hilos Hilos para indexar y para equipar rosters
+     */
+    OptimizadorEquipamiento(const vector<RivalObjetivo>& rivales, int hilos = 4);
+
+    /**
+     * @brief Describe un rival a partir de un personaje y el arma con la que pelea
+     * @param rival Personaje rival
+     * @param arma Arma del rival, nullptr si pelea sin arma
+     * @param peso Peso del rival en la distribución
+     * @return Rival con su daño por ronda ganada
+     */
+    static RivalObjetivo describirRival(const InterfazPersonaje& rival, const InterfazArmas* arma, double peso);
+
+    /**
+     * @brief Fija el pool de armas candidatas y lo ordena
+     * @param pool Armas candidatas (no pasan a ser propiedad del optimizador; las nulas se ignoran)
+     */
+    void indexar(const vector<const InterfazArmas*>& pool);
+
+    /**
+     * @brief Busca el mejor equipamiento de un personaje en todo el pool
+     *
+     * Las armas no se reservan: dos llamadas pueden devolver las mismas.
+     *
+     * @param personaje Personaje a equipar
+     * @return Equipamiento con posiciones del pool
+     */
+    Equipamiento optimizar(const InterfazPersonaje& personaje);
+
+    /**
+     * @brief Equipa un roster completo sin repetir armas
+     *
+     * El pool ordenado se reparte intercalado en PARTICIONES partes de
+     * calidad pareja, y el roster también (el personaje i usa la parte
+     * i % PARTICIONES). Cada parte se resuelve en orden de roster, de forma
+     * independiente y en paralelo; el resultado no depende de la cantidad
+     * de hilos.
+     *
+     * @param roster Personajes a equipar
+     * @param resultado Se reemplaza por un equipamiento por personaje, con posiciones del pool
+     * @return Cantidad de personajes que recibieron al menos un arma
+     */
+    size_t optimizarRoster(const vector<InterfazPersonaje*>& roster, vector<Equipamiento>& resultado);
+
+    /**
+     * @brief Equipa un roster con las armas disponibles de una armería y se las entrega
+     *
+     * Los personajes deben tener el inventario vacío: la primera arma que
+     * reciben queda equipada.
+     *
+     * @param roster Personajes a equipar
+     * @param armeria Armería de la que salen las armas
+     * @param resultado Se reemplaza por un equipamiento por personaje, con identificadores de la armería
+     * @return Cantidad de personajes que recibieron al menos un arma
+     */
+    size_t equiparRoster(const vector<InterfazPersonaje*>& roster, Armeria& armeria, vector<Equipamiento>& resultado);
+
+    /**
+     * @brief Probabilidad de victoria con un equipamiento dado
+     * @param personaje Personaje que pelea
+     * @param equipada Arma equipada, nullptr si no tiene
+     * @param reserva Arma de reserva, nullptr si no tiene
+     * @return Probabilidad de ganar contra la distribución de rivales
+     */
+    double probabilidadVictoria(const InterfazPersonaje& personaje, const InterfazArmas* equipada,
+                                const InterfazArmas* reserva);
+
+    size_t getCandidatas() const;
+    size_t getEvaluados() const;        ///< Equipamientos valorados en la última optimización
+    size_t getRevisadas() const;        ///< Armas recorridas en la última optimización
+
+private:
+    static constexpr int PARTICIONES = 16;
+    static constexpr int MAX_GOLPES = VIDA_DUELO;
+
+    /**
+     * @brief Arma del pool con lo que no depende del personaje
+     */
+    struct Candidata {
+        uint32_t posicion;      ///< Posición en el pool
+        int valorMaximo;        ///< Mayor resultado posible de estimarUso
+        int usos;
+    };
+
+    /**
+     * @brief Contadores de una búsqueda
+     */
+    struct Contadores {
+        size_t evaluados = 0;
+        size_t revisadas = 0;
+    };
+
+    template <typename Tarea>
+    void enParalelo(size_t cantidad, Tarea tarea) const;
+
+    static double danioPorGolpe(const TablaDanio& tabla);
+    static double cotaPorGolpe(const InterfazPersonaje& personaje, const InterfazArmas& arma);
+    static uint32_t disponible(vector<uint32_t>& siguiente, uint32_t posicion);
+
+    int golpesNecesarios(double danioEquipada, int usosEquipada, double danioReserva, int usosReserva) const;
+    double valorar(double danioEquipada, int usosEquipada, double danioReserva, int usosReserva) const;
+
+    /**
+     * @brief Búsqueda con poda sobre una lista de candidatas ordenada
+     * @param personaje Personaje a equipar
+     * @param evaluador Evaluador de daño del hilo
+     * @param orden Índices en candidatas, de mayor a menor valorMaximo
+     * @param siguiente Saltos a la próxima candidata libre (se marcan las elegidas); nullptr para no reservar
+     * @param contadores Contadores a incrementar
+     * @return Mejor equipamiento, con posiciones del pool
+     */
+    Equipamiento buscarMejor(const InterfazPersonaje& personaje, EvaluadorDanio& evaluador,
+                             const vector<uint32_t>& orden, vector<uint32_t>* siguiente,
+                             Contadores& contadores) const;
+
+    int hilos;
+    array<double, MAX_GOLPES + 1> victoriaPorGolpes;   ///< Probabilidad de ganar si hacen falta k golpes
+    vector<const InterfazArmas*> pool;
+    vector<Candidata> candidatas;                       ///< De mayor a menor valorMaximo
+    vector<uint32_t> todas;                             ///< 0..candidatas.size()-1, para buscar sin particiones
+    EvaluadorDanio evaluador;
+    Contadores ultimos;
+};
@@ -3,6 +3,8 @@
 #include <ctime>
 #include <cstdlib>
 #include <array>
+#include <limits>
+#include <stdexcept>
 
 /**
  * @brief Implementación del método crearPersonaje
@@ -245,7 +247,7 @@ unique_ptr<InterfazArmas> PersonajeFactory::crearArma(TipoArma tipo) {
     string nombre;
     int poder, durabilidad;
     double peso;
-    Rarity rareza = static_cast<Rarity>(obtenerNumeroAleatorio(0, 4)); // 0-4 para los valores de enum Rarity
+    Rarity rareza = static_cast<Rarity>(sortearBotin(TablaBotin::Rareza));
     
     // Generar valores aleatorios básicos
     poder = obtenerNumeroAleatorio(10, 50);
@@ -428,7 +430,7 @@ unique_ptr<InterfazArmas> PersonajeFactory::crearArmaAleatoria() {
  */
 unique_ptr<InterfazArmas> PersonajeFactory::crearArmaParaMago() {
     // Los magos prefieren armas mágicas (0-3)
-    int tipoArma = obtenerNumeroAleatorio(0, 3);
+    int tipoArma = sortearBotin(TablaBotin::ObjetosMagicos);
     return crearArma(static_cast<TipoArma>(tipoArma));
 }
 
@@ -441,7 +443,7 @@ unique_ptr<InterfazArmas> PersonajeFactory::crearArmaParaMago() {
  */
 unique_ptr<InterfazArmas> PersonajeFactory::crearArmaParaGuerrero() {
     // Los guerreros prefieren armas de combate (4-8)
-    int tipoArma = obtenerNumeroAleatorio(4, 8);
+    int tipoArma = static_cast<int>(TipoArma::HachaSimple) + sortearBotin(TablaBotin::ArmasDeCombate);
     return crearArma(static_cast<TipoArma>(tipoArma));
 }
 
@@ -480,25 +482,11 @@ shared_ptr<InterfazPersonaje> PersonajeFactory::crearPersonajeArmado(TipoPersona
                   tipo == TipoPersonaje::Brujo || 
                   tipo == TipoPersonaje::Nigromante);
     
-    // Añadir armas según sea apropiado para el tipo
+    // Añadir armas según sea apropiado para el tipo: la tabla de cada clase
+    // reparte por defecto 80% entre armas afines y 20% entre las demás
+    TablaBotin tablaArmas = esMago ? TablaBotin::ArmasMago : TablaBotin::ArmasGuerrero;
     for (int i = 0; i < numArmas; ++i) {
-        unique_ptr<InterfazArmas> arma;
-        
-        if (esMago) {
-            // 80% de probabilidad de arma mágica, 20% de arma de combate
-            if (obtenerNumeroAleatorio(1, 100) <= 80) {
-                arma = crearArmaParaMago();
-            } else {
-                arma = crearArmaParaGuerrero();
-            }
-        } else {
-            // 80% de probabilidad de arma de combate, 20% de arma mágica
-            if (obtenerNumeroAleatorio(1, 100) <= 80) {
-                arma = crearArmaParaGuerrero();
-            } else {
-                arma = crearArmaParaMago();
-            }
-        }
+        unique_ptr<InterfazArmas> arma = crearArma(static_cast<TipoArma>(sortearBotin(tablaArmas)));
         
         // Equipar el arma al personaje usando move para transferir la propiedad
         personaje->agregarArma(move(arma));
@@ -605,6 +593,814 @@ shared_ptr<InterfazPersonaje> PersonajeFactory::crearPersonajeModoCombtePPT(Tipo
     return personaje;
 }
 
+// ==========================================
+// CREACION POR PROTOTIPOS (CLONACION)
+// ==========================================
+
+/**
+ * @brief Rango [min, max] de un atributo generado aleatoriamente
+ */
+struct RangoAtributo {
+    int min;
+    int max;
+};
+
+/**
+ * @brief Rangos de los atributos base de cada arquetipo de personaje
+ * 
+ * Son los mismos rangos que usa crearPersonaje. El prototipo se construye con
+ * los mínimos y cada clon suma una variación en [0, max - min], de modo que los
+ * bonus que aplican los constructores (resistencia física, corrupción, etc.)
+ * se conservan en la copia.
+ */
+struct RangosArquetipo {
+    RangoAtributo fuerza;
+    RangoAtributo destreza;
+    RangoAtributo constitucion;
+    RangoAtributo inteligencia;
+    RangoAtributo recurso; // maná para magos, estamina para guerreros
+};
+
+// Indexado por TipoPersonaje
+static const array<RangosArquetipo, 9> RANGOS_ARQUETIPO = {{
+    {{7, 12},  {10, 15}, {8, 14},  {15, 20}, {100, 150}}, // Hechicero
+    {{6, 11},  {9, 14},  {7, 13},  {16, 20}, {100, 140}}, // Conjurador
+    {{8, 13},  {7, 12},  {9, 15},  {14, 19}, {80, 120}},  // Brujo
+    {{7, 11},  {6, 12},  {10, 14}, {16, 20}, {90, 130}},  // Nigromante
+    {{16, 20}, {12, 16}, {14, 18}, {6, 10},  {90, 120}},  // Barbaro
+    {{15, 19}, {10, 14}, {13, 17}, {12, 16}, {80, 110}},  // Paladin
+    {{14, 18}, {11, 15}, {13, 17}, {10, 14}, {85, 110}},  // Caballero
+    {{13, 17}, {14, 18}, {10, 14}, {8, 12},  {70, 100}},  // Mercenario
+    {{15, 19}, {13, 17}, {14, 18}, {7, 11},  {80, 110}}   // Gladiador
+}};
+
+static const RangoAtributo RANGO_NIVEL = {5, 10};
+static const RangoAtributo RANGO_HP = {80, 130};
+
+// Prefijo del nombre de cada arma, indexado por TipoArma
+static const array<string, 9> PREFIJOS_ARMA = {
+    "Bastón de ", "Grimorio de ", "Poción de ", "Amuleto de ",
+    "Hacha de ", "Hacha Doble de ", "Espada de ", "Lanza de ", "Garrote de "
+};
+
+/**
+ * @brief Implementación del método construirPrototipoPersonaje
+ * 
+ * Construye el arquetipo de cada tipo con los mínimos de RANGOS_ARQUETIPO y
+ * valores intermedios para los atributos específicos de la subclase. Es la
+ * única vez que se ejecuta el constructor completo para ese tipo.
+ * 
+ * @param tipo Tipo de personaje
+ * @return Puntero único al prototipo construido
+ */
+unique_ptr<InterfazPersonaje> PersonajeFactory::construirPrototipoPersonaje(TipoPersonaje tipo) {
+    const RangosArquetipo& r = RANGOS_ARQUETIPO[static_cast<int>(tipo)];
+    const string nombre = "Arquetipo";
+    const int nivel = RANGO_NIVEL.min;
+    const int hp = RANGO_HP.min;
+
+    switch (tipo) {
+        case TipoPersonaje::Hechicero:
+            return make_unique<Hechicero>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EscuelaMagia::Evocacion, FuentePoder::Arcana,
+                15, false, 7, "Sombra"
+            );
+        case TipoPersonaje::Conjurador:
+            return make_unique<Conjurador>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EscuelaMagia::Conjuracion, FuentePoder::Elemental,
+                12, false, 22, "Elemental de Fuego"
+            );
+        case TipoPersonaje::Brujo:
+            return make_unique<Brujo>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EscuelaMagia::Necromancia, FuentePoder::Infernal,
+                "Señor del Abismo", 20, 15, true
+            );
+        case TipoPersonaje::Nigromante:
+            return make_unique<Nigromante>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EscuelaMagia::Necromancia, FuentePoder::Infernal,
+                20, 30, false, 15
+            );
+        case TipoPersonaje::Barbaro:
+            return make_unique<Barbaro>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EstiloCombate::Berserker, TipoArmadura::Media,
+                11, 12, 15, 22, "¡Por mi clan!", 15
+            );
+        case TipoPersonaje::Paladin:
+            return make_unique<Paladin>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EstiloCombate::Defensivo, TipoArmadura::Pesada,
+                12, 15, 40, "Luz del Alba", 20, true, 30
+            );
+        case TipoPersonaje::Caballero:
+            return make_unique<Caballero>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EstiloCombate::Equilibrado, TipoArmadura::Pesada,
+                12, 12, 32, "Por el Reino", true, 20, "Orden del Dragón"
+            );
+        case TipoPersonaje::Mercenario:
+            return make_unique<Mercenario>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EstiloCombate::Agresivo, TipoArmadura::Media,
+                15, 10, 125, 15, 11, "Compañía Negra"
+            );
+        case TipoPersonaje::Gladiador:
+        default:
+            return make_unique<Gladiador>(
+                nombre, nivel, hp, Raza::Humano, r.fuerza.min, r.destreza.min, r.constitucion.min, r.inteligencia.min,
+                r.recurso.min, EstiloCombate::Agresivo, TipoArmadura::Media,
+                15, 10, 15, 10, 2, "Arena del León", "El Implacable"
+            );
+    }
+}
+
+/**
+ * @brief Implementación del método construirPrototipoArma
+ * 
+ * Construye el arquetipo de cada tipo de arma con valores representativos.
+ * Los atributos base (poder, durabilidad, peso, rareza y nombre) se vuelven
+ * a sortear en cada clon.
+ * 
+ * @param tipo Tipo de arma
+ * @return Puntero único al prototipo construido
+ */
+unique_ptr<InterfazArmas> PersonajeFactory::construirPrototipoArma(TipoArma tipo) {
+    switch (tipo) {
+        case TipoArma::Baston:
+            return make_unique<Baston>("Bastón", 30, 100, 2.0, Rarity::Comun,
+                                       65, TipoMadera::Roble, TipoGema::Rubi, 8, ElementoMagico::Fuego);
+        case TipoArma::LibroHechizos: {
+            auto libro = make_unique<LibroHechizos>("Grimorio", 30, 100, 1.5, Rarity::Comun,
+                                                    100, 300, IdiomaLibro::Comun, MaterialCubierta::Cuero);
+            libro->aprenderHechizo("Misiles Mágicos");
+            return libro;
+        }
+        case TipoArma::Pocion:
+            return make_unique<Pocion>("Poción", 30, 100, 0.5, Rarity::Comun,
+                                       0, EfectoPocion::Curacion, 30, 3, ColorPocion::Rojo, false);
+        case TipoArma::Amuleto:
+            return make_unique<Amuleto>("Amuleto", 30, 100, 0.5, Rarity::Comun,
+                                        50, "Protección", 15, MaterialAmuleto::Plata, false);
+        case TipoArma::HachaSimple:
+            return make_unique<HachaSimple>("Hacha", 30, 100, 2.5, Rarity::Comun,
+                                            65, TipoMango::Madera, 1.0, true, 10, "Forjada en la Ciudadela");
+        case TipoArma::HachaDoble:
+            return make_unique<HachaDoble>("Hacha Doble", 30, 100, 4.0, Rarity::Comun,
+                                           65, 1.0, 6, true, "Inscripción rúnica antigua", 17);
+        case TipoArma::Espada:
+            return make_unique<Espada>("Espada", 30, 100, 1.8, Rarity::Comun,
+                                       75, TipoHojaEspada::Recta, MaterialGuarda::Acero, 1.0, 12, EstiloEsgrima::UnaMano);
+        case TipoArma::Lanza:
+            return make_unique<Lanza>("Lanza", 30, 100, 3.0, Rarity::Comun,
+                                      55, 2.5, MaterialPuntaLanza::Acero, false, 6, true);
+        case TipoArma::Garrote:
+        default:
+            return make_unique<Garrote>("Garrote", 30, 100, 3.5, Rarity::Comun,
+                                        40, TipoMadera::Roble, true, 40.0, 20, OrigenGarrote::RamaArbol);
+    }
+}
+
+/**
+ * @brief Implementación del método obtenerPrototipoPersonaje
+ * 
+ * Los prototipos se guardan en un arreglo estático indexado por tipo y se
+ * construyen de forma perezosa la primera vez que se piden.
+ * 
+ * @param tipo Tipo de personaje
+ * @return Referencia constante al prototipo
+ */
+const InterfazPersonaje& PersonajeFactory::obtenerPrototipoPersonaje(TipoPersonaje tipo) {
+    static array<unique_ptr<InterfazPersonaje>, 9> prototipos;
+    
+    unique_ptr<InterfazPersonaje>& prototipo = prototipos[static_cast<int>(tipo)];
+    if (!prototipo) {
+        prototipo = construirPrototipoPersonaje(tipo);
+    }
+    return *prototipo;
+}
+
+/**
+ * @brief Implementación del método obtenerPrototipoArma
+ * @param tipo Tipo de arma
+ * @return Referencia constante al prototipo
+ */
+const InterfazArmas& PersonajeFactory::obtenerPrototipoArma(TipoArma tipo) {
+    static array<unique_ptr<InterfazArmas>, 9> prototipos;
+    
+    unique_ptr<InterfazArmas>& prototipo = prototipos[static_cast<int>(tipo)];
+    if (!prototipo) {
+        prototipo = construirPrototipoArma(tipo);
+    }
+    return *prototipo;
+}
+
+/**
+ * @brief Implementación del método crearPersonajeDesdePrototipo
+ * 
+ * Sortea los atributos uno por uno con obtenerNumeroAleatorio, con los
+ * rangos del arquetipo, y los aplica sobre un clon del prototipo. Nombre y
+ * raza se sortean igual que en crearPersonaje.
+ * 
+ * @param tipo Tipo de personaje a crear
+ * @return Puntero compartido al personaje clonado
+ */
+shared_ptr<InterfazPersonaje> PersonajeFactory::crearPersonajeDesdePrototipo(TipoPersonaje tipo) {
+    return clonarConAtributos(tipo, sortearFila(tipo));
+}
+
+/**
+ * @brief Implementación del método sortearFila
+ * @param tipo Tipo de personaje
+ * @return Atributos sorteados
+ */
+FilaAtributos PersonajeFactory::sortearFila(TipoPersonaje tipo) {
+    const RangosArquetipo& r = RANGOS_ARQUETIPO[static_cast<int>(tipo)];
+    
+    FilaAtributos fila;
+    fila.nivel = obtenerNumeroAleatorio(RANGO_NIVEL.min, RANGO_NIVEL.max);
+    fila.hp = obtenerNumeroAleatorio(RANGO_HP.min, RANGO_HP.max);
+    fila.raza = obtenerNumeroAleatorio(0, 4);
+    fila.fuerza = obtenerNumeroAleatorio(r.fuerza.min, r.fuerza.max);
+    fila.destreza = obtenerNumeroAleatorio(r.destreza.min, r.destreza.max);
+    fila.constitucion = obtenerNumeroAleatorio(r.constitucion.min, r.constitucion.max);
+    fila.inteligencia = obtenerNumeroAleatorio(r.inteligencia.min, r.inteligencia.max);
+    fila.recurso = obtenerNumeroAleatorio(r.recurso.min, r.recurso.max);
+    fila.indiceNombre = obtenerNumeroAleatorio(0, CANTIDAD_NOMBRES - 1);
+    return fila;
+}
+
+/**
+ * @brief Implementación del método clonarConAtributos
+ * 
+ * Clona el arquetipo y le suma a cada atributo base la diferencia entre el
+ * valor de la fila y el mínimo con el que se construyó el prototipo. Así el
+ * clon queda igual que si el constructor hubiera recibido esos valores,
+ * incluidos los bonus propios de cada subclase.
+ * 
+ * @param tipo Tipo de personaje
+ * @param atributos Atributos sorteados
+ * @return Puntero compartido al personaje clonado
+ */
+shared_ptr<InterfazPersonaje> PersonajeFactory::clonarConAtributos(TipoPersonaje tipo, const FilaAtributos& atributos) {
+    const RangosArquetipo& r = RANGOS_ARQUETIPO[static_cast<int>(tipo)];
+    unique_ptr<InterfazPersonaje> clon = obtenerPrototipoPersonaje(tipo).clonar();
+    
+    int extraNivel = atributos.nivel - RANGO_NIVEL.min;
+    int extraHP = atributos.hp - RANGO_HP.min;
+    int extraFuerza = atributos.fuerza - r.fuerza.min;
+    int extraDestreza = atributos.destreza - r.destreza.min;
+    int extraConstitucion = atributos.constitucion - r.constitucion.min;
+    int extraInteligencia = atributos.inteligencia - r.inteligencia.min;
+    int extraRecurso = atributos.recurso - r.recurso.min;
+    Raza raza = static_cast<Raza>(atributos.raza);
+    
+    // El tipo ya dice de qué rama es el arquetipo: no hace falta dynamic_cast
+    const bool esMago = tipo <= TipoPersonaje::Nigromante;
+    Mago* mago = esMago ? static_cast<Mago*>(clon.get()) : nullptr;
+    Guerrero* guerrero = esMago ? nullptr : static_cast<Guerrero*>(clon.get());
+    
+    AtributosPersonaje base = esMago ? mago->getAtributosBase() : guerrero->getAtributosBase();
+    base.raza = raza;
+    base.nivel += extraNivel;
+    base.hpMaximo += extraHP;
+    base.hpActual = numeric_limits<int>::max();   // setAtributosBase la recorta al HP máximo
+    base.fuerza += extraFuerza;
+    base.destreza += extraDestreza;
+    base.constitucion += extraConstitucion;
+    base.inteligencia += extraInteligencia;
+    base.recursoMaximo += extraRecurso;
+    base.recursoActual = base.recursoMaximo;
+    
+    clon->setNombre(obtenerNombre(esMago, atributos.indiceNombre));
+    if (esMago) {
+        mago->setAtributosBase(base);
+    } else {
+        guerrero->setAtributosBase(base);
+    }
+    
+    // Desde el puntero crudo el shared_ptr arma su bloque de control simple,
+    // sin arrastrar el deleter del unique_ptr
+    return shared_ptr<InterfazPersonaje>(clon.release());
+}
+
+/**
+ * @brief Implementación del método crearArmaDesdePrototipo
+ * 
+ * Clona el arquetipo del arma y vuelve a sortear sus atributos base con los
+ * mismos rangos que crearArma. En las pociones la durabilidad actual
+ * representa las dosis, por eso solo se recorta al nuevo máximo.
+ * 
+ * @param tipo Tipo de arma a crear
+ * @return Puntero único al arma clonada
+ */
+unique_ptr<InterfazArmas> PersonajeFactory::crearArmaDesdePrototipo(TipoArma tipo) {
+    unique_ptr<InterfazArmas> clon = obtenerPrototipoArma(tipo).clonar();
+    
+    string nombre = PREFIJOS_ARMA[static_cast<int>(tipo)] + obtenerNombreAleatorio(tipo <= TipoArma::Amuleto);
+    Rarity rareza = static_cast<Rarity>(sortearBotin(TablaBotin::Rareza));
+    int poder = obtenerNumeroAleatorio(10, 50);
+    int durabilidad = obtenerNumeroAleatorio(50, 150);
+    double peso = 0.5 + static_cast<double>(obtenerNumeroAleatorio(1, 100)) / 20.0;
+    
+    clon->setNombre(nombre);
+    if (ObjetoMagico* objeto = dynamic_cast<ObjetoMagico*>(clon.get())) {
+        int actual = objeto->getDurabilidadActual();
+        bool completo = actual == objeto->getDurabilidadMaxima();
+        objeto->setAtributosBase(rareza, poder, peso, durabilidad, completo ? durabilidad : min(actual, durabilidad),
+                                 objeto->getEnergiaArcanaMaxima(), objeto->getEnergiaArcanaActual());
+    } else if (ArmaDeCombate* arma = dynamic_cast<ArmaDeCombate*>(clon.get())) {
+        arma->setAtributosBase(rareza, poder, peso, durabilidad, durabilidad, arma->getNivelFilo());
+    }
+    
+    return clon;
+}
+
+/**
+ * @brief Implementación del método generarColumnasAtributos
+ * 
+ * Llena cada columna completa con un solo bucle del generador por lotes,
+ * usando los mismos rangos que crearPersonaje para ese tipo.
+ * 
+ * @param tipo Tipo de personaje del lote
+ * @param cantidad Cantidad de personajes
+ * @param semilla Semilla del lote
+ * @return Columnas con los atributos sorteados
+ */
+ColumnasAtributos PersonajeFactory::generarColumnasAtributos(TipoPersonaje tipo, size_t cantidad, uint64_t semilla) {
+    const RangosArquetipo& r = RANGOS_ARQUETIPO[static_cast<int>(tipo)];
+    GeneradorLotes generador(semilla);
+    
+    ColumnasAtributos columnas;
+    columnas.redimensionar(cantidad);
+    generador.llenarColumna(columnas.nivel, RANGO_NIVEL.min, RANGO_NIVEL.max);
+    generador.llenarColumna(columnas.hp, RANGO_HP.min, RANGO_HP.max);
+    generador.llenarColumna(columnas.raza, 0, 4);
+    generador.llenarColumna(columnas.fuerza, r.fuerza.min, r.fuerza.max);
+    generador.llenarColumna(columnas.destreza, r.destreza.min, r.destreza.max);
+    generador.llenarColumna(columnas.constitucion, r.constitucion.min, r.constitucion.max);
+    generador.llenarColumna(columnas.inteligencia, r.inteligencia.min, r.inteligencia.max);
+    generador.llenarColumna(columnas.recurso, r.recurso.min, r.recurso.max);
+    generador.llenarColumna(columnas.indiceNombre, 0, CANTIDAD_NOMBRES - 1);
+    return columnas;
+}
+
+/**
+ * @brief Implementación del método generarColumnasAtributosEscalar
+ * 
+ * Recorre el lote fila por fila con sortearFila, como lo haría una serie
+ * de llamadas a crearPersonajeDesdePrototipo.
+ * 
+ * @param tipo Tipo de personaje del lote
+ * @param cantidad Cantidad de personajes
+ * @return Columnas con los atributos sorteados
+ */
+ColumnasAtributos PersonajeFactory::generarColumnasAtributosEscalar(TipoPersonaje tipo, size_t cantidad) {
+    ColumnasAtributos columnas;
+    columnas.redimensionar(cantidad);
+    for (size_t i = 0; i < cantidad; ++i) {
+        FilaAtributos fila = sortearFila(tipo);
+        columnas.nivel[i] = fila.nivel;
+        columnas.hp[i] = fila.hp;
+        columnas.raza[i] = fila.raza;
+        columnas.fuerza[i] = fila.fuerza;
+        columnas.destreza[i] = fila.destreza;
+        columnas.constitucion[i] = fila.constitucion;
+        columnas.inteligencia[i] = fila.inteligencia;
+        columnas.recurso[i] = fila.recurso;
+        columnas.indiceNombre[i] = fila.indiceNombre;
+    }
+    return columnas;
+}
+
+/**
+ * @brief Implementación del método crearOleada
+ * 
+ * Sortea los atributos de toda la oleada por columnas y luego clona el
+ * arquetipo una vez por fila, evitando el costo del constructor completo
+ * y de los sorteos individuales en cada personaje.
+ * 
+ * @param tipo Tipo de personaje de la oleada
+ * @param cantidad Cantidad de personajes a generar
+ * @return Vector con los personajes generados
+ */
+vector<shared_ptr<InterfazPersonaje>> PersonajeFactory::crearOleada(TipoPersonaje tipo, int cantidad) {
+    vector<shared_ptr<InterfazPersonaje>> oleada;
+    if (cantidad <= 0) return oleada;
+    
+    // La semilla del lote sale del generador de la fábrica (reproducible en modo procedural)
+    uint64_t semilla = (static_cast<uint64_t>(obtenerNumeroAleatorio(0, INT32_MAX)) << 32)
+                     ^ static_cast<uint64_t>(obtenerNumeroAleatorio(0, INT32_MAX));
+    ColumnasAtributos columnas = generarColumnasAtributos(tipo, cantidad, semilla);
+    
+    oleada.reserve(cantidad);
+    for (int i = 0; i < cantidad; ++i) {
+        oleada.push_back(clonarConAtributos(tipo, columnas.getFila(i)));
+    }
+    return oleada;
+}
+
+// ==========================================
+// GENERACION PROCEDURAL (SEMILLA, ID)
+// ==========================================
+
+thread_local mt19937_64* PersonajeFactory::generadorDeterminista = nullptr;
+
+/**
+ * @brief Implementación del método mezclarSemilla
+ * 
+ * Aplica el finalizador de SplitMix64 sobre la semilla combinada con el
+ * índice, de modo que índices consecutivos den semillas no correlacionadas.
+ * 
+ * @param semilla Semilla de 64 bits del mundo
+ * @param id Índice del personaje
+ * @return Semilla derivada para ese personaje
+ */
+uint64_t PersonajeFactory::mezclarSemilla(uint64_t semilla, uint64_t id) {
+    uint64_t z = semilla + (id + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Implementación del método tipoProcedural
+ * @param semilla Semilla de 64 bits del mundo
+ * @param id Índice del personaje
+ * @return Tipo de personaje correspondiente a (semilla, id)
+ */
+TipoPersonaje PersonajeFactory::tipoProcedural(uint64_t semilla, uint64_t id) {
+    return static_cast<TipoPersonaje>(mezclarSemilla(semilla, id) % 9);
+}
+
+/**
+ * @brief Implementación del método crearPersonajeProcedural
+ * 
+ * Siembra un generador local con (semilla, id) y lo activa mientras se crea
+ * el personaje armado, así obtenerNumeroAleatorio deja de depender de rand().
+ * Al terminar se desactiva, aun si la creación lanza una excepción.
+ * 
+ * @param semilla Semilla de 64 bits del mundo
+ * @param id Índice del personaje dentro del mundo
+ * @return Puntero compartido al personaje materializado
+ */
+shared_ptr<InterfazPersonaje> PersonajeFactory::crearPersonajeProcedural(uint64_t semilla, uint64_t id) {
+    mt19937_64 generador(mezclarSemilla(semilla, id));
+    mt19937_64* anterior = generadorDeterminista;
+    generadorDeterminista = &generador;
+    
+    shared_ptr<InterfazPersonaje> personaje;
+    try {
+        int numArmas = obtenerNumeroAleatorio(0, 2);
+        personaje = crearPersonajeArmado(tipoProcedural(semilla, id), numArmas);
+    } catch (...) {
+        generadorDeterminista = anterior;
+        throw;
+    }
+    
+    generadorDeterminista = anterior;
+    return personaje;
+}
+
+// ==========================================
+// TABLAS DE BOTIN PONDERADAS (METODO ALIAS)
+// ==========================================
+
+// Cantidad de resultados de cada tabla, indexado por TablaBotin
+static const array<int, 5> TAMANIO_TABLA_BOTIN = {5, 4, 5, 9, 9};
+
+/**
+ * @brief Implementación del método obtenerTablaBotin
+ * 
+ * Las tablas por defecto reproducen los sorteos originales de la fábrica:
+ * rareza y tipo uniformes, y para cada clase un 80% repartido entre sus
+ * armas afines y un 20% entre las demás.
+ * 
+ * @param tabla Tabla a obtener
+ * @return Referencia a la tabla alias correspondiente
+ */
+TablaAlias& PersonajeFactory::obtenerTablaBotin(TablaBotin tabla) {
+    static array<TablaAlias, 5> tablas = {
+        TablaAlias({1, 1, 1, 1, 1}),                        // Rareza
+        TablaAlias({1, 1, 1, 1}),                           // ObjetosMagicos
+        TablaAlias({1, 1, 1, 1, 1}),                        // ArmasDeCombate
+        TablaAlias({20, 20, 20, 20, 4, 4, 4, 4, 4}),        // ArmasMago
+        TablaAlias({5, 5, 5, 5, 16, 16, 16, 16, 16})        // ArmasGuerrero
+    };
+    return tablas[static_cast<int>(tabla)];
+}
+
+/**
+ * @brief Implementación del método sortearBotin
+ * 
+ * Sortea la columna y el valor uniforme con obtenerNumeroAleatorio, de modo
+ * que la creación procedural siga siendo reproducible.
+ * 
+ * @param tabla Tabla a sortear
+ * @return Índice sorteado
+ */
+int PersonajeFactory::sortearBotin(TablaBotin tabla) {
+    const TablaAlias& alias = obtenerTablaBotin(tabla);
+    int columna = obtenerNumeroAleatorio(0, alias.getCantidad() - 1);
+    double u = static_cast<double>(obtenerNumeroAleatorio(0, 999999)) / 1000000.0;
+    return alias.muestrear(columna, u);
+}
+
+/**
+ * @brief Implementación del método configurarTablaBotin
+ * 
+ * @param tabla Tabla a configurar
+ * @param pesos Pesos de cada resultado
+ * @return true si se configuró, false si los pesos no son válidos
+ */
+bool PersonajeFactory::configurarTablaBotin(TablaBotin tabla, const vector<double>& pesos) {
+    int esperado = TAMANIO_TABLA_BOTIN[static_cast<int>(tabla)];
+    if (static_cast<int>(pesos.size()) != esperado) {
+        cerr << "Error: la tabla de botín necesita " << esperado << " pesos y se recibieron "
+             << pesos.size() << "." << endl;
+        return false;
+    }
+    
+    try {
+        obtenerTablaBotin(tabla) = TablaAlias(pesos);
+    } catch (const std::invalid_argument& e) {
+        cerr << "Error: " << e.what() << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Implementación del método getProbabilidadBotin
+ * @param tabla Tabla a consultar
+ * @param indice Índice del resultado
+ * @return Probabilidad normalizada del resultado
+ */
+double PersonajeFactory::getProbabilidadBotin(TablaBotin tabla, int indice) {
+    return obtenerTablaBotin(tabla).getProbabilidad(indice);
+}
+
+/**
+ * @brief Implementación del método generarBotin
+ * 
+ * @param tabla Tabla a sortear
+ * @param cantidad Cantidad de resultados
+ * @param semilla Semilla del generador
+ * @return Vector con los índices sorteados
+ */
+vector<int> PersonajeFactory::generarBotin(TablaBotin tabla, size_t cantidad, uint64_t semilla) {
+    mt19937_64 generador(semilla);
+    vector<int> resultado;
+    obtenerTablaBotin(tabla).muestrearLote(generador, resultado, cantidad);
+    return resultado;
+}
+
+// ==========================================
+// SNAPSHOT BINARIO DEL ROSTER
+// ==========================================
+
+/**
+ * @brief Implementación del método obtenerTipoPersonaje
+ * @param personaje Personaje a inspeccionar
+ * @return Tipo de personaje de su clase dinámica
+ */
+TipoPersonaje PersonajeFactory::obtenerTipoPersonaje(const InterfazPersonaje& personaje) {
+    const InterfazPersonaje* p = &personaje;
+    if (dynamic_cast<const Conjurador*>(p)) return TipoPersonaje::Conjurador;
+    if (dynamic_cast<const Brujo*>(p)) return TipoPersonaje::Brujo;
+    if (dynamic_cast<const Nigromante*>(p)) return TipoPersonaje::Nigromante;
+    if (dynamic_cast<const Barbaro*>(p)) return TipoPersonaje::Barbaro;
+    if (dynamic_cast<const Paladin*>(p)) return TipoPersonaje::Paladin;
+    if (dynamic_cast<const Caballero*>(p)) return TipoPersonaje::Caballero;
+    if (dynamic_cast<const Mercenario*>(p)) return TipoPersonaje::Mercenario;
+    if (dynamic_cast<const Gladiador*>(p)) return TipoPersonaje::Gladiador;
+    return TipoPersonaje::Hechicero; // Hechicero o un Mago genérico
+}
+
+/**
+ * @brief Implementación del método obtenerTipoArma
+ * @param arma Arma a inspeccionar
+ * @return Tipo de arma de su clase dinámica
+ */
+TipoArma PersonajeFactory::obtenerTipoArma(const InterfazArmas& arma) {
+    const InterfazArmas* a = &arma;
+    if (dynamic_cast<const Baston*>(a)) return TipoArma::Baston;
+    if (dynamic_cast<const LibroHechizos*>(a)) return TipoArma::LibroHechizos;
+    if (dynamic_cast<const Pocion*>(a)) return TipoArma::Pocion;
+    if (dynamic_cast<const Amuleto*>(a)) return TipoArma::Amuleto;
+    if (dynamic_cast<const HachaSimple*>(a)) return TipoArma::HachaSimple;
+    if (dynamic_cast<const HachaDoble*>(a)) return TipoArma::HachaDoble;
+    if (dynamic_cast<const Lanza*>(a)) return TipoArma::Lanza;
+    if (dynamic_cast<const Garrote*>(a)) return TipoArma::Garrote;
+    return TipoArma::Espada;
+}
+
+/**
+ * @brief Implementación del método guardarRoster
+ * 
+ * Recorre los personajes y vuelca cada uno en un registro de tamaño fijo,
+ * seguido de sus armas, sus hechizos y las listas de su subclase. El estado
+ * de subclase sale de getEstadoClase y el de cada arma de su checkpoint.
+ * Los textos se deduplican en el escritor. La escritura final es un bloque
+ * por sección.
+ * 
+ * @param ruta Ruta del archivo a escribir
+ * @param personajes Personajes a guardar
+ * @return true si se guardó correctamente
+ */
+bool PersonajeFactory::guardarRoster(const string& ruta, const vector<shared_ptr<InterfazPersonaje>>& personajes) {
+    EscritorRoster escritor;
+    
+    for (const auto& personaje : personajes) {
+        if (!personaje) continue;
+        
+        RegistroPersonaje registro{};
+        registro.tipo = static_cast<uint8_t>(obtenerTipoPersonaje(*personaje));
+        registro.nombre = escritor.agregarTexto(personaje->getNombre());
+        registro.primerArma = escritor.getCantidadArmas();
+        registro.primerHechizo = escritor.getCantidadHechizos();
+        registro.primerElemento = escritor.getCantidadElementos();
+        
+        AtributosPersonaje base;
+        EstadoClasePersonaje estadoClase;
+        if (const Mago* mago = dynamic_cast<const Mago*>(personaje.get())) {
+            base = mago->getAtributosBase();
+            estadoClase = mago->getEstadoClase();
+            registro.armaEquipada = static_cast<int8_t>(mago->getArmaEquipadaPos());
+            for (const string& hechizo : mago->getHechizosConocidos()) {
+                escritor.agregarHechizo(hechizo);
+            }
+            registro.cantidadHechizos = static_cast<uint32_t>(mago->getHechizosConocidos().size());
+        } else if (const Guerrero* guerrero = dynamic_cast<const Guerrero*>(personaje.get())) {
+            base = guerrero->getAtributosBase();
+            estadoClase = guerrero->getEstadoClase();
+            registro.armaEquipada = static_cast<int8_t>(guerrero->getArmaEquipadaPos());
+        } else {
+            continue;
+        }
+        registro.raza = static_cast<uint8_t>(base.raza);
+        registro.nivel = base.nivel;
+        registro.hpMax = base.hpMaximo;
+        registro.hpActual = base.hpActual;
+        registro.fuerza = base.fuerza;
+        registro.destreza = base.destreza;
+        registro.constitucion = base.constitucion;
+        registro.inteligencia = base.inteligencia;
+        registro.recursoMaximo = base.recursoMaximo;
+        registro.recursoActual = base.recursoActual;
+        copy(begin(estadoClase.rasgos), end(estadoClase.rasgos), registro.rasgos);
+        copy(begin(estadoClase.contadores), end(estadoClase.contadores), registro.estadoClase);
+        for (const ElementoClase& elemento : estadoClase.elementos) {
+            escritor.agregarElemento(elemento.texto, elemento.valores[0], elemento.valores[1]);
+        }
+        registro.cantidadElementos = static_cast<uint32_t>(estadoClase.elementos.size());
+        
+        // Las armas se escriben después de los hechizos del personaje
+        for (int posicion = 0; posicion < personaje->getCapacidadArmas(); ++posicion) {
+            const InterfazArmas* arma = personaje->getArma(posicion);
+            if (!arma) continue;
+            
+            RegistroArma regArma{};
+            regArma.tipo = static_cast<uint8_t>(obtenerTipoArma(*arma));
+            regArma.rareza = static_cast<uint8_t>(arma->getRareza());
+            regArma.nombre = escritor.agregarTexto(arma->getNombre());
+            regArma.poder = arma->getPoder();
+            regArma.durabilidadMaxima = arma->getDurabilidadMaxima();
+            regArma.durabilidadActual = arma->getDurabilidadActual();
+            regArma.primerHechizo = escritor.getCantidadHechizos();
+            
+            CheckpointArma estadoArma = arma->guardarCheckpoint();
+            regArma.sintonizado = estadoArma.estaSintonizado ? 1 : 0;
+            regArma.preparadaContraCarga = estadoArma.preparadaContraCarga ? 1 : 0;
+            regArma.efectoPocion = estadoArma.efectoPocion;
+            regArma.potenciaEfecto = estadoArma.potenciaEfecto;
+            
+            if (const ArmaDeCombate* combate = dynamic_cast<const ArmaDeCombate*>(arma)) {
+                regArma.peso = combate->getPeso();
+                regArma.nivelFilo = combate->getNivelFilo();
+            } else if (const ObjetoMagico* objeto = dynamic_cast<const ObjetoMagico*>(arma)) {
+                regArma.peso = objeto->getPeso();
+                regArma.energiaArcanaMaxima = objeto->getEnergiaArcanaMaxima();
+                regArma.energiaArcanaActual = objeto->getEnergiaArcanaActual();
+            }
+            if (const LibroHechizos* libro = dynamic_cast<const LibroHechizos*>(arma)) {
+                for (const string& hechizo : libro->getHechizos()) {
+                    escritor.agregarHechizo(hechizo);
+                }
+                regArma.cantidadHechizos = static_cast<uint32_t>(libro->getHechizos().size());
+            }
+            
+            escritor.agregarArma(regArma);
+            registro.cantidadArmas++;
+        }
+        
+        escritor.agregarPersonaje(registro);
+    }
+    
+    return escritor.guardar(ruta);
+}
+
+/**
+ * @brief Implementación del método armaDesdeRegistro
+ * 
+ * Los valores propios de pociones, amuletos y lanzas se aplican con
+ * restaurarCheckpoint, partiendo del checkpoint del arma ya ajustada.
+ * 
+ * @param vista Roster abierto
+ * @param registro Registro del arma
+ * @return Puntero único al arma reconstruida
+ */
+unique_ptr<InterfazArmas> PersonajeFactory::armaDesdeRegistro(const VistaRoster& vista, const RegistroArma& registro) {
+    unique_ptr<InterfazArmas> arma = obtenerPrototipoArma(static_cast<TipoArma>(registro.tipo)).clonar();
+    Rarity rareza = static_cast<Rarity>(registro.rareza);
+    
+    arma->setNombre(string(vista.getTexto(registro.nombre)));
+    if (ObjetoMagico* objeto = dynamic_cast<ObjetoMagico*>(arma.get())) {
+        objeto->setAtributosBase(rareza, registro.poder, registro.peso, registro.durabilidadMaxima,
+                                 registro.durabilidadActual, registro.energiaArcanaMaxima, registro.energiaArcanaActual);
+    } else if (ArmaDeCombate* combate = dynamic_cast<ArmaDeCombate*>(arma.get())) {
+        combate->setAtributosBase(rareza, registro.poder, registro.peso, registro.durabilidadMaxima,
+                                  registro.durabilidadActual, registro.nivelFilo);
+    }
+    
+    if (LibroHechizos* libro = dynamic_cast<LibroHechizos*>(arma.get())) {
+        vector<string> hechizos;
+        hechizos.reserve(registro.cantidadHechizos);
+        for (uint32_t h = 0; h < registro.cantidadHechizos; ++h) {
+            hechizos.emplace_back(vista.getHechizo(registro.primerHechizo + h));
+        }
+        libro->setHechizos(move(hechizos));
+    }
+    
+    CheckpointArma estado = arma->guardarCheckpoint();
+    estado.dosisRestantes = registro.durabilidadActual;  // En las pociones la durabilidad son las dosis
+    estado.potenciaEfecto = registro.potenciaEfecto;
+    estado.efectoPocion = registro.efectoPocion;
+    estado.estaSintonizado = registro.sintonizado != 0;
+    estado.preparadaContraCarga = registro.preparadaContraCarga != 0;
+    arma->restaurarCheckpoint(estado);
+    
+    return arma;
+}
+
+/**
+ * @brief Implementación del método materializarDesdeRoster
+ * 
+ * VistaRoster::abrir ya validó tipos, razas, rasgos y rangos del registro,
+ * así que se usan tal cual. El estado de clase se aplica antes que los
+ * atributos base porque la resistencia física cambia el HP máximo.
+ * 
+ * @param vista Roster abierto
+ * @param indice Índice del personaje en el roster
+ * @return Puntero compartido al personaje reconstruido
+ */
+shared_ptr<InterfazPersonaje> PersonajeFactory::materializarDesdeRoster(const VistaRoster& vista, size_t indice) {
+    const RegistroPersonaje& registro = vista.getPersonaje(indice);
+    unique_ptr<InterfazPersonaje> personaje = obtenerPrototipoPersonaje(static_cast<TipoPersonaje>(registro.tipo)).clonar();
+    
+    vector<unique_ptr<InterfazArmas>> armas;
+    for (uint32_t a = 0; a < registro.cantidadArmas; ++a) {
+        armas.push_back(armaDesdeRegistro(vista, vista.getArma(registro.primerArma + a)));
+    }
+    
+    AtributosPersonaje base{registro.nivel, registro.hpMax, registro.hpActual,
+                            static_cast<Raza>(registro.raza), registro.fuerza, registro.destreza,
+                            registro.constitucion, registro.inteligencia, registro.recursoMaximo,
+                            registro.recursoActual};
+    
+    EstadoClasePersonaje estadoClase{};
+    copy(begin(registro.rasgos), end(registro.rasgos), estadoClase.rasgos);
+    copy(begin(registro.estadoClase), end(registro.estadoClase), estadoClase.contadores);
+    estadoClase.elementos.reserve(registro.cantidadElementos);
+    for (uint32_t e = 0; e < registro.cantidadElementos; ++e) {
+        const RegistroElementoClase& elemento = vista.getElemento(registro.primerElemento + e);
+        estadoClase.elementos.push_back(ElementoClase{string(vista.getTexto(elemento.texto)),
+                                                      {elemento.valores[0], elemento.valores[1]}});
+    }
+    
+    personaje->setNombre(string(vista.getTexto(registro.nombre)));
+    if (Mago* mago = dynamic_cast<Mago*>(personaje.get())) {
+        vector<string> hechizos;
+        hechizos.reserve(registro.cantidadHechizos);
+        for (uint32_t h = 0; h < registro.cantidadHechizos; ++h) {
+            hechizos.emplace_back(vista.getHechizo(registro.primerHechizo + h));
+        }
+        mago->setEstadoClase(estadoClase);
+        mago->setAtributosBase(base);
+        mago->setHechizosConocidos(move(hechizos));
+        mago->setInventario(move(armas), registro.armaEquipada);
+    } else if (Guerrero* guerrero = dynamic_cast<Guerrero*>(personaje.get())) {
+        guerrero->setEstadoClase(estadoClase);
+        guerrero->setAtributosBase(base);
+        guerrero->setInventario(move(armas), registro.armaEquipada);
+    }
+    
+    return personaje;
+}
+
 /**
  * @brief Implementación del método obtenerNombreAleatorio
  * 
@@ -615,8 +1411,22 @@ shared_ptr<InterfazPersonaje> PersonajeFactory::crearPersonajeModoCombtePPT(Tipo
  * @return Nombre aleatorio seleccionado
  */
 string PersonajeFactory::obtenerNombreAleatorio(bool esMago) {
+    return obtenerNombre(esMago, obtenerNumeroAleatorio(0, CANTIDAD_NOMBRES - 1));
+}
+
+/**
+ * @brief Implementación del método obtenerNombre
+ * 
+ * Devuelve el nombre de la posición indicada en la lista de magos o de
+ * guerreros. Los índices fuera de rango se ajustan con módulo.
+ * 
+ * @param esMago Indica si el personaje es un mago (true) o guerrero (false)
+ * @param indice Posición en la lista de nombres
+ * @return Nombre correspondiente
+ */
+string PersonajeFactory::obtenerNombre(bool esMago, int indice) {
     // Nombres para magos
-    const array<string, 20> nombresMagos = {
+    static const array<string, CANTIDAD_NOMBRES> nombresMagos = {
         "Gandalf", "Merlin", "Morgana", "Radagast", "Elminster", 
         "Raistlin", "Medivh", "Galadriel", "Saruman", "Allanon", 
         "Jaina", "Khadgar", "Ged", "Rincewind", "Polgara", 
@@ -624,18 +1434,15 @@ string PersonajeFactory::obtenerNombreAleatorio(bool esMago) {
     };
     
     // Nombres para guerreros
-    const array<string, 20> nombresGuerreros = {
+    static const array<string, CANTIDAD_NOMBRES> nombresGuerreros = {
         "Aragorn", "Conan", "Boromir", "Bronn", "Sandor", 
         "Drizzt", "Geralt", "Gimli", "Legolas", "Turin", 
         "Thorin", "Druss", "Wulfgar", "Caramon", "Sturm", 
         "Éomer", "Fingolfin", "Fëanor", "Beren", "Túrin"
     };
     
-    if (esMago) {
-        return nombresMagos[obtenerNumeroAleatorio(0, 19)];
-    } else {
-        return nombresGuerreros[obtenerNumeroAleatorio(0, 19)];
-    }
+    indice = ((indice % CANTIDAD_NOMBRES) + CANTIDAD_NOMBRES) % CANTIDAD_NOMBRES;
+    return esMago ? nombresMagos[indice] : nombresGuerreros[indice];
 }
 
 /**
@@ -661,5 +1468,10 @@ int PersonajeFactory::obtenerNumeroAleatorio(int min, int max) {
         std::swap(min, max);
     }
     
+    // Durante una creación procedural los sorteos salen del generador sembrado
+    if (generadorDeterminista != nullptr) {
+        return min + static_cast<int>((*generadorDeterminista)() % static_cast<uint64_t>(max - min + 1));
+    }
+    
     return min + (rand() % (max - min + 1));
 }
@@ -6,6 +6,8 @@
 #include <random>
 #include <ctime>
 #include <iostream>
+#include <cstdint>
+#include <array>
 
 // Inclusión de cabeceras para personajes y armas
 #include "../Ejercicio-1/Personajes/InterfazPersonaje.hpp"
@@ -34,6 +36,10 @@
 #include "../Ejercicio-1/Arma/ArmasDeCombate/Lanza.hpp"
 #include "../Ejercicio-1/Arma/ArmasDeCombate/Garrote.hpp"
 
+#include "TablaAlias.hpp"
+#include "GeneradorLotes.hpp"
+#include "RosterBinario.hpp"
+
 using namespace std;
 
 /**
@@ -66,6 +72,22 @@ enum class TipoArma {
     Garrote
 };
 
+/**
+ * @brief Enumeración que identifica las tablas de botín ponderadas de la fábrica
+ *
+ * Rareza devuelve índices de Rarity. ObjetosMagicos devuelve índices 0-3 y
+ * ArmasDeCombate índices 0-4, que se suman a TipoArma::HachaSimple. Las
+ * tablas ArmasMago y ArmasGuerrero cubren los nueve valores de TipoArma y
+ * reemplazan al antiguo reparto 80/20 de crearPersonajeArmado.
+ */
+enum class TablaBotin {
+    Rareza = 0,
+    ObjetosMagicos,
+    ArmasDeCombate,
+    ArmasMago,
+    ArmasGuerrero
+};
+
 /**
  * @brief Estructura que almacena los resultados de la generación de personajes
  * 
@@ -170,13 +192,243 @@ public:
      */
     static shared_ptr<InterfazPersonaje> crearPersonajeModoCombtePPT(TipoPersonaje tipo, int numArmas);
 
+    // ==========================================
+    // CREACION POR PROTOTIPOS (CLONACION)
+    // ==========================================
+
+    /**
+     * @brief Crea un personaje clonando el arquetipo de su tipo y variando sus atributos
+     *
+     * El arquetipo se construye una sola vez con los valores minimos de cada rango;
+     * los clones solo suman una variacion aleatoria a los atributos base, sin volver
+     * a ejecutar el constructor completo ni sus validaciones.
+     *
+     * Solo se puede usar desde un hilo: las tablas de prototipos se construyen
+     * de forma perezosa sin sincronizacion y los sorteos usan rand() y la
+     * semilla estatica de obtenerNumeroAleatorio.
+     *
+     * @param tipo Tipo de personaje a crear
+     * @return Puntero compartido al personaje clonado
+     */
+    static shared_ptr<InterfazPersonaje> crearPersonajeDesdePrototipo(TipoPersonaje tipo);
+
+    /**
+     * @brief Crea un arma clonando el arquetipo de su tipo y variando sus atributos base
+     * @param tipo Tipo de arma a crear
+     * @return Puntero único al arma clonada
+     */
+    static unique_ptr<InterfazArmas> crearArmaDesdePrototipo(TipoArma tipo);
+
+    /**
+     * @brief Genera una oleada de personajes del mismo tipo a partir de su arquetipo
+     * @param tipo Tipo de personaje de la oleada
+     * @param cantidad Cantidad de personajes a generar
+     * @return Vector con los personajes generados
+     */
+    static vector<shared_ptr<InterfazPersonaje>> crearOleada(TipoPersonaje tipo, int cantidad);
+
+    /**
+     * @brief Sortea por columnas los atributos base de un lote de personajes
+     *
+     * Usa el generador por lotes (SplitMix64 + reducción de Lemire) en lugar
+     * de varias llamadas a obtenerNumeroAleatorio por personaje.
+     *
+     * @param tipo Tipo de personaje del lote
+     * @param cantidad Cantidad de personajes
+     * @param semilla Semilla del lote
+     * @return Columnas con los atributos sorteados
+     */
+    static ColumnasAtributos generarColumnasAtributos(TipoPersonaje tipo, size_t cantidad, uint64_t semilla);
+
+    /**
+     * @brief Sortea las mismas columnas campo por campo con obtenerNumeroAleatorio
+     *
+     * Es el camino escalar de crearPersonajeDesdePrototipo aplicado a un lote;
+     * sirve de referencia para medir generarColumnasAtributos.
+     *
+     * @param tipo Tipo de personaje del lote
+     * @param cantidad Cantidad de personajes
+     * @return Columnas con los atributos sorteados
+     */
+    static ColumnasAtributos generarColumnasAtributosEscalar(TipoPersonaje tipo, size_t cantidad);
+
+    // ==========================================
+    // GENERACION PROCEDURAL (SEMILLA, ID)
+    // ==========================================
+
+    /**
+     * @brief Crea el personaje determinado por una semilla de mundo y un indice
+     *
+     * Mientras dura la llamada, todos los sorteos de la fabrica salen de un
+     * generador sembrado con (semilla, id). Por eso la misma pareja siempre
+     * produce el mismo personaje, con las mismas armas.
+     *
+     * @param semilla Semilla de 64 bits del mundo
+     * @param id Indice del personaje dentro del mundo
+     * @return Puntero compartido al personaje materializado
+     */
+    static shared_ptr<InterfazPersonaje> crearPersonajeProcedural(uint64_t semilla, uint64_t id);
+
+    /**
+     * @brief Obtiene el tipo del personaje (semilla, id) sin materializarlo
+     * @param semilla Semilla de 64 bits del mundo
+     * @param id Indice del personaje dentro del mundo
+     * @return Tipo de personaje que se obtendria al materializarlo
+     */
+    static TipoPersonaje tipoProcedural(uint64_t semilla, uint64_t id);
+
+    // ==========================================
+    // TABLAS DE BOTIN PONDERADAS (METODO ALIAS)
+    // ==========================================
+
+    /**
+     * @brief Reemplaza los pesos de una tabla de botín
+     *
+     * Por defecto las tablas reproducen el comportamiento original: rareza y
+     * tipo de arma uniformes, y 80/20 entre armas afines y no afines.
+     *
+     * @param tabla Tabla a configurar
+     * @param pesos Pesos de cada resultado (la cantidad debe coincidir con la tabla)
+     * @return true si se configuró, false si los pesos no son válidos
+     */
+    static bool configurarTablaBotin(TablaBotin tabla, const vector<double>& pesos);
+
+    /**
+     * @brief Obtiene la probabilidad actual de un resultado en una tabla de botín
+     * @param tabla Tabla a consultar
+     * @param indice Índice del resultado
+     * @return Probabilidad normalizada del resultado
+     */
+    static double getProbabilidadBotin(TablaBotin tabla, int indice);
+
+    /**
+     * @brief Sortea una gran cantidad de resultados de una tabla de botín
+     *
+     * Usa un generador propio sembrado con la semilla dada, así que no
+     * interfiere con los sorteos de la fábrica y es reproducible.
+     *
+     * @param tabla Tabla a sortear
+     * @param cantidad Cantidad de resultados
+     * @param semilla Semilla del generador
+     * @return Vector con los índices sorteados (ver TablaBotin)
+     */
+    static vector<int> generarBotin(TablaBotin tabla, size_t cantidad, uint64_t semilla);
+
+    // ==========================================
+    // SNAPSHOT BINARIO DEL ROSTER
+    // ==========================================
+
+    /**
+     * @brief Determina el tipo concreto de un personaje
+     * @param personaje Personaje a inspeccionar
+     * @return Tipo de personaje correspondiente a su clase dinámica
+     */
+    static TipoPersonaje obtenerTipoPersonaje(const InterfazPersonaje& personaje);
+
+    /**
+     * @brief Determina el tipo concreto de un arma
+     * @param arma Arma a inspeccionar
+     * @return Tipo de arma correspondiente a su clase dinámica
+     */
+    static TipoArma obtenerTipoArma(const InterfazArmas& arma);
+
+    /**
+     * @brief Guarda personajes, estadísticas, estado de subclase, inventarios, hechizos y estado de armas en un roster binario
+     * @param ruta Ruta del archivo a escribir
+     * @param personajes Personajes a guardar
+     * @return true si se guardó correctamente, false en caso contrario
+     */
+    static bool guardarRoster(const string& ruta, const vector<shared_ptr<InterfazPersonaje>>& personajes);
+
+    /**
+     * @brief Reconstruye un personaje completo a partir de un roster mapeado
+     *
+     * Clona el arquetipo del tipo guardado y le asigna los valores del registro:
+     * nombre, raza, nivel, HP, atributos, recurso, hechizos e inventario; los
+     * rasgos de clase, los contadores de subclase (los del checkpoint) y sus
+     * listas (técnicas, contratos, pactos, maleficios y servidores); y el
+     * estado de cada arma, incluido el de pociones, amuletos y lanzas.
+     *
+     * No se guardan los modificadores activos ni los atributos de
+     * construcción de cada tipo de arma (forma de la hoja, material...), ni
+     * los textos descriptivos de las subclases (título, arena, deidad...):
+     * vuelven a los valores del arquetipo.
+     *
+     * @param vista Roster abierto
+     * @param indice Índice del personaje en el roster
+     * @return Puntero compartido al personaje reconstruido
+     */
+    static shared_ptr<InterfazPersonaje> materializarDesdeRoster(const VistaRoster& vista, size_t indice);
+
 private:
+    /**
+     * @brief Obtiene el arquetipo de un tipo de personaje, construyéndolo la primera vez
+     * @param tipo Tipo de personaje
+     * @return Referencia constante al prototipo
+     */
+    static const InterfazPersonaje& obtenerPrototipoPersonaje(TipoPersonaje tipo);
+
+    /**
+     * @brief Obtiene el arquetipo de un tipo de arma, construyéndolo la primera vez
+     * @param tipo Tipo de arma
+     * @return Referencia constante al prototipo
+     */
+    static const InterfazArmas& obtenerPrototipoArma(TipoArma tipo);
+
+    /**
+     * @brief Construye el arquetipo de un personaje con los valores mínimos de su tipo
+     * @param tipo Tipo de personaje
+     * @return Puntero único al prototipo construido
+     */
+    static unique_ptr<InterfazPersonaje> construirPrototipoPersonaje(TipoPersonaje tipo);
+
+    /**
+     * @brief Sortea con obtenerNumeroAleatorio los atributos base de un personaje
+     * @param tipo Tipo de personaje
+     * @return Atributos sorteados con los rangos del arquetipo
+     */
+    static FilaAtributos sortearFila(TipoPersonaje tipo);
+
+    /**
+     * @brief Clona el arquetipo de un tipo y le aplica una fila de atributos sorteados
+     * @param tipo Tipo de personaje
+     * @param atributos Atributos a aplicar
+     * @return Puntero compartido al personaje clonado
+     */
+    static shared_ptr<InterfazPersonaje> clonarConAtributos(TipoPersonaje tipo, const FilaAtributos& atributos);
+
+    /**
+     * @brief Reconstruye un arma a partir de su registro en un roster
+     * @param vista Roster abierto
+     * @param registro Registro del arma
+     * @return Puntero único al arma reconstruida
+     */
+    static unique_ptr<InterfazArmas> armaDesdeRegistro(const VistaRoster& vista, const RegistroArma& registro);
+
+    /**
+     * @brief Construye el arquetipo de un arma con valores representativos de su tipo
+     * @param tipo Tipo de arma
+     * @return Puntero único al prototipo construido
+     */
+    static unique_ptr<InterfazArmas> construirPrototipoArma(TipoArma tipo);
+
     /**
      * @brief Obtiene un nombre aleatorio apropiado para el tipo de personaje
      * @param esMago Indica si el personaje es un mago (true) o guerrero (false)
      * @return Nombre aleatorio del personaje
      */
     static string obtenerNombreAleatorio(bool esMago);
+
+    /**
+     * @brief Obtiene un nombre de las listas de la fábrica por posición
+     * @param esMago Indica si el personaje es un mago (true) o guerrero (false)
+     * @param indice Posición en la lista de nombres
+     * @return Nombre correspondiente
+     */
+    static string obtenerNombre(bool esMago, int indice);
+
+    /// Cantidad de nombres de cada lista (magos y guerreros)
+    static const int CANTIDAD_NOMBRES = 20;
     
     // ==========================================
     // METODO PRIVADO PARA CREAR NUMERO ALEATORIO (EJERCICIO 2 a.)
@@ -189,4 +441,29 @@ private:
      * @return Número aleatorio dentro del rango [min, max]
      */
     static int obtenerNumeroAleatorio(int min, int max);
+
+    /**
+     * @brief Mezcla la semilla del mundo con un indice (SplitMix64)
+     * @param semilla Semilla de 64 bits del mundo
+     * @param id Indice del personaje
+     * @return Semilla derivada para ese personaje
+     */
+    static uint64_t mezclarSemilla(uint64_t semilla, uint64_t id);
+
+    /**
+     * @brief Obtiene la tabla de botín pedida, construyendo los valores por defecto la primera vez
+     * @param tabla Tabla a obtener
+     * @return Referencia a la tabla alias correspondiente
+     */
+    static TablaAlias& obtenerTablaBotin(TablaBotin tabla);
+
+    /**
+     * @brief Sortea un resultado de una tabla de botín con el generador de la fábrica
+     * @param tabla Tabla a sortear
+     * @return Índice sorteado (ver TablaBotin)
+     */
+    static int sortearBotin(TablaBotin tabla);
+
+    /// Generador que reemplaza a rand() durante una creacion procedural (nullptr si no hay)
+    static thread_local mt19937_64* generadorDeterminista;
 };
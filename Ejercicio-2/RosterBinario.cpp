@@ -0,0 +1,349 @@
+#include "RosterBinario.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Redondea un desplazamiento al siguiente múltiplo de 8
+ * @param valor Desplazamiento a alinear
+ * @return Desplazamiento alineado
+ */
+static uint64_t alinearA8(uint64_t valor) {
+    return (valor + 7) & ~static_cast<uint64_t>(7);
+}
+
+// ==========================================
+// ESCRITOR DE ROSTER
+// ==========================================
+
+/**
+ * @brief Implementación del método agregarTexto
+ *
+ * Reutiliza la referencia si el mismo texto ya se había agregado.
+ *
+ * @param texto Texto a agregar
+ * @return Referencia al texto dentro del roster
+ */
+RefTexto EscritorRoster::agregarTexto(const string& texto) {
+    auto it = textosExistentes.find(texto);
+    if (it != textosExistentes.end()) {
+        return it->second;
+    }
+
+    RefTexto ref{static_cast<uint32_t>(textos.size()), static_cast<uint32_t>(texto.size())};
+    textos += texto;
+    textosExistentes.emplace(texto, ref);
+    return ref;
+}
+
+/**
+ * @brief Implementación del método agregarHechizo
+ * @param hechizo Nombre del hechizo
+ * @return Índice del hechizo en la tabla
+ */
+uint32_t EscritorRoster::agregarHechizo(const string& hechizo) {
+    hechizos.push_back(agregarTexto(hechizo));
+    return static_cast<uint32_t>(hechizos.size() - 1);
+}
+
+/**
+ * @brief Implementación del método agregarElemento
+ * @param texto Texto del elemento
+ * @param valor1 Primer valor asociado
+ * @param valor2 Segundo valor asociado
+ * @return Índice del elemento en la tabla
+ */
+uint32_t EscritorRoster::agregarElemento(const string& texto, int32_t valor1, int32_t valor2) {
+    elementos.push_back(RegistroElementoClase{agregarTexto(texto), {valor1, valor2}});
+    return static_cast<uint32_t>(elementos.size() - 1);
+}
+
+/**
+ * @brief Implementación del método agregarArma
+ * @param registro Registro a agregar
+ * @return Índice del arma en la sección de armas
+ */
+uint32_t EscritorRoster::agregarArma(const RegistroArma& registro) {
+    armas.push_back(registro);
+    return static_cast<uint32_t>(armas.size() - 1);
+}
+
+/**
+ * @brief Implementación del método agregarPersonaje
+ * @param registro Registro a agregar
+ */
+void EscritorRoster::agregarPersonaje(const RegistroPersonaje& registro) {
+    personajes.push_back(registro);
+}
+
+uint32_t EscritorRoster::getCantidadArmas() const { return static_cast<uint32_t>(armas.size()); }
+uint32_t EscritorRoster::getCantidadHechizos() const { return static_cast<uint32_t>(hechizos.size()); }
+uint32_t EscritorRoster::getCantidadElementos() const { return static_cast<uint32_t>(elementos.size()); }
+
+/**
+ * @brief Implementación del método guardar
+ *
+ * Calcula los desplazamientos de cada sección, escribe la cabecera y luego
+ * cada sección en bloque, rellenando con ceros hasta la alineación.
+ *
+ * @param ruta Ruta del archivo a escribir
+ * @return true si se escribió correctamente, false en caso contrario
+ */
+bool EscritorRoster::guardar(const string& ruta) const {
+    CabeceraRoster cabecera{};
+    memcpy(cabecera.firma, FIRMA_ROSTER, sizeof(FIRMA_ROSTER));
+    cabecera.version = VERSION_ROSTER;
+    cabecera.tamanioCabecera = sizeof(CabeceraRoster);
+    cabecera.cantidadPersonajes = personajes.size();
+    cabecera.cantidadArmas = armas.size();
+    cabecera.cantidadHechizos = hechizos.size();
+    cabecera.cantidadElementos = elementos.size();
+    cabecera.offsetPersonajes = sizeof(CabeceraRoster);
+    cabecera.offsetArmas = alinearA8(cabecera.offsetPersonajes + personajes.size() * sizeof(RegistroPersonaje));
+    cabecera.offsetHechizos = alinearA8(cabecera.offsetArmas + armas.size() * sizeof(RegistroArma));
+    cabecera.offsetElementos = alinearA8(cabecera.offsetHechizos + hechizos.size() * sizeof(RefTexto));
+    cabecera.offsetTextos = alinearA8(cabecera.offsetElementos + elementos.size() * sizeof(RegistroElementoClase));
+    cabecera.tamanioTextos = textos.size();
+
+    ofstream archivo(ruta, ios::binary | ios::trunc);
+    if (!archivo) {
+        cerr << "Error: no se pudo crear el archivo de roster " << ruta << endl;
+        return false;
+    }
+
+    const char ceros[8] = {0};
+    uint64_t posicion = 0;
+    auto escribirSeccion = [&](uint64_t offset, const void* datos, size_t bytes) {
+        archivo.write(ceros, static_cast<streamsize>(offset - posicion));
+        archivo.write(static_cast<const char*>(datos), static_cast<streamsize>(bytes));
+        posicion = offset + bytes;
+    };
+
+    escribirSeccion(0, &cabecera, sizeof(cabecera));
+    escribirSeccion(cabecera.offsetPersonajes, personajes.data(), personajes.size() * sizeof(RegistroPersonaje));
+    escribirSeccion(cabecera.offsetArmas, armas.data(), armas.size() * sizeof(RegistroArma));
+    escribirSeccion(cabecera.offsetHechizos, hechizos.data(), hechizos.size() * sizeof(RefTexto));
+    escribirSeccion(cabecera.offsetElementos, elementos.data(), elementos.size() * sizeof(RegistroElementoClase));
+    escribirSeccion(cabecera.offsetTextos, textos.data(), textos.size());
+
+    if (!archivo) {
+        cerr << "Error: falló la escritura del roster " << ruta << endl;
+        return false;
+    }
+    return true;
+}
+
+// ==========================================
+// VISTA MAPEADA DEL ROSTER
+// ==========================================
+
+VistaRoster::VistaRoster() : datos(nullptr), tamanio(0), cabecera(nullptr) {}
+
+VistaRoster::~VistaRoster() {
+    cerrar();
+}
+
+/**
+ * @brief Implementación del método abrir
+ *
+ * Mapea el archivo completo en solo lectura y comprueba firma, versión,
+ * tamaño de cabecera, que cada sección quede dentro del archivo y que cada
+ * registro sea válido. Si algo no coincide, libera el mapeo y devuelve false.
+ *
+ * @param ruta Ruta del archivo
+ * @return true si se abrió correctamente
+ */
+bool VistaRoster::abrir(const string& ruta) {
+    cerrar();
+
+    int descriptor = open(ruta.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        cerr << "Error: no se pudo abrir el roster " << ruta << endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(descriptor, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(CabeceraRoster)) {
+        cerr << "Error: el roster " << ruta << " es demasiado chico." << endl;
+        close(descriptor);
+        return false;
+    }
+
+    size_t bytes = static_cast<size_t>(info.st_size);
+    void* mapeo = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor); // El mapeo sigue siendo válido sin el descriptor
+    if (mapeo == MAP_FAILED) {
+        cerr << "Error: no se pudo mapear el roster " << ruta << endl;
+        return false;
+    }
+
+    datos = static_cast<const unsigned char*>(mapeo);
+    tamanio = bytes;
+    cabecera = reinterpret_cast<const CabeceraRoster*>(datos);
+
+    auto seccionValida = [&](uint64_t offset, uint64_t cantidad, uint64_t tamanioElemento) {
+        return offset % 8 == 0 && offset <= tamanio && cantidad <= (tamanio - offset) / tamanioElemento;
+    };
+
+    bool valido = memcmp(cabecera->firma, FIRMA_ROSTER, sizeof(FIRMA_ROSTER)) == 0
+        && cabecera->version == VERSION_ROSTER
+        && cabecera->tamanioCabecera == sizeof(CabeceraRoster)
+        && seccionValida(cabecera->offsetPersonajes, cabecera->cantidadPersonajes, sizeof(RegistroPersonaje))
+        && seccionValida(cabecera->offsetArmas, cabecera->cantidadArmas, sizeof(RegistroArma))
+        && seccionValida(cabecera->offsetHechizos, cabecera->cantidadHechizos, sizeof(RefTexto))
+        && seccionValida(cabecera->offsetElementos, cabecera->cantidadElementos, sizeof(RegistroElementoClase))
+        && cabecera->offsetTextos <= tamanio
+        && cabecera->tamanioTextos <= tamanio - cabecera->offsetTextos
+        && registrosValidos();
+
+    if (!valido) {
+        cerr << "Error: " << ruta << " no es un roster válido (versión " << VERSION_ROSTER << ")." << endl;
+        cerrar();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Implementación del método registrosValidos
+ *
+ * Un byte de tipo corrupto no se reinterpreta como otro tipo: el roster
+ * completo se rechaza.
+ *
+ * @return true si todos los registros son válidos
+ */
+bool VistaRoster::registrosValidos() const {
+    auto textoValido = [this](const RefTexto& ref) {
+        return static_cast<uint64_t>(ref.desplazamiento) + ref.longitud <= cabecera->tamanioTextos;
+    };
+    auto rangoValido = [](uint64_t primero, uint64_t cantidad, uint64_t total) {
+        return primero <= total && cantidad <= total - primero;
+    };
+    auto rasgoValido = [](int32_t valor, uint8_t cantidad) {
+        return valor >= 0 && valor < cantidad;
+    };
+
+    const RefTexto* hechizos = reinterpret_cast<const RefTexto*>(datos + cabecera->offsetHechizos);
+    for (uint64_t h = 0; h < cabecera->cantidadHechizos; ++h) {
+        if (!textoValido(hechizos[h])) return false;
+    }
+
+    const RegistroElementoClase* elementos = reinterpret_cast<const RegistroElementoClase*>(datos + cabecera->offsetElementos);
+    for (uint64_t e = 0; e < cabecera->cantidadElementos; ++e) {
+        if (!textoValido(elementos[e].texto)) return false;
+    }
+
+    const RegistroArma* armas = reinterpret_cast<const RegistroArma*>(datos + cabecera->offsetArmas);
+    for (uint64_t a = 0; a < cabecera->cantidadArmas; ++a) {
+        const RegistroArma& arma = armas[a];
+        if (arma.tipo >= CANTIDAD_TIPOS_ROSTER || arma.rareza >= CANTIDAD_RAREZAS_ROSTER
+            || arma.efectoPocion < 0 || arma.efectoPocion >= CANTIDAD_EFECTOS_ROSTER
+            || !rangoValido(arma.primerHechizo, arma.cantidadHechizos, cabecera->cantidadHechizos)
+            || !textoValido(arma.nombre)) {
+            return false;
+        }
+    }
+
+    const RegistroPersonaje* personajes = reinterpret_cast<const RegistroPersonaje*>(datos + cabecera->offsetPersonajes);
+    for (uint64_t p = 0; p < cabecera->cantidadPersonajes; ++p) {
+        const RegistroPersonaje& personaje = personajes[p];
+        bool esMago = personaje.tipo < CANTIDAD_MAGOS_ROSTER;
+        bool rasgosValidos = esMago
+            ? rasgoValido(personaje.rasgos[0], CANTIDAD_ESCUELAS_ROSTER) && rasgoValido(personaje.rasgos[1], CANTIDAD_FUENTES_ROSTER)
+            : rasgoValido(personaje.rasgos[0], CANTIDAD_ESTILOS_ROSTER) && rasgoValido(personaje.rasgos[1], CANTIDAD_ARMADURAS_ROSTER);
+        if (personaje.tipo >= CANTIDAD_TIPOS_ROSTER || personaje.raza >= CANTIDAD_RAZAS_ROSTER || !rasgosValidos
+            || personaje.cantidadArmas > MAX_ARMAS_ROSTER
+            || personaje.armaEquipada < -1 || personaje.armaEquipada >= personaje.cantidadArmas
+            || !rangoValido(personaje.primerArma, personaje.cantidadArmas, cabecera->cantidadArmas)
+            || !rangoValido(personaje.primerHechizo, personaje.cantidadHechizos, cabecera->cantidadHechizos)
+            || !rangoValido(personaje.primerElemento, personaje.cantidadElementos, cabecera->cantidadElementos)
+            || !textoValido(personaje.nombre)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Implementación del método cerrar
+ */
+void VistaRoster::cerrar() {
+    if (datos != nullptr) {
+        munmap(const_cast<unsigned char*>(datos), tamanio);
+    }
+    datos = nullptr;
+    tamanio = 0;
+    cabecera = nullptr;
+}
+
+bool VistaRoster::estaAbierta() const { return datos != nullptr; }
+
+size_t VistaRoster::getCantidadPersonajes() const { return cabecera ? cabecera->cantidadPersonajes : 0; }
+size_t VistaRoster::getCantidadArmas() const { return cabecera ? cabecera->cantidadArmas : 0; }
+size_t VistaRoster::getCantidadHechizos() const { return cabecera ? cabecera->cantidadHechizos : 0; }
+size_t VistaRoster::getCantidadElementos() const { return cabecera ? cabecera->cantidadElementos : 0; }
+
+/**
+ * @brief Implementación del método getPersonaje
+ * @param indice Índice del personaje
+ * @return Referencia al registro dentro del mapeo
+ */
+const RegistroPersonaje& VistaRoster::getPersonaje(size_t indice) const {
+    if (indice >= getCantidadPersonajes()) {
+        throw out_of_range("Índice de personaje fuera del roster.");
+    }
+    return reinterpret_cast<const RegistroPersonaje*>(datos + cabecera->offsetPersonajes)[indice];
+}
+
+/**
+ * @brief Implementación del método getArma
+ * @param indice Índice del arma
+ * @return Referencia al registro dentro del mapeo
+ */
+const RegistroArma& VistaRoster::getArma(size_t indice) const {
+    if (indice >= getCantidadArmas()) {
+        throw out_of_range("Índice de arma fuera del roster.");
+    }
+    return reinterpret_cast<const RegistroArma*>(datos + cabecera->offsetArmas)[indice];
+}
+
+/**
+ * @brief Implementación del método getHechizo
+ * @param indice Índice del hechizo
+ * @return Vista al texto del hechizo
+ */
+string_view VistaRoster::getHechizo(size_t indice) const {
+    if (indice >= getCantidadHechizos()) {
+        throw out_of_range("Índice de hechizo fuera del roster.");
+    }
+    return getTexto(reinterpret_cast<const RefTexto*>(datos + cabecera->offsetHechizos)[indice]);
+}
+
+/**
+ * @brief Implementación del método getElemento
+ * @param indice Índice del elemento
+ * @return Referencia al registro dentro del mapeo
+ */
+const RegistroElementoClase& VistaRoster::getElemento(size_t indice) const {
+    if (indice >= getCantidadElementos()) {
+        throw out_of_range("Índice de elemento fuera del roster.");
+    }
+    return reinterpret_cast<const RegistroElementoClase*>(datos + cabecera->offsetElementos)[indice];
+}
+
+/**
+ * @brief Implementación del método getTexto
+ * @param ref Referencia al texto
+ * @return Vista al texto dentro del mapeo
+ */
+string_view VistaRoster::getTexto(const RefTexto& ref) const {
+    if (cabecera == nullptr || static_cast<uint64_t>(ref.desplazamiento) + ref.longitud > cabecera->tamanioTextos) {
+        return string_view();
+    }
+    return string_view(reinterpret_cast<const char*>(datos + cabecera->offsetTextos + ref.desplazamiento), ref.longitud);
+}
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// ==========================================
+// FORMATO BINARIO DEL ROSTER (VERSION 2)
+// ==========================================
+//
+// [CabeceraRoster][RegistroPersonaje x N][RegistroArma x M][RefTexto x H]
+// [RegistroElementoClase x E][textos]
+//
+// Todas las referencias son índices o desplazamientos relativos al inicio
+// del archivo (o de la sección de textos), nunca punteros. Así el archivo
+// se puede mapear en cualquier dirección y compartir en solo lectura entre
+// procesos. Los enteros se guardan en el orden de bytes de la máquina
+// (little-endian en x86/ARM); la firma y la versión permiten rechazar
+// archivos incompatibles.
+//
+// La versión 2 agrega los rasgos de clase y el estado de subclase de cada
+// personaje (con sus listas en la sección de elementos) y el estado propio
+// de pociones, amuletos y lanzas.
+
+/// Firma de 8 bytes al comienzo de todo roster
+static const char FIRMA_ROSTER[8] = {'T', 'P', '1', 'R', 'O', 'S', 'T', 'R'};
+
+/// Versión actual del formato
+static const uint32_t VERSION_ROSTER = 2;
+
+/// Cantidad de valores de TipoPersonaje y de TipoArma
+static const uint8_t CANTIDAD_TIPOS_ROSTER = 9;
+/// Cantidad de valores de Raza
+static const uint8_t CANTIDAD_RAZAS_ROSTER = 5;
+/// Cantidad de valores de Rarity
+static const uint8_t CANTIDAD_RAREZAS_ROSTER = 5;
+/// Capacidad del inventario de magos y guerreros
+static const uint8_t MAX_ARMAS_ROSTER = 2;
+/// Los tipos de personaje menores a este valor son magos; el resto, guerreros
+static const uint8_t CANTIDAD_MAGOS_ROSTER = 4;
+/// Cantidad de valores de EscuelaMagia y de FuentePoder
+static const uint8_t CANTIDAD_ESCUELAS_ROSTER = 8;
+static const uint8_t CANTIDAD_FUENTES_ROSTER = 6;
+/// Cantidad de valores de EstiloCombate y de TipoArmadura
+static const uint8_t CANTIDAD_ESTILOS_ROSTER = 5;
+static const uint8_t CANTIDAD_ARMADURAS_ROSTER = 5;
+/// Cantidad de valores de EfectoPocion
+static const uint8_t CANTIDAD_EFECTOS_ROSTER = 7;
+/// Rasgos de clase y contadores de subclase por personaje
+static const int MAX_RASGOS_ROSTER = 4;
+static const int MAX_ESTADO_CLASE_ROSTER = 4;
+
+/**
+ * @brief Referencia a un texto dentro de la sección de textos del roster
+ */
+struct RefTexto {
+    uint32_t desplazamiento;  ///< Posición relativa al inicio de la sección de textos
+    uint32_t longitud;        ///< Cantidad de bytes (sin terminador)
+};
+
+/**
+ * @brief Cabecera del archivo de roster
+ */
+struct CabeceraRoster {
+    char firma[8];
+    uint32_t version;
+    uint32_t tamanioCabecera;
+    uint64_t cantidadPersonajes;
+    uint64_t cantidadArmas;
+    uint64_t cantidadHechizos;
+    uint64_t cantidadElementos;
+    uint64_t offsetPersonajes;
+    uint64_t offsetArmas;
+    uint64_t offsetHechizos;
+    uint64_t offsetElementos;
+    uint64_t offsetTextos;
+    uint64_t tamanioTextos;
+};
+
+/**
+ * @brief Registro de tamaño fijo de un personaje
+ *
+ * El recurso es maná para magos y estamina para guerreros. Las armas del
+ * personaje ocupan [primerArma, primerArma + cantidadArmas) en la sección de
+ * armas, sus hechizos [primerHechizo, primerHechizo + cantidadHechizos) y
+ * las listas de su subclase (técnicas, contratos, pactos, maleficios o
+ * servidores) [primerElemento, primerElemento + cantidadElementos).
+ *
+ * rasgos son estilo, armadura, defensa base y resistencia física en los
+ * guerreros, y escuela y fuente de poder en los magos. estadoClase son los
+ * mismos contadores que guarda CheckpointPersonaje.
+ */
+struct RegistroPersonaje {
+    uint8_t tipo;            ///< Valor de TipoPersonaje
+    uint8_t raza;            ///< Valor de Raza
+    int8_t armaEquipada;     ///< Posición del arma equipada o -1
+    uint8_t cantidadArmas;
+    int32_t nivel;
+    int32_t hpMax;
+    int32_t hpActual;
+    int32_t fuerza;
+    int32_t destreza;
+    int32_t constitucion;
+    int32_t inteligencia;
+    int32_t recursoMaximo;
+    int32_t recursoActual;
+    uint32_t primerArma;
+    uint32_t primerHechizo;
+    uint32_t cantidadHechizos;
+    RefTexto nombre;
+    int32_t rasgos[MAX_RASGOS_ROSTER];
+    int32_t estadoClase[MAX_ESTADO_CLASE_ROSTER];
+    uint32_t primerElemento;
+    uint32_t cantidadElementos;
+    uint32_t relleno;        ///< Completa el registro a 104 bytes
+};
+
+/**
+ * @brief Registro de tamaño fijo de un arma u objeto mágico
+ *
+ * nivelFilo solo aplica a armas de combate; la energía arcana solo a
+ * objetos mágicos. En las pociones la durabilidad actual son las dosis.
+ * Los libros de hechizos guardan sus hechizos igual que los personajes.
+ * Los campos que no aplican al tipo quedan en 0.
+ */
+struct RegistroArma {
+    double peso;
+    uint8_t tipo;            ///< Valor de TipoArma
+    uint8_t rareza;          ///< Valor de Rarity
+    uint8_t sintonizado;     ///< Solo amuletos
+    uint8_t preparadaContraCarga;  ///< Solo lanzas
+    int32_t poder;
+    int32_t durabilidadMaxima;
+    int32_t durabilidadActual;
+    int32_t nivelFilo;
+    int32_t energiaArcanaMaxima;
+    int32_t energiaArcanaActual;
+    int32_t efectoPocion;    ///< Valor de EfectoPocion (solo pociones)
+    int32_t potenciaEfecto;  ///< Solo pociones
+    uint32_t primerHechizo;
+    uint32_t cantidadHechizos;
+    RefTexto nombre;
+};
+
+/**
+ * @brief Elemento de una lista de subclase de un personaje
+ *
+ * Los valores son los que la subclase asocia al texto (por ejemplo la
+ * recompensa de un contrato o el HP y el daño de un servidor).
+ */
+struct RegistroElementoClase {
+    RefTexto texto;
+    int32_t valores[2];
+};
+
+static_assert(is_trivially_copyable_v<CabeceraRoster>, "La cabecera debe ser POD");
+static_assert(is_trivially_copyable_v<RegistroPersonaje>, "RegistroPersonaje debe ser POD");
+static_assert(is_trivially_copyable_v<RegistroArma>, "RegistroArma debe ser POD");
+static_assert(is_trivially_copyable_v<RegistroElementoClase>, "RegistroElementoClase debe ser POD");
+static_assert(sizeof(CabeceraRoster) % 8 == 0 && sizeof(RegistroPersonaje) % 8 == 0 &&
+              sizeof(RegistroArma) % 8 == 0 && sizeof(RegistroElementoClase) % 8 == 0 && sizeof(RefTexto) == 8,
+              "Los registros deben mantener la alineación de 8 bytes");
+
+/**
+ * @brief Construye un roster en memoria y lo escribe en disco
+ *
+ * Los textos repetidos (nombres, hechizos, elementos) se guardan una sola vez.
+ */
+class EscritorRoster {
+public:
+    /**
+     * @brief Agrega un texto a la sección de textos (o reutiliza uno igual)
+     * @param texto Texto a agregar
+     * @return Referencia al texto dentro del roster
+     */
+    RefTexto agregarTexto(const string& texto);
+
+    /**
+     * @brief Agrega un hechizo a la tabla de hechizos
+     * @param hechizo Nombre del hechizo
+     * @return Índice del hechizo en la tabla
+     */
+    uint32_t agregarHechizo(const string& hechizo);
+
+    /**
+     * @brief Agrega un elemento a la tabla de elementos de subclase
+     * @param texto Texto del elemento
+     * @param valor1 Primer valor asociado
+     * @param valor2 Segundo valor asociado
+     * @return Índice del elemento en la tabla
+     */
+    uint32_t agregarElemento(const string& texto, int32_t valor1, int32_t valor2);
+
+    /**
+     * @brief Agrega un registro de arma
+     * @param registro Registro a agregar
+     * @return Índice del arma en la sección de armas
+     */
+    uint32_t agregarArma(const RegistroArma& registro);
+
+    /**
+     * @brief Agrega un registro de personaje
+     * @param registro Registro a agregar
+     */
+    void agregarPersonaje(const RegistroPersonaje& registro);
+
+    /**
+     * @brief Obtiene la cantidad de armas agregadas
+     * @return Cantidad de registros de arma
+     */
+    uint32_t getCantidadArmas() const;
+
+    /**
+     * @brief Obtiene la cantidad de hechizos agregados
+     * @return Cantidad de entradas en la tabla de hechizos
+     */
+    uint32_t getCantidadHechizos() const;
+
+    /**
+     * @brief Obtiene la cantidad de elementos de subclase agregados
+     * @return Cantidad de entradas en la tabla de elementos
+     */
+    uint32_t getCantidadElementos() const;
+
+    /**
+     * @brief Escribe el roster completo en un archivo
+     * @param ruta Ruta del archivo a escribir
+     * @return true si se escribió correctamente, false en caso contrario
+     */
+    bool guardar(const string& ruta) const;
+
+private:
+    vector<RegistroPersonaje> personajes;
+    vector<RegistroArma> armas;
+    vector<RefTexto> hechizos;
+    vector<RegistroElementoClase> elementos;
+    string textos;
+    unordered_map<string, RefTexto> textosExistentes;
+};
+
+/**
+ * @brief Vista de solo lectura de un roster mapeado en memoria
+ *
+ * abrir() mapea el archivo con mmap y valida la cabecera, los límites de
+ * cada sección y cada registro: tipos, razas, rarezas, rasgos y efectos
+ * dentro de sus enumeraciones, rangos de armas, hechizos y elementos dentro
+ * de sus secciones y textos dentro de la sección de textos. A partir de ahí
+ * los registros se leen directamente del mapeo, sin copiar ni interpretar
+ * nada. El mapeo es compartido, así que varios procesos que abran el mismo
+ * roster comparten las mismas páginas.
+ */
+class VistaRoster {
+public:
+    VistaRoster();
+    ~VistaRoster();
+
+    VistaRoster(const VistaRoster&) = delete;
+    VistaRoster& operator=(const VistaRoster&) = delete;
+
+    /**
+     * @brief Mapea y valida un archivo de roster
+     *
+     * La validación recorre todos los registros una vez, así que abrir
+     * cuesta O(personajes + armas + hechizos + elementos).
+     *
+     * @param ruta Ruta del archivo
+     * @return true si se abrió correctamente, false si no existe o no es válido
+     */
+    bool abrir(const string& ruta);
+
+    /**
+     * @brief Libera el mapeo actual (si lo hay)
+     */
+    void cerrar();
+
+    /**
+     * @brief Indica si hay un roster mapeado
+     * @return true si la vista está abierta
+     */
+    bool estaAbierta() const;
+
+    size_t getCantidadPersonajes() const;
+    size_t getCantidadArmas() const;
+    size_t getCantidadHechizos() const;
+    size_t getCantidadElementos() const;
+
+    /**
+     * @brief Obtiene el registro de un personaje
+     * @param indice Índice del personaje
+     * @return Referencia al registro dentro del mapeo
+     * @throws out_of_range si el índice no es válido
+     */
+    const RegistroPersonaje& getPersonaje(size_t indice) const;
+
+    /**
+     * @brief Obtiene el registro de un arma
+     * @param indice Índice del arma
+     * @return Referencia al registro dentro del mapeo
+     * @throws out_of_range si el índice no es válido
+     */
+    const RegistroArma& getArma(size_t indice) const;
+
+    /**
+     * @brief Obtiene el nombre de un hechizo de la tabla de hechizos
+     * @param indice Índice del hechizo
+     * @return Vista al texto dentro del mapeo
+     * @throws out_of_range si el índice no es válido
+     */
+    string_view getHechizo(size_t indice) const;
+
+    /**
+     * @brief Obtiene un elemento de la tabla de elementos de subclase
+     * @param indice Índice del elemento
+     * @return Referencia al registro dentro del mapeo
+     * @throws out_of_range si el índice no es válido
+     */
+    const RegistroElementoClase& getElemento(size_t indice) const;
+
+    /**
+     * @brief Obtiene un texto de la sección de textos
+     * @param ref Referencia al texto
+     * @return Vista al texto dentro del mapeo (vacía si la referencia no es válida)
+     */
+    string_view getTexto(const RefTexto& ref) const;
+
+private:
+    /**
+     * @brief Comprueba que cada registro respete los límites del formato
+     * @return true si todos los registros son válidos
+     */
+    bool registrosValidos() const;
+
+    const unsigned char* datos;
+    size_t tamanio;
+    const CabeceraRoster* cabecera;
+};
@@ -0,0 +1,140 @@
+#include "TablaAlias.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Implementación del constructor por defecto
+ *
+ * Una tabla de una sola entrada siempre devuelve 0.
+ */
+TablaAlias::TablaAlias() : TablaAlias(vector<double>{1.0}) {}
+
+/**
+ * @brief Implementación del constructor a partir de pesos
+ *
+ * Normaliza los pesos para que su promedio sea 1 y reparte las columnas en
+ * "chicas" (< 1) y "grandes" (>= 1). Cada columna chica se completa con
+ * parte de una grande, que pasa a ser su alias. El resultado son n columnas
+ * de altura 1 con a lo sumo dos resultados cada una.
+ */
+TablaAlias::TablaAlias(const vector<double>& pesos) {
+    if (pesos.empty()) {
+        throw std::invalid_argument("La tabla de botín necesita al menos un peso.");
+    }
+
+    double total = 0.0;
+    for (double peso : pesos) {
+        if (peso < 0.0) {
+            throw std::invalid_argument("Los pesos de la tabla de botín no pueden ser negativos.");
+        }
+        total += peso;
+    }
+    if (total <= 0.0) {
+        throw std::invalid_argument("La suma de los pesos de la tabla de botín debe ser positiva.");
+    }
+
+    const int n = static_cast<int>(pesos.size());
+    probabilidad.assign(n, 0.0);
+    umbral.assign(n, 0);
+    alias.assign(n, 0);
+    normalizados.resize(n);
+
+    vector<double> escalados(n);
+    vector<int> chicas;
+    vector<int> grandes;
+    chicas.reserve(n);
+    grandes.reserve(n);
+
+    for (int i = 0; i < n; ++i) {
+        normalizados[i] = pesos[i] / total;
+        escalados[i] = normalizados[i] * n;
+        if (escalados[i] < 1.0) {
+            chicas.push_back(i);
+        } else {
+            grandes.push_back(i);
+        }
+    }
+
+    while (!chicas.empty() && !grandes.empty()) {
+        int chica = chicas.back();
+        chicas.pop_back();
+        int grande = grandes.back();
+
+        probabilidad[chica] = escalados[chica];
+        alias[chica] = grande;
+
+        escalados[grande] = (escalados[grande] + escalados[chica]) - 1.0;
+        if (escalados[grande] < 1.0) {
+            grandes.pop_back();
+            chicas.push_back(grande);
+        }
+    }
+
+    // Lo que queda (por redondeo) tiene probabilidad 1 de quedarse en su columna
+    for (int i : grandes) {
+        probabilidad[i] = 1.0;
+        alias[i] = i;
+    }
+    for (int i : chicas) {
+        probabilidad[i] = 1.0;
+        alias[i] = i;
+    }
+
+    for (int i = 0; i < n; ++i) {
+        double escalado = probabilidad[i] * 4294967296.0;
+        umbral[i] = escalado >= 4294967295.0 ? UINT32_MAX : static_cast<uint32_t>(escalado);
+    }
+}
+
+/**
+ * @brief Implementación del método muestrear con columna y valor uniforme
+ * @param columna Columna elegida uniformemente
+ * @param u Valor uniforme en [0, 1)
+ * @return Índice sorteado
+ */
+int TablaAlias::muestrear(int columna, double u) const {
+    if (columna < 0 || columna >= getCantidad()) {
+        columna = 0;
+    }
+    return u < probabilidad[columna] ? columna : alias[columna];
+}
+
+/**
+ * @brief Implementación del método muestrear con 64 bits aleatorios
+ * @param aleatorio Valor aleatorio de 64 bits
+ * @return Índice sorteado
+ */
+int TablaAlias::muestrear(uint64_t aleatorio) const {
+    uint32_t alto = static_cast<uint32_t>(aleatorio >> 32);
+    uint32_t bajo = static_cast<uint32_t>(aleatorio);
+    int columna = static_cast<int>((static_cast<uint64_t>(alto) * umbral.size()) >> 32);
+
+    if (umbral[columna] == UINT32_MAX) {
+        return columna;
+    }
+    return bajo < umbral[columna] ? columna : alias[columna];
+}
+
+/**
+ * @brief Implementación del método muestrearLote
+ * @param generador Generador de 64 bits a utilizar
+ * @param salida Vector donde se escriben los resultados
+ * @param cantidad Cantidad de sorteos
+ */
+void TablaAlias::muestrearLote(mt19937_64& generador, vector<int>& salida, size_t cantidad) const {
+    salida.resize(cantidad);
+    for (size_t i = 0; i < cantidad; ++i) {
+        salida[i] = muestrear(static_cast<uint64_t>(generador()));
+    }
+}
+
+int TablaAlias::getCantidad() const { return static_cast<int>(probabilidad.size()); }
+
+/**
+ * @brief Implementación del método getProbabilidad
+ * @param indice Índice del resultado
+ * @return Probabilidad normalizada del resultado
+ */
+double TablaAlias::getProbabilidad(int indice) const {
+    if (indice < 0 || indice >= getCantidad()) return 0.0;
+    return normalizados[indice];
+}
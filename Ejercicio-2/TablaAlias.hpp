@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Tabla de muestreo ponderado con el método alias de Walker (variante de Vose)
+ *
+ * Se construye en O(n) a partir de pesos arbitrarios no negativos y permite
+ * sortear un índice en O(1): se elige una columna uniforme y, con una sola
+ * comparación, se devuelve la columna o su alias. Se usa para las tablas de
+ * botín de la fábrica (rareza y tipo de arma).
+ */
+class TablaAlias {
+public:
+    /**
+     * @brief Constructor por defecto: tabla de una sola entrada
+     */
+    TablaAlias();
+
+    /**
+     * @brief Construye la tabla a partir de una lista de pesos
+     * @param pesos Pesos no negativos de cada resultado (al menos uno positivo)
+     * @throws invalid_argument si la lista está vacía, tiene pesos negativos o suma cero
+     */
+    explicit TablaAlias(const vector<double>& pesos);
+
+    /**
+     * @brief Sortea un índice a partir de una columna y un valor uniforme
+     * @param columna Columna elegida uniformemente en [0, getCantidad())
+     * @param u Valor uniforme en [0, 1)
+     * @return Índice sorteado
+     */
+    int muestrear(int columna, double u) const;
+
+    /**
+     * @brief Sortea un índice a partir de 64 bits aleatorios
+     *
+     * Los 32 bits altos eligen la columna (multiplicación en lugar de módulo)
+     * y los 32 bajos se comparan contra el umbral entero de esa columna.
+     *
+     * @param aleatorio Valor aleatorio de 64 bits
+     * @return Índice sorteado
+     */
+    int muestrear(uint64_t aleatorio) const;
+
+    /**
+     * @brief Sortea muchos índices de una vez con un generador dado
+     * @param generador Generador de 64 bits a utilizar
+     * @param salida Vector donde se escriben los resultados (se redimensiona)
+     * @param cantidad Cantidad de sorteos
+     */
+    void muestrearLote(mt19937_64& generador, vector<int>& salida, size_t cantidad) const;
+
+    /**
+     * @brief Obtiene la cantidad de resultados posibles
+     * @return Cantidad de entradas de la tabla
+     */
+    int getCantidad() const;
+
+    /**
+     * @brief Obtiene la probabilidad normalizada de un resultado
+     * @param indice Índice del resultado
+     * @return Probabilidad en [0, 1], o 0 si el índice es inválido
+     */
+    double getProbabilidad(int indice) const;
+
+private:
+    vector<double> probabilidad;   // Probabilidad de quedarse con la columna
+    vector<uint32_t> umbral;       // probabilidad escalada a 2^32 para el sorteo entero
+    vector<int> alias;             // Resultado alternativo de cada columna
+    vector<double> normalizados;   // Pesos normalizados originales (para consulta)
+};
@@ -2,7 +2,17 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <chrono>
+#include <cstdio>
+#include <thread>
 #include "PersonajeFactory.hpp"
+#include "MundoProcedural.hpp"
+#include "ExportadorStream.hpp"
+#include "Armeria.hpp"
+#include "OptimizadorEquipamiento.hpp"
+#include "../Ejercicio-1/Personajes/EvaluadorDanio.hpp"
+#include "../Ejercicio-1/Personajes/BatallaEquipos.hpp"
+#include "../Ejercicio-1/Personajes/EfectosTemporales.hpp"
 
 using namespace std;
 
@@ -23,18 +33,48 @@ void mostrarInfoPersonaje(const shared_ptr<InterfazPersonaje>& personaje) {
     cout << endl;
 }
 
+
 /**
- * @brief Función principal del programa
- * 
- * Demuestra la funcionalidad de la clase PersonajeFactory creando diferentes
- * tipos de personajes y mostrando su información. También genera grupos
- * aleatorios de personajes y muestra estadísticas sobre ellos.
- * 
- * @return 0 si el programa termina correctamente
+ * @brief Tamaños de los demos
+ *
+ * Por defecto son chicos para que el programa termine en pocos segundos;
+ * con --benchmark se usan los tamaños de las mediciones de rendimiento.
  */
-int main() {
-    cout << "===== EJERCICIO 2: CREACIÓN DINÁMICA DE PERSONAJES Y ARMAS =====" << endl << endl;
-    
+struct EscalaDemo {
+    int oleada;                  ///< Gladiadores clonados del arquetipo
+    int comparacion;             ///< Personajes o armas por medición de creación y ranking
+    int botines;
+    int filasAtributos;          ///< Filas de atributos generadas por columnas
+    int simulaciones;            ///< Peleas hipotéticas sobre el mismo checkpoint
+    int porEquipo;               ///< Personajes por bando en batallas e invocaciones
+    int temporizadores;
+    int lecturas;                ///< Lecturas de estadísticas sin cambios
+    int objetivos;               ///< Caballeros bajo maleficios
+    int horda;
+    int contratosPorHilo;
+    int mercenarios;
+    int usosTecnicas;
+    int paladines;               ///< El ejército es diez veces mayor y el enemigo el doble
+    int mezclas;
+    int armasArmeria;
+    int armasOptimizador;
+    int personajesOptimizador;
+};
+
+static const EscalaDemo ESCALA_DEMO = {
+    100, 2000, 100000, 100000, 200, 200, 50000, 100000, 500, 3000,
+    2500, 80, 20000, 100, 20000, 30000, 20000, 2000
+};
+
+static const EscalaDemo ESCALA_BENCHMARK = {
+    1000, 20000, 1000000, 1000000, 1000, 2000, 1000000, 1000000, 5000, 30000,
+    25000, 800, 200000, 1000, 200000, 300000, 1000000, 100000
+};
+
+/**
+ * @brief Crea personajes sueltos, armados y en modo combate PPT
+ */
+static void demoCreacionBasica() {
     cout << "Creando un caballero..." << endl;
     auto caballero = PersonajeFactory::crearPersonaje(TipoPersonaje::Caballero);
     mostrarInfoPersonaje(caballero);
@@ -49,7 +89,13 @@ int main() {
     auto barbaroCombatePPT = PersonajeFactory::crearPersonajeModoCombtePPT(TipoPersonaje::Barbaro, 1);
     cout << "HP establecido para combate PPT: " << barbaroCombatePPT->getHP() << " (debería ser 100)" << endl;
     mostrarInfoPersonaje(barbaroCombatePPT);
-    
+}
+
+/**
+ * @brief Genera grupos aleatorios de magos y guerreros
+ * @return Grupos generados
+ */
+static ResultadoGeneracion demoGruposAleatorios() {
     cout << "\n\n===== GENERACIÓN DE GRUPOS ALEATORIOS =====" << endl;
     ResultadoGeneracion resultado = PersonajeFactory::generarGruposPersonajes();
     
@@ -67,7 +113,1137 @@ int main() {
         cout << "\n=== EJEMPLO DE GUERRERO GENERADO ===" << endl;
         mostrarInfoPersonaje(resultado.guerreros[0]);
     }
+    return resultado;
+}
+
+/**
+ * @brief Clona una oleada desde el arquetipo y compara con el constructor completo
+ * @param escala Tamaños del demo
+ */
+static void demoPrototipos(const EscalaDemo& escala) {
+    cout << "\n\n===== OLEADA CREADA A PARTIR DE PROTOTIPOS =====" << endl;
+    auto oleada = PersonajeFactory::crearOleada(TipoPersonaje::Gladiador, escala.oleada);
+    cout << "Clonados " << oleada.size() << " gladiadores desde su arquetipo." << endl;
+
+    auto lanzaClonada = PersonajeFactory::crearArmaDesdePrototipo(TipoArma::Lanza);
+    oleada[0]->agregarArma(move(lanzaClonada));
+    cout << "\n=== EJEMPLO DE GLADIADOR CLONADO ===" << endl;
+    mostrarInfoPersonaje(oleada[0]);
+
+    const int cantidadComparacion = escala.comparacion;
+    auto inicioConstructor = chrono::steady_clock::now();
+    for (int i = 0; i < cantidadComparacion; ++i) {
+        PersonajeFactory::crearPersonaje(TipoPersonaje::Gladiador);
+    }
+    auto inicioClon = chrono::steady_clock::now();
+    for (int i = 0; i < cantidadComparacion; ++i) {
+        PersonajeFactory::crearPersonajeDesdePrototipo(TipoPersonaje::Gladiador);
+    }
+    auto finClon = chrono::steady_clock::now();
+    cout << "\n" << cantidadComparacion << " gladiadores con constructor completo: "
+         << chrono::duration_cast<chrono::milliseconds>(inicioClon - inicioConstructor).count() << " ms; "
+         << "clonados del arquetipo: "
+         << chrono::duration_cast<chrono::milliseconds>(finClon - inicioClon).count() << " ms" << endl;
+}
+
+/**
+ * @brief Materializa un personaje a partir de (semilla, id)
+ */
+static void demoMundoProcedural() {
+    cout << "\n\n===== MUNDO PROCEDURAL (SEMILLA, ID) =====" << endl;
+    MundoProcedural mundo(20240501ULL, 64);
+    HandlePersonaje handle = mundo.obtenerHandle(123456789ULL);
+    auto materializado = mundo.materializar(handle);
+    auto repetido = mundo.materializar(handle);
+    auto regenerado = PersonajeFactory::crearPersonajeProcedural(handle.semilla, handle.id);
+    cout << "Personaje #" << handle.id << ": " << materializado->getNombre()
+         << " (HP " << materializado->getHP() << ")" << endl;
+    cout << "Regenerado desde cero: " << regenerado->getNombre()
+         << " (HP " << regenerado->getHP() << ")" << endl;
+    cout << "Segunda materialización desde caché: " << (materializado == repetido ? "sí" : "no") << endl;
+    mundo.mostrarEstadisticas();
+}
+
+/**
+ * @brief Sortea botines con la tabla de rarezas ponderada
+ * @param escala Tamaños del demo
+ */
+static void demoTablasBotin(const EscalaDemo& escala) {
+    cout << "\n\n===== TABLAS DE BOTÍN PONDERADAS =====" << endl;
+    PersonajeFactory::configurarTablaBotin(TablaBotin::Rareza, {50, 25, 15, 8, 2});
+    vector<int> rarezas = PersonajeFactory::generarBotin(TablaBotin::Rareza, escala.botines, 42);
+    vector<int> conteo(5, 0);
+    for (int r : rarezas) {
+        conteo[r]++;
+    }
+    cout << "Rarezas sorteadas en " << rarezas.size() << " botines:" << endl;
+    for (int r = 0; r < 5; ++r) {
+        cout << "  " << rarityToString(static_cast<Rarity>(r)) << ": " << conteo[r]
+             << " (esperado " << PersonajeFactory::getProbabilidadBotin(TablaBotin::Rareza, r) * 100 << "%)" << endl;
+    }
+}
+
+/**
+ * @brief Compara la creación uno por uno con la generación por lotes
+ * @param escala Tamaños del demo
+ * @return Paladines clonados por lotes
+ */
+static vector<shared_ptr<InterfazPersonaje>> demoAtributosPorLotes(const EscalaDemo& escala) {
+    cout << "\n\n===== GENERACIÓN DE ATRIBUTOS POR LOTES =====" << endl;
+    const int cantidadLote = escala.comparacion;
+    auto inicio = chrono::steady_clock::now();
+    for (int i = 0; i < cantidadLote; ++i) {
+        PersonajeFactory::crearPersonaje(TipoPersonaje::Paladin);
+    }
+    auto medio = chrono::steady_clock::now();
+    auto loteClonado = PersonajeFactory::crearOleada(TipoPersonaje::Paladin, cantidadLote);
+    auto fin = chrono::steady_clock::now();
+    ColumnasAtributos columnas = PersonajeFactory::generarColumnasAtributos(TipoPersonaje::Paladin, escala.filasAtributos, 7);
+    auto finColumnas = chrono::steady_clock::now();
+    ColumnasAtributos columnasEscalares = PersonajeFactory::generarColumnasAtributosEscalar(TipoPersonaje::Paladin, escala.filasAtributos);
+    auto finEscalar = chrono::steady_clock::now();
+
+    cout << cantidadLote << " paladines con constructor completo: "
+         << chrono::duration_cast<chrono::milliseconds>(medio - inicio).count() << " ms" << endl;
+    cout << cantidadLote << " paladines por lote (columnas + clonación): "
+         << chrono::duration_cast<chrono::milliseconds>(fin - medio).count() << " ms" << endl;
+    cout << columnas.getCantidad() << " filas de atributos con el generador por lotes: "
+         << chrono::duration_cast<chrono::milliseconds>(finColumnas - fin).count() << " ms; con obtenerNumeroAleatorio: "
+         << chrono::duration_cast<chrono::milliseconds>(finEscalar - finColumnas).count() << " ms ("
+         << columnasEscalares.getCantidad() << " filas)" << endl;
+    return loteClonado;
+}
+
+/**
+ * @brief Guarda el roster en binario, lo mapea y reconstruye el primer personaje
+ * @param roster Personajes a usar
+ */
+static void demoSnapshotRoster(const vector<shared_ptr<InterfazPersonaje>>& roster) {
+    cout << "\n\n===== SNAPSHOT BINARIO DEL ROSTER =====" << endl;
+    const string rutaRoster = "roster.bin";
+
+    if (PersonajeFactory::guardarRoster(rutaRoster, roster)) {
+        auto inicioCarga = chrono::steady_clock::now();
+        VistaRoster vista;
+        bool abierto = vista.abrir(rutaRoster);
+        auto finCarga = chrono::steady_clock::now();
+
+        if (abierto) {
+            cout << "Roster mapeado: " << vista.getCantidadPersonajes() << " personajes, "
+                 << vista.getCantidadArmas() << " armas, " << vista.getCantidadHechizos() << " hechizos en "
+                 << chrono::duration_cast<chrono::microseconds>(finCarga - inicioCarga).count() << " us" << endl;
+            cout << "\n=== PRIMER PERSONAJE RECONSTRUIDO DEL ROSTER ===" << endl;
+            mostrarInfoPersonaje(PersonajeFactory::materializarDesdeRoster(vista, 0));
+        }
+        vista.cerrar();
+        remove(rutaRoster.c_str());
+    }
+}
+
+/**
+ * @brief Exporta el roster a CSV y NDJSON
+ * @param roster Personajes a usar
+ */
+static void demoExportacion(const vector<shared_ptr<InterfazPersonaje>>& roster) {
+    cout << "\n\n===== EXPORTACIÓN CSV / NDJSON =====" << endl;
+    ExportadorStream csvPersonajes(FormatoExportacion::CSV);
+    ExportadorStream csvArmas(FormatoExportacion::CSV);
+    ExportadorStream ndjson(FormatoExportacion::NDJSON);
+
+    auto inicioExportacion = chrono::steady_clock::now();
+    if (csvPersonajes.abrir("personajes.csv") && csvArmas.abrir("armas.csv") && ndjson.abrir("roster.ndjson")) {
+        csvPersonajes.escribirPersonajes(roster);
+        csvArmas.escribirArmas(roster);
+        ndjson.escribirPersonajes(roster);
+        ndjson.escribirArmas(roster);
+        ndjson.escribirResultadoDuelo(ResultadoDuelo{roster[0]->getNombre(), roster[1]->getNombre(), 1, 7, 40, 0, true});
+    }
+    csvPersonajes.cerrar();
+    csvArmas.cerrar();
+    ndjson.cerrar();
+    auto finExportacion = chrono::steady_clock::now();
+
+    uint64_t bytes = csvPersonajes.getBytesEscritos() + csvArmas.getBytesEscritos() + ndjson.getBytesEscritos();
+    cout << "Exportados " << csvPersonajes.getRegistrosEscritos() << " personajes y "
+         << csvArmas.getRegistrosEscritos() << " armas a CSV, y " << ndjson.getRegistrosEscritos()
+         << " registros a NDJSON (" << bytes / 1024 << " KiB) en "
+         << chrono::duration_cast<chrono::milliseconds>(finExportacion - inicioExportacion).count() << " ms" << endl;
+
+    remove("personajes.csv");
+    remove("armas.csv");
+    remove("roster.ndjson");
+}
+
+/**
+ * @brief Simula peleas hipotéticas volviendo siempre al mismo checkpoint
+ * @param escala Tamaños del demo
+ */
+static void demoCheckpoint(const EscalaDemo& escala) {
+    cout << "\n\n===== CHECKPOINT Y COMBATES HIPOTÉTICOS =====" << endl;
+    auto luchador = PersonajeFactory::crearPersonajeArmado(TipoPersonaje::Barbaro, 2);
+    CheckpointPersonaje inicial;
+    luchador->guardarCheckpoint(inicial);
+
+    // Simular varias peleas sobre el mismo bárbaro, volviendo siempre al checkpoint
+    const int simulaciones = escala.simulaciones;
+    long long hpPerdidoTotal = 0;
+    long long durabilidadGastadaTotal = 0;
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);  // Silenciar los mensajes de combate
+    for (int i = 0; i < simulaciones; ++i) {
+        for (int golpe = 0; golpe < 5; ++golpe) {
+            if (InterfazArmas* arma = luchador->getArma(0)) {
+                arma->usar();
+            }
+            luchador->recibirDanio(8, false);
+        }
+        CheckpointPersonaje final;
+        luchador->guardarCheckpoint(final);
+        DeltaPersonaje delta = calcularDelta(inicial, final);
+        hpPerdidoTotal -= delta.hpActual;
+        durabilidadGastadaTotal -= delta.durabilidadArmas[0];
+        luchador->restaurarCheckpoint(inicial);
+    }
+    cout.rdbuf(salidaOriginal);
+
+    CheckpointPersonaje restaurado;
+    luchador->guardarCheckpoint(restaurado);
+    cout << simulaciones << " peleas simuladas sobre " << luchador->getNombre() << ": HP perdido promedio "
+         << static_cast<double>(hpPerdidoTotal) / simulaciones << ", durabilidad gastada promedio "
+         << static_cast<double>(durabilidadGastadaTotal) / simulaciones << endl;
+    cout << "Estado final igual al inicial: "
+         << (deltaVacio(calcularDelta(inicial, restaurado)) ? "sí" : "no") << endl;
+}
+
+/**
+ * @brief Enfrenta dos equipos con cola de iniciativa
+ * @param escala Tamaños del demo
+ */
+static void demoBatallaEquipos(const EscalaDemo& escala) {
+    cout << "\n\n===== BATALLA POR EQUIPOS CON INICIATIVA =====" << endl;
+    const int porEquipo = escala.porEquipo;
+    auto gladiadores = PersonajeFactory::crearOleada(TipoPersonaje::Gladiador, porEquipo);
+    auto nigromantes = PersonajeFactory::crearOleada(TipoPersonaje::Nigromante, porEquipo);
+
+    BatallaEquipos batalla(PoliticaObjetivo::MenorHP, 42);
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);  // Los clones salen sin armas: se equipan en silencio
+    for (int i = 0; i < porEquipo; ++i) {
+        gladiadores[i]->agregarArma(PersonajeFactory::crearArmaDesdePrototipo(TipoArma::Espada));
+        nigromantes[i]->agregarArma(PersonajeFactory::crearArmaDesdePrototipo(TipoArma::Baston));
+        batalla.agregar(gladiadores[i].get(), 0);
+        batalla.agregar(nigromantes[i].get(), 1);
+    }
+    cout.rdbuf(salidaOriginal);
+
+    auto inicioBatalla = chrono::steady_clock::now();
+    ResultadoBatalla resultadoBatalla = batalla.ejecutar();
+    auto finBatalla = chrono::steady_clock::now();
+
+    cout << porEquipo << " gladiadores contra " << porEquipo << " nigromantes: ";
+    if (resultadoBatalla.equipoGanador >= 0) {
+        cout << "ganan los " << (resultadoBatalla.equipoGanador == 0 ? "gladiadores" : "nigromantes")
+             << " con " << resultadoBatalla.supervivientes[resultadoBatalla.equipoGanador] << " supervivientes";
+    } else {
+        cout << "sin ganador (" << resultadoBatalla.supervivientes[0] << " contra "
+             << resultadoBatalla.supervivientes[1] << " en pie)";
+    }
+    cout << " tras " << resultadoBatalla.acciones << " acciones en "
+         << chrono::duration_cast<chrono::milliseconds>(finBatalla - inicioBatalla).count() << " ms" << endl;
+}
+
+/**
+ * @brief Enfrenta dos formaciones con posiciones y alcance de arma
+ * @param escala Tamaños del demo
+ */
+static void demoBatallaPosiciones(const EscalaDemo& escala) {
+    cout << "\n\n===== BATALLA CON POSICIONES Y ALCANCE =====" << endl;
+    const int porEquipo = escala.porEquipo;
+    auto lanceros = PersonajeFactory::crearOleada(TipoPersonaje::Gladiador, porEquipo);
+    auto hacheros = PersonajeFactory::crearOleada(TipoPersonaje::Mercenario, porEquipo);
+
+    // Dos formaciones de 40 columnas separadas por 60 m
+    BatallaEquipos batalla(PoliticaObjetivo::MenorHP, 7);
+    batalla.configurarCampo(200.0, 260.0, 4.0);
+    // Armas creadas una por una (no clonadas de un prototipo) para que cada
+    // lanza tenga su asta y cada hacha su mango y su condición de arrojadiza
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    for (int i = 0; i < porEquipo; ++i) {
+        lanceros[i]->agregarArma(PersonajeFactory::crearArma(TipoArma::Lanza));
+        hacheros[i]->agregarArma(PersonajeFactory::crearArma(TipoArma::HachaSimple));
+        double x = 2.0 + (i % 40) * 4.0;
+        double fila = (i / 40) * 1.5;
+        batalla.agregar(lanceros[i].get(), 0, Posicion{x, 10.0 + fila});
+        batalla.agregar(hacheros[i].get(), 1, Posicion{x, 145.0 + fila});
+    }
+    cout.rdbuf(salidaOriginal);
+
+    auto inicioBatalla = chrono::steady_clock::now();
+    ResultadoBatalla resultadoBatalla = batalla.ejecutar();
+    auto finBatalla = chrono::steady_clock::now();
+
+    cout << porEquipo << " lanceros contra " << porEquipo << " hacheros: ";
+    if (resultadoBatalla.equipoGanador >= 0) {
+        cout << "ganan los " << (resultadoBatalla.equipoGanador == 0 ? "lanceros" : "hacheros")
+             << " con " << resultadoBatalla.supervivientes[resultadoBatalla.equipoGanador] << " supervivientes";
+    } else {
+        cout << "sin ganador (" << resultadoBatalla.supervivientes[0] << " contra "
+             << resultadoBatalla.supervivientes[1] << " en pie)";
+    }
+    cout << " tras " << resultadoBatalla.acciones << " ataques (" << resultadoBatalla.lanzamientos
+         << " hachas arrojadas) y " << resultadoBatalla.movimientos << " movimientos en " << chrono::duration_cast<chrono::milliseconds>(finBatalla - inicioBatalla).count()
+         << " ms" << endl;
+}
+
+/**
+ * @brief Aplica pociones y efectos periódicos con la rueda de temporizadores
+ * @param escala Tamaños del demo
+ */
+static void demoEfectosTemporales(const EscalaDemo& escala) {
+    cout << "\n\n===== EFECTOS TEMPORALES (RUEDA DE TEMPORIZADORES) =====" << endl;
+    auto gladiador = PersonajeFactory::crearPersonajeArmado(TipoPersonaje::Gladiador, 1);
+    Pocion fuerza("Tónico de Fuerza", 10, 2, 0.2, Rarity::Comun, 0, EfectoPocion::Fuerza, 8, 2, ColorPocion::Rojo, false);
+    Pocion veneno("Veneno de Áspid", 10, 1, 0.1, Rarity::Comun, 0, EfectoPocion::Veneno, 20, 1, ColorPocion::Verde, false);
+
+    EfectosTemporales efectos;
+    int indice = efectos.registrar(gladiador.get());
+    int hpInicial = gladiador->getHP();
+    const PilaModificadores& pila = *pilaModificadoresDe(gladiador.get());
+
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    efectos.programarRegeneracion(indice, 5, 10);
+    efectos.beberPocion(indice, fuerza, 30);
+    efectos.beberPocion(indice, veneno, 10);
+    for (int tick = 0; tick < 10; ++tick) efectos.avanzar();
+    cout.rdbuf(salidaOriginal);
+    cout << "Tick " << efectos.getTickActual() << ": bonus de fuerza +" << pila.getPlano(AtributoPersonaje::Fuerza)
+         << ", HP " << hpInicial << " -> " << gladiador->getHP() << endl;
+
+    cout.rdbuf(nullptr);
+    for (int tick = 0; tick < 30; ++tick) efectos.avanzar();
+    cout.rdbuf(salidaOriginal);
+    cout << "Tick " << efectos.getTickActual() << ": bonus de fuerza +" << pila.getPlano(AtributoPersonaje::Fuerza)
+         << ", efectos pendientes " << efectos.getEfectosPendientes() << " (regeneración)" << endl;
+
+    // Carga masiva: un temporizador periódico por cada uno de un millón de personajes
+    const int cantidad = escala.temporizadores;
+    RuedaTemporizadores rueda(cantidad);
+    for (int i = 0; i < cantidad; ++i) {
+        rueda.programar(1 + i % 32, i, 0, 1, 32 + static_cast<uint32_t>(i % 32));
+    }
+    vector<EventoTemporizador> vencidos;
+    size_t eventos = 0;
+    auto inicioTicks = chrono::steady_clock::now();
+    for (int tick = 0; tick < 256; ++tick) {
+        vencidos.clear();
+        eventos += rueda.avanzar(vencidos);
+    }
+    auto finTicks = chrono::steady_clock::now();
+    cout << "256 ticks con " << cantidad << " temporizadores activos: " << eventos << " vencimientos en "
+         << chrono::duration_cast<chrono::milliseconds>(finTicks - inicioTicks).count() << " ms" << endl;
+}
+
+/**
+ * @brief Suma y quita modificadores y mide las lecturas de estadísticas
+ * @param escala Tamaños del demo
+ */
+static void demoPilaModificadores(const EscalaDemo& escala) {
+    cout << "\n\n===== PILA DE MODIFICADORES =====" << endl;
+    auto personaje = PersonajeFactory::crearPersonaje(TipoPersonaje::Paladin);
+    Guerrero* paladin = dynamic_cast<Guerrero*>(personaje.get());
+    PilaModificadores& pila = paladin->getModificadores();
+
+    auto mostrar = [paladin](const string& momento) {
+        const EstadisticasDerivadas& stats = paladin->getEstadisticas();
+        cout << momento << ": fuerza " << stats.fuerza << ", defensa " << stats.defensa
+             << ", HP máx " << stats.hpMaximo << ", bonus Golpe Fuerte +"
+             << stats.bonusMovimiento[static_cast<int>(MovimientoCombate::GolpeFuerte)] << endl;
+    };
+
+    mostrar("Base");
+    pila.agregar(Modificador{AtributoPersonaje::Defensa, OrigenModificador::Equipo, 6, 0});
+    pila.agregar(Modificador{AtributoPersonaje::Fuerza, OrigenModificador::Aura, 4, 0});
+    int bendicion = pila.agregar(Modificador{AtributoPersonaje::HPMaximo, OrigenModificador::Buff, 0, 20});
+    pila.agregar(Modificador{AtributoPersonaje::Fuerza, OrigenModificador::Maldicion, 0, -25});
+    mostrar("Equipo + aura + bendición + maldición");
+    pila.quitar(bendicion);
+    pila.quitarOrigen(OrigenModificador::Maldicion);
+    mostrar("Sin bendición ni maldición");
+
+    // Lecturas repetidas sin cambios: no se recalcula nada
+    const int lecturas = escala.lecturas;
+    long long total = 0;
+    auto inicioLecturas = chrono::steady_clock::now();
+    for (int i = 0; i < lecturas; ++i) {
+        total += paladin->getEstadisticas().bonusMovimiento[i % CANTIDAD_MOVIMIENTOS];
+    }
+    auto finLecturas = chrono::steady_clock::now();
+    cout << lecturas << " lecturas de estadísticas en "
+         << chrono::duration_cast<chrono::microseconds>(finLecturas - inicioLecturas).count()
+         << " µs (suma " << total << ")" << endl;
+}
+
+/**
+ * @brief Lanza maleficios con duración y los avanza en lote
+ * @param escala Tamaños del demo
+ */
+static void demoMaleficios(const EscalaDemo& escala) {
+    cout << "\n\n===== MALEFICIOS CON DURACIÓN =====" << endl;
+    MotorMaleficios motor;
+    int marchitar = motor.definir(DefinicionMaleficio{"Marchitar", 6, 2, ReglaApilamiento::Acumular, 3,
+                                                      AtributoPersonaje::Fuerza, -10});
+    int plaga = motor.definir(DefinicionMaleficio{"Plaga", 4, 1, ReglaApilamiento::Independiente, 1,
+                                                  AtributoPersonaje::Fuerza, 0});
+
+    auto personajeBrujo = PersonajeFactory::crearPersonaje(TipoPersonaje::Brujo);
+    auto personajeBarbaro = PersonajeFactory::crearPersonaje(TipoPersonaje::Barbaro);
+    Brujo* brujo = dynamic_cast<Brujo*>(personajeBrujo.get());
+    Guerrero* barbaro = dynamic_cast<Guerrero*>(personajeBarbaro.get());
+    int objetivo = motor.registrar(barbaro);
+    int fuerzaInicial = barbaro->getFuerza();
+    int hpInicial = barbaro->getHP();
+
+    // Tres lanzamientos de Marchitar se acumulan; la fuerza baja 10% por acumulación
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    brujo->aprenderMaleficio("Marchitar");
+    for (int i = 0; i < 3; ++i) {
+        brujo->lanzarMaleficio("Marchitar", motor, objetivo);
+    }
+    cout.rdbuf(salidaOriginal);
+    cout << "Marchitar x" << motor.getAcumulaciones(objetivo, marchitar) << ": fuerza "
+         << fuerzaInicial << " -> " << barbaro->getFuerza() << endl;
+
+    cout.rdbuf(nullptr);
+    while (motor.getActivos() > 0) motor.avanzar();
+    cout.rdbuf(salidaOriginal);
+    cout << "Al terminar: HP " << hpInicial << " -> " << barbaro->getHP()
+         << ", fuerza " << barbaro->getFuerza() << endl;
+
+    // Batalla masiva: miles de maleficios activos avanzando en una sola pasada por tick
+    const int cantidadObjetivos = escala.objetivos;
+    auto oleada = PersonajeFactory::crearOleada(TipoPersonaje::Caballero, cantidadObjetivos);
+    MotorMaleficios motorMasivo;
+    int marchitarMasivo = motorMasivo.definir(motor.getDefinicion(marchitar));
+    int plagaMasiva = motorMasivo.definir(motor.getDefinicion(plaga));
+    for (auto& caballero : oleada) {
+        motorMasivo.registrar(caballero.get());
+    }
+    for (int i = 0; i < cantidadObjetivos * 4; ++i) {
+        motorMasivo.aplicar(i % cantidadObjetivos, (i % 3 == 0) ? marchitarMasivo : plagaMasiva, 1 + i % 3);
+    }
+    size_t activosIniciales = motorMasivo.getActivos();
+
+    cout.rdbuf(nullptr);
+    auto inicioMaleficios = chrono::steady_clock::now();
+    int ticks = 0;
+    while (motorMasivo.getActivos() > 0) {
+        motorMasivo.avanzar();
+        ++ticks;
+    }
+    auto finMaleficios = chrono::steady_clock::now();
+    cout.rdbuf(salidaOriginal);
+    cout << activosIniciales << " maleficios sobre " << cantidadObjetivos << " caballeros: "
+         << motorMasivo.getDanioTotal() << " de daño en " << ticks << " ticks ("
+         << chrono::duration_cast<chrono::milliseconds>(finMaleficios - inicioMaleficios).count() << " ms)" << endl;
+}
+
+/**
+ * @brief Levanta una horda en el pool de no-muertos y la hace combatir
+ * @param escala Tamaños del demo
+ */
+static void demoNoMuertos(const EscalaDemo& escala) {
+    cout << "\n\n===== EJÉRCITO DE NO-MUERTOS (POOL CON GENERACIONES) =====" << endl;
+    const int tamanioHorda = escala.horda;
+    PoolNoMuertos mundo(tamanioHorda);
+    auto personajeNigromante = PersonajeFactory::crearPersonaje(TipoPersonaje::Nigromante);
+    auto paladin = PersonajeFactory::crearPersonaje(TipoPersonaje::Paladin);
+    Nigromante* nigromante = dynamic_cast<Nigromante*>(personajeNigromante.get());
+    nigromante->setMundo(mundo);
+
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    auto inicioHorda = chrono::steady_clock::now();
+    int levantados = nigromante->levantarHorda("Esqueleto", tamanioHorda);
+    auto finHorda = chrono::steady_clock::now();
+    cout.rdbuf(salidaOriginal);
+    cout << levantados << " esqueletos levantados en "
+         << chrono::duration_cast<chrono::microseconds>(finHorda - inicioHorda).count()
+         << " µs (pool: " << mundo.getActivos() << " activos)" << endl;
+
+    // Un identificador guardado deja de ser válido cuando su no-muerto cae,
+    // aunque el lugar se reutilice para otro
+    IdNoMuerto primero = nigromante->getServidores().front();
+
+    // Rondas: la horda ataca y el paladín destruye una franja de esqueletos
+    mt19937 generador(7);
+    int rondas = 0;
+    long long danioHorda = 0;
+    auto inicioCombate = chrono::steady_clock::now();
+    cout.rdbuf(nullptr);
+    while (nigromante->getCantidadServidores() > 0 && rondas < 20) {
+        danioHorda += nigromante->ordenarAtaque(*paladin);
+        paladin->curar(1000);
+        const vector<IdNoMuerto>& servidores = nigromante->getServidores();
+        for (size_t i = 0; i < servidores.size(); i += 2) {
+            nigromante->herirServidor(servidores[i], 5 + static_cast<int>(generador() % 20));
+        }
+        ++rondas;
+    }
+    cout.rdbuf(salidaOriginal);
+    auto finCombate = chrono::steady_clock::now();
+
+    bool primeroValido = mundo.esValido(primero);
+    IdNoMuerto reemplazo = mundo.crear("Zombi", 10, 2);
+    cout << rondas << " rondas: " << danioHorda << " de daño de la horda, quedan "
+         << nigromante->getCantidadServidores() << " esqueletos ("
+         << chrono::duration_cast<chrono::milliseconds>(finCombate - inicioCombate).count() << " ms)" << endl;
+    cout << "Primer esqueleto " << (primeroValido ? "en pie" : "destruido")
+         << "; nuevo zombi en el lugar " << reemplazo.indice << " (generación " << reemplazo.generacion << ")"
+         << ", capacidad del pool " << mundo.getCapacidad() << endl;
+    mundo.destruir(reemplazo);
+    personajeNigromante.reset();  // sus servidores vuelven al pool antes que el pool se destruya
+}
+
+/**
+ * @brief Invoca criaturas de conjuradores contra un bando de bárbaros
+ * @param escala Tamaños del demo
+ */
+static void demoInvocaciones(const EscalaDemo& escala) {
+    cout << "\n\n===== INVOCACIONES DE CONJURADORES =====" << endl;
+    MotorInvocaciones motor;
+    int elemental = motor.definir(PlantillaCriatura{"Elemental de Fuego", 30, 2, 5});
+
+    // Cada conjurador pacta una vez y abre varias invocaciones contra su rival;
+    // todas las criaturas atacan en una sola pasada por tick. Los bárbaros
+    // forman un bando: si uno cae, las criaturas pasan al siguiente en pie
+    const int cantidadDuelos = escala.porEquipo;
+    auto conjuradores = PersonajeFactory::crearOleada(TipoPersonaje::Conjurador, cantidadDuelos);
+    auto barbaros = PersonajeFactory::crearOleada(TipoPersonaje::Barbaro, cantidadDuelos);
+    vector<int> indicesConjuradores;
+    vector<int> indicesBarbaros;
+    for (int i = 0; i < cantidadDuelos; ++i) {
+        indicesConjuradores.push_back(motor.registrar(conjuradores[i].get(), 0));
+        indicesBarbaros.push_back(motor.registrar(barbaros[i].get(), 1));
+    }
+
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    long long danioPrevisto = 0;
+    for (int i = 0; i < cantidadDuelos; ++i) {
+        Conjurador* conjurador = dynamic_cast<Conjurador*>(conjuradores[i].get());
+        conjurador->realizarPacto("Elemental de Fuego");
+        for (int j = 0; j < 5; ++j) {
+            danioPrevisto += conjurador->invocarCriatura("Elemental de Fuego", motor,
+                                                         indicesConjuradores[i], indicesBarbaros[i]);
+        }
+    }
+    cout.rdbuf(salidaOriginal);
+    size_t activasIniciales = motor.getActivos();
+    cout << activasIniciales << " criaturas \"" << motor.getPlantilla(elemental).nombre
+         << "\" invocadas por " << cantidadDuelos << " conjuradores" << endl;
+
+    // Los bárbaros contraatacan a las criaturas que protegen a los primeros conjuradores
+    int caidas = 0;
+    for (int i = 0; i < cantidadDuelos / 10; ++i) {
+        caidas += motor.herirInvocaciones(indicesConjuradores[i], 45);
+    }
+
+    cout.rdbuf(nullptr);
+    auto inicioInvocaciones = chrono::steady_clock::now();
+    int ticks = 0;
+    while (motor.getActivos() > 0) {
+        motor.avanzar();
+        ++ticks;
+    }
+    auto finInvocaciones = chrono::steady_clock::now();
+    cout.rdbuf(salidaOriginal);
+    cout << caidas << " criaturas cayeron antes de atacar; el resto causó " << motor.getDanioTotal()
+         << " de daño (previsto " << danioPrevisto << ") en " << ticks << " ticks ("
+         << chrono::duration_cast<chrono::microseconds>(finInvocaciones - inicioInvocaciones).count() << " µs); "
+         << motor.getReasignaciones() << " cambios de objetivo" << endl;
+}
+
+/**
+ * @brief Publica, toma y liquida contratos desde varios hilos
+ * @param escala Tamaños del demo
+ */
+static void demoMercadoContratos(const EscalaDemo& escala) {
+    cout << "\n\n===== MERCADO DE CONTRATOS =====" << endl;
+    MercadoContratos mercado;
+    auto personajeMercenario = PersonajeFactory::crearPersonaje(TipoPersonaje::Mercenario);
+    Mercenario* mercenario = dynamic_cast<Mercenario*>(personajeMercenario.get());
+    mercado.publicar("Rey Goblin", 120);
+    mercado.publicar("Dragón Rojo", 900, 60);
+    mercado.publicar("Rey Goblin", 80);
+
+    // El dragón exige más reputación; las dos recompensas por el Rey Goblin se suman
+    int oroInicial = mercenario->getOro();
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    mercenario->tomarContrato(mercado);
+    mercenario->tomarContrato("Rey Goblin", mercado);
+    mercenario->completarContrato("Rey Goblin", mercado);
+    size_t cobraron = mercado.liquidar();
+    cout.rdbuf(salidaOriginal);
+    cout << "Reputación " << mercenario->getReputacion() << ", oro " << oroInicial << " -> "
+         << mercenario->getOro() << " (" << cobraron << " pago liquidado), quedan "
+         << mercado.getAbiertos() << " contratos abiertos" << endl;
+
+    // Muchos hilos publican y toman contratos a la vez
+    const int hilos = 8;
+    const int contratosPorHilo = escala.contratosPorHilo;
+    vector<string> objetivos;
+    for (int i = 0; i < 5000; ++i) {
+        objetivos.push_back("Objetivo " + to_string(i));
+    }
+
+    auto inicioPublicacion = chrono::steady_clock::now();
+    vector<thread> publicadores;
+    for (int h = 0; h < hilos; ++h) {
+        publicadores.emplace_back([&mercado, &objetivos, contratosPorHilo, h]() {
+            mt19937 generador(h + 1);
+            for (int i = 0; i < contratosPorHilo; ++i) {
+                mercado.publicar(objetivos[generador() % objetivos.size()],
+                                 10 + static_cast<int>(generador() % 500),
+                                 static_cast<int>(generador() % 7) * 5);
+            }
+        });
+    }
+    for (thread& publicador : publicadores) publicador.join();
+    auto finPublicacion = chrono::steady_clock::now();
+    size_t abiertos = mercado.getAbiertos();
+
+    const int cantidadMercenarios = escala.mercenarios;
+    const int contratosPorMercenario = 100;
+    auto compania = PersonajeFactory::crearOleada(TipoPersonaje::Mercenario, cantidadMercenarios);
+    long long oroAntes = 0;
+    for (auto& miembro : compania) {
+        oroAntes += dynamic_cast<Mercenario*>(miembro.get())->getOro();
+    }
+
+    auto inicioToma = chrono::steady_clock::now();
+    vector<thread> tomadores;
+    for (int h = 0; h < hilos; ++h) {
+        tomadores.emplace_back([&mercado, &compania, h]() {
+            for (size_t m = h; m < compania.size(); m += hilos) {
+                Mercenario* miembro = dynamic_cast<Mercenario*>(compania[m].get());
+                Contrato contrato;
+                for (int i = 0; i < contratosPorMercenario && mercado.tomarMejor(miembro->getReputacion(), contrato); ++i) {
+                    mercado.registrarPago(miembro, contrato.recompensa);
+                }
+            }
+        });
+    }
+    for (thread& tomador : tomadores) tomador.join();
+    auto finToma = chrono::steady_clock::now();
+
+    size_t pagos = mercado.getPagosPendientes();
+    cout.rdbuf(nullptr);
+    auto inicioLiquidacion = chrono::steady_clock::now();
+    cobraron = mercado.liquidar();
+    auto finLiquidacion = chrono::steady_clock::now();
+    cout.rdbuf(salidaOriginal);
+    long long oroDespues = 0;
+    for (auto& miembro : compania) {
+        oroDespues += dynamic_cast<Mercenario*>(miembro.get())->getOro();
+    }
+
+    cout << abiertos << " contratos publicados por " << hilos << " hilos en "
+         << chrono::duration_cast<chrono::milliseconds>(finPublicacion - inicioPublicacion).count() << " ms" << endl;
+    cout << pagos << " contratos tomados por " << cantidadMercenarios << " mercenarios en "
+         << chrono::duration_cast<chrono::milliseconds>(finToma - inicioToma).count() << " ms; "
+         << cobraron << " cobros en lote (" << oroDespues - oroAntes << " de oro) en "
+         << chrono::duration_cast<chrono::microseconds>(finLiquidacion - inicioLiquidacion).count() << " µs" << endl;
+}
+
+/**
+ * @brief Usa técnicas de gladiador por identificador y por nombre
+ * @param escala Tamaños del demo
+ */
+static void demoCatalogoTecnicas(const EscalaDemo& escala) {
+    cout << "\n\n===== CATÁLOGO DE TÉCNICAS DE GLADIADOR =====" << endl;
+    CatalogoTecnicas& catalogo = CatalogoTecnicas::global();
+    auto personajeGladiador = PersonajeFactory::crearPersonaje(TipoPersonaje::Gladiador);
+    Gladiador* gladiador = dynamic_cast<Gladiador*>(personajeGladiador.get());
+
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    gladiador->aprenderTecnica("Golpe del León");
+    gladiador->aprenderTecnica("Danza de Redes");
+    gladiador->aprenderTecnica("Barrido de Escudo");   // se registra con la fórmula por defecto
+    cout.rdbuf(salidaOriginal);
+
+    cout << "Técnicas de " << gladiador->getNombre() << ":" << endl;
+    for (int id : gladiador->getTecnicas()) {
+        const Tecnica tecnica = catalogo.getTecnica(id);
+        cout << "  #" << id << " " << tecnica.nombre << " (fuerza " << tecnica.coefFuerza
+             << "%, destreza " << tecnica.coefDestreza << "%, nivel " << tecnica.coefNivel
+             << "%, costo " << tecnica.costoEstamina << ")" << endl;
+    }
+
+    // Uso repetido por identificador frente a uso por nombre
+    const int usos = escala.usosTecnicas;
+    const int idLeon = catalogo.buscar("Golpe del León");
+    long long danioPorId = 0;
+    long long danioPorNombre = 0;
+    cout.rdbuf(nullptr);
+    auto inicioId = chrono::steady_clock::now();
+    for (int i = 0; i < usos; ++i) {
+        gladiador->recuperarEstamina(100);
+        danioPorId += gladiador->usarTecnica(idLeon);
+    }
+    auto finId = chrono::steady_clock::now();
+    for (int i = 0; i < usos; ++i) {
+        gladiador->recuperarEstamina(100);
+        danioPorNombre += gladiador->usarTecnica("Golpe del León");
+    }
+    auto finNombre = chrono::steady_clock::now();
+    cout.rdbuf(salidaOriginal);
+    cout << usos << " usos por id: " << danioPorId << " de daño en "
+         << chrono::duration_cast<chrono::milliseconds>(finId - inicioId).count() << " ms; por nombre: "
+         << danioPorNombre << " en "
+         << chrono::duration_cast<chrono::milliseconds>(finNombre - finId).count() << " ms" << endl;
+}
+
+/**
+ * @brief Aplica auras de área a un ejército en marcha
+ * @param escala Tamaños del demo
+ */
+static void demoAuras(const EscalaDemo& escala) {
+    cout << "\n\n===== AURAS DE ÁREA (PALADINES Y CABALLEROS) =====" << endl;
+    // Paladines reforzando a un ejército diez veces mayor de bárbaros, más un escuadrón enemigo
+    const int cantidadPaladines = escala.paladines;
+    const int tamanioEjercito = escala.paladines * 10;
+    const double lado = 500.0;
+    MotorAuras motor(lado, lado, RADIO_AURA_DIVINA);
+    auto paladines = PersonajeFactory::crearOleada(TipoPersonaje::Paladin, cantidadPaladines);
+    auto ejercito = PersonajeFactory::crearOleada(TipoPersonaje::Barbaro, tamanioEjercito);
+    auto enemigos = PersonajeFactory::crearOleada(TipoPersonaje::Caballero, escala.paladines * 2);
+
+    mt19937 generador(11);
+    uniform_real_distribution<double> coordenada(0.0, lado);
+    vector<int> indicesPaladines;
+    vector<int> indicesEjercito;
+    vector<Posicion> posicionesEjercito;
+    vector<Posicion> posicionesPaladines;
+    for (auto& paladin : paladines) {
+        posicionesPaladines.push_back(Posicion{coordenada(generador), coordenada(generador)});
+        indicesPaladines.push_back(motor.registrar(paladin.get(), 0, posicionesPaladines.back()));
+    }
+    for (int i = 0; i < tamanioEjercito; ++i) {
+        posicionesEjercito.push_back(Posicion{coordenada(generador), coordenada(generador)});
+    }
+    posicionesEjercito.front() = posicionesPaladines.front();  // la muestra marcha junto al primer paladín
+    for (size_t i = 0; i < ejercito.size(); ++i) {
+        indicesEjercito.push_back(motor.registrar(ejercito[i].get(), 0, posicionesEjercito[i]));
+    }
+    Guerrero* muestra = dynamic_cast<Guerrero*>(ejercito.front().get());
+    int defensaSinAura = muestra->getDefensa();
+    vector<int> indicesEnemigos;
+    for (auto& caballero : enemigos) {
+        indicesEnemigos.push_back(motor.registrar(caballero.get(), 1, Posicion{coordenada(generador), coordenada(generador)}));
+    }
+
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    for (size_t i = 0; i < paladines.size(); ++i) {
+        dynamic_cast<Paladin*>(paladines[i].get())->activarAuraDivina(motor, indicesPaladines[i]);
+    }
+    for (size_t i = 0; i < enemigos.size(); i += 4) {
+        dynamic_cast<Caballero*>(enemigos[i].get())->defenderAliados(motor, indicesEnemigos[i]);
+    }
+    cout.rdbuf(salidaOriginal);
+
+    auto inicioAplicacion = chrono::steady_clock::now();
+    size_t reforzados = motor.avanzar();
+    auto finAplicacion = chrono::steady_clock::now();
+    size_t sinCambios = motor.avanzar();
+    auto finQuieto = chrono::steady_clock::now();
+
+    int conAura = 0;
+    for (int indice : indicesEjercito) {
+        if (motor.getBonusPlano(indice, AtributoPersonaje::Defensa) > 0) ++conAura;
+    }
+    cout << motor.getAuras() << " auras activas: " << reforzados << " personajes actualizados en "
+         << chrono::duration_cast<chrono::microseconds>(finAplicacion - inicioAplicacion).count() << " µs; "
+         << conAura << " de " << tamanioEjercito << " bárbaros dentro de un aura" << endl;
+    cout << "Tick sin movimientos: " << sinCambios << " cambios en "
+         << chrono::duration_cast<chrono::microseconds>(finQuieto - finAplicacion).count() << " µs" << endl;
+    cout << "Defensa de " << muestra->getNombre() << ": " << defensaSinAura << " -> " << muestra->getDefensa()
+         << " (bonus de aura " << motor.getBonusPlano(indicesEjercito.front(), AtributoPersonaje::Defensa) << ")" << endl;
+
+    // El ejército avanza: cada tick se mueve una décima parte y vencen las defensas de los caballeros
+    uniform_real_distribution<double> paso(-3.0, 3.0);
+    auto inicioMarcha = chrono::steady_clock::now();
+    size_t cambiosMarcha = 0;
+    for (int tick = 0; tick < 5; ++tick) {
+        for (size_t i = tick; i < indicesEjercito.size(); i += 10) {
+            Posicion& posicion = posicionesEjercito[i];
+            posicion.x = clamp(posicion.x + paso(generador), 0.0, lado);
+            posicion.y = clamp(posicion.y + paso(generador), 0.0, lado);
+            motor.mover(indicesEjercito[i], posicion);
+        }
+        cambiosMarcha += motor.avanzar();
+    }
+    auto finMarcha = chrono::steady_clock::now();
+    cout << "5 ticks de marcha: " << cambiosMarcha << " cambios de bonus en "
+         << chrono::duration_cast<chrono::milliseconds>(finMarcha - inicioMarcha).count() << " ms" << endl;
+}
+
+/**
+ * @brief Fabrica mezclas en lote con el recetario de alquimia
+ * @param escala Tamaños del demo
+ */
+static void demoRecetario(const EscalaDemo& escala) {
+    cout << "\n\n===== RECETARIO DE ALQUIMIA =====" << endl;
+    RecetarioAlquimia& recetario = RecetarioAlquimia::global();
+
+    Pocion antidoto("Antídoto de Ruda", 10, 2, 0.2, Rarity::PocoComun, 0, EfectoPocion::Antidoto, 14, 2, ColorPocion::Verde, false);
+    Pocion veneno("Veneno de Áspid", 10, 1, 0.1, Rarity::Comun, 0, EfectoPocion::Veneno, 20, 1, ColorPocion::Verde, false);
+    antidoto.combinar(veneno, recetario);
+
+    cout << "Recetas que usan " << efectoPocionToString(EfectoPocion::Veneno) << ":";
+    for (int id : recetario.recetasCon(EfectoPocion::Veneno)) {
+        cout << " [" << recetario.getReceta(id).nombre << "]";
+    }
+    cout << endl;
+
+    // Una economía de alquimistas: muchas mezclas de un surtido acotado de pociones
+    mt19937 generador(21);
+    uniform_int_distribution<int> efectoAleatorio(0, 6);
+    uniform_int_distribution<int> colorAleatorio(0, 6);
+    uniform_int_distribution<int> potenciaAleatoria(1, 12);
+    uniform_int_distribution<int> rarezaAleatoria(0, 3);
+    uniform_int_distribution<int> cantidadAleatoria(2, MAX_INGREDIENTES - 1);
+    vector<Ingrediente> inventario;
+    for (int i = 0; i < 40; ++i) {
+        inventario.push_back(Ingrediente{static_cast<EfectoPocion>(efectoAleatorio(generador)),
+                                         static_cast<ColorPocion>(colorAleatorio(generador)),
+                                         potenciaAleatoria(generador) * 5,
+                                         static_cast<Rarity>(rarezaAleatoria(generador))});
+    }
+    uniform_int_distribution<size_t> elegir(0, inventario.size() - 1);
+    vector<vector<Ingrediente>> pedidos(escala.mezclas);
+    for (vector<Ingrediente>& pedido : pedidos) {
+        int cantidad = cantidadAleatoria(generador);
+        for (int i = 0; i < cantidad; ++i) {
+            pedido.push_back(inventario[elegir(generador)]);
+        }
+    }
+
+    vector<ResultadoMezcla> resultados;
+    auto inicio = chrono::steady_clock::now();
+    size_t exitosas = recetario.fabricarLote(pedidos, resultados);
+    auto fin = chrono::steady_clock::now();
+    cout << pedidos.size() << " mezclas en "
+         << chrono::duration_cast<chrono::milliseconds>(fin - inicio).count() << " ms: "
+         << exitosas << " exitosas, " << recetario.getMemorizados() << " resultados distintos memorizados ("
+         << recetario.getAciertos() << " aciertos, " << recetario.getFallos() << " calculadas)" << endl;
+
+    inicio = chrono::steady_clock::now();
+    recetario.fabricarLote(pedidos, resultados);
+    fin = chrono::steady_clock::now();
+    cout << "Segunda ronda con la memoria llena: "
+         << chrono::duration_cast<chrono::milliseconds>(fin - inicio).count() << " ms" << endl;
+}
+
+/**
+ * @brief Carga la armería por columnas, la consulta y presta una lanza
+ * @param escala Tamaños del demo
+ */
+static void demoArmeria(const EscalaDemo& escala) {
+    cout << "\n\n===== ARMERÍA POR COLUMNAS =====" << endl;
+    // Depósito con armas de todos los tipos; la mitad con desgaste aleatorio
+    const int cantidadArmas = escala.armasArmeria;
+    Armeria armeria;
+    mt19937 generador(48);
+    uniform_int_distribution<int> tipoAleatorio(0, static_cast<int>(TipoArma::Garrote));
+    uniform_int_distribution<int> desgaste(0, 99);
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    auto inicioCarga = chrono::steady_clock::now();
+    for (int i = 0; i < cantidadArmas; ++i) {
+        unique_ptr<InterfazArmas> arma = PersonajeFactory::crearArma(static_cast<TipoArma>(tipoAleatorio(generador)));
+        if (i % 2 == 0) {
+            CheckpointArma checkpoint = arma->guardarCheckpoint();
+            checkpoint.durabilidadActual = checkpoint.durabilidadActual * desgaste(generador) / 100;
+            arma->restaurarCheckpoint(checkpoint);
+        }
+        armeria.agregar(move(arma));
+    }
+    auto finCarga = chrono::steady_clock::now();
+    cout.rdbuf(salidaOriginal);
+    auto inicioIndices = chrono::steady_clock::now();
+    armeria.indexar();
+    auto finIndices = chrono::steady_clock::now();
+
+    vector<uint32_t> encontradas;
+    ConsultaArmeria lanzaEpica;
+    lanzaEpica.tipo = static_cast<int>(TipoArma::Lanza);
+    lanzaEpica.rarezaMinima = Rarity::Epico;
+    lanzaEpica.rarezaMaxima = Rarity::Epico;
+    lanzaEpica.durabilidadMinima = 500;
+    auto inicioConsulta = chrono::steady_clock::now();
+    armeria.mejores(lanzaEpica, 1, encontradas);
+    auto finConsulta = chrono::steady_clock::now();
+    cout << cantidadArmas << " armas cargadas en "
+         << chrono::duration_cast<chrono::milliseconds>(finCarga - inicioCarga).count() << " ms e indexadas en "
+         << chrono::duration_cast<chrono::milliseconds>(finIndices - inicioIndices).count() << " ms" << endl;
+    cout << "Mejor lanza épica con más de la mitad de durabilidad ("
+         << chrono::duration_cast<chrono::microseconds>(finConsulta - inicioConsulta).count() << " µs): "
+         << armeria.getArma(encontradas.front())->getNombre() << ", poder " << armeria.getPoder(encontradas.front())
+         << ", durabilidad " << armeria.getDurabilidad(encontradas.front()) / 10 << "%" << endl;
+
+    ConsultaArmeria legendarias;
+    legendarias.rarezaMinima = Rarity::Legendario;
+    inicioConsulta = chrono::steady_clock::now();
+    armeria.mejores(legendarias, 10, encontradas);
+    finConsulta = chrono::steady_clock::now();
+    cout << "Top 10 legendarias de cualquier tipo en "
+         << chrono::duration_cast<chrono::microseconds>(finConsulta - inicioConsulta).count() << " µs; la primera: "
+         << armeria.getArma(encontradas.front())->getNombre() << " (poder " << armeria.getPoder(encontradas.front()) << ")" << endl;
+
+    ConsultaArmeria casiNuevas;
+    casiNuevas.tipo = static_cast<int>(TipoArma::Espada);
+    casiNuevas.durabilidadMinima = 990;
+    casiNuevas.poderMinimo = 45;
+    inicioConsulta = chrono::steady_clock::now();
+    size_t cantidadEncontradas = armeria.buscar(casiNuevas, encontradas);
+    finConsulta = chrono::steady_clock::now();
+    cout << "Espadas de poder 45+ casi intactas: " << cantidadEncontradas << " en "
+         << chrono::duration_cast<chrono::microseconds>(finConsulta - inicioConsulta).count() << " µs" << endl;
+
+    // Préstamo: la mejor lanza sale al inventario de un guerrero, pelea y vuelve gastada
+    auto guerrero = PersonajeFactory::crearPersonaje(TipoPersonaje::Caballero);
+    armeria.mejores(lanzaEpica, 1, encontradas);
+    uint32_t lanza = encontradas.front();
+    salidaOriginal = cout.rdbuf(nullptr);
+    armeria.entregar(lanza, *guerrero);
+    for (int i = 0; i < 20; ++i) {
+        guerrero->atacar(MovimientoCombate::GolpeFuerte);
+    }
+    armeria.devolver(*guerrero, 0);
+    cout.rdbuf(salidaOriginal);
+    armeria.mejores(lanzaEpica, 1, encontradas);
+    cout << "Tras prestarla y devolverla, la lanza tiene " << armeria.getDurabilidad(lanza) / 10
+         << "% de durabilidad; la mejor lanza épica ahora es "
+         << (encontradas.empty() ? string("ninguna") : armeria.getArma(encontradas.front())->getNombre()) << endl;
+}
+
+/**
+ * @brief Ordena armas sueltas por daño esperado sin usarlas
+ * @param escala Tamaños del demo
+ */
+static void demoDanioEsperado(const EscalaDemo& escala) {
+    cout << "\n\n===== DAÑO ESPERADO POR ARMA =====" << endl;
+    // Ranking de armas sueltas para un gladiador, sin usar ninguna
+    const int cantidadArmas = escala.comparacion;
+    auto personaje = PersonajeFactory::crearPersonaje(TipoPersonaje::Gladiador);
+    Gladiador* gladiador = dynamic_cast<Gladiador*>(personaje.get());
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+    vector<unique_ptr<InterfazArmas>> armas;
+    vector<const InterfazArmas*> candidatas;
+    for (int i = 0; i < cantidadArmas; ++i) {
+        armas.push_back(PersonajeFactory::crearArma(static_cast<TipoArma>(i % (static_cast<int>(TipoArma::Garrote) + 1))));
+        candidatas.push_back(armas.back().get());
+    }
+    cout.rdbuf(salidaOriginal);
+
+    EvaluadorDanio evaluador;
+    vector<size_t> orden;
+    auto inicioRanking = chrono::steady_clock::now();
+    evaluador.ordenar(*personaje, candidatas, MovimientoCombate::GolpeFuerte, orden);
+    auto finRanking = chrono::steady_clock::now();
+    evaluador.ordenar(*personaje, candidatas, MovimientoCombate::DefensaYGolpe, orden);
+    auto inicioRepetido = chrono::steady_clock::now();
+    evaluador.ordenar(*personaje, candidatas, MovimientoCombate::GolpeFuerte, orden);
+    auto finRepetido = chrono::steady_clock::now();
+    cout << cantidadArmas << " armas evaluadas en "
+         << chrono::duration_cast<chrono::microseconds>(finRanking - inicioRanking).count() << " µs; "
+         << "el mismo ranking con las tablas memorizadas en "
+         << chrono::duration_cast<chrono::microseconds>(finRepetido - inicioRepetido).count() << " µs ("
+         << evaluador.getAciertos() << " aciertos, " << evaluador.getFallos() << " fallos)" << endl;
+    for (int i = 0; i < 3; ++i) {
+        EstimacionDanio estimacion = evaluador.evaluar(*personaje, *candidatas[orden[i]], MovimientoCombate::GolpeFuerte);
+        cout << "  " << i + 1 << ". " << candidatas[orden[i]]->getNombre() << ": " << estimacion.esperado
+             << " de daño esperado (varianza " << estimacion.varianza << ")" << endl;
+    }
+
+    // Los garrotes son los únicos cuyo próximo golpe depende del azar
+    for (const InterfazArmas* arma : candidatas) {
+        EstimacionDanio estimacion = evaluador.evaluar(*personaje, *arma, MovimientoCombate::GolpeFuerte);
+        if (estimacion.varianza > 0.0) {
+            cout << "Garrote " << arma->getNombre() << ": " << estimacion.esperado
+                 << " de daño esperado con varianza " << estimacion.varianza << endl;
+            break;
+        }
+    }
+
+    // Usar la mejor arma gasta durabilidad y solo su tabla se recalcula
+    size_t fallosAntes = evaluador.getFallos();
+    salidaOriginal = cout.rdbuf(nullptr);
+    armas[orden[0]]->usar();
+    cout.rdbuf(salidaOriginal);
+    evaluador.ordenar(*personaje, candidatas, MovimientoCombate::GolpeFuerte, orden);
+    cout << "Tras usar la mejor arma se recalcularon " << evaluador.getFallos() - fallosAntes << " tabla(s)" << endl;
+
+    // Diez victorias más suben el bonus de experiencia: cambia la firma del gladiador
+    fallosAntes = evaluador.getFallos();
+    salidaOriginal = cout.rdbuf(nullptr);
+    for (int i = 0; i < 10; ++i) {
+        gladiador->registrarVictoria();
+    }
+    cout.rdbuf(salidaOriginal);
+    evaluador.ordenar(*personaje, candidatas, MovimientoCombate::GolpeFuerte, orden);
+    cout << "Tras diez victorias se recalcularon " << evaluador.getFallos() - fallosAntes
+         << " tablas; la mejor arma hace ahora "
+         << evaluador.evaluar(*personaje, *candidatas[orden[0]], MovimientoCombate::GolpeFuerte).esperado << endl;
+
+    // Preparar una lanza cambia su checkpoint: la tabla se recalcula sola
+    Lanza* lanza = dynamic_cast<Lanza*>(armas[static_cast<int>(TipoArma::Lanza)].get());
+    double antes = evaluador.evaluar(*personaje, *lanza, MovimientoCombate::GolpeFuerte).esperado;
+    salidaOriginal = cout.rdbuf(nullptr);
+    lanza->prepararContraCarga();
+    cout.rdbuf(salidaOriginal);
+    cout << "Lanza " << lanza->getNombre() << ": " << antes << " de daño esperado, "
+         << evaluador.evaluar(*personaje, *lanza, MovimientoCombate::GolpeFuerte).esperado
+         << " preparada contra carga" << endl;
+}
+
+/**
+ * @brief Equipa un roster entero con las mejores armas de la armería
+ * @param escala Tamaños del demo
+ */
+static void demoEquipamientoOptimo(const EscalaDemo& escala) {
+    cout << "\n\n===== EQUIPAMIENTO ÓPTIMO DESDE LA ARMERÍA =====" << endl;
+    const int cantidadArmas = escala.armasOptimizador;
+    const int cantidadPersonajes = escala.personajesOptimizador;
+    const int cantidadTipos = static_cast<int>(TipoPersonaje::Gladiador) + 1;
+    streambuf* salidaOriginal = cout.rdbuf(nullptr);
+
+    // Rivales esperados: un bárbaro con hacha doble (el doble de frecuente) y un hechicero con bastón
+    auto barbaro = PersonajeFactory::crearPersonaje(TipoPersonaje::Barbaro);
+    auto hechicero = PersonajeFactory::crearPersonaje(TipoPersonaje::Hechicero);
+    auto hacha = PersonajeFactory::crearArma(TipoArma::HachaDoble);
+    auto baston = PersonajeFactory::crearArma(TipoArma::Baston);
+    vector<RivalObjetivo> rivales = {
+        OptimizadorEquipamiento::describirRival(*barbaro, hacha.get(), 2.0),
+        OptimizadorEquipamiento::describirRival(*hechicero, baston.get(), 1.0)
+    };
+
+    // Armería con desgaste aleatorio en la mitad de las armas
+    Armeria armeria;
+    mt19937 generador(50);
+    uniform_int_distribution<int> tipoAleatorio(0, static_cast<int>(TipoArma::Garrote));
+    uniform_int_distribution<int> desgaste(0, 99);
+    auto inicioCarga = chrono::steady_clock::now();
+    for (int i = 0; i < cantidadArmas; ++i) {
+        unique_ptr<InterfazArmas> arma = PersonajeFactory::crearArma(static_cast<TipoArma>(tipoAleatorio(generador)));
+        if (i % 2 == 0) {
+            CheckpointArma checkpoint = arma->guardarCheckpoint();
+            checkpoint.durabilidadActual = checkpoint.durabilidadActual * desgaste(generador) / 100;
+            arma->restaurarCheckpoint(checkpoint);
+        }
+        armeria.agregar(move(arma));
+    }
+    vector<shared_ptr<InterfazPersonaje>> personajes;
+    vector<InterfazPersonaje*> roster;
+    for (int i = 0; i < cantidadPersonajes; ++i) {
+        personajes.push_back(PersonajeFactory::crearPersonaje(static_cast<TipoPersonaje>(i % cantidadTipos)));
+        roster.push_back(personajes.back().get());
+    }
+    auto finCarga = chrono::steady_clock::now();
+    cout.rdbuf(salidaOriginal);
+    cout << cantidadArmas << " armas y " << cantidadPersonajes << " personajes creados en "
+         << chrono::duration_cast<chrono::milliseconds>(finCarga - inicioCarga).count() << " ms" << endl;
+
+    // Un solo personaje contra todo el pool, sin reservar armas
+    OptimizadorEquipamiento optimizador(rivales);
+    vector<uint32_t> ids;
+    armeria.buscar(ConsultaArmeria{}, ids);
+    vector<const InterfazArmas*> pool;
+    for (uint32_t id : ids) {
+        pool.push_back(armeria.getArma(id));
+    }
+    auto inicioIndice = chrono::steady_clock::now();
+    optimizador.indexar(pool);
+    auto finIndice = chrono::steady_clock::now();
+    auto inicioUno = chrono::steady_clock::now();
+    Equipamiento mejor = optimizador.optimizar(*roster.back());
+    auto finUno = chrono::steady_clock::now();
+    cout << "Índice de " << optimizador.getCandidatas() << " armas en "
+         << chrono::duration_cast<chrono::milliseconds>(finIndice - inicioIndice).count() << " ms" << endl;
+    auto nombreEnPool = [&pool](uint32_t posicion) {
+        return posicion != OptimizadorEquipamiento::NINGUNA ? pool[posicion]->getNombre() : string("nada");
+    };
+    cout << roster.back()->getNombre() << ": " << nombreEnPool(mejor.equipada) << " equipada y "
+         << nombreEnPool(mejor.reserva) << " de reserva, " << mejor.victoria * 100 << "% de victorias ("
+         << chrono::duration_cast<chrono::microseconds>(finUno - inicioUno).count() << " µs, "
+         << optimizador.getRevisadas() << " armas revisadas, " << optimizador.getEvaluados() << " equipamientos evaluados)" << endl;
+    cout << "Con una espada recién forjada tendría "
+         << optimizador.probabilidadVictoria(*roster.back(), PersonajeFactory::crearArma(TipoArma::Espada).get(), nullptr) * 100
+         << "% de victorias" << endl;
+
+    // Todo el roster, sin repetir armas, y entrega desde la armería
+    vector<Equipamiento> equipamientos;
+    salidaOriginal = cout.rdbuf(nullptr);
+    auto inicioRoster = chrono::steady_clock::now();
+    size_t equipados = optimizador.equiparRoster(roster, armeria, equipamientos);
+    auto finRoster = chrono::steady_clock::now();
+    cout.rdbuf(salidaOriginal);
+    double victoriaMedia = 0.0;
+    for (const Equipamiento& equipamiento : equipamientos) {
+        victoriaMedia += equipamiento.victoria / equipamientos.size();
+    }
+    cout << equipados << " personajes equipados en "
+         << chrono::duration_cast<chrono::milliseconds>(finRoster - inicioRoster).count() << " ms ("
+         << optimizador.getRevisadas() << " armas revisadas, " << optimizador.getEvaluados()
+         << " equipamientos evaluados); victoria media " << victoriaMedia * 100 << "%" << endl;
+    auto armaDe = [](const InterfazPersonaje& personaje) {
+        const InterfazArmas* arma = personaje.getArma(0);
+        return arma ? arma->getNombre() : string("ningún arma");
+    };
+    cout << "Quedan " << armeria.getCantidad() - armeria.getPrestadas() << " armas en la armería; "
+         << roster.front()->getNombre() << " lleva " << armaDe(*roster.front())
+         << " y " << roster.back()->getNombre() << " lleva " << armaDe(*roster.back()) << endl;
+}
+
+/**
+ * @brief Función principal del programa
+ * 
+ * Demuestra la funcionalidad de la clase PersonajeFactory creando diferentes
+ * tipos de personajes y mostrando su información, y recorre los demos de
+ * cada subsistema.
+ * 
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos; --benchmark usa los tamaños grandes
+ * @return 0 si el programa termina correctamente
+ */
+int main(int argc, char* argv[]) {
+    const EscalaDemo& escala = (argc > 1 && string(argv[1]) == "--benchmark") ? ESCALA_BENCHMARK : ESCALA_DEMO;
+    cout << "===== EJERCICIO 2: CREACIÓN DINÁMICA DE PERSONAJES Y ARMAS =====" << endl << endl;
     
+    demoCreacionBasica();
+    ResultadoGeneracion resultado = demoGruposAleatorios();
+    demoPrototipos(escala);
+    demoMundoProcedural();
+    demoTablasBotin(escala);
+    vector<shared_ptr<InterfazPersonaje>> loteClonado = demoAtributosPorLotes(escala);
+
+    vector<shared_ptr<InterfazPersonaje>> roster = resultado.magos;
+    roster.insert(roster.end(), resultado.guerreros.begin(), resultado.guerreros.end());
+    roster.insert(roster.end(), loteClonado.begin(), loteClonado.end());
+    demoSnapshotRoster(roster);
+    demoExportacion(roster);
+
+    demoCheckpoint(escala);
+    demoBatallaEquipos(escala);
+    demoBatallaPosiciones(escala);
+    demoEfectosTemporales(escala);
+    demoPilaModificadores(escala);
+    demoMaleficios(escala);
+    demoNoMuertos(escala);
+    demoInvocaciones(escala);
+    demoMercadoContratos(escala);
+    demoCatalogoTecnicas(escala);
+    demoAuras(escala);
+    demoRecetario(escala);
+    demoArmeria(escala);
+    demoDanioEsperado(escala);
+    demoEquipamientoOptimo(escala);
+
     cout << "\n===== PROGRAMA FINALIZADO =====" << endl;
     
     return 0;
@@ -0,0 +1,190 @@
+/**
+ * @file ClasificacionLiga.cpp
+ * @brief Implementación de la tabla de posiciones de la liga
+ */
+
+#include "ClasificacionLiga.hpp"
+
+namespace {
+
+/**
+ * @brief Prioridad pseudoaleatoria de un nodo (splitmix64 del índice)
+ *
+ * Derivarla del índice hace que el árbol tenga la misma forma en cada
+ * ejecución.
+ */
+uint32_t prioridadDe(int jugador) {
+    uint64_t z = static_cast<uint64_t>(jugador) + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<uint32_t>(z ^ (z >> 31));
+}
+
+} // namespace
+
+/**
+ * @brief Implementación del constructor de ClasificacionLiga
+ */
+ClasificacionLiga::ClasificacionLiga() : raiz(NULO), cantidad(0) {}
+
+/**
+ * @brief Implementación del método actualizar
+ *
+ * Cambiar un puntaje es quitar el nodo y volver a insertarlo con la nueva
+ * clave.
+ *
+ * @param jugador Índice del jugador
+ * @param puntaje Nuevo puntaje
+ */
+void ClasificacionLiga::actualizar(int jugador, double puntaje) {
+    if (jugador < 0) return;
+    if (jugador >= static_cast<int>(nodos.size())) {
+        for (int i = static_cast<int>(nodos.size()); i <= jugador; ++i) {
+            nodos.push_back(Nodo{0.0, prioridadDe(i), NULO, NULO, 1, false});
+        }
+    }
+    quitar(jugador);
+
+    Nodo& nodo = nodos[jugador];
+    nodo.puntaje = puntaje;
+    nodo.izquierdo = nodo.derecho = NULO;
+    nodo.tamanio = 1;
+    nodo.presente = true;
+
+    int menores, resto;
+    separar(raiz, jugador, menores, resto);
+    raiz = unir(unir(menores, jugador), resto);
+    ++cantidad;
+}
+
+bool ClasificacionLiga::quitar(int jugador) {
+    if (jugador < 0 || jugador >= static_cast<int>(nodos.size()) || !nodos[jugador].presente) {
+        return false;
+    }
+    raiz = quitarDe(raiz, jugador);
+    nodos[jugador].presente = false;
+    --cantidad;
+    return true;
+}
+
+/**
+ * @brief Implementación del método getPosicion
+ *
+ * Baja desde la raíz sumando los subárboles izquierdos que quedan antes
+ * del jugador.
+ *
+ * @param jugador Índice del jugador
+ * @return Posición (1 es el primero), 0 si no está en la tabla
+ */
+int ClasificacionLiga::getPosicion(int jugador) const {
+    if (jugador < 0 || jugador >= static_cast<int>(nodos.size()) || !nodos[jugador].presente) {
+        return 0;
+    }
+    int anteriores = 0;
+    int t = raiz;
+    while (t != NULO) {
+        if (t == jugador) {
+            return anteriores + tamanio(nodos[t].izquierdo) + 1;
+        }
+        if (precede(jugador, t)) {
+            t = nodos[t].izquierdo;
+        } else {
+            anteriores += tamanio(nodos[t].izquierdo) + 1;
+            t = nodos[t].derecho;
+        }
+    }
+    return 0;
+}
+
+int ClasificacionLiga::getEnPosicion(int posicion) const {
+    if (posicion < 1 || posicion > static_cast<int>(cantidad)) {
+        return -1;
+    }
+    int t = raiz;
+    while (t != NULO) {
+        int izquierda = tamanio(nodos[t].izquierdo);
+        if (posicion <= izquierda) {
+            t = nodos[t].izquierdo;
+        } else if (posicion == izquierda + 1) {
+            return t;
+        } else {
+            posicion -= izquierda + 1;
+            t = nodos[t].derecho;
+        }
+    }
+    return -1;
+}
+
+int ClasificacionLiga::contarMayores(double puntaje) const {
+    int mayores = 0;
+    int t = raiz;
+    while (t != NULO) {
+        if (nodos[t].puntaje > puntaje) {
+            mayores += tamanio(nodos[t].izquierdo) + 1;
+            t = nodos[t].derecho;
+        } else {
+            t = nodos[t].izquierdo;
+        }
+    }
+    return mayores;
+}
+
+double ClasificacionLiga::getPuntaje(int jugador) const {
+    return jugador >= 0 && jugador < static_cast<int>(nodos.size()) && nodos[jugador].presente
+        ? nodos[jugador].puntaje : 0.0;
+}
+
+size_t ClasificacionLiga::getCantidad() const { return cantidad; }
+
+bool ClasificacionLiga::precede(int a, int b) const {
+    if (nodos[a].puntaje != nodos[b].puntaje) return nodos[a].puntaje > nodos[b].puntaje;
+    return a < b;
+}
+
+int ClasificacionLiga::tamanio(int nodo) const { return nodo == NULO ? 0 : nodos[nodo].tamanio; }
+
+void ClasificacionLiga::recalcular(int nodo) {
+    nodos[nodo].tamanio = tamanio(nodos[nodo].izquierdo) + tamanio(nodos[nodo].derecho) + 1;
+}
+
+void ClasificacionLiga::separar(int t, int clave, int& menores, int& resto) {
+    if (t == NULO) {
+        menores = resto = NULO;
+        return;
+    }
+    if (precede(t, clave)) {
+        separar(nodos[t].derecho, clave, nodos[t].derecho, resto);
+        menores = t;
+    } else {
+        separar(nodos[t].izquierdo, clave, menores, nodos[t].izquierdo);
+        resto = t;
+    }
+    recalcular(t);
+}
+
+int ClasificacionLiga::unir(int a, int b) {
+    if (a == NULO) return b;
+    if (b == NULO) return a;
+    if (nodos[a].prioridad > nodos[b].prioridad) {
+        nodos[a].derecho = unir(nodos[a].derecho, b);
+        recalcular(a);
+        return a;
+    }
+    nodos[b].izquierdo = unir(a, nodos[b].izquierdo);
+    recalcular(b);
+    return b;
+}
+
+int ClasificacionLiga::quitarDe(int t, int jugador) {
+    if (t == NULO) return NULO;
+    if (t == jugador) {
+        return unir(nodos[t].izquierdo, nodos[t].derecho);
+    }
+    if (precede(jugador, t)) {
+        nodos[t].izquierdo = quitarDe(nodos[t].izquierdo, jugador);
+    } else {
+        nodos[t].derecho = quitarDe(nodos[t].derecho, jugador);
+    }
+    recalcular(t);
+    return t;
+}
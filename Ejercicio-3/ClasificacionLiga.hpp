@@ -0,0 +1,98 @@
+/**
+ * @file ClasificacionLiga.hpp
+ * @brief Define la tabla de posiciones de una liga con consultas por posición
+ *
+ * Un árbol de estadísticas de orden (treap) mantiene a los jugadores
+ * ordenados por puntaje. Cada nodo guarda el tamaño de su subárbol, así que
+ * tanto la posición de un jugador como el jugador en una posición se
+ * obtienen en O(log n) esperado, igual que insertar o cambiar un puntaje.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class ClasificacionLiga
+ * @brief Tabla de posiciones ordenada por puntaje (mayor primero)
+ *
+ * Los jugadores se identifican con enteros consecutivos desde 0 y cada uno
+ * ocupa siempre el nodo de su mismo índice. A igual puntaje va primero el
+ * jugador de índice menor, así el orden es total y determinista.
+ */
+class ClasificacionLiga {
+public:
+    ClasificacionLiga();
+
+    /**
+     * @brief Agrega un jugador o actualiza su puntaje
+     * @param jugador Índice del jugador
+     * @param puntaje Nuevo puntaje
+     */
+    void actualizar(int jugador, double puntaje);
+
+    /**
+     * @brief Quita un jugador de la tabla
+     * @param jugador Índice del jugador
+     * @return true si estaba en la tabla
+     */
+    bool quitar(int jugador);
+
+    /**
+     * @brief Obtiene la posición de un jugador
+     * @param jugador Índice del jugador
+     * @return Posición (1 es el primero), 0 si no está en la tabla
+     */
+    int getPosicion(int jugador) const;
+
+    /**
+     * @brief Obtiene el jugador que ocupa una posición
+     * @param posicion Posición buscada (1 es el primero)
+     * @return Índice del jugador, -1 si la posición no existe
+     */
+    int getEnPosicion(int posicion) const;
+
+    /**
+     * @brief Cuenta los jugadores con puntaje estrictamente mayor
+     * @param puntaje Puntaje de referencia
+     * @return Cantidad de jugadores por encima
+     */
+    int contarMayores(double puntaje) const;
+
+    double getPuntaje(int jugador) const;
+    size_t getCantidad() const;
+
+private:
+    static constexpr int NULO = -1;
+
+    struct Nodo {
+        double puntaje;
+        uint32_t prioridad;
+        int izquierdo;
+        int derecho;
+        int tamanio;
+        bool presente;
+    };
+
+    /// true si el jugador a va antes que el jugador b en la tabla
+    bool precede(int a, int b) const;
+
+    int tamanio(int nodo) const;
+    void recalcular(int nodo);
+
+    /// Separa t en los nodos que preceden a clave y el resto
+    void separar(int t, int clave, int& menores, int& resto);
+
+    /// Une dos árboles donde todo a precede a todo b
+    int unir(int a, int b);
+
+    int quitarDe(int t, int jugador);
+
+    vector<Nodo> nodos;
+    int raiz;
+    size_t cantidad;
+};
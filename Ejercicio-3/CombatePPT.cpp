@@ -30,7 +30,10 @@ using namespace std;
 CombatePPT::CombatePPT(bool configManual, bool usarDañoFijo)
     : jugador1(nullptr), jugador2(nullptr), 
       combateTerminado(false), configManual(configManual),
-      usarDañoFijo(usarDañoFijo) {
+      usarDañoFijo(usarDañoFijo), turnosJugados(0),
+      tablaIA(16), ia(ConfiguracionMCTS{5.0, 0, 2, static_cast<uint64_t>(time(nullptr))}) {
+    ia.setTablaTransposicion(&tablaIA);
+
     // Inicializar la semilla para números aleatorios
     srand(static_cast<unsigned int>(time(nullptr)));
 }
@@ -135,8 +138,8 @@ bool CombatePPT::ejecutarTurno() {
     // Obtener elección del jugador 1 (usuario)
     OpcionAtaque opcionJ1 = obtenerEleccionJugador();
     
-    // Generar elección aleatoria para jugador 2 (IA)
-    OpcionAtaque opcionJ2 = generarEleccionAleatoria();
+    // Elección del jugador 2 (IA) por búsqueda Monte Carlo
+    OpcionAtaque opcionJ2 = generarEleccionIA();
     
     // Mostrar elecciones
     cout << "\n" << jugador1->personaje->getNombre() << " elige: " 
@@ -155,6 +158,8 @@ bool CombatePPT::ejecutarTurno() {
         aplicarDanio(*jugador2, *jugador1, opcionJ2);
     }
     
+    turnosJugados++;
+    
     // Verificar si ha terminado el combate
     if (jugador1->personaje->getHP() <= 0 || jugador2->personaje->getHP() <= 0) {
         combateTerminado = true;
@@ -217,6 +222,20 @@ OpcionAtaque CombatePPT::generarEleccionAleatoria() const {
     return static_cast<OpcionAtaque>(rand() % 3 + 1);
 }
 
+/**
+ * @brief Implementación del método generarEleccionIA
+ * 
+ * Si el combate no está configurado se recurre a la elección aleatoria.
+ * 
+ * @return Opción de ataque elegida por la IA
+ */
+OpcionAtaque CombatePPT::generarEleccionIA() {
+    if (jugador1 == nullptr || jugador2 == nullptr) {
+        return generarEleccionAleatoria();
+    }
+    return ia.elegirOpcion(capturarEstado());
+}
+
 /**
  * @brief Implementación del método resolverEnfrentamiento
  * 
@@ -230,17 +249,7 @@ OpcionAtaque CombatePPT::generarEleccionAleatoria() const {
  * @return true si gana el jugador 1, false si gana el jugador 2
  */
 bool CombatePPT::resolverEnfrentamiento(OpcionAtaque op1, OpcionAtaque op2) const {
-    // Implementar lógica piedra-papel-tijera
-    if (op1 == OpcionAtaque::GolpeFuerte && op2 == OpcionAtaque::GolpeRapido)
-        return true;  // Golpe Fuerte gana a Golpe Rápido
-    
-    if (op1 == OpcionAtaque::GolpeRapido && op2 == OpcionAtaque::DefensaYGolpe)
-        return true;  // Golpe Rápido gana a Defensa y Golpe
-    
-    if (op1 == OpcionAtaque::DefensaYGolpe && op2 == OpcionAtaque::GolpeFuerte)
-        return true;  // Defensa y Golpe gana a Golpe Fuerte
-    
-    return false;  // En cualquier otro caso, el jugador 1 pierde
+    return ganaEnfrentamiento(op1, op2);
 }
 
 /**
@@ -584,6 +593,54 @@ bool CombatePPT::getUsarDañoFijo() const {
     return usarDañoFijo;
 }
 
+/**
+ * @brief Implementación del método obtenerResultadoDuelo
+ * 
+ * @return Resultado con nombres, ganador, turnos y HP finales
+ */
+ResultadoDuelo CombatePPT::obtenerResultadoDuelo() const {
+    ResultadoDuelo resultado{"", "", 0, turnosJugados, 0, 0, usarDañoFijo};
+    if (jugador1 == nullptr || jugador2 == nullptr) {
+        return resultado;
+    }
+    
+    resultado.jugador1 = jugador1->personaje->getNombre();
+    resultado.jugador2 = jugador2->personaje->getNombre();
+    resultado.hpFinal1 = jugador1->personaje->getHP();
+    resultado.hpFinal2 = jugador2->personaje->getHP();
+    if (resultado.hpFinal2 <= 0 && resultado.hpFinal1 > 0) {
+        resultado.ganador = 1;
+    } else if (resultado.hpFinal1 <= 0 && resultado.hpFinal2 > 0) {
+        resultado.ganador = 2;
+    }
+    return resultado;
+}
+
+/**
+ * @brief Implementación del método capturarEstado
+ * 
+ * @return Estado del duelo con ambos combatientes y el turno actual
+ */
+EstadoDuelo CombatePPT::capturarEstado() const {
+    EstadoDuelo estado;
+    estado.turno = turnosJugados;
+    estado.danioFijo = usarDañoFijo;
+    if (jugador1 != nullptr && jugador2 != nullptr) {
+        estado.jugador1 = CombatienteCOW(*jugador1->personaje, jugador1->arma);
+        estado.jugador2 = CombatienteCOW(*jugador2->personaje, jugador2->arma);
+    }
+    return estado;
+}
+
+/**
+ * @brief Implementación del método getTablaIA
+ * 
+ * @return Referencia constante a la tabla de transposición de la IA
+ */
+const TablaTransposicion& CombatePPT::getTablaIA() const {
+    return tablaIA;
+}
+
 // ==========================================================================
 // MÉTODOS DE VISUALIZACIÓN
 // ==========================================================================
@@ -4,7 +4,7 @@
  * 
  * Este archivo contiene la definición de la clase CombatePPT, que implementa un sistema
  * de combate por turnos basado en el juego Piedra-Papel-Tijera entre dos personajes.
- * También define estructuras auxiliares como Combatiente y OpcionAtaque.
+ * También define la estructura auxiliar Combatiente; OpcionAtaque vive en EstadoDuelo.hpp.
  */
 
 #pragma once
@@ -15,19 +15,12 @@
 #include <ctime>
 #include <iostream>
 #include "../Ejercicio-2/PersonajeFactory.hpp"
+#include "../Ejercicio-2/ExportadorStream.hpp"
+#include "EstadoDuelo.hpp"
+#include "IAMonteCarlo.hpp"
 
 using namespace std;
 
-/**
- * @enum OpcionAtaque
- * @brief Define las opciones de ataque disponibles para el combate PPT
- */
-enum class OpcionAtaque {
-    GolpeFuerte = 1,  ///< Opción Golpe Fuerte (gana a Golpe Rápido)
-    GolpeRapido = 2,  ///< Opción Golpe Rápido (gana a Defensa y Golpe)
-    DefensaYGolpe = 3 ///< Opción Defensa y Golpe (gana a Golpe Fuerte)
-};
-
 /**
  * @struct Combatiente
  * @brief Estructura que almacena información de un combatiente en el sistema PPT
@@ -106,6 +99,28 @@ public:
      * @return true si se usa daño fijo, false en caso contrario
      */
     bool getUsarDañoFijo() const;
+    
+    /**
+     * @brief Resume el combate en un ResultadoDuelo para exportarlo
+     * @return Resultado con nombres, ganador, turnos y HP finales
+     */
+    ResultadoDuelo obtenerResultadoDuelo() const;
+    
+    /**
+     * @brief Captura el estado actual del combate como EstadoDuelo
+     * 
+     * La copia es independiente de los personajes reales: sirve para simular
+     * continuaciones del combate sin modificarlo.
+     * 
+     * @return Estado del duelo con ambos combatientes y el turno actual
+     */
+    EstadoDuelo capturarEstado() const;
+    
+    /**
+     * @brief Obtiene la tabla de transposición de la IA (para consultar su tasa de aciertos)
+     * @return Referencia constante a la tabla
+     */
+    const TablaTransposicion& getTablaIA() const;
 
 private:
     Combatiente* jugador1;        ///< Combatiente controlado por el usuario
@@ -113,6 +128,9 @@ private:
     bool combateTerminado;        ///< Indica si el combate ha terminado
     bool configManual;            ///< Indica si el usuario selecciona su personaje
     bool usarDañoFijo;            ///< Indica si se usa daño fijo de 10 sin bonificaciones
+    int turnosJugados;            ///< Cantidad de turnos resueltos
+    TablaTransposicion tablaIA;   ///< Posiciones ya evaluadas por la IA, compartida entre turnos
+    IAMonteCarlo ia;              ///< Búsqueda Monte Carlo que elige por el jugador 2
     
     // Métodos auxiliares de lógica
     
@@ -128,6 +146,16 @@ private:
      */
     OpcionAtaque generarEleccionAleatoria() const;
     
+    /**
+     * @brief Genera la elección de ataque de la IA con búsqueda Monte Carlo
+     * 
+     * Busca sobre el estado actual del combate (sin conocer la elección del
+     * jugador 1) durante el presupuesto de tiempo de la IA.
+     * 
+     * @return Opción de ataque elegida por la IA
+     */
+    OpcionAtaque generarEleccionIA();
+    
     /**
      * @brief Prepara un personaje para el combate PPT estableciendo su HP a 100
      * @param personaje Puntero compartido al personaje a preparar
@@ -0,0 +1,245 @@
+/**
+ * @file EstadoDuelo.cpp
+ * @brief Implementación de CombatienteCOW y EstadoDuelo
+ */
+
+#include "EstadoDuelo.hpp"
+#include <algorithm>
+#include "../Ejercicio-1/Personajes/Mago.hpp"
+#include "../Ejercicio-1/Personajes/Guerrero.hpp"
+#include "../Ejercicio-1/Personajes/Magos/Nigromante.hpp"
+
+/**
+ * @brief Implementación de ganaEnfrentamiento
+ *
+ * - Golpe Fuerte vence a Golpe Rápido
+ * - Golpe Rápido vence a Defensa y Golpe
+ * - Defensa y Golpe vence a Golpe Fuerte
+ *
+ * @param op1 Opción del primer jugador
+ * @param op2 Opción del segundo jugador
+ * @return true si op1 vence a op2
+ */
+bool ganaEnfrentamiento(OpcionAtaque op1, OpcionAtaque op2) {
+    return (op1 == OpcionAtaque::GolpeFuerte && op2 == OpcionAtaque::GolpeRapido)
+        || (op1 == OpcionAtaque::GolpeRapido && op2 == OpcionAtaque::DefensaYGolpe)
+        || (op1 == OpcionAtaque::DefensaYGolpe && op2 == OpcionAtaque::GolpeFuerte);
+}
+
+// ==========================================================================
+// COMBATIENTE COPY-ON-WRITE
+// ==========================================================================
+
+/**
+ * @brief Implementación del constructor por defecto
+ */
+CombatienteCOW::CombatienteCOW()
+    : datos(make_shared<const DatosCombatiente>()), estado{0, 0, 0, false} {}
+
+/**
+ * @brief Implementación del constructor a partir de un personaje
+ *
+ * Copia una sola vez los datos inmutables (nombre, atributos, hechizos,
+ * reducción de daño) y lo que devolvería usar() en el arma, consultado con
+ * estimarUso() sin gastarla. Si el primer uso es especial (lanza preparada
+ * contra carga), los siguientes se estiman sobre un clon sin preparar. El
+ * estado actual pasa a ser el estado inicial; los HP máximos son los del
+ * personaje, no sus HP actuales.
+ *
+ * @param personaje Personaje de origen
+ * @param arma Arma equipada (puede ser nullptr)
+ */
+CombatienteCOW::CombatienteCOW(const InterfazPersonaje& personaje, const InterfazArmas* arma)
+    : estado{personaje.getHP(), 0, 0, false} {
+
+    auto nuevos = make_shared<DatosCombatiente>();
+    nuevos->nombre = personaje.getNombre();
+    nuevos->esMago = false;
+    nuevos->hpMax = max(personaje.getHP(), 1);
+    nuevos->reduccion = personaje.getReduccionDanio();
+    nuevos->fuerza = nuevos->destreza = nuevos->constitucion = nuevos->inteligencia = 0;
+    nuevos->recursoMaximo = 0;
+
+    if (const Mago* mago = dynamic_cast<const Mago*>(&personaje)) {
+        nuevos->esMago = true;
+        nuevos->hpMax = max(mago->getHPMaximo(), 1);
+        nuevos->fuerza = mago->getFuerza();
+        nuevos->destreza = mago->getDestreza();
+        nuevos->constitucion = mago->getConstitucion();
+        nuevos->inteligencia = mago->getInteligencia();
+        nuevos->recursoMaximo = mago->getMana();
+        estado.recurso = mago->getMana();
+        nuevos->hechizos = mago->getHechizosConocidos();
+    } else if (const Guerrero* guerrero = dynamic_cast<const Guerrero*>(&personaje)) {
+        nuevos->hpMax = max(guerrero->getHPMaximo(), 1);
+        nuevos->fuerza = guerrero->getFuerza();
+        nuevos->destreza = guerrero->getDestreza();
+        nuevos->constitucion = guerrero->getConstitucion();
+        nuevos->inteligencia = guerrero->getInteligencia();
+        nuevos->recursoMaximo = guerrero->getEstamina();
+        estado.recurso = guerrero->getEstamina();
+    }
+
+    nuevos->tieneArma = arma != nullptr;
+    nuevos->primerUsoArma = nuevos->usoArma = DistribucionDanio{1, {0}, {1.0}};
+    nuevos->usosInicialesArma = 0;
+    if (const Nigromante* nigromante = dynamic_cast<const Nigromante*>(&personaje)) {
+        estado.filacteria = nigromante->tieneFilacteria();
+    }
+    if (arma) {
+        nuevos->nombreArma = arma->getNombre();
+        nuevos->primerUsoArma = nuevos->usoArma = arma->estimarUso();
+        CheckpointArma checkpoint = arma->guardarCheckpoint();
+        if (checkpoint.preparadaContraCarga) {
+            unique_ptr<InterfazArmas> sinPreparar = arma->clonar();
+            checkpoint.preparadaContraCarga = false;
+            sinPreparar->restaurarCheckpoint(checkpoint);
+            nuevos->usoArma = sinPreparar->estimarUso();
+        }
+        nuevos->usosInicialesArma = arma->estimarUsosRestantes();
+        estado.usosArma = nuevos->usosInicialesArma;
+    }
+
+    datos = move(nuevos);
+}
+
+const DatosCombatiente& CombatienteCOW::getDatos() const { return *datos; }
+
+/**
+ * @brief Implementación del método modificarDatos
+ *
+ * Si otros combatientes comparten los datos, se hace una copia propia antes
+ * de devolverlos para escritura.
+ *
+ * @return Referencia a datos propios de este combatiente
+ */
+DatosCombatiente& CombatienteCOW::modificarDatos() {
+    if (datos.use_count() > 1) {
+        datos = make_shared<const DatosCombatiente>(*datos);
+    }
+    return const_cast<DatosCombatiente&>(*datos);
+}
+
+const EstadoMutableCombatiente& CombatienteCOW::getEstado() const { return estado; }
+EstadoMutableCombatiente& CombatienteCOW::getEstado() { return estado; }
+int CombatienteCOW::getHP() const { return estado.hp; }
+bool CombatienteCOW::estaVivo() const { return estado.hp > 0; }
+
+/**
+ * @brief Implementación del método usarArma
+ *
+ * Los 53 bits altos de azar dan un número uniforme en [0, 1) que elige el
+ * resultado según las probabilidades acumuladas.
+ *
+ * @param azar Número aleatorio de 64 bits
+ * @return Bonus de daño del golpe
+ */
+int CombatienteCOW::usarArma(uint64_t azar) {
+    if (!datos->tieneArma || estado.usosArma <= 0) {
+        return 0;
+    }
+
+    const DistribucionDanio& uso = estado.usosArma == datos->usosInicialesArma ? datos->primerUsoArma : datos->usoArma;
+    double sorteo = static_cast<double>(azar >> 11) * 0x1.0p-53;
+    int resultado = uso.cantidad - 1;
+    for (int i = 0; i < uso.cantidad - 1; ++i) {
+        sorteo -= uso.probabilidades[i];
+        if (sorteo < 0.0) {
+            resultado = i;
+            break;
+        }
+    }
+    estado.usosArma--;
+    return uso.valores[resultado] / 10;
+}
+
+/**
+ * @brief Implementación del método recibirDanio
+ *
+ * Sigue el mismo orden que Nigromante::recibirDanio: primero la reducción
+ * y después la filacteria, que deja al combatiente con un tercio de sus HP
+ * máximos.
+ *
+ * @param cantidad Daño recibido
+ * @param esCombatePPT true si el duelo usa daño fijo
+ * @return true si sigue vivo
+ */
+bool CombatienteCOW::recibirDanio(int cantidad, bool esCombatePPT) {
+    if (cantidad <= 0) {
+        return estaVivo();
+    }
+    if (esCombatePPT) {
+        estado.hp = max(0, estado.hp - 10);
+        return estaVivo();
+    }
+
+    int reduccion = datos->reduccion.calcular(cantidad);
+    if (reduccion > 0) {
+        cantidad -= reduccion;
+    }
+    if (estado.filacteria && estado.hp <= cantidad) {
+        estado.hp = datos->hpMax / 3;
+        estado.filacteria = false;
+        return true;
+    }
+    estado.hp = max(0, estado.hp - cantidad);
+    return estaVivo();
+}
+
+/**
+ * @brief Implementación del método compartenDatos
+ * @param otro Combatiente a comparar
+ * @return true si apuntan a los mismos datos
+ */
+bool CombatienteCOW::compartenDatos(const CombatienteCOW& otro) const {
+    return datos == otro.datos;
+}
+
+// ==========================================================================
+// ESTADO DEL DUELO
+// ==========================================================================
+
+/**
+ * @brief Implementación del método aplicarTurno
+ * @param op1 Opción del jugador 1
+ * @param op2 Opción del jugador 2
+ * @param azar Número aleatorio para sortear el resultado del arma
+ */
+void EstadoDuelo::aplicarTurno(OpcionAtaque op1, OpcionAtaque op2, uint64_t azar) {
+    if (haTerminado()) {
+        return;
+    }
+    turno++;
+
+    if (op1 == op2) {
+        return;
+    }
+
+    bool ganaJugador1 = ganaEnfrentamiento(op1, op2);
+    CombatienteCOW& ganador = ganaJugador1 ? jugador1 : jugador2;
+    CombatienteCOW& perdedor = ganaJugador1 ? jugador2 : jugador1;
+
+    int danio = 10;
+    if (!danioFijo) {
+        danio += ganador.usarArma(azar);
+    }
+    perdedor.recibirDanio(danio, danioFijo);
+}
+
+/**
+ * @brief Implementación del método haTerminado
+ * @return true si algún combatiente quedó sin HP
+ */
+bool EstadoDuelo::haTerminado() const {
+    return !jugador1.estaVivo() || !jugador2.estaVivo();
+}
+
+/**
+ * @brief Implementación del método getGanador
+ * @return 1 o 2 según quién ganó, 0 si no terminó o ambos cayeron
+ */
+int EstadoDuelo::getGanador() const {
+    if (jugador1.estaVivo() && !jugador2.estaVivo()) return 1;
+    if (jugador2.estaVivo() && !jugador1.estaVivo()) return 2;
+    return 0;
+}
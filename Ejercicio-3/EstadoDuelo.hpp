@@ -0,0 +1,202 @@
+/**
+ * @file EstadoDuelo.hpp
+ * @brief Define un estado de duelo PPT liviano para búsquedas especulativas
+ *
+ * Este archivo contiene CombatienteCOW, una representación copy-on-write de un
+ * combatiente (personaje más arma equipada), y EstadoDuelo, que reúne a los dos
+ * combatientes y aplica las reglas de CombatePPT sin tocar los personajes reales.
+ * También define OpcionAtaque, compartida con CombatePPT.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Ejercicio-1/Personajes/InterfazPersonaje.hpp"
+
+using namespace std;
+
+/**
+ * @enum OpcionAtaque
+ * @brief Define las opciones de ataque disponibles para el combate PPT
+ */
+enum class OpcionAtaque {
+    GolpeFuerte = 1,  ///< Opción Golpe Fuerte (gana a Golpe Rápido)
+    GolpeRapido = 2,  ///< Opción Golpe Rápido (gana a Defensa y Golpe)
+    DefensaYGolpe = 3 ///< Opción Defensa y Golpe (gana a Golpe Fuerte)
+};
+
+/**
+ * @brief Indica si una opción de ataque vence a otra
+ * @param op1 Opción del primer jugador
+ * @param op2 Opción del segundo jugador
+ * @return true si op1 vence a op2 (false también en caso de empate)
+ */
+bool ganaEnfrentamiento(OpcionAtaque op1, OpcionAtaque op2);
+
+/**
+ * @struct DatosCombatiente
+ * @brief Datos de un combatiente que no cambian durante el duelo
+ *
+ * Se comparten entre todas las copias de un CombatienteCOW.
+ */
+struct DatosCombatiente {
+    string nombre;
+    string nombreArma;
+    bool esMago;
+    int hpMax;
+    int fuerza;
+    int destreza;
+    int constitucion;
+    int inteligencia;
+    int recursoMaximo;          ///< Maná máximo para magos, estamina máxima para guerreros
+    vector<string> hechizos;
+    bool tieneArma;
+    DistribucionDanio primerUsoArma;    ///< estimarUso() del arma al armar el combatiente
+    DistribucionDanio usoArma;          ///< estimarUso() para los usos siguientes al primero
+    int usosInicialesArma;              ///< estimarUsosRestantes() al armar el combatiente
+    ReduccionDanio reduccion;   ///< Defensa del personaje fuera del daño fijo (getReduccionDanio)
+};
+
+/**
+ * @struct EstadoMutableCombatiente
+ * @brief Valores de un combatiente que cambian durante el duelo
+ *
+ * Es lo único que se copia al clonar un CombatienteCOW.
+ */
+struct EstadoMutableCombatiente {
+    int hp;
+    int recurso;
+    int usosArma;               ///< Usos que le quedan al arma antes de romperse o agotarse
+    bool filacteria;            ///< El nigromante todavía puede salvarse de un golpe mortal
+};
+
+/**
+ * @class CombatienteCOW
+ * @brief Combatiente copy-on-write para simular duelos
+ *
+ * Clonar copia un puntero compartido a los datos inmutables y unos pocos
+ * enteros de estado, en lugar de duplicar el personaje polimórfico y su
+ * inventario. Si alguna vez hace falta cambiar los datos compartidos,
+ * modificarDatos() los separa primero (copy-on-write).
+ */
+class CombatienteCOW {
+public:
+    /**
+     * @brief Constructor por defecto (combatiente vacío, sin datos)
+     */
+    CombatienteCOW();
+
+    /**
+     * @brief Construye un combatiente a partir de un personaje y su arma
+     * @param personaje Personaje de origen
+     * @param arma Arma equipada (puede ser nullptr)
+     */
+    CombatienteCOW(const InterfazPersonaje& personaje, const InterfazArmas* arma);
+
+    /**
+     * @brief Obtiene los datos inmutables compartidos
+     * @return Referencia constante a los datos
+     */
+    const DatosCombatiente& getDatos() const;
+
+    /**
+     * @brief Obtiene los datos para modificarlos, separándolos si están compartidos
+     * @return Referencia a datos propios de este combatiente
+     */
+    DatosCombatiente& modificarDatos();
+
+    /**
+     * @brief Obtiene el estado mutable
+     * @return Referencia constante al estado
+     */
+    const EstadoMutableCombatiente& getEstado() const;
+
+    /**
+     * @brief Obtiene el estado mutable para modificarlo
+     * @return Referencia al estado
+     */
+    EstadoMutableCombatiente& getEstado();
+
+    int getHP() const;
+    bool estaVivo() const;
+
+    /**
+     * @brief Usa el arma equipada como lo hace CombatePPT con bonificaciones
+     *
+     * El bonus es usar() / 10, con el valor sorteado de la distribución que
+     * dio estimarUso() al armar el combatiente; así valen las reglas de cada
+     * arma (medio poder del bastón, alcance de la lanza, desgaste del
+     * garrote, signo del efecto de la poción). El primer uso puede ser
+     * distinto (lanza preparada contra carga). Cada uso gasta uno de los
+     * usos restantes; sin usos el arma no suma bonus.
+     *
+     * @param azar Número aleatorio de 64 bits para sortear el resultado
+     * @return Bonus de daño del golpe
+     */
+    int usarArma(uint64_t azar);
+
+    /**
+     * @brief Resta HP al combatiente con las reglas de recibirDanio del personaje
+     *
+     * Con daño fijo siempre son 10 puntos. Si no, se descuenta la reducción
+     * del personaje (frenesí, aura divina, honor, resistencia a la muerte) y
+     * la filacteria del nigromante lo salva una vez de un golpe mortal.
+     *
+     * @param cantidad Daño recibido
+     * @param esCombatePPT true si el duelo usa daño fijo
+     * @return true si sigue vivo
+     */
+    bool recibirDanio(int cantidad, bool esCombatePPT);
+
+    /**
+     * @brief Indica si dos combatientes comparten los mismos datos inmutables
+     * @param otro Combatiente a comparar
+     * @return true si apuntan a los mismos datos
+     */
+    bool compartenDatos(const CombatienteCOW& otro) const;
+
+private:
+    shared_ptr<const DatosCombatiente> datos;
+    EstadoMutableCombatiente estado;
+};
+
+/**
+ * @struct EstadoDuelo
+ * @brief Estado completo de un duelo PPT, barato de copiar
+ *
+ * Copiar un EstadoDuelo es copiar dos CombatienteCOW y un par de enteros;
+ * está pensado para que la IA explore muchas continuaciones por decisión.
+ */
+struct EstadoDuelo {
+    CombatienteCOW jugador1;
+    CombatienteCOW jugador2;
+    int turno = 0;
+    bool danioFijo = true;
+
+    /**
+     * @brief Aplica un turno con las reglas de CombatePPT
+     *
+     * El perdedor del enfrentamiento recibe 10 puntos de daño, más el bonus
+     * del arma del ganador si no se usa daño fijo. En empate no hay daño.
+     *
+     * @param op1 Opción del jugador 1
+     * @param op2 Opción del jugador 2
+     * @param azar Número aleatorio para sortear el resultado del arma (solo sin daño fijo)
+     */
+    void aplicarTurno(OpcionAtaque op1, OpcionAtaque op2, uint64_t azar = 0);
+
+    /**
+     * @brief Indica si el duelo terminó
+     * @return true si algún combatiente quedó sin HP
+     */
+    bool haTerminado() const;
+
+    /**
+     * @brief Obtiene el ganador del duelo
+     * @return 1 o 2 según quién ganó, 0 si no terminó o ambos cayeron
+     */
+    int getGanador() const;
+};
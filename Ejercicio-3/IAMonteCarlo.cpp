@@ -0,0 +1,291 @@
+/**
+ * @file IAMonteCarlo.cpp
+ * @brief Implementación de la IA de búsqueda Monte Carlo para el combate PPT
+ */
+
+#include "IAMonteCarlo.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+/**
+ * @brief Implementación del constructor de IAMonteCarlo
+ * @param configuracion Parámetros de la búsqueda
+ */
+IAMonteCarlo::IAMonteCarlo(const ConfiguracionMCTS& configuracion)
+    : configuracion(configuracion), tabla(nullptr), decisiones(0),
+      iteracionesUltimaBusqueda(0), visitasUltimaBusqueda{} {
+    this->configuracion.hilos = max(1, this->configuracion.hilos);
+}
+
+/**
+ * @brief Implementación del método elegirOpcion
+ *
+ * Reparte las simulaciones entre el hilo actual y (hilos - 1) hilos
+ * auxiliares hasta agotar el presupuesto de tiempo o de iteraciones. Con
+ * tabla, la opción más visitada de la raíz queda como mejor opción de la
+ * posición.
+ *
+ * @param estado Estado actual del duelo
+ * @return Opción de ataque elegida para el jugador 2
+ */
+OpcionAtaque IAMonteCarlo::elegirOpcion(const EstadoDuelo& estado) {
+    const uint64_t numeroDecision = decisiones++;
+    auto semillaHilo = [&](int hilo) {
+        return configuracion.semilla + numeroDecision * 0x9E3779B97F4A7C15ULL + static_cast<uint64_t>(hilo) * 0xBF58476D1CE4E5B9ULL;
+    };
+
+    Nodo raiz;
+    atomic<long> iteraciones{0};
+    if (tabla) {
+        tabla->nuevaBusqueda();
+        EntradaTransposicion entrada;
+        uint64_t clave = hashZobrist(estado);
+        asociarPosicion(raiz, clave, entrada, tabla->buscar(clave, entrada));
+    }
+    const auto limite = chrono::steady_clock::now()
+        + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double, milli>(configuracion.presupuestoMs));
+
+    auto trabajar = [&](int hilo) {
+        mt19937_64 generador(semillaHilo(hilo));
+        vector<PasoCamino> camino;
+        camino.reserve(64);
+        while (true) {
+            if (configuracion.maxIteraciones > 0) {
+                if (iteraciones.fetch_add(1) >= configuracion.maxIteraciones) {
+                    iteraciones.fetch_sub(1);
+                    break;
+                }
+            } else {
+                if (chrono::steady_clock::now() >= limite) {
+                    break;
+                }
+                iteraciones.fetch_add(1);
+            }
+            iterar(raiz, estado, generador, camino);
+        }
+    };
+
+    if (!estado.haTerminado()) {
+        vector<thread> auxiliares;
+        for (int hilo = 1; hilo < configuracion.hilos; ++hilo) {
+            auxiliares.emplace_back(trabajar, hilo);
+        }
+        trabajar(0);
+        for (thread& auxiliar : auxiliares) {
+            auxiliar.join();
+        }
+    }
+
+    iteracionesUltimaBusqueda = iteraciones.load();
+    visitasUltimaBusqueda = raiz.visitasJ2;
+
+    long total = raiz.visitasJ2[0] + raiz.visitasJ2[1] + raiz.visitasJ2[2];
+    mt19937_64 generadorEleccion(semillaHilo(configuracion.hilos));
+    if (total <= 0) {
+        return static_cast<OpcionAtaque>(generadorEleccion() % 3 + 1);
+    }
+
+    // Los empates llevan a la misma posición que la raíz: la búsqueda completa tiene la última palabra
+    if (tabla) {
+        tabla->anotarMejorOpcion(raiz.clave, static_cast<int>(max_element(raiz.visitasJ2.begin(), raiz.visitasJ2.end())
+                                                              - raiz.visitasJ2.begin()) + 1);
+    }
+
+    long sorteo = static_cast<long>(generadorEleccion() % static_cast<uint64_t>(total));
+    for (int opcion = 0; opcion < 3; ++opcion) {
+        if (sorteo < raiz.visitasJ2[opcion]) {
+            return static_cast<OpcionAtaque>(opcion + 1);
+        }
+        sorteo -= raiz.visitasJ2[opcion];
+    }
+    return OpcionAtaque::DefensaYGolpe;
+}
+
+/**
+ * @brief Implementación del método iterar
+ *
+ * La selección y la expansión se hacen con el árbol bloqueado y sumando
+ * pérdida virtual a cada opción elegida; la simulación corre sin bloqueo y
+ * la retropropagación vuelve a bloquear para quitar la pérdida virtual y
+ * sumar la recompensa real.
+ *
+ * Con tabla, la hoja nueva queda asociada a su posición y cada nodo del
+ * camino con suficientes visitas anota su opción más visitada del jugador 2
+ * cuando cambia.
+ *
+ * @param raiz Nodo raíz
+ * @param estadoRaiz Estado del duelo en la raíz
+ * @param generador Generador del hilo
+ * @param camino Vector auxiliar reutilizado entre simulaciones
+ */
+void IAMonteCarlo::iterar(Nodo& raiz, const EstadoDuelo& estadoRaiz, mt19937_64& generador, vector<PasoCamino>& camino) {
+    const int perdida = configuracion.perdidaVirtual;
+    EstadoDuelo estado = estadoRaiz;
+    camino.clear();
+    Nodo* hoja = nullptr;
+
+    {
+        lock_guard<mutex> bloqueo(mutexArbol);
+        Nodo* nodo = &raiz;
+        while (!estado.haTerminado()) {
+            int opcionJ1 = seleccionarUCB(nodo->visitas, nodo->visitasJ1, nodo->recompensaJ1);
+            int opcionJ2 = seleccionarUCB(nodo->visitas, nodo->visitasJ2, nodo->recompensaJ2, nodo->opcionSugerida);
+
+            nodo->visitas += perdida;
+            nodo->visitasJ1[opcionJ1] += perdida;
+            nodo->visitasJ2[opcionJ2] += perdida;
+            camino.push_back({nodo, opcionJ1, opcionJ2});
+
+            estado.aplicarTurno(static_cast<OpcionAtaque>(opcionJ1 + 1), static_cast<OpcionAtaque>(opcionJ2 + 1),
+                                generador());
+
+            unique_ptr<Nodo>& hijo = nodo->hijos[opcionJ1 * 3 + opcionJ2];
+            if (!hijo) {
+                hijo = make_unique<Nodo>();
+                hoja = hijo.get();
+                break;
+            }
+            nodo = hijo.get();
+        }
+    }
+
+    double recompensa;
+    EntradaTransposicion guardada;
+    uint64_t clave = 0;
+    bool conClave = false;
+    bool acierto = false;
+    if (tabla && !estado.haTerminado()) {
+        clave = hashZobrist(estado);
+        conClave = true;
+        acierto = tabla->buscar(clave, guardada);
+        if (acierto && guardada.muestras >= configuracion.minMuestrasTabla) {
+            recompensa = guardada.valor;
+        } else {
+            recompensa = simular(estado, generador);
+            tabla->acumular(clave, recompensa);
+        }
+    } else {
+        recompensa = simular(estado, generador);
+    }
+
+    lock_guard<mutex> bloqueo(mutexArbol);
+    if (hoja && conClave) {
+        asociarPosicion(*hoja, clave, guardada, acierto);
+    }
+    for (const PasoCamino& paso : camino) {
+        Nodo& nodo = *paso.nodo;
+        nodo.visitas += 1 - perdida;
+        nodo.visitasJ1[paso.opcionJ1] += 1 - perdida;
+        nodo.visitasJ2[paso.opcionJ2] += 1 - perdida;
+        nodo.recompensaJ1[paso.opcionJ1] += 1.0 - recompensa;
+        nodo.recompensaJ2[paso.opcionJ2] += recompensa;
+
+        if (nodo.conClave && nodo.visitas >= configuracion.minMuestrasTabla) {
+            int mejor = static_cast<int>(max_element(nodo.visitasJ2.begin(), nodo.visitasJ2.end()) - nodo.visitasJ2.begin());
+            if (mejor != nodo.opcionAnotada) {
+                nodo.opcionAnotada = mejor;
+                tabla->anotarMejorOpcion(nodo.clave, mejor + 1);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Implementación del método asociarPosicion
+ * @param nodo Nodo a preparar
+ * @param clave Hash Zobrist de su posición
+ * @param entrada Contenido de la tabla, si hubo acierto
+ * @param acierto true si la posición estaba en la tabla
+ */
+void IAMonteCarlo::asociarPosicion(Nodo& nodo, uint64_t clave, const EntradaTransposicion& entrada, bool acierto) {
+    nodo.clave = clave;
+    nodo.conClave = true;
+    if (acierto && entrada.mejorOpcion > 0) {
+        nodo.opcionSugerida = entrada.mejorOpcion - 1;
+        nodo.opcionAnotada = nodo.opcionSugerida;
+    }
+}
+
+/**
+ * @brief Implementación del método seleccionarUCB
+ *
+ * Las opciones sin visitas se prueban primero, empezando por la sugerida
+ * por la tabla si la hay. La pérdida virtual cuenta
+ * como visitas sin recompensa, así que baja el promedio de la rama mientras
+ * otro hilo la está simulando.
+ *
+ * @param visitasNodo Visitas del nodo
+ * @param visitas Visitas de cada opción
+ * @param recompensa Recompensa acumulada de cada opción
+ * @param primera Opción a probar antes que las demás sin visitas, -1 para el orden natural
+ * @return Índice de la opción (0 a 2)
+ */
+int IAMonteCarlo::seleccionarUCB(long visitasNodo, const array<long, 3>& visitas, const array<double, 3>& recompensa,
+                                 int primera) const {
+    if (primera >= 0 && visitas[primera] <= 0) {
+        return primera;
+    }
+    int mejor = 0;
+    double mejorValor = -1.0;
+    const double logVisitas = log(static_cast<double>(max(visitasNodo, 1L)));
+
+    for (int opcion = 0; opcion < 3; ++opcion) {
+        if (visitas[opcion] <= 0) {
+            return opcion;
+        }
+        double n = static_cast<double>(visitas[opcion]);
+        double valor = recompensa[opcion] / n + configuracion.exploracion * sqrt(logVisitas / n);
+        if (valor > mejorValor) {
+            mejorValor = valor;
+            mejor = opcion;
+        }
+    }
+    return mejor;
+}
+
+/**
+ * @brief Implementación del método simular
+ * @param estado Estado de partida (se modifica)
+ * @param generador Generador del hilo
+ * @return Recompensa para el jugador 2, entre 0 y 1
+ */
+double IAMonteCarlo::simular(EstadoDuelo& estado, mt19937_64& generador) const {
+    for (int turno = 0; turno < configuracion.maxTurnosSimulacion && !estado.haTerminado(); ++turno) {
+        uint64_t azar = generador();
+        estado.aplicarTurno(static_cast<OpcionAtaque>(azar % 3 + 1), static_cast<OpcionAtaque>((azar >> 32) % 3 + 1),
+                            generador());
+    }
+    return evaluar(estado);
+}
+
+/**
+ * @brief Implementación del método evaluar
+ * @param estado Estado a evaluar
+ * @return 1 si ganó el jugador 2, 0 si perdió, o una estimación por diferencia de HP
+ */
+double IAMonteCarlo::evaluar(const EstadoDuelo& estado) {
+    switch (estado.getGanador()) {
+        case 2: return 1.0;
+        case 1: return 0.0;
+        default: break;
+    }
+
+    int hp1 = max(estado.jugador1.getHP(), 0);
+    int hp2 = max(estado.jugador2.getHP(), 0);
+    return 0.5 + 0.5 * static_cast<double>(hp2 - hp1) / max(hp1 + hp2, 1);
+}
+
+long IAMonteCarlo::getIteracionesUltimaBusqueda() const { return iteracionesUltimaBusqueda; }
+array<long, 3> IAMonteCarlo::getVisitasUltimaBusqueda() const { return visitasUltimaBusqueda; }
+const ConfiguracionMCTS& IAMonteCarlo::getConfiguracion() const { return configuracion; }
+
+/**
+ * @brief Implementación del método setTablaTransposicion
+ * @param tabla Tabla a usar, o nullptr para desactivarla
+ */
+void IAMonteCarlo::setTablaTransposicion(TablaTransposicion* tabla) {
+    this->tabla = tabla;
+}
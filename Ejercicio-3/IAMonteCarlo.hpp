@@ -0,0 +1,177 @@
+/**
+ * @file IAMonteCarlo.hpp
+ * @brief Define la IA de búsqueda Monte Carlo (MCTS) para el combate PPT
+ *
+ * Como ambos jugadores eligen a la vez, el árbol usa UCT desacoplado: cada
+ * nodo guarda estadísticas separadas para las opciones de cada jugador y un
+ * hijo por cada par de opciones. Las simulaciones se reparten entre varios
+ * hilos que comparten el árbol, usando pérdida virtual para que no bajen
+ * todos por la misma rama.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+#include "EstadoDuelo.hpp"
+#include "TablaTransposicion.hpp"
+
+using namespace std;
+
+/**
+ * @struct ConfiguracionMCTS
+ * @brief Parámetros de la búsqueda
+ */
+struct ConfiguracionMCTS {
+    double presupuestoMs = 5.0;     ///< Tiempo máximo por decisión
+    int maxIteraciones = 0;         ///< Tope de simulaciones (0 = solo por tiempo)
+    int hilos = 2;                  ///< Hilos que comparten el árbol
+    uint64_t semilla = 0x5EED;      ///< Semilla del generador determinista
+    double exploracion = 1.4;       ///< Constante de exploración de UCB1
+    int perdidaVirtual = 1;         ///< Visitas perdidas que suma cada hilo al bajar por una rama
+    int maxTurnosSimulacion = 200;  ///< Corte de cada simulación aleatoria
+    int minMuestrasTabla = 8;       ///< Muestras desde las que se confía en la tabla de transposición
+};
+
+/**
+ * @class IAMonteCarlo
+ * @brief Selecciona la opción de ataque del jugador 2 mediante MCTS
+ *
+ * Con hilos = 1 y maxIteraciones > 0 la búsqueda es reproducible: cada
+ * decisión usa un generador mt19937_64 derivado de la semilla y del número
+ * de decisión.
+ */
+class IAMonteCarlo {
+public:
+    /**
+     * @brief Constructor
+     * @param configuracion Parámetros de la búsqueda
+     */
+    explicit IAMonteCarlo(const ConfiguracionMCTS& configuracion = ConfiguracionMCTS());
+
+    /**
+     * @brief Elige la opción del jugador 2 para el estado dado
+     *
+     * La elección final se sortea en proporción a las visitas de cada opción
+     * en la raíz: en un juego simultáneo jugar siempre la más visitada sería
+     * predecible y explotable.
+     *
+     * @param estado Estado actual del duelo
+     * @return Opción de ataque elegida
+     */
+    OpcionAtaque elegirOpcion(const EstadoDuelo& estado);
+
+    /**
+     * @brief Obtiene la cantidad de simulaciones de la última decisión
+     * @return Simulaciones completadas
+     */
+    long getIteracionesUltimaBusqueda() const;
+
+    /**
+     * @brief Obtiene las visitas de cada opción del jugador 2 en la última decisión
+     * @return Visitas para GolpeFuerte, GolpeRapido y DefensaYGolpe
+     */
+    array<long, 3> getVisitasUltimaBusqueda() const;
+
+    const ConfiguracionMCTS& getConfiguracion() const;
+
+    /**
+     * @brief Asocia una tabla de transposición compartida
+     *
+     * Las hojas cuya posición ya tiene suficientes muestras en la tabla usan
+     * el promedio guardado en lugar de simular; el resto simula y suma su
+     * resultado a la tabla. Solo se guardan promedios de simulaciones desde
+     * hojas: el resultado agregado de la raíz no va a la tabla, porque mezcla
+     * valores del árbol con simulaciones y no es comparable con ellos.
+     *
+     * Al retropropagar, cada nodo anota en la tabla la opción del jugador 2
+     * más visitada; un nodo nuevo cuya posición ya tiene mejor opción la
+     * prueba primero al expandirse. La tabla no pasa a ser propiedad de la IA.
+     *
+     * @param tabla Tabla a usar, o nullptr para desactivarla
+     */
+    void setTablaTransposicion(TablaTransposicion* tabla);
+
+private:
+    /**
+     * @struct Nodo
+     * @brief Nodo del árbol con estadísticas desacopladas por jugador
+     */
+    struct Nodo {
+        long visitas = 0;
+        array<long, 3> visitasJ1{};
+        array<long, 3> visitasJ2{};
+        array<double, 3> recompensaJ1{};   ///< Desde el punto de vista del jugador 1
+        array<double, 3> recompensaJ2{};   ///< Desde el punto de vista del jugador 2
+        array<unique_ptr<Nodo>, 9> hijos;  ///< Indexado por opcionJ1 * 3 + opcionJ2
+        uint64_t clave = 0;                ///< Hash Zobrist de la posición (solo con tabla)
+        bool conClave = false;
+        int opcionSugerida = -1;           ///< Opción del jugador 2 que se prueba primero, -1 si ninguna
+        int opcionAnotada = -1;            ///< Última mejor opción anotada en la tabla
+    };
+
+    /**
+     * @struct PasoCamino
+     * @brief Nodo visitado y opciones elegidas en una simulación
+     */
+    struct PasoCamino {
+        Nodo* nodo;
+        int opcionJ1;
+        int opcionJ2;
+    };
+
+    /**
+     * @brief Ejecuta una simulación completa: selección, expansión, simulación y retropropagación
+     * @param raiz Nodo raíz
+     * @param estadoRaiz Estado del duelo en la raíz
+     * @param generador Generador del hilo
+     * @param camino Vector auxiliar reutilizado entre simulaciones
+     */
+    void iterar(Nodo& raiz, const EstadoDuelo& estadoRaiz, mt19937_64& generador, vector<PasoCamino>& camino);
+
+    /**
+     * @brief Elige la opción de un jugador con UCB1
+     * @param visitasNodo Visitas del nodo
+     * @param visitas Visitas de cada opción
+     * @param recompensa Recompensa acumulada de cada opción
+     * @param primera Opción a probar antes que las demás sin visitas, -1 para el orden natural
+     * @return Índice de la opción (0 a 2)
+     */
+    int seleccionarUCB(long visitasNodo, const array<long, 3>& visitas, const array<double, 3>& recompensa,
+                       int primera = -1) const;
+
+    /**
+     * @brief Asocia un nodo con su posición y toma la mejor opción que ya tenga en la tabla
+     * @param nodo Nodo a preparar
+     * @param clave Hash Zobrist de su posición
+     * @param entrada Contenido de la tabla, si hubo acierto
+     * @param acierto true si la posición estaba en la tabla
+     */
+    static void asociarPosicion(Nodo& nodo, uint64_t clave, const EntradaTransposicion& entrada, bool acierto);
+
+    /**
+     * @brief Juega el duelo con opciones aleatorias hasta terminar o llegar al corte
+     * @param estado Estado de partida (se modifica)
+     * @param generador Generador del hilo
+     * @return Recompensa para el jugador 2, entre 0 y 1
+     */
+    double simular(EstadoDuelo& estado, mt19937_64& generador) const;
+
+    /**
+     * @brief Evalúa un estado desde el punto de vista del jugador 2
+     * @param estado Estado a evaluar
+     * @return 1 si ganó, 0 si perdió, o una estimación por diferencia de HP
+     */
+    static double evaluar(const EstadoDuelo& estado);
+
+    ConfiguracionMCTS configuracion;
+    TablaTransposicion* tabla;
+    mutex mutexArbol;
+    uint64_t decisiones;
+    long iteracionesUltimaBusqueda;
+    array<long, 3> visitasUltimaBusqueda;
+};
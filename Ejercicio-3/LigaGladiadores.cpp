@@ -0,0 +1,293 @@
+/**
+ * @file LigaGladiadores.cpp
+ * @brief Implementación de la liga de gladiadores con ratings Glicko-2
+ */
+
+#include "LigaGladiadores.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace {
+
+/// Factor entre la escala de Glicko y la interna de Glicko-2
+const double ESCALA_GLICKO = 173.7178;
+
+/// Tolerancia del cálculo iterativo de la volatilidad
+const double TOLERANCIA_VOLATILIDAD = 1e-6;
+
+const double PI = 3.14159265358979323846;
+
+/**
+ * @brief Mezcla de splitmix64 para derivar semillas independientes
+ */
+uint64_t mezclar(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+double factorG(double phi) {
+    return 1.0 / sqrt(1.0 + 3.0 * phi * phi / (PI * PI));
+}
+
+} // namespace
+
+/**
+ * @brief Implementación del constructor de LigaGladiadores
+ * @param configuracion Parámetros de la liga
+ */
+LigaGladiadores::LigaGladiadores(const ConfiguracionLiga& configuracion)
+    : configuracion(configuracion), temporada(0) {
+    this->configuracion.hilos = max(1, this->configuracion.hilos);
+    this->configuracion.rondasPorTemporada = max(1, this->configuracion.rondasPorTemporada);
+    this->configuracion.maxTurnos = max(1, this->configuracion.maxTurnos);
+}
+
+/**
+ * @brief Implementación de enParalelo
+ *
+ * Cada hilo recibe un bloque contiguo; el hilo que llama procesa el último.
+ */
+template <typename Tarea>
+void LigaGladiadores::enParalelo(size_t cantidad, Tarea tarea) const {
+    const size_t hilos = min<size_t>(static_cast<size_t>(configuracion.hilos), max<size_t>(1, cantidad));
+    vector<thread> auxiliares;
+    for (size_t h = 0; h + 1 < hilos; ++h) {
+        auxiliares.emplace_back(tarea, cantidad * h / hilos, cantidad * (h + 1) / hilos);
+    }
+    tarea(cantidad * (hilos - 1) / hilos, cantidad);
+    for (thread& auxiliar : auxiliares) {
+        auxiliar.join();
+    }
+}
+
+/**
+ * @brief Implementación del método inscribir
+ *
+ * Los datos del gladiador se copian una vez a un CombatienteCOW; cada duelo
+ * parte de una copia barata de ese estado.
+ *
+ * @param gladiador Gladiador a inscribir
+ * @return Índice del gladiador en la liga, -1 si es nulo
+ */
+int LigaGladiadores::inscribir(Gladiador* gladiador) {
+    if (!gladiador) {
+        return -1;
+    }
+    int indice = static_cast<int>(gladiadores.size());
+    gladiadores.push_back(gladiador);
+    combatientes.emplace_back(*gladiador, gladiador->getArma(0));
+    ratings.push_back(RatingGlicko{1500.0, 350.0, 0.06});
+    clasificacion.actualizar(indice, 1500.0);
+    return indice;
+}
+
+/**
+ * @brief Implementación del método jugarTemporada
+ *
+ * 1. Sorteo de parejas (secuencial y determinista).
+ * 2. Duelos en paralelo: cada hilo escribe solo los resultados de su bloque.
+ * 3. Nuevos ratings en paralelo: cada hilo calcula los de su bloque de
+ *    gladiadores leyendo los ratings anteriores.
+ * 4. Tabla de posiciones y registro en cada gladiador (secuencial).
+ *
+ * @return Cantidad de duelos jugados
+ */
+size_t LigaGladiadores::jugarTemporada() {
+    if (gladiadores.size() < 2) {
+        return 0;
+    }
+    ++temporada;
+    sortearPartidas();
+
+    const uint64_t semillaTemporada = mezclar(configuracion.semilla ^ static_cast<uint64_t>(temporada));
+    enParalelo(partidas.size(), [this, semillaTemporada](size_t desde, size_t hasta) {
+        for (size_t p = desde; p < hasta; ++p) {
+            partidas[p].puntaje = simularDuelo(partidas[p].a, partidas[p].b, mezclar(semillaTemporada + p));
+        }
+    });
+
+    vector<RatingGlicko> nuevos(ratings.size());
+    enParalelo(ratings.size(), [this, &nuevos](size_t desde, size_t hasta) {
+        for (size_t i = desde; i < hasta; ++i) {
+            nuevos[i] = calcularRating(static_cast<int>(i));
+        }
+    });
+    ratings.swap(nuevos);
+
+    for (size_t i = 0; i < gladiadores.size(); ++i) {
+        clasificacion.actualizar(static_cast<int>(i), ratings[i].rating);
+
+        int victorias = 0;
+        int derrotas = 0;
+        for (int k = inicioPartidas[i]; k < inicioPartidas[i + 1]; ++k) {
+            const Partida& partida = partidas[partidasDe[k]];
+            double puntaje = partida.a == static_cast<int>(i) ? partida.puntaje : 1.0 - partida.puntaje;
+            if (puntaje > 0.5) ++victorias;
+            else if (puntaje < 0.5) ++derrotas;
+        }
+        gladiadores[i]->registrarTemporada(victorias, derrotas);
+    }
+    return partidas.size();
+}
+
+int LigaGladiadores::getPosicion(int indice) const { return clasificacion.getPosicion(indice); }
+
+int LigaGladiadores::getEnPosicion(int posicion) const { return clasificacion.getEnPosicion(posicion); }
+
+int LigaGladiadores::getPosicionDeRating(double rating) const { return clasificacion.contarMayores(rating) + 1; }
+
+Gladiador* LigaGladiadores::getGladiador(int indice) const { return gladiadores.at(indice); }
+const RatingGlicko& LigaGladiadores::getRating(int indice) const { return ratings.at(indice); }
+size_t LigaGladiadores::getInscriptos() const { return gladiadores.size(); }
+int LigaGladiadores::getTemporada() const { return temporada; }
+
+/**
+ * @brief Implementación del método sortearPartidas
+ *
+ * En cada ronda se mezcla el orden de los gladiadores y se enfrentan de a
+ * pares consecutivos (con cantidad impar, el último descansa). Después se
+ * arma, con un conteo, la lista de partidas de cada gladiador en el orden
+ * en que se jugaron.
+ */
+void LigaGladiadores::sortearPartidas() {
+    const int cantidad = static_cast<int>(gladiadores.size());
+    partidas.clear();
+    vector<int> orden(cantidad);
+    iota(orden.begin(), orden.end(), 0);
+    mt19937_64 generador(mezclar(configuracion.semilla + static_cast<uint64_t>(temporada)));
+    for (int ronda = 0; ronda < configuracion.rondasPorTemporada; ++ronda) {
+        shuffle(orden.begin(), orden.end(), generador);
+        for (int i = 0; i + 1 < cantidad; i += 2) {
+            partidas.push_back(Partida{orden[i], orden[i + 1], 0.5});
+        }
+    }
+
+    inicioPartidas.assign(cantidad + 1, 0);
+    for (const Partida& partida : partidas) {
+        ++inicioPartidas[partida.a + 1];
+        ++inicioPartidas[partida.b + 1];
+    }
+    for (int i = 0; i < cantidad; ++i) {
+        inicioPartidas[i + 1] += inicioPartidas[i];
+    }
+    partidasDe.assign(partidas.size() * 2, 0);
+    vector<int> siguiente(inicioPartidas.begin(), inicioPartidas.end() - 1);
+    for (size_t p = 0; p < partidas.size(); ++p) {
+        partidasDe[siguiente[partidas[p].a]++] = static_cast<int>(p);
+        partidasDe[siguiente[partidas[p].b]++] = static_cast<int>(p);
+    }
+}
+
+/**
+ * @brief Implementación del método simularDuelo
+ *
+ * Se juega con daño variable para que el arma y los HP de cada gladiador
+ * pesen en el resultado.
+ *
+ * @param a Gladiador que juega como jugador 1
+ * @param b Gladiador que juega como jugador 2
+ * @param semillaDuelo Semilla propia del duelo
+ * @return Puntaje del gladiador a (1 gana, 0.5 empate, 0 pierde)
+ */
+double LigaGladiadores::simularDuelo(int a, int b, uint64_t semillaDuelo) const {
+    EstadoDuelo estado;
+    estado.jugador1 = combatientes[a];
+    estado.jugador2 = combatientes[b];
+    estado.danioFijo = false;
+
+    mt19937_64 generador(semillaDuelo);
+    while (!estado.haTerminado() && estado.turno < configuracion.maxTurnos) {
+        uint64_t sorteo = generador();
+        estado.aplicarTurno(static_cast<OpcionAtaque>(1 + sorteo % 3),
+                            static_cast<OpcionAtaque>(1 + (sorteo >> 32) % 3), generador());
+    }
+
+    switch (estado.getGanador()) {
+        case 1: return 1.0;
+        case 2: return 0.0;
+        default: return 0.5;
+    }
+}
+
+/**
+ * @brief Implementación del método calcularRating
+ *
+ * Pasos 2 a 8 del algoritmo de Glicko-2 (Glickman, 2013); la volatilidad
+ * se obtiene con el método de Illinois. Un gladiador sin partidas solo
+ * aumenta su desviación.
+ *
+ * @param indice Índice del gladiador
+ * @return Rating al final de la temporada
+ */
+RatingGlicko LigaGladiadores::calcularRating(int indice) const {
+    const RatingGlicko& actual = ratings[indice];
+    const double mu = (actual.rating - 1500.0) / ESCALA_GLICKO;
+    const double phi = actual.desviacion / ESCALA_GLICKO;
+    const double sigma = actual.volatilidad;
+
+    double sumaVarianza = 0.0;
+    double sumaMejora = 0.0;
+    for (int k = inicioPartidas[indice]; k < inicioPartidas[indice + 1]; ++k) {
+        const Partida& partida = partidas[partidasDe[k]];
+        bool esA = partida.a == indice;
+        const RatingGlicko& rival = ratings[esA ? partida.b : partida.a];
+        double puntaje = esA ? partida.puntaje : 1.0 - partida.puntaje;
+
+        double muRival = (rival.rating - 1500.0) / ESCALA_GLICKO;
+        double g = factorG(rival.desviacion / ESCALA_GLICKO);
+        double esperado = 1.0 / (1.0 + exp(-g * (mu - muRival)));
+        sumaVarianza += g * g * esperado * (1.0 - esperado);
+        sumaMejora += g * (puntaje - esperado);
+    }
+
+    if (sumaVarianza == 0.0) {
+        double phiNuevo = sqrt(phi * phi + sigma * sigma);
+        return RatingGlicko{actual.rating, min(350.0, phiNuevo * ESCALA_GLICKO), sigma};
+    }
+
+    const double v = 1.0 / sumaVarianza;
+    const double delta = v * sumaMejora;
+    const double tau = configuracion.tau;
+    const double a = log(sigma * sigma);
+    auto f = [&](double x) {
+        double ex = exp(x);
+        double denominador = phi * phi + v + ex;
+        return ex * (delta * delta - phi * phi - v - ex) / (2.0 * denominador * denominador)
+            - (x - a) / (tau * tau);
+    };
+
+    double A = a;
+    double B;
+    if (delta * delta > phi * phi + v) {
+        B = log(delta * delta - phi * phi - v);
+    } else {
+        int k = 1;
+        while (f(a - k * tau) < 0.0) ++k;
+        B = a - k * tau;
+    }
+    double fA = f(A);
+    double fB = f(B);
+    while (fabs(B - A) > TOLERANCIA_VOLATILIDAD) {
+        double C = A + (A - B) * fA / (fB - fA);
+        double fC = f(C);
+        if (fC * fB <= 0.0) {
+            A = B;
+            fA = fB;
+        } else {
+            fA /= 2.0;
+        }
+        B = C;
+        fB = fC;
+    }
+    const double sigmaNueva = exp(A / 2.0);
+
+    const double phiPrevia = sqrt(phi * phi + sigmaNueva * sigmaNueva);
+    const double phiNuevo = 1.0 / sqrt(1.0 / (phiPrevia * phiPrevia) + 1.0 / v);
+    const double muNuevo = mu + phiNuevo * phiNuevo * sumaMejora;
+    return RatingGlicko{muNuevo * ESCALA_GLICKO + 1500.0, phiNuevo * ESCALA_GLICKO, sigmaNueva};
+}
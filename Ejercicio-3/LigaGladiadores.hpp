@@ -0,0 +1,147 @@
+/**
+ * @file LigaGladiadores.hpp
+ * @brief Define la liga de gladiadores con ratings Glicko-2
+ *
+ * Cada temporada es un período de rating de Glicko-2: se juegan varias
+ * rondas de duelos PPT entre parejas sorteadas, repartidas entre varios
+ * hilos, y al final se actualizan todos los ratings a la vez. La tabla de
+ * posiciones se mantiene en un ClasificacionLiga.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "ClasificacionLiga.hpp"
+#include "EstadoDuelo.hpp"
+#include "../Ejercicio-1/Personajes/Guerrero/Gladiador.hpp"
+
+using namespace std;
+
+/**
+ * @struct ConfiguracionLiga
+ * @brief Parámetros de la liga
+ */
+struct ConfiguracionLiga {
+    int hilos = 4;                  ///< Hilos que simulan duelos y calculan ratings
+    int rondasPorTemporada = 10;    ///< Duelos por gladiador en cada temporada
+    int maxTurnos = 200;            ///< Un duelo que llega a este turno es empate
+    uint64_t semilla = 0x11C4;      ///< Semilla de sorteos y duelos
+    double tau = 0.5;               ///< Restricción del cambio de volatilidad de Glicko-2
+};
+
+/**
+ * @struct RatingGlicko
+ * @brief Rating de un gladiador en la escala de Glicko (1500 inicial)
+ */
+struct RatingGlicko {
+    double rating;
+    double desviacion;       ///< RD: incertidumbre del rating
+    double volatilidad;
+};
+
+/**
+ * @class LigaGladiadores
+ * @brief Temporadas de duelos PPT entre gladiadores inscriptos
+ *
+ * El resultado no depende de la cantidad de hilos: cada duelo usa un
+ * generador derivado de la semilla, la temporada, la ronda y la partida, y
+ * el nuevo rating de cada gladiador se calcula sumando sus partidas en
+ * orden fijo, sin acumuladores compartidos entre hilos.
+ */
+class LigaGladiadores {
+public:
+    /**
+     * @brief Constructor
+     * @param configuracion Parámetros de la liga
+     */
+    explicit LigaGladiadores(const ConfiguracionLiga& configuracion = ConfiguracionLiga());
+
+    /**
+     * @brief Inscribe un gladiador con su estado y primera arma actuales
+     * @param gladiador Gladiador (no pasa a ser propiedad de la liga)
+     * @return Índice del gladiador en la liga, -1 si es nulo
+     */
+    int inscribir(Gladiador* gladiador);
+
+    /**
+     * @brief Juega una temporada completa y actualiza ratings y posiciones
+     *
+     * Las victorias y derrotas de la temporada se registran en cada
+     * gladiador con una sola llamada.
+     *
+     * @return Cantidad de duelos jugados
+     */
+    size_t jugarTemporada();
+
+    /**
+     * @brief Obtiene la posición de un gladiador en la tabla
+     * @param indice Índice del gladiador
+     * @return Posición (1 es el primero), 0 si no está inscripto
+     */
+    int getPosicion(int indice) const;
+
+    /**
+     * @brief Obtiene el gladiador que ocupa una posición
+     * @param posicion Posición (1 es el primero)
+     * @return Índice del gladiador, -1 si la posición no existe
+     */
+    int getEnPosicion(int posicion) const;
+
+    /**
+     * @brief Obtiene la posición que tendría un rating dado
+     * @param rating Rating de referencia
+     * @return Posición que ocuparía (1 es el primero)
+     */
+    int getPosicionDeRating(double rating) const;
+
+    Gladiador* getGladiador(int indice) const;
+    const RatingGlicko& getRating(int indice) const;
+    size_t getInscriptos() const;
+    int getTemporada() const;
+
+private:
+    /**
+     * @struct Partida
+     * @brief Duelo de una temporada; puntaje es el del gladiador a (1, 0.5 o 0)
+     */
+    struct Partida {
+        int a;
+        int b;
+        double puntaje;
+    };
+
+    /**
+     * @brief Sortea las parejas de todas las rondas de la temporada
+     */
+    void sortearPartidas();
+
+    /**
+     * @brief Simula un duelo con opciones al azar de ambos lados
+     * @return Puntaje del gladiador a
+     */
+    double simularDuelo(int a, int b, uint64_t semillaDuelo) const;
+
+    /**
+     * @brief Calcula el nuevo rating de un gladiador con sus partidas de la temporada
+     */
+    RatingGlicko calcularRating(int indice) const;
+
+    /**
+     * @brief Ejecuta tarea(desde, hasta) sobre [0, cantidad) repartido en bloques entre los hilos
+     */
+    template <typename Tarea>
+    void enParalelo(size_t cantidad, Tarea tarea) const;
+
+    ConfiguracionLiga configuracion;
+    vector<Gladiador*> gladiadores;
+    vector<CombatienteCOW> combatientes;
+    vector<RatingGlicko> ratings;
+    ClasificacionLiga clasificacion;
+    int temporada;
+
+    // Temporada en curso
+    vector<Partida> partidas;
+    vector<int> inicioPartidas;      ///< Partidas de cada gladiador: [inicio[i], inicio[i+1]) en partidasDe
+    vector<int> partidasDe;
+};
@@ -0,0 +1,309 @@
+/**
+ * @file TablaTransposicion.cpp
+ * @brief Implementación del hashing Zobrist y de la tabla de transposición
+ */
+
+#include "TablaTransposicion.hpp"
+#include <algorithm>
+#include <array>
+
+namespace {
+
+/// Campos codificados por combatiente: HP, recurso, usos restantes del arma y filacteria
+const int CAMPOS_ZOBRIST = 4;
+
+/**
+ * @brief Finalizador de splitmix64
+ *
+ * Es una biyección de 64 bits: entradas distintas dan salidas distintas.
+ */
+uint64_t mezclar(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Semillas aleatorias de Zobrist por (jugador, campo), generadas una sola vez
+ *
+ * En lugar de una tabla de claves por valor (que obliga a repetir claves a
+ * partir de cierto valor), la clave de un valor es mezclar(semilla ^ valor).
+ * Como mezclar es biyectiva, dos valores distintos de un mismo campo nunca
+ * comparten clave, sea cual sea el rango de HP, durabilidad o energía.
+ */
+struct ClavesZobrist {
+    array<array<uint64_t, CAMPOS_ZOBRIST>, 2> semillas;
+    uint64_t danioFijo;
+
+    ClavesZobrist() {
+        uint64_t x = 0x2545F4914F6CDD1DULL;
+        auto siguiente = [&x]() { return mezclar(x += 0x9E3779B97F4A7C15ULL); };
+        for (auto& jugador : semillas) {
+            for (uint64_t& semilla : jugador) {
+                semilla = siguiente();
+            }
+        }
+        danioFijo = siguiente();
+    }
+
+    uint64_t clave(int jugador, int campo, int valor) const {
+        return mezclar(semillas[jugador][campo] ^ static_cast<uint32_t>(valor));
+    }
+};
+
+const ClavesZobrist& clavesZobrist() {
+    static const ClavesZobrist claves;
+    return claves;
+}
+
+uint64_t hashCombatiente(const ClavesZobrist& claves, int jugador, const EstadoMutableCombatiente& estado) {
+    return claves.clave(jugador, 0, estado.hp)
+         ^ claves.clave(jugador, 1, estado.recurso)
+         ^ claves.clave(jugador, 2, estado.usosArma)
+         ^ claves.clave(jugador, 3, estado.filacteria ? 1 : 0);
+}
+
+const uint64_t BIT_VALIDA = 1ULL;
+const uint64_t MASCARA_GENERACION = 0xFFULL << 8;
+const double ESCALA_VALOR = 4294967295.0;
+
+} // namespace
+
+/**
+ * @brief Implementación de hashZobrist
+ * @param estado Estado a codificar
+ * @return Hash de 64 bits
+ */
+uint64_t hashZobrist(const EstadoDuelo& estado) {
+    const ClavesZobrist& claves = clavesZobrist();
+    uint64_t hash = hashCombatiente(claves, 0, estado.jugador1.getEstado())
+                  ^ hashCombatiente(claves, 1, estado.jugador2.getEstado());
+    if (estado.danioFijo) {
+        hash ^= claves.danioFijo;
+    }
+    return hash;
+}
+
+// ==========================================================================
+// TABLA DE TRANSPOSICIÓN
+// ==========================================================================
+
+/**
+ * @brief Implementación del constructor de TablaTransposicion
+ * @param log2Cubetas Logaritmo en base 2 de la cantidad de cubetas
+ */
+TablaTransposicion::TablaTransposicion(int log2Cubetas)
+    : entradas(new Entrada[size_t(2) << clamp(log2Cubetas, 1, 28)]),
+      mascaraCubetas((size_t(1) << clamp(log2Cubetas, 1, 28)) - 1),
+      generacion(1), consultas(0), aciertos(0), guardados(0), reemplazos(0) {}
+
+/**
+ * @brief Implementación del método buscar
+ * @param clave Hash Zobrist de la posición
+ * @param entrada Salida con el contenido si se encontró
+ * @return true si la posición está en la tabla
+ */
+bool TablaTransposicion::buscar(uint64_t clave, EntradaTransposicion& entrada) {
+    consultas.fetch_add(1, memory_order_relaxed);
+    Entrada* cubeta = &entradas[(clave & mascaraCubetas) * 2];
+    uint64_t datos;
+    for (int i = 0; i < 2; ++i) {
+        if (leer(cubeta[i], clave, datos)) {
+            aciertos.fetch_add(1, memory_order_relaxed);
+            entrada = desempaquetar(datos);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Implementación del método guardar
+ * @param clave Hash Zobrist de la posición
+ * @param entrada Valor, muestras y mejor opción
+ */
+void TablaTransposicion::guardar(uint64_t clave, const EntradaTransposicion& entrada) {
+    const uint8_t generacionActual = generacion.load(memory_order_relaxed);
+    const uint64_t nuevos = empaquetar(entrada, generacionActual);
+    Entrada* cubeta = &entradas[(clave & mascaraCubetas) * 2];
+    guardados.fetch_add(1, memory_order_relaxed);
+
+    uint64_t datos;
+    for (int i = 0; i < 2; ++i) {
+        if (leer(cubeta[i], clave, datos)) {
+            escribir(cubeta[i], clave, nuevos);
+            return;
+        }
+    }
+
+    // Entrada preferida: se reemplaza si está vacía, es vieja o tiene menos muestras
+    uint64_t preferida = cubeta[0].datos.load(memory_order_relaxed);
+    Entrada* destino = &cubeta[1];
+    if (!(preferida & BIT_VALIDA)
+        || generacionDe(preferida) != generacionActual
+        || muestrasDe(preferida) <= entrada.muestras) {
+        destino = &cubeta[0];
+    }
+
+    if (destino->datos.load(memory_order_relaxed) & BIT_VALIDA) {
+        reemplazos.fetch_add(1, memory_order_relaxed);
+    }
+    escribir(*destino, clave, nuevos);
+}
+
+/**
+ * @brief Implementación del método acumular
+ * @param clave Hash Zobrist de la posición
+ * @param valor Nueva evaluación para el jugador 2
+ */
+void TablaTransposicion::acumular(uint64_t clave, double valor) {
+    Entrada* cubeta = &entradas[(clave & mascaraCubetas) * 2];
+    EntradaTransposicion entrada{valor, 1, 0};
+    uint64_t datos;
+    for (int i = 0; i < 2; ++i) {
+        if (leer(cubeta[i], clave, datos)) {
+            EntradaTransposicion previa = desempaquetar(datos);
+            entrada.muestras = min(previa.muestras + 1, 0xFFFF);
+            entrada.valor = previa.valor + (valor - previa.valor) / entrada.muestras;
+            entrada.mejorOpcion = previa.mejorOpcion;
+            break;
+        }
+    }
+    guardar(clave, entrada);
+}
+
+/**
+ * @brief Implementación del método anotarMejorOpcion
+ * @param clave Hash Zobrist de la posición
+ * @param opcion 1 a 3 según OpcionAtaque
+ */
+void TablaTransposicion::anotarMejorOpcion(uint64_t clave, int opcion) {
+    Entrada* cubeta = &entradas[(clave & mascaraCubetas) * 2];
+    EntradaTransposicion entrada{0.5, 0, opcion};
+    uint64_t datos;
+    for (int i = 0; i < 2; ++i) {
+        if (leer(cubeta[i], clave, datos)) {
+            entrada = desempaquetar(datos);
+            if (entrada.mejorOpcion == opcion) {
+                return;
+            }
+            entrada.mejorOpcion = opcion;
+            break;
+        }
+    }
+    guardar(clave, entrada);
+}
+
+/**
+ * @brief Implementación del método nuevaBusqueda
+ *
+ * Las generaciones van de 1 a 255; la 0 queda para entradas viejas. Al dar
+ * la vuelta, todas las entradas pasan a la generación 0: si no, una entrada
+ * escrita hace exactamente 255 búsquedas tendría la misma generación que la
+ * actual y se protegería como si fuera nueva. El recorrido completo se hace
+ * una vez cada 255 búsquedas.
+ */
+void TablaTransposicion::nuevaBusqueda() {
+    uint8_t siguiente = static_cast<uint8_t>(generacion.load(memory_order_relaxed) + 1);
+    if (siguiente == 0) {
+        for (size_t i = 0; i < getCapacidad(); ++i) {
+            uint64_t datos = entradas[i].datos.load(memory_order_relaxed);
+            uint64_t clave = entradas[i].claveXorDatos.load(memory_order_relaxed) ^ datos;
+            if (datos & BIT_VALIDA) {
+                escribir(entradas[i], clave, datos & ~MASCARA_GENERACION);
+            }
+        }
+        siguiente = 1;
+    }
+    generacion.store(siguiente, memory_order_relaxed);
+}
+
+/**
+ * @brief Implementación del método limpiar
+ *
+ * No debe llamarse mientras otros hilos usan la tabla.
+ */
+void TablaTransposicion::limpiar() {
+    for (size_t i = 0; i < (mascaraCubetas + 1) * 2; ++i) {
+        entradas[i].claveXorDatos.store(0, memory_order_relaxed);
+        entradas[i].datos.store(0, memory_order_relaxed);
+    }
+    generacion.store(1);
+    consultas.store(0);
+    aciertos.store(0);
+    guardados.store(0);
+    reemplazos.store(0);
+}
+
+size_t TablaTransposicion::getCapacidad() const { return (mascaraCubetas + 1) * 2; }
+uint64_t TablaTransposicion::getConsultas() const { return consultas.load(memory_order_relaxed); }
+uint64_t TablaTransposicion::getAciertos() const { return aciertos.load(memory_order_relaxed); }
+uint64_t TablaTransposicion::getGuardados() const { return guardados.load(memory_order_relaxed); }
+uint64_t TablaTransposicion::getReemplazos() const { return reemplazos.load(memory_order_relaxed); }
+
+/**
+ * @brief Implementación del método getTasaAciertos
+ * @return Aciertos / consultas, o 0 si no hubo consultas
+ */
+double TablaTransposicion::getTasaAciertos() const {
+    uint64_t total = getConsultas();
+    return total == 0 ? 0.0 : static_cast<double>(getAciertos()) / static_cast<double>(total);
+}
+
+// ==========================================================================
+// EMPAQUETADO DE ENTRADAS
+// ==========================================================================
+
+/**
+ * @brief Implementación del método empaquetar
+ *
+ * Formato de los 64 bits: bit 0 entrada válida, bits 1-2 mejor opción,
+ * bits 8-15 generación, bits 16-31 muestras y bits 32-63 el valor en punto fijo.
+ *
+ * @param entrada Contenido a empaquetar
+ * @param generacion Generación de la búsqueda actual
+ * @return Datos empaquetados
+ */
+uint64_t TablaTransposicion::empaquetar(const EntradaTransposicion& entrada, uint8_t generacion) {
+    uint64_t valor = static_cast<uint64_t>(clamp(entrada.valor, 0.0, 1.0) * ESCALA_VALOR + 0.5);
+    uint64_t muestras = static_cast<uint64_t>(clamp(entrada.muestras, 0, 0xFFFF));
+    uint64_t opcion = static_cast<uint64_t>(clamp(entrada.mejorOpcion, 0, 3));
+    return BIT_VALIDA | (opcion << 1) | (uint64_t(generacion) << 8) | (muestras << 16) | (valor << 32);
+}
+
+EntradaTransposicion TablaTransposicion::desempaquetar(uint64_t datos) {
+    return EntradaTransposicion{
+        static_cast<double>(datos >> 32) / ESCALA_VALOR,
+        muestrasDe(datos),
+        static_cast<int>((datos >> 1) & 3)
+    };
+}
+
+int TablaTransposicion::muestrasDe(uint64_t datos) { return static_cast<int>((datos >> 16) & 0xFFFF); }
+uint8_t TablaTransposicion::generacionDe(uint64_t datos) { return static_cast<uint8_t>(datos >> 8); }
+
+/**
+ * @brief Implementación del método leer
+ *
+ * Las dos cargas pueden ser relaxed. Cada palabra se lee entera (es
+ * atómica), así que lo único que puede pasar con una escritura concurrente
+ * es leer datos de una escritura y claveXorDatos de otra; entonces
+ * (verificación XOR datos) no da la clave y la entrada se ve como un fallo.
+ * Ningún orden entre las dos palabras cambia eso, y la tabla no publica
+ * otra memoria a través de estas entradas que necesite acquire/release.
+ *
+ * @param entrada Entrada a leer
+ * @param clave Clave buscada
+ * @param datos Salida con los datos empaquetados
+ * @return true si la entrada corresponde a la clave
+ */
+bool TablaTransposicion::leer(const Entrada& entrada, uint64_t clave, uint64_t& datos) {
+    datos = entrada.datos.load(memory_order_relaxed);
+    uint64_t verificacion = entrada.claveXorDatos.load(memory_order_relaxed);
+    return (datos & BIT_VALIDA) && (verificacion ^ datos) == clave;
+}
+
+void TablaTransposicion::escribir(Entrada& entrada, uint64_t clave, uint64_t datos) {
+    entrada.claveXorDatos.store(clave ^ datos, memory_order_relaxed);
+    entrada.datos.store(datos, memory_order_relaxed);
+}
@@ -0,0 +1,164 @@
+/**
+ * @file TablaTransposicion.hpp
+ * @brief Define la tabla de transposición con hashing Zobrist para estados de duelo
+ *
+ * La búsqueda vuelve muchas veces a las mismas posiciones (mismos HP, usos
+ * del arma y recurso de ambos combatientes) por órdenes de turnos
+ * distintos. Esta tabla guarda el valor estimado y la mejor opción de cada
+ * posición para no volver a evaluarla. Es de tamaño fijo, se comparte entre
+ * hilos y no usa bloqueos.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "EstadoDuelo.hpp"
+
+using namespace std;
+
+/**
+ * @brief Calcula el hash Zobrist de un estado de duelo
+ *
+ * Combina con XOR una clave aleatoria por (jugador, campo, valor) para HP,
+ * recurso, usos restantes del arma y filacteria, más una clave para el
+ * modo de daño.
+ * El número de turno no participa: dos caminos que llegan a los mismos
+ * valores son la misma posición.
+ *
+ * @param estado Estado a codificar
+ * @return Hash de 64 bits
+ */
+uint64_t hashZobrist(const EstadoDuelo& estado);
+
+/**
+ * @struct EntradaTransposicion
+ * @brief Contenido de una posición encontrada en la tabla
+ */
+struct EntradaTransposicion {
+    double valor;            ///< Valor estimado para el jugador 2 (0 a 1)
+    int muestras;            ///< Cantidad de evaluaciones promediadas en valor
+    int mejorOpcion;         ///< 1 a 3 según OpcionAtaque, 0 si no se conoce
+};
+
+/**
+ * @class TablaTransposicion
+ * @brief Tabla de transposición sin bloqueos, con cubetas de dos entradas
+ *
+ * Cada entrada son dos palabras atómicas: los datos empaquetados y la clave
+ * XOR los datos. Al leer se verifica que (clave XOR datos) coincida, así una
+ * escritura concurrente a medias se ve como un fallo y no como datos
+ * corruptos. Por eso alcanza con accesos relaxed (ver leer).
+ *
+ * Política de reemplazo por cubeta: la primera entrada conserva la posición
+ * con más muestras (salvo que sea de una búsqueda anterior) y la segunda se
+ * reemplaza siempre.
+ */
+class TablaTransposicion {
+public:
+    /**
+     * @brief Constructor
+     * @param log2Cubetas Logaritmo en base 2 de la cantidad de cubetas
+     */
+    explicit TablaTransposicion(int log2Cubetas = 16);
+
+    /**
+     * @brief Busca una posición
+     * @param clave Hash Zobrist de la posición
+     * @param entrada Salida con el contenido si se encontró
+     * @return true si la posición está en la tabla
+     */
+    bool buscar(uint64_t clave, EntradaTransposicion& entrada);
+
+    /**
+     * @brief Guarda una posición aplicando la política de reemplazo
+     * @param clave Hash Zobrist de la posición
+     * @param entrada Valor, muestras y mejor opción
+     */
+    void guardar(uint64_t clave, const EntradaTransposicion& entrada);
+
+    /**
+     * @brief Suma una evaluación al promedio guardado de una posición
+     *
+     * Leer y volver a guardar no es atómico: si dos hilos actualizan la misma
+     * posición a la vez se puede perder una muestra, lo cual es aceptable para
+     * un promedio.
+     *
+     * @param clave Hash Zobrist de la posición
+     * @param valor Nueva evaluación para el jugador 2
+     */
+    void acumular(uint64_t clave, double valor);
+
+    /**
+     * @brief Anota la mejor opción conocida de una posición sin tocar su promedio
+     *
+     * Si la posición no está, se crea con cero muestras: guarda la opción
+     * pero su valor no se usa hasta que acumule evaluaciones.
+     *
+     * @param clave Hash Zobrist de la posición
+     * @param opcion 1 a 3 según OpcionAtaque
+     */
+    void anotarMejorOpcion(uint64_t clave, int opcion);
+
+    /**
+     * @brief Marca el comienzo de una búsqueda nueva
+     *
+     * Las entradas de búsquedas anteriores pasan a poder reemplazarse aunque
+     * tengan más muestras. No debe llamarse mientras otros hilos usan la
+     * tabla: cada 255 búsquedas recorre todas las entradas.
+     */
+    void nuevaBusqueda();
+
+    /**
+     * @brief Vacía la tabla y los contadores
+     */
+    void limpiar();
+
+    size_t getCapacidad() const;
+    uint64_t getConsultas() const;
+    uint64_t getAciertos() const;
+    uint64_t getGuardados() const;
+    uint64_t getReemplazos() const;
+
+    /**
+     * @brief Obtiene la tasa de aciertos
+     * @return Aciertos / consultas, o 0 si no hubo consultas
+     */
+    double getTasaAciertos() const;
+
+private:
+    /**
+     * @struct Entrada
+     * @brief Entrada empaquetada en dos palabras atómicas
+     */
+    struct Entrada {
+        atomic<uint64_t> claveXorDatos{0};
+        atomic<uint64_t> datos{0};
+    };
+
+    static uint64_t empaquetar(const EntradaTransposicion& entrada, uint8_t generacion);
+    static EntradaTransposicion desempaquetar(uint64_t datos);
+    static int muestrasDe(uint64_t datos);
+    static uint8_t generacionDe(uint64_t datos);
+
+    /**
+     * @brief Lee una entrada verificando que no esté a medio escribir
+     * @param entrada Entrada a leer
+     * @param clave Clave buscada
+     * @param datos Salida con los datos empaquetados
+     * @return true si la entrada corresponde a la clave
+     */
+    static bool leer(const Entrada& entrada, uint64_t clave, uint64_t& datos);
+
+    static void escribir(Entrada& entrada, uint64_t clave, uint64_t datos);
+
+    unique_ptr<Entrada[]> entradas;
+    size_t mascaraCubetas;
+    atomic<uint8_t> generacion;     ///< 1 a 255; 0 marca entradas de búsquedas viejas
+    atomic<uint64_t> consultas;
+    atomic<uint64_t> aciertos;
+    atomic<uint64_t> guardados;
+    atomic<uint64_t> reemplazos;
+};
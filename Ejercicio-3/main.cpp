@@ -8,13 +8,16 @@
  */
 
 #include <iostream>
+#include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <limits>
 #include "CombatePPT.hpp"
+#include "LigaGladiadores.hpp"
 
 using namespace std;
 bool usarDañoFijo = true;
+string rutaHistorial;  // Archivo NDJSON donde se agregan los duelos; vacío si no se pidió --historial
 
 /**
  * @brief Limpia la pantalla del terminal
@@ -141,19 +144,20 @@ int mostrarMenuPrincipal() {
     cout << "╠═══════════════════════════════╣" << endl;
     cout << "║  \033[1;36m1.\033[0m Iniciar Nuevo Combate     ║" << endl;
     cout << "║  \033[1;36m2.\033[0m Configurar Sistema de Daño║" << endl;
+    cout << "║  \033[1;36m3.\033[0m Liga de Gladiadores       ║" << endl;
     cout << "║  \033[1;36m0.\033[0m Salir                     ║" << endl;
     cout << "╚═══════════════════════════════╝" << endl;
     
     int opcion;
     while (true) {
-        cout << "\n\033[1;32m➤\033[0m Seleccione una opción (0-2): ";
+        cout << "\n\033[1;32m➤\033[0m Seleccione una opción (0-3): ";
         cin >> opcion;
         
         if (cin.fail()) {
             cin.clear();
             cin.ignore(numeric_limits<streamsize>::max(), '\n');
             cout << "\033[1;31m✗ Entrada inválida. Intente de nuevo.\033[0m" << endl;
-        } else if (opcion >= 0 && opcion <= 2) {
+        } else if (opcion >= 0 && opcion <= 3) {
             cin.ignore(numeric_limits<streamsize>::max(), '\n');
             return opcion;
         } else {
@@ -178,17 +182,88 @@ void mostrarCreditos() {
     cout << "╚════════════════════════════════════════════════════════╝" << endl;
 }
 
+/**
+ * @brief Juega varias temporadas de la liga de gladiadores y muestra la tabla
+ * 
+ * Los duelos de cada temporada se simulan en paralelo y los ratings se
+ * actualizan con Glicko-2 al final de cada una.
+ */
+void jugarLigaGladiadores() {
+    limpiarPantalla();
+    bordeDecorado("LIGA DE GLADIADORES");
+    cout << endl;
+    
+    const int cantidadGladiadores = 20000;
+    const int temporadas = 3;
+    
+    vector<shared_ptr<InterfazPersonaje>> personajes;
+    LigaGladiadores liga;
+    for (int i = 0; i < cantidadGladiadores; ++i) {
+        personajes.push_back(PersonajeFactory::crearPersonajeArmado(TipoPersonaje::Gladiador, 1));
+        liga.inscribir(dynamic_cast<Gladiador*>(personajes.back().get()));
+    }
+    cout << liga.getInscriptos() << " gladiadores inscriptos." << endl;
+    
+    streambuf* salidaOriginal = cout.rdbuf();
+    for (int t = 0; t < temporadas; ++t) {
+        cout.rdbuf(nullptr);
+        auto inicio = chrono::steady_clock::now();
+        size_t duelos = liga.jugarTemporada();
+        auto fin = chrono::steady_clock::now();
+        cout.rdbuf(salidaOriginal);
+        cout << "Temporada " << liga.getTemporada() << ": " << duelos << " duelos en "
+             << chrono::duration_cast<chrono::milliseconds>(fin - inicio).count() << " ms" << endl;
+    }
+    
+    cout << "\n\033[1;33mTabla de posiciones:\033[0m" << endl;
+    for (int posicion = 1; posicion <= 5; ++posicion) {
+        int indice = liga.getEnPosicion(posicion);
+        Gladiador* gladiador = liga.getGladiador(indice);
+        const RatingGlicko& rating = liga.getRating(indice);
+        cout << "  " << posicion << ". " << gladiador->getNombre() << " - rating "
+             << static_cast<int>(rating.rating) << " ± " << static_cast<int>(2 * rating.desviacion)
+             << " (" << gladiador->getVictorias() << "V/" << gladiador->getDerrotas() << "D)" << endl;
+    }
+    
+    auto inicioConsultas = chrono::steady_clock::now();
+    long long sumaPosiciones = 0;
+    for (int i = 0; i < cantidadGladiadores; ++i) {
+        sumaPosiciones += liga.getPosicion(i);
+    }
+    auto finConsultas = chrono::steady_clock::now();
+    cout << "\n" << cantidadGladiadores << " consultas de posición en "
+         << chrono::duration_cast<chrono::microseconds>(finConsultas - inicioConsultas).count()
+         << " µs (posición media " << sumaPosiciones / cantidadGladiadores << ")" << endl;
+    cout << "Un rating de 1700 quedaría en la posición " << liga.getPosicionDeRating(1700.0) << endl;
+    
+    cout << "\n\033[1;36m➤\033[0m Presione Enter para volver al menú principal...";
+    cin.get();
+}
+
 /**
  * @brief Función principal del programa
  * 
  * Muestra el menú principal y gestiona las diferentes opciones,
  * incluyendo iniciar combate, configurar el sistema y salir del juego.
+ * Con --historial [ruta] cada duelo terminado se agrega como una línea
+ * NDJSON a la ruta indicada (historial_duelos.ndjson si no se indica).
  * 
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos de la línea de comandos
  * @return 0 si el programa finaliza correctamente
  */
-int main() {
+int main(int argc, char* argv[]) {
     srand(static_cast<unsigned int>(time(nullptr)));
     
+    for (int i = 1; i < argc; ++i) {
+        if (string(argv[i]) == "--historial") {
+            rutaHistorial = "historial_duelos.ndjson";
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                rutaHistorial = argv[++i];
+            }
+        }
+    }
+    
     while (true) {
         int opcion = mostrarMenuPrincipal();
         
@@ -200,6 +275,9 @@ int main() {
         } else if (opcion == 2) {
             configurarCombate();
             continue;
+        } else if (opcion == 3) {
+            jugarLigaGladiadores();
+            continue;
         }
         
         limpiarPantalla();
@@ -221,6 +299,15 @@ int main() {
         limpiarPantalla();
         combate.mostrarResultado();
         
+        // Registrar el duelo en el historial (una línea NDJSON por combate), solo si se pidió
+        if (!rutaHistorial.empty()) {
+            ExportadorStream historial(FormatoExportacion::NDJSON, 4096);
+            if (historial.abrir(rutaHistorial, true)) {
+                historial.escribirResultadoDuelo(combate.obtenerResultadoDuelo());
+                historial.cerrar();
+            }
+        }
+        
         cout << "\n\033[1;36m➤\033[0m Presione Enter para volver al menú principal...";
         cin.get();
     }